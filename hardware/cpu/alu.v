@@ -8,7 +8,9 @@
  * All logic functions are implemented with the simple verilog operations,
  * adder and subtractor are integrated into a single adder with XOR gates
  * on B input. At the end all operations are combined with a MUX8, then the
- * result of MUX8 is multiplexed with the result from multiplier.
+ * result of MUX8 is multiplexed with the result from multiplier. With the
+ * B extension bit-manipulation operations have their own unit, selected
+ * by the decoder, it shares the rotator with the barrel shifter.
  *
  * i_clk_n   - Inverted clock input
  * i_rst     - Reset input
@@ -18,6 +20,11 @@
  * i_funct7  - Secondary (alternative or Mul/Div) function selector
  * i_alu_en  - ALU enable (when disabled addition is performed)
  * i_alu_imm - ALU input B immediate (some function selections depend on it)
+ * i_bm_en   - Bit-manipulation operation (B_EXTENSION only)
+ * i_start   - First cycle of the opcode in EX phase (POSEDGE_ONLY only)
+ *
+ * i_md_result - Mul/Div result from the external Mul/Div unit (scoreboard)
+ * o_md_en     - Mul/Div operation (for the external Mul/Div unit)
  *
  * o_alu_out - ALU operation result
  * o_busy    - ALU busy (routed from Mul/Div and shifter circuitry)
@@ -25,10 +32,14 @@
 `include "config.v"
 `include "shifter.v"
 
-`ifdef M_EXTENSION
+`ifdef MULDIV_IN_ALU
 `include "muldiv.v"
 `endif
 
+`ifdef B_EXTENSION
+`include "bitmanip.v"
+`endif
+
 module alu (
   input         i_clk_n,
   // verilator lint_off unused
@@ -42,6 +53,17 @@ module alu (
   input  [ 6:0] i_funct7,
   input         i_alu_en,
   input         i_alu_imm,
+`ifdef B_EXTENSION
+  input         i_bm_en,
+`endif
+`ifdef POSEDGE_ONLY
+  input         i_start,
+`endif
+
+`ifdef MULDIV_SCOREBOARD
+  input  [31:0] i_md_result,
+  output        o_md_en,
+`endif
 
   output        o_busy,
   output [31:0] o_alu_out
@@ -72,12 +94,21 @@ module alu (
 
   // Final MUX
   reg  [31:0] mux;
+  wire [31:0] alu_result;
+
+  // B extension circuitry
+`ifdef B_EXTENSION
+  wire [31:0] shift_rotate;
+  wire [31:0] bm_result;
+`endif
 
   // M extension circuitry
 `ifdef M_EXTENSION
   wire        funct7_0;
-  wire [31:0] md_result;
   wire        md_en;
+`endif
+`ifdef MULDIV_IN_ALU
+  wire [31:0] md_result;
   wire        md_busy;
 `endif
 
@@ -126,7 +157,13 @@ module alu (
     .i_funct3   (i_funct3),
     .i_op_alt   (funct7_5),
     .i_shift_en (shift_en),
+`ifdef POSEDGE_ONLY
+    .i_start    (i_start),
+`endif
     .o_result   (shift_result),
+`ifdef B_EXTENSION
+    .o_rotate   (shift_rotate),
+`endif
     .o_busy     (shift_busy)
   );
 
@@ -155,10 +192,32 @@ module alu (
     endcase
   end
 
+  /**
+   * B extension circuitry
+   *  Bit-manipulation result replaces the ALU MUX output
+   */
+`ifdef B_EXTENSION
+  bitmanip bitmanip_i (
+    .i_in_a    (i_in_a),
+    .i_in_b    (i_in_b),
+    .i_funct3  (i_funct3),
+    .i_funct7  (i_funct7),
+    .i_alu_imm (i_alu_imm),
+    .i_rotate  (shift_rotate),
+    .o_result  (bm_result)
+  );
+
+  assign alu_result = (i_bm_en) ? bm_result : mux;
+`else
+  assign alu_result = mux;
+`endif
+
   /**
    * M extension circuitry
+   *  In the scoreboard mode Mul/Div circuitry is a separate unit, only the
+   *  opcode decoding stays here
    */
-`ifdef M_EXTENSION
+`ifdef MULDIV_IN_ALU
   muldiv muldiv_i (
     .i_clk_n   (i_clk_n),
     .i_rst     (i_rst),
@@ -166,10 +225,15 @@ module alu (
     .i_in_b    (i_in_b),
     .i_funct3  (i_funct3),
     .i_md_en   (md_en),
+`ifdef POSEDGE_ONLY
+    .i_start   (i_start),
+`endif
     .o_result  (md_result),
     .o_busy    (md_busy)
   );
+`endif
 
+`ifdef M_EXTENSION
   assign md_en = funct7_0 && i_alu_en && !i_alu_imm;
 `endif
 
@@ -177,12 +241,18 @@ module alu (
    * Output assignment
    *  Here ALU MUX output and M extension output is combined
    */
-`ifdef M_EXTENSION
+`ifdef MULDIV_IN_ALU
   assign o_busy = shift_busy || md_busy;
-  assign o_alu_out = (md_en) ? md_result : mux;
+  assign o_alu_out = (md_en) ? md_result : alu_result;
+`else
+`ifdef MULDIV_SCOREBOARD
+  assign o_busy = shift_busy;
+  assign o_alu_out = (md_en) ? i_md_result : alu_result;
+  assign o_md_en = md_en;
 `else
   assign o_busy = shift_busy;
-  assign o_alu_out = mux;
+  assign o_alu_out = alu_result;
+`endif
 `endif
 
 endmodule
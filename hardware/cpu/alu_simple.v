@@ -0,0 +1,143 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: alu_simple.v
+ *
+ * This file contains the simple ALU of the second issue slot (DUAL_ISSUE).
+ * It's the same as the main ALU without the Mul/Div and bit-manipulation
+ * circuitry, all operations take a single cycle, so the shifts are only
+ * done with the barrel shifter (without it shifts are never issued to the
+ * second slot and the shift result is zero).
+ *
+ * i_clk_n   - Inverted clock input (unused, barrel shifter only)
+ * i_rst     - Reset input (unused, barrel shifter only)
+ * i_in_a    - Data input A
+ * i_in_B    - Data input B
+ * i_funct3  - Main function selector
+ * i_funct7  - Secondary (alternative) function selector
+ * i_alu_en  - ALU enable (when disabled addition is performed)
+ * i_alu_imm - ALU input B immediate (some function selections depend on it)
+ *
+ * o_alu_out - ALU operation result
+ ***************************************************************************/
+`include "config.v"
+// shifter.v is included along with alu.v
+
+module alu_simple (
+  // verilator lint_off unused
+  input         i_clk_n,
+  input         i_rst,
+  // verilator lint_on unused
+
+  input  [31:0] i_in_a,
+  input  [31:0] i_in_b,
+
+  input  [ 2:0] i_funct3,
+  input  [ 6:0] i_funct7,
+  input         i_alu_en,
+  input         i_alu_imm,
+
+  output [31:0] o_alu_out
+);
+
+
+  // Funct7 decoding
+  wire        funct7_5;
+
+  // Adder/subtractor
+  wire        op_subtract;
+  wire [31:0] adder_in_b;
+  wire [31:0] adder_out;
+
+  // Logic operations
+  wire [31:0] logic_xor;
+  wire [31:0] logic_or;
+  wire [31:0] logic_and;
+
+  // Comparators
+  wire [31:0] comp;
+  wire [31:0] comp_u;
+
+  // Shifter
+  wire [31:0] shift_result;
+
+  // Final MUX
+  reg  [31:0] mux;
+
+
+  /**
+   * Funct7 decoding
+   *  funct7_5 is alternative ALU operation
+   */
+  assign funct7_5 = (i_funct7 == 7'b0100000);
+
+  /**
+   * Adder/subtractor
+   */
+  assign op_subtract = i_alu_en && !i_alu_imm && funct7_5;
+  assign adder_in_b = (op_subtract) ? ~i_in_b : i_in_b;
+  assign adder_out = i_in_a + adder_in_b + {31'd0, op_subtract};
+
+  /**
+   * Logic operators
+   */
+  assign logic_xor = i_in_a ^ i_in_b;
+  assign logic_or  = i_in_a | i_in_b;
+  assign logic_and = i_in_a & i_in_b;
+
+  /**
+   * Signed/unsigned comparator
+   */
+  assign comp   = {31'd0, (  $signed(i_in_a) <   $signed(i_in_b))};
+  assign comp_u = {31'd0, ($unsigned(i_in_a) < $unsigned(i_in_b))};
+
+  /**
+   * Shifter circuitry (barrel shifter only)
+   */
+`ifdef BARREL_SHIFTER
+  shifter shifter_i (
+    .i_clk_n    (i_clk_n),
+    .i_rst      (i_rst),
+    .i_in_a     (i_in_a),
+    .i_in_b     (i_in_b[4:0]),
+    .i_funct3   (i_funct3),
+    .i_op_alt   (funct7_5),
+    .i_shift_en (i_alu_en),
+`ifdef POSEDGE_ONLY
+    .i_start    (1'b0),
+`endif
+    .o_result   (shift_result),
+`ifdef B_EXTENSION
+    .o_rotate   (),
+`endif
+    .o_busy     ()
+  );
+`else
+  assign shift_result = 0;
+`endif
+
+  /**
+   * Final ALU MUX
+   */
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case (i_funct3 & {3{i_alu_en}})
+      3'b000: mux = adder_out;
+      3'b001: mux = shift_result;
+      3'b010: mux = comp;
+      3'b011: mux = comp_u;
+      3'b100: mux = logic_xor;
+      3'b101: mux = shift_result;
+      3'b110: mux = logic_or;
+      3'b111: mux = logic_and;
+    endcase
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_alu_out = mux;
+
+endmodule
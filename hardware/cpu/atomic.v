@@ -0,0 +1,190 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: atomic.v
+ *
+ * This file contains the A extension circuitry of the MA phase. LR.W is a
+ * load that also sets the reservation (address of the word), SC.W is a
+ * store that is only done if the reservation is valid and matches its
+ * address (RD is 0 if it was done and 1 if it wasn't), SC.W clears the
+ * reservation. With MULTI_CORE the reservation is also cleared when another
+ * hart writes the reserved word (snooped from the shared bus). AMOs are
+ * done as read-modify-write: the memory is read in the first cycle of MA
+ * phase (the pipeline waits), the read data is registered and the result
+ * is written in the next cycle (with POSEDGE_ONLY the read data arrives one
+ * cycle later, so AMO takes one more cycle). Old memory value is written to
+ * RD. Opcodes are executed in order, so aq and rl bits are ignored.
+ *
+ * i_clk        - Clock input
+ * i_rst        - Reset input
+ * i_ce         - Clock enable (MA phase opcode leaves)
+ *
+ * i_atomic     - A extension opcode in MA phase
+ * i_rd         - MA phase opcode reads the memory
+ * i_wr         - MA phase opcode writes the memory
+ * i_funct5     - Atomic operation selector
+ * i_addr       - Memory address
+ * i_data_wr    - Data to be stored (RS2)
+ * i_data_rd    - Data from the memory (unformatted, AMOs are word only)
+ * i_rd_done    - Memory read was accepted
+ * i_snoop_wr   - Other hart writes the memory (MULTI_CORE only)
+ * i_snoop_addr - Address of the write
+ *
+ * o_rd_en      - Memory read is allowed in this cycle
+ * o_wr_en      - Memory write is allowed in this cycle
+ * o_wait       - MA phase has to wait (AMO read)
+ * o_lock       - Memory has to stay with this hart (AMO in progress)
+ * o_data_wr    - Data to be stored (AMO result or RS2)
+ * o_res_en     - Result comes from this unit (SC.W and AMOs)
+ * o_res        - Result (old memory value or SC.W status)
+ ***************************************************************************/
+`include "config.v"
+
+module atomic (
+  input         i_clk,
+  input         i_rst,
+  input         i_ce,
+
+  input         i_atomic,
+  input         i_rd,
+  input         i_wr,
+  input  [ 4:0] i_funct5,
+  input  [31:0] i_addr,
+  input  [31:0] i_data_wr,
+  input  [31:0] i_data_rd,
+  input         i_rd_done,
+`ifdef MULTI_CORE
+  input         i_snoop_wr,
+  input  [31:0] i_snoop_addr,
+`endif
+
+  output        o_rd_en,
+  output        o_wr_en,
+  output        o_wait,
+  output        o_lock,
+  output [31:0] o_data_wr,
+  output        o_res_en,
+  output [31:0] o_res
+);
+
+
+  // Operation decoding
+  wire        op_lr;
+  wire        op_sc;
+  wire        op_amo;
+
+  // Reservation
+  reg         rsv_valid;
+  reg  [29:0] rsv_addr;
+  wire        sc_ok;
+
+  // Read-modify-write
+  reg  [31:0] amo_data;
+  reg         amo_wr;
+`ifdef POSEDGE_ONLY
+  reg         amo_fetch;
+`endif
+  wire        amo_rd;
+  wire        lt;
+  wire        lt_u;
+  reg  [31:0] amo_res;
+
+
+  /**
+   * Operation decoding
+   */
+  assign op_lr  = i_atomic && i_rd && !i_wr;
+  assign op_sc  = i_atomic && !i_rd && i_wr;
+  assign op_amo = i_atomic && i_rd && i_wr;
+
+  /**
+   * Reservation
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      rsv_valid <= 0;
+      rsv_addr  <= 0;
+    end else if (i_ce && op_lr) begin
+      rsv_valid <= 1'b1;
+      rsv_addr  <= i_addr[31:2];
+    end else if (i_ce && op_sc) begin
+      rsv_valid <= 0;
+`ifdef MULTI_CORE
+    end else if (i_snoop_wr && (i_snoop_addr[31:2] == rsv_addr)) begin
+      rsv_valid <= 0;
+`endif
+    end
+  end
+
+  assign sc_ok = rsv_valid && (rsv_addr == i_addr[31:2]);
+
+  /**
+   * Read-modify-write state
+   *  Read phase lasts until the read is accepted, write phase until the
+   *  opcode leaves MA phase
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      amo_data  <= 0;
+      amo_wr    <= 0;
+`ifdef POSEDGE_ONLY
+      amo_fetch <= 0;
+`endif
+    end else if (i_ce) begin
+      amo_wr    <= 0;
+`ifdef POSEDGE_ONLY
+    end else if (amo_fetch) begin
+      amo_data  <= i_data_rd;
+      amo_fetch <= 0;
+      amo_wr    <= 1'b1;
+    end else if (op_amo && i_rd_done) begin
+      amo_fetch <= 1'b1;
+`else
+    end else if (op_amo && i_rd_done) begin
+      amo_data  <= i_data_rd;
+      amo_wr    <= 1'b1;
+`endif
+    end
+  end
+
+`ifdef POSEDGE_ONLY
+  assign amo_rd = op_amo && !amo_wr && !amo_fetch;
+`else
+  assign amo_rd = op_amo && !amo_wr;
+`endif
+
+  /**
+   * AMO operations
+   */
+  assign lt   = (  $signed(amo_data) <   $signed(i_data_wr));
+  assign lt_u = ($unsigned(amo_data) < $unsigned(i_data_wr));
+
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case (i_funct5)
+      5'b00000: amo_res = amo_data + i_data_wr;              // AMOADD
+      5'b00100: amo_res = amo_data ^ i_data_wr;              // AMOXOR
+      5'b01000: amo_res = amo_data | i_data_wr;              // AMOOR
+      5'b01100: amo_res = amo_data & i_data_wr;              // AMOAND
+      5'b10000: amo_res = (lt)   ? amo_data : i_data_wr;     // AMOMIN
+      5'b10100: amo_res = (lt)   ? i_data_wr : amo_data;     // AMOMAX
+      5'b11000: amo_res = (lt_u) ? amo_data : i_data_wr;     // AMOMINU
+      5'b11100: amo_res = (lt_u) ? i_data_wr : amo_data;     // AMOMAXU
+      default:  amo_res = i_data_wr;                         // AMOSWAP
+    endcase
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_rd_en   = !op_amo || amo_rd;
+  assign o_wr_en   = (!op_amo || amo_wr) && (!op_sc || sc_ok);
+  assign o_wait    = op_amo && !amo_wr;
+  assign o_lock    = op_amo && !amo_wr;
+  assign o_data_wr = (op_amo) ? amo_res : i_data_wr;
+  assign o_res_en  = op_sc || op_amo;
+  assign o_res     = (op_sc) ? {31'd0, !sc_ok} : amo_data;
+
+endmodule
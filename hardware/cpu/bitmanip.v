@@ -0,0 +1,150 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: bitmanip.v
+ *
+ * This file contains the bit-manipulation circuitry for the Zba, Zbb and
+ * Zbs extensions. All operations are combinational and take a single cycle,
+ * the operation is selected with funct7 and funct3 fields (like in the
+ * encoding), unary Zbb operations (CLZ, CTZ, CPOP, SEXT.B, SEXT.H) are
+ * selected with the immediate (rs2 field). Rotations and BEXT reuse the
+ * rotator stage of the barrel shifter (it rotates right when funct3 is
+ * 101, left otherwise).
+ *
+ * i_in_a    - Data input A
+ * i_in_b    - Data input B (register or immediate)
+ * i_funct3  - Function selector
+ * i_funct7  - Function group selector
+ * i_alu_imm - ALU input B immediate (unary operations and ROL share the code)
+ * i_rotate  - Input A rotated by B (from the barrel shifter)
+ *
+ * o_result  - Bit-manipulation operation result
+ ***************************************************************************/
+`include "config.v"
+
+module bitmanip (
+  input  [31:0] i_in_a,
+  input  [31:0] i_in_b,
+
+  input  [ 2:0] i_funct3,
+  input  [ 6:0] i_funct7,
+  input         i_alu_imm,
+  input  [31:0] i_rotate,
+
+  output [31:0] o_result
+);
+
+
+  // Zba
+  wire [31:0] sh_add;
+
+  // Zbb
+  reg  [ 5:0] clz;
+  reg  [ 5:0] ctz;
+  reg  [ 5:0] cpop;
+  reg  [31:0] unary;
+  wire [31:0] orc_b;
+  wire [31:0] rev8;
+  wire        lt;
+  wire        lt_u;
+
+  // Zbs
+  wire [31:0] bit_mask;
+
+  // Final MUX
+  reg  [31:0] mux;
+
+  /**
+   * Shift and add (SH1ADD SH2ADD SH3ADD)
+   *  funct3[2:1] is the shift amount
+   */
+  assign sh_add = (i_in_a << i_funct3[2:1]) + i_in_b;
+
+  /**
+   * Count leading/trailing zeros and set bits
+   *  The last matching bit wins, so the loops go in the opposite directions
+   */
+  always @* begin
+    clz  = 6'd32;
+    ctz  = 6'd32;
+    cpop = 6'd0;
+    for (integer i = 0; i < 32; i = i + 1) begin
+      if (i_in_a[i]) clz = 6'd31 - i[5:0];
+      if (i_in_a[31-i]) ctz = 6'd31 - i[5:0];
+      cpop = cpop + {5'd0, i_in_a[i]};
+    end
+  end
+
+  /**
+   * Unary operations (selected with rs2 field)
+   */
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case (i_in_b[2:0])
+      3'b000:  unary = {26'd0, clz};
+      3'b001:  unary = {26'd0, ctz};
+      3'b010:  unary = {26'd0, cpop};
+      3'b100:  unary = {{24{i_in_a[7]}}, i_in_a[7:0]};
+      3'b101:  unary = {{16{i_in_a[15]}}, i_in_a[15:0]};
+      default: unary = 32'd0;
+    endcase
+  end
+
+  /**
+   * Byte operations (ORC.B REV8)
+   */
+  for (genvar i = 0; i < 4; i = i + 1) begin
+    assign orc_b[i*8+7:i*8] = {8{|i_in_a[i*8+7:i*8]}};
+    assign rev8[i*8+7:i*8] = i_in_a[31-i*8:24-i*8];
+  end
+
+  /**
+   * Minimum/maximum comparators
+   */
+  assign lt   = (  $signed(i_in_a) <   $signed(i_in_b));
+  assign lt_u = ($unsigned(i_in_a) < $unsigned(i_in_b));
+
+  /**
+   * Single bit mask (BSET BCLR BINV)
+   */
+  assign bit_mask = 32'd1 << i_in_b[4:0];
+
+  /**
+   * Final bit-manipulation MUX
+   */
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case ({i_funct7, i_funct3})
+      10'b0100000_111: mux = i_in_a & ~i_in_b;                  // ANDN
+      10'b0100000_110: mux = i_in_a | ~i_in_b;                  // ORN
+      10'b0100000_100: mux = ~(i_in_a ^ i_in_b);                // XNOR
+      10'b0010000_010: mux = sh_add;                            // SH1ADD
+      10'b0010000_100: mux = sh_add;                            // SH2ADD
+      10'b0010000_110: mux = sh_add;                            // SH3ADD
+      10'b0000101_100: mux = (lt)   ? i_in_a : i_in_b;          // MIN
+      10'b0000101_101: mux = (lt_u) ? i_in_a : i_in_b;          // MINU
+      10'b0000101_110: mux = (lt)   ? i_in_b : i_in_a;          // MAX
+      10'b0000101_111: mux = (lt_u) ? i_in_b : i_in_a;          // MAXU
+      10'b0000100_100: mux = {16'd0, i_in_a[15:0]};             // ZEXT.H
+      10'b0110000_001: mux = (i_alu_imm) ? unary : i_rotate;    // ROL, unary
+      10'b0110000_101: mux = i_rotate;                          // ROR RORI
+      10'b0010100_101: mux = orc_b;                             // ORC.B
+      10'b0110100_101: mux = rev8;                              // REV8
+      10'b0010100_001: mux = i_in_a | bit_mask;                 // BSET(I)
+      10'b0100100_001: mux = i_in_a & ~bit_mask;                // BCLR(I)
+      10'b0110100_001: mux = i_in_a ^ bit_mask;                 // BINV(I)
+      10'b0100100_101: mux = {31'd0, i_rotate[0]};              // BEXT(I)
+      default:         mux = 32'd0;
+    endcase
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_result = mux;
+
+endmodule
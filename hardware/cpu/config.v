@@ -16,30 +16,140 @@
 
   // Try to forward the data instead of stalling the pipelibe
   `define HAZARD_DATA_FORWARDNG
+  // Also forward the ALU result from EX phase (only loads stall the pipeline)
+//`define HAZARD_EX_FORWARDING
 
   // Clear the data bus address and output when no memory access is performed
 //`define CLEAN_DATA
 
+  // Clock the whole core on the rising edge only (register file is read
+  //  asynchronously, memories are read synchronously with the next address
+  //  and the load data arrives in the WB phase)
+//`define POSEDGE_ONLY
+
+  // Export the trace of the instructions leaving the EX phase (see cpi.py)
+//`define TRACE_PORT
+
   // Include the CSR module
   `define INCLUDE_CSR
+  // Include the performance counters (mcycle, minstret, mhpmcounter3-6)
+  `define CSR_COUNTERS
   // Route out the external CSR bus out of the CPU
 //`define CSR_EXTERNAL_BUS
+  // Include machine mode traps (ECALL, EBREAK, MRET, illegal opcodes, trap
+  //  CSRs) and the external interrupt input (requires the CSR module)
+//`define TRAPS
 
   // Include Compressed extension
   `define C_EXTENSION
   // Always wait for misaligned instructions data to arrive (not only when needed)
 //`define C_FETCH_T2
+  // Fetch through the halfword queue (no misaligned opcode penalty, fetch goes
+  //  on while the pipeline is stalled), replaces C_FETCH_T2
+//`define FETCH_QUEUE
+  // Issue two instructions per cycle, the second one has to be a simple ALU
+  //  opcode (requires the fetch queue, it's enabled automatically)
+//`define DUAL_ISSUE
+
+  // Resolve JAL (and C.J/C.JAL) in ID phase (one bubble instead of the flush)
+//`define DECODE_JAL
+
+  // Predict branches in the fetch unit (branch target buffer + 2-bit counters)
+//`define BRANCH_PREDICTOR
+  // Use gshare (global history) direction predictor instead of BTB counters
+//`define BP_GSHARE
+  // Number of the branch target buffer entries (log2)
+  `define BP_BTB_BITS 4
+  // Number of the gshare pattern history table entries (log2)
+  `define BP_PHT_BITS 6
+
+  // Predict return addresses with the return address stack (in ID phase)
+//`define RETURN_STACK
+  // Number of the return address stack entries (log2)
+  `define RAS_BITS 2
 
   // Replace the bit shifter with the barrel shifter
   `define BARREL_SHIFTER
+  // Include Zba, Zbb and Zbs bit-manipulation extensions (requires the barrel
+  //  shifter, it's enabled automatically)
+//`define B_EXTENSION
   // Include Mutiply/Divide extension
   `define M_EXTENSION
+  // Include Atomic extension (LR.W, SC.W and AMOs done in the MA phase)
+//`define A_EXTENSION
+  // Use 3 stage pipelined multiplier (DSP48A1 slices) instead of sequential one
+//`define MUL_DSP
+  // Use radix-4 sequential multiplier (2 bits per cycle, no DSP slices)
+//`define MUL_RADIX4
+  // Use fast divider (early termination, 2 bits per cycle) instead of 32 cycle one
+//`define DIV_FAST
+  // Let the independent opcodes flow while Mul/Div is busy (Mul/Div scoreboard)
+//`define MULDIV_SCOREBOARD
+  // Include single-precision Floating-point extension (FP register file, two
+  //  stage FMA pipeline, iterative FDIV/FSQRT unit, requires the CSR module)
+//`define F_EXTENSION
+
+  /**************************************************************************
+   * Bus settings
+   *************************************************************************/
+  // Insert a wait state into I/O accesses (I/O read data is registered, so
+  // the peripherals aren't in the critical path of the data port)
+//`define BUS_IO_WAIT
+  // Start of the I/O address space
+  `define BUS_IO_BASE 32'h00008000
+
+  /**************************************************************************
+   * Multi-core settings
+   *************************************************************************/
+  // Give the core the hart ID input (mhartid is CSR_MHARTID + i_hart_id),
+  //  required by the multi-core cluster (cluster.v)
+//`define MULTI_CORE
+  // Number of the cores in the cluster (log2, at least 1)
+  `define CLUSTER_BITS 1
+
+  /**************************************************************************
+   * Cache settings
+   *************************************************************************/
+  // Include instruction cache (between the CPU and the instruction memory)
+//`define ICACHE
+  // Number of instruction cache ways (1 - direct mapped, 2 - 2-way)
+  `define ICACHE_WAYS 1
+  // Number of instruction cache sets (log2)
+  `define ICACHE_SET_BITS 6
+  // Number of words in instruction cache line (log2)
+  `define ICACHE_LINE_BITS 2
+
+  // Include data cache with the store buffer (between the CPU and the data
+  // memory)
+//`define DCACHE
+  // Number of data cache sets (log2)
+  `define DCACHE_SET_BITS 6
+  // Number of words in data cache line (log2)
+  `define DCACHE_LINE_BITS 2
+  // Number of store buffer entries (log2)
+  `define DCACHE_SB_BITS 2
+  // Start of the uncached (I/O) address space
+  `define DCACHE_UNCACHED `BUS_IO_BASE
+
+  /**************************************************************************
+   * Peripheral settings
+   *************************************************************************/
+  // Number of UART transmitter and receiver buffer entries (log2)
+  `define UART_FIFO_BITS 4
+  // Place the UART buffers in the block RAM (for the large buffers)
+//`define UART_FIFO_BRAM
+  // Include the DMA controller (memory fill/copy and UART receiver
+  //  streaming, it sits between the CPU and the data bus)
+//`define DMA
 
   /**************************************************************************
    * CSR contents settings
    *************************************************************************/
   // misa CSR contents
+  // A extension - bit 0 (set automatically with A_EXTENSION)
+  // B extension - bit 1 (set automatically with B_EXTENSION)
   // C extension - bit 2
+  // F extension - bit 5 (set automatically with F_EXTENSION)
   // M extension - bit 12
   // I base ISA - bit 8
   `define CSR_MISA 32'h40001104
@@ -57,7 +167,8 @@
   `define CSR_MIMPID 32'h2D1BC3B7
 
   // mhartid CSR contents
-  // It's hardware thread ID so for single-core CPU this must be 0
+  // It's hardware thread ID so for single-core CPU this must be 0 (with
+  //  MULTI_CORE it's the ID of the first hart, i_hart_id is added to it)
   `define CSR_MHARTID 32'h00000000
 
 
@@ -71,6 +182,92 @@
   //`define REGS_DISTRIBUTED
   `endif
 
+  /**************************************************************************
+   * Command line overrides (-DNO_<option> disables the option, used by the
+   * benchmark runner to compare the configurations)
+   *************************************************************************/
+  `ifdef NO_HAZARD_DATA_FORWARDNG
+    `undef HAZARD_DATA_FORWARDNG
+  `endif
+  `ifdef NO_C_EXTENSION
+    `undef C_EXTENSION
+  `endif
+  `ifdef NO_BARREL_SHIFTER
+    `undef BARREL_SHIFTER
+  `endif
+  `ifdef NO_CSR_COUNTERS
+    `undef CSR_COUNTERS
+  `endif
+
+  /**************************************************************************
+   * Derived settings (don't edit)
+   *************************************************************************/
+  `ifdef M_EXTENSION
+    `ifndef MULDIV_SCOREBOARD
+      // Mul/Div circuitry is the part of the ALU (stalls the pipeline)
+      `define MULDIV_IN_ALU
+    `endif
+  `else
+    `undef MULDIV_SCOREBOARD
+  `endif
+  `ifndef HAZARD_DATA_FORWARDNG
+    `undef HAZARD_EX_FORWARDING
+  `endif
+  `ifndef INCLUDE_CSR
+    `undef TRAPS
+    `undef F_EXTENSION
+  `endif
+  `ifdef MULDIV_SCOREBOARD
+    // Hazard unit checks the RD of the opcode in ID phase (scoreboard)
+    `define HAZARD_SCOREBOARD
+  `endif
+  `ifdef F_EXTENSION
+    // Register indexes get the 6th bit selecting the FP register file
+    `define REG_BITS 6
+    `ifndef HAZARD_SCOREBOARD
+      // FDIV/FSQRT unit uses the scoreboard too
+      `define HAZARD_SCOREBOARD
+    `endif
+  `else
+    `define REG_BITS 5
+  `endif
+  `ifdef DUAL_ISSUE
+    `ifndef FETCH_QUEUE
+      // Second instruction comes from the fetch queue
+      `define FETCH_QUEUE
+    `endif
+  `endif
+  `ifndef C_EXTENSION
+    `undef FETCH_QUEUE
+    `undef DUAL_ISSUE
+  `endif
+  `ifdef B_EXTENSION
+    `ifndef BARREL_SHIFTER
+      // Rotations use the rotator stage of the barrel shifter
+      `define BARREL_SHIFTER
+    `endif
+  `endif
+  `ifndef POSEDGE_ONLY
+    `ifndef BARREL_SHIFTER
+      // Bit shifter stalls the pipeline after the load was answered
+      `define LOAD_DATA_KEEP
+    `endif
+    `ifdef MULDIV_IN_ALU
+      `ifndef LOAD_DATA_KEEP
+        // So does the Mul/Div circuitry in the ALU
+        `define LOAD_DATA_KEEP
+      `endif
+    `endif
+  `endif
+  // Number of the cores in the cluster
+  `define CLUSTER_CORES (1 << `CLUSTER_BITS)
+  `ifdef POSEDGE_ONLY
+    `ifndef REGS_DISTRIBUTED
+      // Register file is read asynchronously (it can't be a BRAM)
+      `define REGS_DISTRIBUTED
+    `endif
+  `endif
+
   /**************************************************************************
    * Simulation settings
    *************************************************************************/
@@ -0,0 +1,150 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: counters.v
+ *
+ * This file contains the performance counters accessed through the CSR
+ * interface. Every counter is 64 bits wide and counts the events on the
+ * input with the same index:
+ *
+ * 0 - mcycle       - Clock cycles
+ * 1 - time         - Read-only alias of mcycle (no real time clock)
+ * 2 - minstret     - Retired instructions
+ * 3 - mhpmcounter3 - Data hazard stall cycles
+ * 4 - mhpmcounter4 - Branch flushes
+ * 5 - mhpmcounter5 - ALU busy cycles (Mul/Div and bit shifter)
+ * 6 - mhpmcounter6 - Loads and stores
+ *
+ * User aliases (cycle, time, instret, hpmcounterN) are read-only, counters
+ * can be stopped with mcountinhibit, mhpmeventN registers are read-only and
+ * return the counter number, the remaining mhpmcounters read as zero.
+ *
+ * i_clk     - Clock input
+ * i_rst     - Reset input
+ * i_wr      - Write enable input (only valid in one cycle per instruction)
+ * i_addr    - CSR address input
+ * i_wr_data - CSR write data input
+ * i_events  - Event inputs (counted in every cycle in which they're set)
+ * i_instret_2 - Two instructions retired in this cycle (DUAL_ISSUE only,
+ *               minstret is incremented by two)
+ *
+ * o_rd_data - CSR read data output
+ * o_hit     - CSR address belongs to the counters
+ ***************************************************************************/
+`include "config.v"
+
+module counters (
+  input         i_clk,
+  input         i_rst,
+
+  input         i_wr,
+  input  [11:0] i_addr,
+  input  [31:0] i_wr_data,
+  input  [ 6:0] i_events,
+`ifdef DUAL_ISSUE
+  input         i_instret_2,
+`endif
+
+  output [31:0] o_rd_data,
+  output        o_hit
+);
+
+
+  // Counter values
+  wire [63:0] count [0:6];
+  reg  [ 6:0] inhibit;
+
+  // Address decoder
+  wire [ 4:0] index;
+  wire        sel_machine;
+  wire        sel_user;
+  wire        sel_count;
+  wire        sel_inhibit;
+  wire        sel_event;
+
+  // Write enables
+  wire        wr_lo;
+  wire        wr_hi;
+
+  // Read circuitry
+  wire [ 2:0] rd_index;
+  wire [63:0] rd_count;
+
+  /**
+   * Address decoder
+   *  0xB00-0xB1F - Machine counters (low half)
+   *  0xB80-0xB9F - Machine counters (high half)
+   *  0xC00-0xC1F - User counters (low half)
+   *  0xC80-0xC9F - User counters (high half)
+   *  0x320       - mcountinhibit
+   *  0x323-0x33F - mhpmevent3-31
+   */
+  assign index       = i_addr[4:0];
+  assign sel_machine = (i_addr[11:8] == 4'hB);
+  assign sel_user    = (i_addr[11:8] == 4'hC);
+  assign sel_count   = (sel_machine || sel_user) && (i_addr[6:5] == 2'b00);
+  assign sel_inhibit = (i_addr == 12'h320);
+  assign sel_event   = (i_addr[11:5] == 7'b0011001) && (index >= 5'd3);
+
+  assign wr_lo = i_wr && sel_machine && sel_count && !i_addr[7];
+  assign wr_hi = i_wr && sel_machine && sel_count &&  i_addr[7];
+
+  /**
+   * Counters
+   *  Write has the priority over the increment
+   */
+  for (genvar i = 0; i < 7; i = i + 1) begin : cnt
+    if (i == 1) begin : time_alias
+      // Read through mcycle (see rd_index)
+      assign count[i] = 64'd0;
+    end else begin : counter
+      reg  [63:0] value;
+      wire [63:0] step;
+
+`ifdef DUAL_ISSUE
+      assign step = (i == 2 && i_instret_2) ? 64'd2 : 64'd1;
+`else
+      assign step = 64'd1;
+`endif
+
+      always @(posedge i_clk) begin
+        if (i_rst) begin
+          value <= 0;
+        end else if (wr_lo && (index == i)) begin
+          value[31:0] <= i_wr_data;
+        end else if (wr_hi && (index == i)) begin
+          value[63:32] <= i_wr_data;
+        end else if (i_events[i] && !inhibit[i]) begin
+          value <= value + step;
+        end
+      end
+
+      assign count[i] = value;
+    end
+  end
+
+  /**
+   * Counter inhibit (time can't be inhibited)
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      inhibit <= 0;
+    end else if (i_wr && sel_inhibit) begin
+      inhibit <= i_wr_data[6:0] & 7'b1111101;
+    end
+  end
+
+  /**
+   * Output assignment
+   */
+  assign rd_index = (index == 5'd1) ? 3'd0 : index[2:0];
+  assign rd_count = (index < 5'd7) ? count[rd_index] : 64'd0;
+
+  assign o_rd_data =
+    (sel_inhibit) ? {25'd0, inhibit} :
+    (sel_event)   ? ((index < 5'd7) ? {27'd0, index} : 32'd0) :
+    (i_addr[7])   ? rd_count[63:32] : rd_count[31:0];
+
+  assign o_hit = sel_count || sel_inhibit || sel_event;
+
+endmodule
@@ -10,6 +10,11 @@
  * i_clk         - Clock input
  * i_clk_ce      - Clock enable
  * i_rst         - Reset input
+ * i_hart_id     - Index of the core in the cluster (MULTI_CORE only)
+ * i_snoop_wr    - Other hart writes the shared memory (MULTI_CORE and
+ *                 A_EXTENSION only, clears the LR.W reservation)
+ * i_snoop_addr  - Address of the write
+ * i_irq         - External interrupt request (TRAPS only, level sensitive)
  *
  * o_csr_addr    - External CSR bus address bus
  * i_csr_rd_data - External CSR bus data input bus
@@ -19,12 +24,41 @@
  *
  * o_addr_i      - Instruction memory address output
  * i_data_in_i   - Instruction memory data input
+ * i_ready_i     - Instruction memory data is valid (fetch waits if cleared)
  *
  * o_addr_d      - Data memory address output
  * i_data_rd_d   - Data memory data input
  * o_data_wr_d   - Data memory data output
  * o_wr_d        - Data memory write enable
  * o_rd_d        - Data memory read enable
+ * o_lock_d      - Data bus has to stay with this hart (AMO in progress,
+ *                 MULTI_CORE and A_EXTENSION only)
+ * i_ready_d     - Data memory request is done (pipeline waits if cleared)
+ *
+ * o_trace_valid  - Instruction leaves the EX phase (TRACE_PORT only)
+ * o_trace_pc     - Its address
+ * o_trace_ir     - Its opcode (upper half is invalid for compressed ones)
+ * o_trace_cycles - Cycles since the previous one (saturated)
+ * o_trace_cause  - Stalls and bubbles that happened in these cycles:
+ *                  [0] data hazard, [1] fetch bubble, [2] branch flush,
+ *                  [3] instruction bus wait, [4] ALU busy, [5] data bus wait
+ * o_trace1_valid - Second issue slot leaves the EX phase too (DUAL_ISSUE
+ *                  and TRACE_PORT only, reported after the first one)
+ * o_trace1_pc    - Its address
+ * o_trace1_ir    - Its opcode
+ *
+ * Both buses use the same ready handshake: the request (address, strobes
+ * and write data) is held unchanged until the ready is set, the data is
+ * taken at the rising edge of the clock at which ready is set. Ready may
+ * be set combinationally in the same cycle (zero wait state memory just
+ * keeps it high). Waiting instruction bus only feeds bubbles into the
+ * pipeline, older instructions keep going; waiting data bus holds the
+ * memory access stage and all the stages before it.
+ *
+ * With POSEDGE_ONLY the memories are expected to be read synchronously on
+ * the rising edge: o_addr_i is the address of the opcode needed in the next
+ * cycle and the load data is expected in the cycle after the data request
+ * was accepted (in the WB phase).
  ***************************************************************************/
 `include "config.v"
 `include "alu.v"
@@ -36,6 +70,26 @@
 `include "regs.v"
 `ifdef INCLUDE_CSR
 `include "csr.v"
+`ifdef CSR_COUNTERS
+`include "counters.v"
+`endif
+`ifdef TRAPS
+`include "trap.v"
+`endif
+`endif
+`ifdef MULDIV_SCOREBOARD
+`include "mdunit.v"
+`endif
+`ifdef DUAL_ISSUE
+`include "alu_simple.v"
+`endif
+`ifdef A_EXTENSION
+`include "atomic.v"
+`endif
+`ifdef F_EXTENSION
+`include "fregs.v"
+`include "fpu.v"
+`include "fpdiv.v"
 `endif
 
 module cpu (
@@ -43,6 +97,20 @@ module cpu (
   input         i_clk_ce,
   input         i_rst,
 
+`ifdef MULTI_CORE
+  // verilator lint_off unused
+  input  [ 7:0] i_hart_id,
+  // verilator lint_on unused
+`ifdef A_EXTENSION
+  input         i_snoop_wr,
+  input  [31:0] i_snoop_addr,
+`endif
+`endif
+
+`ifdef TRAPS
+  input         i_irq,
+`endif
+
 `ifdef CSR_EXTERNAL_BUS
   output [11:0] o_csr_addr,
   input  [31:0] i_csr_rd_data,
@@ -51,35 +119,68 @@ module cpu (
   output        o_csr_rd,
 `endif
 
+`ifdef TRACE_PORT
+  output        o_trace_valid,
+  output [31:0] o_trace_pc,
+  output [31:0] o_trace_ir,
+  output [15:0] o_trace_cycles,
+  output [ 5:0] o_trace_cause,
+`ifdef DUAL_ISSUE
+  output        o_trace1_valid,
+  output [31:0] o_trace1_pc,
+  output [31:0] o_trace1_ir,
+`endif
+`endif
+
   output [31:0] o_addr_i,
   input  [31:0] i_data_in_i,
+  input         i_ready_i,
 
   output [31:0] o_addr_d,
   input  [31:0] i_data_rd_d,
   output [31:0] o_data_wr_d,
   output  [3:0] o_wr_d,
-  output        o_rd_d
+  output        o_rd_d,
+`ifdef MULTI_CORE
+`ifdef A_EXTENSION
+  output        o_lock_d,
+`endif
+`endif
+  input         i_ready_d
 );
 
 
   // Clock signals
+  wire core_ce;
   wire clk_ce;
   wire clk_n;
+`ifdef FETCH_QUEUE
+  wire fetch_ce;
+`endif
+`ifdef POSEDGE_ONLY
+  reg  first_cycle;
+`endif
 
   // Instruction fetch circuitry
   wire [31:0] if_pc;
+  wire [31:0] if_addr;
   wire [31:0] id_pc;
   wire [31:0] id_ir;
   wire [31:0] id_ret;
   wire hz_br;
+`ifdef BRANCH_PREDICTOR
+  wire        id_pred;
+  wire [31:0] id_pred_addr;
+  wire [`BP_PHT_BITS-1:0] id_pred_idx;
+`endif
 
   // Instruction decoder
   wire [31:0] immediate;
   wire [ 2:0] funct3;
   wire [ 6:0] funct7;
-  wire [ 4:0] rs1;
-  wire [ 4:0] rs2;
-  wire [ 4:0] rd;
+  wire [`REG_BITS-1:0] rs1;
+  wire [`REG_BITS-1:0] rs2;
+  wire [`REG_BITS-1:0] rd;
   wire        hz_rs1;
   wire        hz_rs2;
   wire        branch;
@@ -87,6 +188,21 @@ module cpu (
   wire        alu_pc;
   wire        alu_imm;
   wire        alu_en;
+`ifdef B_EXTENSION
+  wire        bm_en;
+`endif
+`ifdef A_EXTENSION
+  wire        atomic;
+`endif
+`ifdef TRAPS
+  wire        illegal;
+`endif
+`ifdef F_EXTENSION
+  wire [ 5:0] rs3;
+  wire        hz_rs3;
+  wire        fpu_en;
+  wire [ 4:0] fpu_op;
+`endif
   wire        d_wr;
   wire        d_rd;
   wire [ 1:0] wb_mux;
@@ -95,10 +211,21 @@ module cpu (
 
   // Register set and hazard detector/forwarder
   wire hz_data;
+  wire id_bubble;
   wire [31:0] rs1_raw_d;
   wire [31:0] rs2_raw_d;
   wire [31:0] rs1_d;
   wire [31:0] rs2_d;
+`ifdef F_EXTENSION
+  wire        hz_data_0;
+  wire        hz_data_3;
+  wire [31:0] irs1_raw_d;
+  wire [31:0] irs2_raw_d;
+  wire [31:0] frs1_raw_d;
+  wire [31:0] frs2_raw_d;
+  wire [31:0] rs3_raw_d;
+  wire [31:0] rs3_d;
+`endif
 
   // Execute stage registers
   reg  [31:0] ex_rs1_d;
@@ -113,18 +240,135 @@ module cpu (
   reg         ex_alu_pc;
   reg         ex_alu_imm;
   reg         ex_alu_en;
+`ifdef B_EXTENSION
+  reg         ex_bm_en;
+`endif
+`ifdef A_EXTENSION
+  reg         ex_atomic;
+`endif
+`ifdef TRAPS
+  reg         ex_illegal;
+`endif
   reg         ex_ma_wr;
   reg         ex_ma_rd;
   reg  [ 1:0] ex_wb_mux;
-  reg  [ 4:0] ex_wb_reg;
+  reg  [`REG_BITS-1:0] ex_wb_reg;
   reg         ex_wb_en;
   // verilator lint_off unused
-  reg  [ 4:0] ex_rs1;
+  reg  [`REG_BITS-1:0] ex_rs1;
   reg         ex_system;
   // verilator lint_on unused
+  reg         ex_valid;
+`ifdef TRACE_PORT
+  reg  [31:0] ex_ir;
+`endif
+`ifdef BRANCH_PREDICTOR
+  reg         ex_pred;
+  reg  [31:0] ex_pred_addr;
+  reg  [`BP_PHT_BITS-1:0] ex_pred_idx;
+`endif
 
   // Branch decoder
   wire br_en;
+  wire br_take;
+  wire br_miss;
+  wire [31:0] br_addr;
+  wire        fetch_br_en;
+  wire [31:0] fetch_br_addr;
+
+  // Machine mode traps
+  wire        trap_go;
+  wire        trap_br_en;
+  wire [31:0] trap_br_addr;
+`ifdef TRAPS
+  wire        ex_priv;
+  wire        ex_ecall;
+  wire        ex_ebreak;
+  wire        ex_mret;
+  wire        trap_valid;
+`endif
+
+  // Jumps resolved in ID phase
+  wire        id_jal_go;
+  wire [31:0] id_jal_addr;
+`ifdef DECODE_JAL
+  wire        id_jal;
+  reg         ex_jal_done;
+`endif
+
+  // Return address stack
+  wire        id_ras_redir;
+  wire [31:0] ras_top;
+`ifdef RETURN_STACK
+  wire        ras_valid;
+  wire        id_link_rd;
+  wire        id_link_rs1;
+  wire        id_ras_push;
+  wire        id_ras_pop;
+  wire        id_ras_go;
+  reg         ex_ras_pred;
+  reg  [31:0] ex_ras_addr;
+`endif
+  wire        br_pred_miss;
+
+  // Second issue slot (DUAL_ISSUE)
+`ifdef DUAL_ISSUE
+  wire [31:0] id1_ir;
+  wire        id1_valid;
+  wire        id1_issue;
+  wire        id1_simple;
+  wire        id1_md;
+  wire        id1_shift;
+  wire        id_pair;
+  wire [31:0] id1_imm;
+  wire [ 2:0] id1_funct3;
+  wire [ 6:0] id1_funct7;
+  wire [`REG_BITS-1:0] id1_rs1;
+  wire [`REG_BITS-1:0] id1_rs2;
+  wire [`REG_BITS-1:0] id1_rd;
+  wire        id1_hz_rs1;
+  wire        id1_hz_rs2;
+  wire        id1_branch;
+  wire        id1_jump;
+  wire        id1_alu_pc;
+  wire        id1_alu_imm;
+  wire        id1_alu_en;
+`ifdef B_EXTENSION
+  wire        id1_bm_en;
+`endif
+  wire        id1_ma_wr;
+  wire        id1_ma_rd;
+  wire [ 1:0] id1_wb_mux;
+  wire        id1_wb_en;
+  wire        id1_system;
+  wire        id1_hz_data;
+  wire        id1_hz_pair;
+  wire [31:0] id1_rs1_raw_d;
+  wire [31:0] id1_rs2_raw_d;
+  wire [31:0] id1_rs1_d;
+  wire [31:0] id1_rs2_d;
+  reg  [31:0] ex1_rs1_d;
+  reg  [31:0] ex1_rs2_d;
+  reg  [31:0] ex1_imm;
+  reg  [31:0] ex1_pc;
+  reg  [ 2:0] ex1_funct3;
+  reg  [ 6:0] ex1_funct7;
+  reg         ex1_alu_pc;
+  reg         ex1_alu_imm;
+  reg         ex1_alu_en;
+  reg  [`REG_BITS-1:0] ex1_wb_reg;
+  reg         ex1_wb_en;
+`ifdef TRACE_PORT
+  reg  [31:0] ex1_ir;
+`endif
+  wire [31:0] ex1_res;
+  reg  [31:0] ma1_res;
+  reg  [`REG_BITS-1:0] ma1_wb_reg;
+  reg         ma1_wb_en;
+  reg  [31:0] wb1_wb_d;
+  reg  [`REG_BITS-1:0] wb1_wb_reg;
+  reg         wb1_wb_en;
+`endif
 
   // Arythmetic and logic unit
   wire [31:0] alu_out;
@@ -132,6 +376,39 @@ module cpu (
   wire [31:0] alu_a_mux;
   wire [31:0] alu_b_mux;
 
+  // Mul/Div unit (scoreboard)
+`ifdef MULDIV_SCOREBOARD
+  wire        id_md_en;
+  wire        md_en;
+  wire [31:0] md_result;
+  wire        md_ex_wait;
+  wire        md_hz_en;
+  wire [`REG_BITS-1:0] md_hz_reg;
+  wire        md_wb_en;
+  wire [`REG_BITS-1:0] md_wb_reg;
+`endif
+
+  // Floating-point units
+`ifdef F_EXTENSION
+  reg  [31:0] ex_rs3_d;
+  reg         ex_fpu_en;
+  reg  [ 4:0] ex_fpu_op;
+  wire        id_fd_en;
+  wire        ex_fd_en;
+  wire [ 2:0] frm;
+  wire [31:0] fpu_result;
+  wire        fpu_busy;
+  wire        fpu_flags_en;
+  wire [ 4:0] fpu_flags;
+  wire [31:0] fd_result;
+  wire [ 4:0] fd_flags;
+  wire        fd_ex_wait;
+  wire        fd_hz_en;
+  wire [`REG_BITS-1:0] fd_hz_reg;
+  wire        fd_wb_en;
+  wire [`REG_BITS-1:0] fd_wb_reg;
+`endif
+
   // Memory access registers
   wire [31:0] ex_res_dat;
   reg  [31:0] ma_rs2_d;
@@ -140,28 +417,87 @@ module cpu (
   reg  [ 2:0] ma_funct3;
   reg         ma_wr;
   reg         ma_rd;
-  reg  [ 4:0] ma_wb_reg;
+  reg  [`REG_BITS-1:0] ma_wb_reg;
   reg  [ 1:0] ma_wb_mux;
   reg         ma_wb_en;
+`ifdef A_EXTENSION
+  reg         ma_atomic;
+  reg  [ 4:0] ma_funct5;
+`endif
 
   // Data memory
   wire [31:0] ma_rd_dat;
+  wire [31:0] ma_ld_dat;
   wire [31:0] ma_wr_dat;
   wire [ 3:0] ma_we;
   wire  [3:0] ma_wr_en;
   wire        ma_rd_en;
+  wire [31:0] ma_rd_bus;
+`ifdef LOAD_DATA_KEEP
+  reg         ma_rd_sent;
+  reg         ma_rd_keep;
+  reg  [31:0] ma_rd_kept;
+`endif
+`ifdef A_EXTENSION
+  wire        at_rd_en;
+  wire        at_wr_en;
+  wire        at_wait;
+  wire        at_lock;
+  wire [31:0] at_data_wr;
+  wire        at_res_en;
+  wire [31:0] at_res;
+`endif
 
   // Write back registers
   reg  [31:0] wb_wb_d;
-  reg  [ 4:0] wb_wb_reg;
+  reg  [`REG_BITS-1:0] wb_wb_reg;
   reg         wb_wb_en;
   reg  [31:0] wb_dat_mux;
+  wire [31:0] wb_res;
+  wire [31:0] wb_dat;
+`ifdef F_EXTENSION
+  reg         wb_fpu;
+`endif
+`ifdef POSEDGE_ONLY
+  reg  [ 1:0] wb_shift;
+  reg  [ 2:0] wb_funct3;
+  reg         wb_load;
+  reg  [31:0] wb_rd_hold;
+  wire [31:0] wb_rd_raw;
+  wire [31:0] wb_rd_dat;
+`endif
 
   /**
    * Clock Signals
    */
-  assign clk_ce = i_clk_ce && !alu_busy;
+  assign core_ce = i_clk_ce && !alu_busy;
+`ifdef A_EXTENSION
+  assign clk_ce = core_ce && i_ready_d && !at_wait;
+`else
+  assign clk_ce = core_ce && i_ready_d;
+`endif
+`ifdef FETCH_QUEUE
+  // Fetch queue fills up while the pipeline waits for the data memory or ALU
+  assign fetch_ce = i_clk_ce;
+`endif
+`ifdef POSEDGE_ONLY
+  // Units that run on the falling edge use the rising edge instead
+  assign clk_n = i_clk;
+`else
   assign clk_n = !i_clk;
+`endif
+
+  // Pipeline has advanced at the last clock edge (first cycle of every
+  //  phase), multicycle units start and the load data is valid in it
+`ifdef POSEDGE_ONLY
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      first_cycle <= 0;
+    end else begin
+      first_cycle <= clk_ce;
+    end
+  end
+`endif
 
   ///////////////////////////////////////////////////////////////////////////
   // FETCH STAGE
@@ -175,10 +511,40 @@ module cpu (
     .i_clk_ce   (clk_ce),
     .i_rst      (i_rst),
     .i_data_in  (i_data_in_i),
+    .i_ready    (i_ready_i),
+`ifdef FETCH_QUEUE
+    .i_fetch_ce (fetch_ce),
+`endif
     .i_hz_data  (hz_data),
-    .i_br_en    (br_en),
-    .i_br_addr  (alu_out),
+    .i_br_en    (fetch_br_en),
+    .i_br_addr  (fetch_br_addr),
+`ifdef BRANCH_PREDICTOR
+    .i_bp_en    (clk_ce && (ex_branch || ex_jump)),
+    .i_bp_jump  (ex_jump),
+    .i_bp_taken (br_en),
+    .i_bp_pc    (ex_pc),
+    .i_bp_addr  (alu_out),
+    .i_bp_idx   (ex_pred_idx),
+`endif
+`ifdef RETURN_STACK
+    .i_ras_push  (id_ras_push),
+    .i_ras_pop   (id_ras_pop),
+    .i_ras_addr  (id_ret),
+    .o_ras_top   (ras_top),
+    .o_ras_valid (ras_valid),
+`endif
+`ifdef BRANCH_PREDICTOR
+    .o_id_pred      (id_pred),
+    .o_id_pred_addr (id_pred_addr),
+    .o_id_pred_idx  (id_pred_idx),
+`endif
+`ifdef DUAL_ISSUE
+    .i_id1_issue (id1_issue),
+    .o_id1_ir    (id1_ir),
+    .o_id1_valid (id1_valid),
+`endif
     .o_if_pc    (if_pc),
+    .o_if_addr  (if_addr),
     .o_id_pc    (id_pc),
     .o_id_ret   (id_ret),
     .o_id_ir    (id_ir),
@@ -208,6 +574,21 @@ module cpu (
     .o_alu_pc    (alu_pc),
     .o_alu_imm   (alu_imm),
     .o_alu_en    (alu_en),
+`ifdef B_EXTENSION
+    .o_bm_en     (bm_en),
+`endif
+`ifdef A_EXTENSION
+    .o_atomic    (atomic),
+`endif
+`ifdef TRAPS
+    .o_illegal   (illegal),
+`endif
+`ifdef F_EXTENSION
+    .o_rs3       (rs3),
+    .o_hz_rs3    (hz_rs3),
+    .o_fpu_en    (fpu_en),
+    .o_fpu_op    (fpu_op),
+`endif
     .o_ma_wr     (d_wr),
     .o_ma_rd     (d_rd),
     .o_wb_mux    (wb_mux),
@@ -216,19 +597,58 @@ module cpu (
 
   /**
    * Register set
+   *  With F_EXTENSION the 6th bit of the register index selects the FP
+   *  register file (second issue slot only uses the integer one)
    */
   regs regs_i (
     .i_clk       (clk_n),
     .i_ce        (clk_ce),
-    .i_addr_rd_a (rs1),
-    .i_addr_rd_b (rs2),
+    .i_addr_rd_a (rs1[4:0]),
+    .i_addr_rd_b (rs2[4:0]),
+`ifdef F_EXTENSION
+    .i_we        (wb_wb_en && !wb_wb_reg[5]),
+`else
     .i_we        (wb_wb_en),
-    .i_addr_wr   (wb_wb_reg),
-    .i_dat_wr    (wb_wb_d),
+`endif
+    .i_addr_wr   (wb_wb_reg[4:0]),
+    .i_dat_wr    (wb_dat),
+`ifdef DUAL_ISSUE
+    .i_addr_rd_c (id1_rs1[4:0]),
+    .i_addr_rd_d (id1_rs2[4:0]),
+    .i_we2       (wb1_wb_en),
+    .i_addr_wr2  (wb1_wb_reg[4:0]),
+    .i_dat_wr2   (wb1_wb_d),
+    .o_dat_rd_c  (id1_rs1_raw_d),
+    .o_dat_rd_d  (id1_rs2_raw_d),
+`endif
+`ifdef F_EXTENSION
+    .o_dat_rd_a  (irs1_raw_d),
+    .o_dat_rd_b  (irs2_raw_d)
+`else
     .o_dat_rd_a  (rs1_raw_d),
     .o_dat_rd_b  (rs2_raw_d)
+`endif
+  );
+
+`ifdef F_EXTENSION
+  fregs fregs_i (
+    .i_clk       (clk_n),
+    .i_ce        (clk_ce),
+    .i_addr_rd_a (rs1[4:0]),
+    .i_addr_rd_b (rs2[4:0]),
+    .i_addr_rd_c (rs3[4:0]),
+    .i_we        (wb_wb_en && wb_wb_reg[5]),
+    .i_addr_wr   (wb_wb_reg[4:0]),
+    .i_dat_wr    (wb_dat),
+    .o_dat_rd_a  (frs1_raw_d),
+    .o_dat_rd_b  (frs2_raw_d),
+    .o_dat_rd_c  (rs3_raw_d)
   );
 
+  assign rs1_raw_d = (rs1[5]) ? frs1_raw_d : irs1_raw_d;
+  assign rs2_raw_d = (rs2[5]) ? frs2_raw_d : irs2_raw_d;
+`endif
+
   /**
    * Hazard detector/forwarder
    */
@@ -247,18 +667,335 @@ module cpu (
     .i_ex_wb_mux  (ex_wb_mux),
     .i_ma_wb_mux  (ma_wb_mux),
     .i_ex_ret     (ex_ret),
+`ifdef HAZARD_EX_FORWARDING
+    .i_ex_res     (ex_res_dat),
+`endif
     .i_ma_res     (ma_res),
-    .i_ma_rd_dat  (ma_rd_dat),
+    .i_ma_rd_dat  (ma_ld_dat),
     .i_ma_ret     (ma_ret),
-    .i_wb_wb_d    (wb_wb_d),
+    .i_wb_wb_d    (wb_dat),
+`endif
+`ifdef HAZARD_SCOREBOARD
+    .i_rd         (rd),
+    .i_wb_en      (wb_en),
+`endif
+`ifdef MULDIV_SCOREBOARD
+    .i_md_en      (id_md_en),
+    .i_md_hz_en   (md_hz_en),
+    .i_md_hz_reg  (md_hz_reg),
+`endif
+`ifdef F_EXTENSION
+    .i_system     (system),
+    .i_fp_busy    (ex_fpu_en || fpu_busy || fd_hz_en),
+    .i_fd_en      (id_fd_en),
+    .i_fd_hz_en   (fd_hz_en),
+    .i_fd_hz_reg  (fd_hz_reg),
+`endif
+`ifdef DUAL_ISSUE
+    .i_ex1_wb_reg (ex1_wb_reg),
+    .i_ma1_wb_reg (ma1_wb_reg),
+    .i_wb1_wb_reg (wb1_wb_reg),
+    .i_ex1_wb_en  (ex1_wb_en),
+    .i_ma1_wb_en  (ma1_wb_en),
+    .i_wb1_wb_en  (wb1_wb_en),
+`ifdef HAZARD_DATA_FORWARDNG
+`ifdef HAZARD_EX_FORWARDING
+    .i_ex1_res    (ex1_res),
+`endif
+    .i_ma1_res    (ma1_res),
+    .i_wb1_wb_d   (wb1_wb_d),
+`endif
+    .i_pair_rd    ({`REG_BITS{1'b0}}),
+    .i_pair_wb_en (1'b0),
+    .o_hz_pair    (),
 `endif
     .i_rs1_raw_d  (rs1_raw_d),
     .i_rs2_raw_d  (rs2_raw_d),
     .o_rs1_d      (rs1_d),
     .o_rs2_d      (rs2_d),
+`ifdef F_EXTENSION
+    .o_hz_data    (hz_data_0)
+`else
     .o_hz_data    (hz_data)
+`endif
+  );
+
+  /**
+   * Hazard detector/forwarder for RS3 (F_EXTENSION)
+   *  FMA opcodes read the third FP register, it goes through the RS1 path
+   *  of the second hazard unit (RS2 path is unused)
+   */
+`ifdef F_EXTENSION
+  hazard hazard_3 (
+    .i_hz_rs1     (hz_rs3),
+    .i_hz_rs2     (1'b0),
+    .i_rs1        (rs3),
+    .i_rs2        (6'd0),
+    .i_ex_wb_reg  (ex_wb_reg),
+    .i_ma_wb_reg  (ma_wb_reg),
+    .i_wb_wb_reg  (wb_wb_reg),
+    .i_ex_wb_en   (ex_wb_en),
+    .i_ma_wb_en   (ma_wb_en),
+    .i_wb_wb_en   (wb_wb_en),
+`ifdef HAZARD_DATA_FORWARDNG
+    .i_ex_wb_mux  (ex_wb_mux),
+    .i_ma_wb_mux  (ma_wb_mux),
+    .i_ex_ret     (ex_ret),
+`ifdef HAZARD_EX_FORWARDING
+    .i_ex_res     (ex_res_dat),
+`endif
+    .i_ma_res     (ma_res),
+    .i_ma_rd_dat  (ma_ld_dat),
+    .i_ma_ret     (ma_ret),
+    .i_wb_wb_d    (wb_dat),
+`endif
+    .i_rd         (rd),
+    .i_wb_en      (1'b0),
+`ifdef MULDIV_SCOREBOARD
+    .i_md_en      (1'b0),
+    .i_md_hz_en   (md_hz_en),
+    .i_md_hz_reg  (md_hz_reg),
+`endif
+    .i_system     (1'b0),
+    .i_fp_busy    (1'b0),
+    .i_fd_en      (1'b0),
+    .i_fd_hz_en   (fd_hz_en),
+    .i_fd_hz_reg  (fd_hz_reg),
+`ifdef DUAL_ISSUE
+    .i_ex1_wb_reg (ex1_wb_reg),
+    .i_ma1_wb_reg (ma1_wb_reg),
+    .i_wb1_wb_reg (wb1_wb_reg),
+    .i_ex1_wb_en  (ex1_wb_en),
+    .i_ma1_wb_en  (ma1_wb_en),
+    .i_wb1_wb_en  (wb1_wb_en),
+`ifdef HAZARD_DATA_FORWARDNG
+`ifdef HAZARD_EX_FORWARDING
+    .i_ex1_res    (ex1_res),
+`endif
+    .i_ma1_res    (ma1_res),
+    .i_wb1_wb_d   (wb1_wb_d),
+`endif
+    .i_pair_rd    (6'd0),
+    .i_pair_wb_en (1'b0),
+    .o_hz_pair    (),
+`endif
+    .i_rs1_raw_d  (rs3_raw_d),
+    .i_rs2_raw_d  (32'd0),
+    .o_rs1_d      (rs3_d),
+    // verilator lint_off PINCONNECTEMPTY
+    .o_rs2_d      (),
+    // verilator lint_on PINCONNECTEMPTY
+    .o_hz_data    (hz_data_3)
+  );
+
+  assign hz_data = hz_data_0 || hz_data_3;
+`endif
+
+`ifdef MULDIV_SCOREBOARD
+  assign id_md_en = alu_en && !alu_imm && (funct7 == 7'b0000001);
+`endif
+`ifdef F_EXTENSION
+  assign id_fd_en = fpu_en && (fpu_op[4:2] == 3'b111);
+`endif
+
+  /**
+   * Jumps resolved in ID phase
+   *  JAL target only depends on the PC and the immediate, so the fetch is
+   *  redirected as soon as the jump leaves the ID phase (one bubble instead
+   *  of the flush from EX phase). Jumps predicted by the branch predictor
+   *  are left for the EX phase to verify.
+   */
+`ifdef DECODE_JAL
+  assign id_jal      = jump && alu_pc;
+  assign id_jal_addr = id_pc + immediate;
+`ifdef BRANCH_PREDICTOR
+  assign id_jal_go   = id_jal && !id_pred && !id_bubble;
+`else
+  assign id_jal_go   = id_jal && !id_bubble;
+`endif
+`else
+  assign id_jal_go   = 1'b0;
+  assign id_jal_addr = 0;
+`endif
+
+  /**
+   * Return address stack
+   *  Calls (JAL/JALR with x1 or x5 as rd) push the return address when they
+   *  leave the ID phase, returns (JALR with x1 or x5 as rs1) pop it and
+   *  redirect the fetch to it, EX phase verifies the target and corrects the
+   *  fetch on misprediction. Only the instructions leaving the ID phase
+   *  touch the stack and the wrong path never gets that far (branches are
+   *  resolved in their first EX cycle), so the stack is never corrupted.
+   */
+`ifdef RETURN_STACK
+  assign id_link_rd  = (rd == 5'd1) || (rd == 5'd5);
+  assign id_link_rs1 = (rs1 == 5'd1) || (rs1 == 5'd5);
+  assign id_ras_push = jump && id_link_rd && !id_bubble;
+  assign id_ras_pop  = jump && !alu_pc && id_link_rs1 &&
+    !(id_link_rd && (rs1 == rd)) && !id_bubble;
+  assign id_ras_go   = id_ras_pop && ras_valid;
+`ifdef BRANCH_PREDICTOR
+  // Fetch doesn't have to be redirected if the BTB has guessed the same
+  assign id_ras_redir = id_ras_go && !(id_pred && (id_pred_addr == ras_top));
+`else
+  assign id_ras_redir = id_ras_go;
+`endif
+`else
+  assign id_ras_redir = 1'b0;
+  assign ras_top      = 0;
+`endif
+
+  /**
+   * Second issue slot (DUAL_ISSUE)
+   *  Instruction after the one in ID phase is decoded by the second decoder
+   *  and issued along with it if it's a simple ALU opcode (OP, OP-IMM, LUI
+   *  or AUIPC without Mul/Div, bit-manipulation and, without the barrel
+   *  shifter, shifts), if the first one doesn't change the control flow
+   *  (branches, jumps, predicted opcodes and system opcodes go alone) and
+   *  if it doesn't read the result of the first one. Its hazards with the
+   *  older opcodes only keep it in ID phase, it doesn't stall the pipeline.
+   */
+`ifdef DUAL_ISSUE
+  decoder decoder_1 (
+    .i_opcode_in (id1_ir),
+    .o_immediate (id1_imm),
+    .o_funct3    (id1_funct3),
+    .o_funct7    (id1_funct7),
+    .o_rs1       (id1_rs1),
+    .o_rs2       (id1_rs2),
+    .o_rd        (id1_rd),
+    .o_system    (id1_system),
+    .o_hz_rs1    (id1_hz_rs1),
+    .o_hz_rs2    (id1_hz_rs2),
+    .o_branch    (id1_branch),
+    .o_jump      (id1_jump),
+    .o_alu_pc    (id1_alu_pc),
+    .o_alu_imm   (id1_alu_imm),
+    .o_alu_en    (id1_alu_en),
+`ifdef B_EXTENSION
+    .o_bm_en     (id1_bm_en),
+`endif
+`ifdef A_EXTENSION
+    .o_atomic    (),
+`endif
+`ifdef TRAPS
+    .o_illegal   (),
+`endif
+`ifdef F_EXTENSION
+    .o_rs3       (),
+    .o_hz_rs3    (),
+    .o_fpu_en    (),
+    .o_fpu_op    (),
+`endif
+    .o_ma_wr     (id1_ma_wr),
+    .o_ma_rd     (id1_ma_rd),
+    .o_wb_mux    (id1_wb_mux),
+    .o_wb_en     (id1_wb_en)
+  );
+
+  hazard hazard_1 (
+    .i_hz_rs1     (id1_hz_rs1),
+    .i_hz_rs2     (id1_hz_rs2),
+    .i_rs1        (id1_rs1),
+    .i_rs2        (id1_rs2),
+    .i_ex_wb_reg  (ex_wb_reg),
+    .i_ma_wb_reg  (ma_wb_reg),
+    .i_wb_wb_reg  (wb_wb_reg),
+    .i_ex_wb_en   (ex_wb_en),
+    .i_ma_wb_en   (ma_wb_en),
+    .i_wb_wb_en   (wb_wb_en),
+`ifdef HAZARD_DATA_FORWARDNG
+    .i_ex_wb_mux  (ex_wb_mux),
+    .i_ma_wb_mux  (ma_wb_mux),
+    .i_ex_ret     (ex_ret),
+`ifdef HAZARD_EX_FORWARDING
+    .i_ex_res     (ex_res_dat),
+`endif
+    .i_ma_res     (ma_res),
+    .i_ma_rd_dat  (ma_ld_dat),
+    .i_ma_ret     (ma_ret),
+    .i_wb_wb_d    (wb_dat),
+`endif
+`ifdef HAZARD_SCOREBOARD
+    .i_rd         (id1_rd),
+    .i_wb_en      (id1_wb_en),
+`endif
+`ifdef MULDIV_SCOREBOARD
+    .i_md_en      (1'b0),
+    .i_md_hz_en   (md_hz_en),
+    .i_md_hz_reg  (md_hz_reg),
+`endif
+`ifdef F_EXTENSION
+    .i_system     (1'b0),
+    .i_fp_busy    (1'b0),
+    .i_fd_en      (1'b0),
+    .i_fd_hz_en   (fd_hz_en),
+    .i_fd_hz_reg  (fd_hz_reg),
+`endif
+    .i_ex1_wb_reg (ex1_wb_reg),
+    .i_ma1_wb_reg (ma1_wb_reg),
+    .i_wb1_wb_reg (wb1_wb_reg),
+    .i_ex1_wb_en  (ex1_wb_en),
+    .i_ma1_wb_en  (ma1_wb_en),
+    .i_wb1_wb_en  (wb1_wb_en),
+`ifdef HAZARD_DATA_FORWARDNG
+`ifdef HAZARD_EX_FORWARDING
+    .i_ex1_res    (ex1_res),
+`endif
+    .i_ma1_res    (ma1_res),
+    .i_wb1_wb_d   (wb1_wb_d),
+`endif
+    .i_pair_rd    (rd),
+    .i_pair_wb_en (wb_en),
+    .o_hz_pair    (id1_hz_pair),
+    .i_rs1_raw_d  (id1_rs1_raw_d),
+    .i_rs2_raw_d  (id1_rs2_raw_d),
+    .o_rs1_d      (id1_rs1_d),
+    .o_rs2_d      (id1_rs2_d),
+    .o_hz_data    (id1_hz_data)
   );
 
+  assign id1_md     = id1_alu_en && !id1_alu_imm && (id1_funct7 == 7'b0000001);
+  assign id1_shift  = id1_alu_en && (id1_funct3[1:0] == 2'b01);
+  assign id1_simple = id1_valid && id1_wb_en && (id1_wb_mux == 2'b00) &&
+    !id1_branch && !id1_jump && !id1_ma_wr && !id1_ma_rd && !id1_system &&
+`ifdef B_EXTENSION
+    !id1_bm_en &&
+`endif
+`ifndef BARREL_SHIFTER
+    !id1_shift &&
+`endif
+    !id1_md;
+
+  // Scoreboarded Mul/Div opcodes write back later than the second slot
+  assign id_pair   = |id_ir &&
+`ifdef BRANCH_PREDICTOR
+    !id_pred &&
+`endif
+`ifdef MULDIV_SCOREBOARD
+    !id_md_en &&
+`endif
+    !branch && !jump && !system;
+  assign id1_issue = id_pair && id1_simple && !id1_hz_data && !id1_hz_pair &&
+    !id_bubble;
+`endif
+
+  // Fetch redirect (EX phase has the priority, it has the older instruction,
+  //  traps and MRET go before the branches)
+  assign fetch_br_en   = trap_br_en || br_miss || id_jal_go || id_ras_redir;
+  assign fetch_br_addr =
+    (trap_br_en) ? trap_br_addr :
+    (br_miss)    ? br_addr :
+    (id_jal_go)  ? id_jal_addr : ras_top;
+
+  // Instruction in ID phase doesn't go to EX phase (bubble is sent instead),
+  //  with the fetch queue instruction bus wait only empties the queue
+`ifdef FETCH_QUEUE
+  assign id_bubble = hz_br || hz_data || br_miss || trap_br_en;
+`else
+  assign id_bubble = hz_br || hz_data || !i_ready_i || br_miss || trap_br_en;
+`endif
+
   ///////////////////////////////////////////////////////////////////////////
   // EXECUTE STAGE
   ///////////////////////////////////////////////////////////////////////////
@@ -267,7 +1004,7 @@ module cpu (
    * Execute Registers
    */
   always @(posedge i_clk) begin
-    if (i_rst || (clk_ce && (hz_br || hz_data || br_en))) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
       ex_rs1_d    <= 0;
       ex_rs2_d    <= 0;
       ex_imm      <= 0;
@@ -310,6 +1047,146 @@ module cpu (
     end
   end
 
+`ifdef F_EXTENSION
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_rs3_d  <= 0;
+      ex_fpu_en <= 0;
+      ex_fpu_op <= 0;
+    end else if (clk_ce) begin
+      ex_rs3_d  <= rs3_d;
+      ex_fpu_en <= fpu_en;
+      ex_fpu_op <= fpu_op;
+    end
+  end
+`endif
+
+  // Instruction in EX phase isn't a bubble (it retires when it leaves it)
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_valid <= 0;
+    end else if (clk_ce) begin
+      ex_valid <= |id_ir;
+    end
+  end
+
+`ifdef B_EXTENSION
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_bm_en <= 0;
+    end else if (clk_ce) begin
+      ex_bm_en <= bm_en;
+    end
+  end
+`endif
+
+`ifdef A_EXTENSION
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_atomic <= 0;
+    end else if (clk_ce) begin
+      ex_atomic <= atomic;
+    end
+  end
+`endif
+
+`ifdef TRAPS
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_illegal <= 0;
+    end else if (clk_ce) begin
+      ex_illegal <= illegal;
+    end
+  end
+`endif
+
+  // Second issue slot (bubble if the second instruction wasn't issued)
+`ifdef DUAL_ISSUE
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && !id1_issue)) begin
+      ex1_rs1_d   <= 0;
+      ex1_rs2_d   <= 0;
+      ex1_imm     <= 0;
+      ex1_pc      <= 0;
+      ex1_funct3  <= 0;
+      ex1_funct7  <= 0;
+      ex1_alu_pc  <= 0;
+      ex1_alu_imm <= 0;
+      ex1_alu_en  <= 0;
+      ex1_wb_reg  <= 0;
+      ex1_wb_en   <= 0;
+    end else if (clk_ce) begin
+      ex1_rs1_d   <= id1_rs1_d;
+      ex1_rs2_d   <= id1_rs2_d;
+      ex1_imm     <= id1_imm;
+      ex1_pc      <= id_ret;
+      ex1_funct3  <= id1_funct3;
+      ex1_funct7  <= id1_funct7;
+      ex1_alu_pc  <= id1_alu_pc;
+      ex1_alu_imm <= id1_alu_imm;
+      ex1_alu_en  <= id1_alu_en;
+      ex1_wb_reg  <= id1_rd;
+      ex1_wb_en   <= id1_wb_en;
+    end
+  end
+
+`ifdef TRACE_PORT
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && !id1_issue)) begin
+      ex1_ir <= 0;
+    end else if (clk_ce) begin
+      ex1_ir <= id1_ir;
+    end
+  end
+`endif
+`endif
+
+`ifdef DECODE_JAL
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_jal_done <= 0;
+    end else if (clk_ce) begin
+      ex_jal_done <= id_jal_go;
+    end
+  end
+`endif
+
+`ifdef TRACE_PORT
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_ir <= 0;
+    end else if (clk_ce) begin
+      ex_ir <= id_ir;
+    end
+  end
+`endif
+
+`ifdef RETURN_STACK
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_ras_pred <= 0;
+      ex_ras_addr <= 0;
+    end else if (clk_ce) begin
+      ex_ras_pred <= id_ras_go;
+      ex_ras_addr <= ras_top;
+    end
+  end
+`endif
+
+`ifdef BRANCH_PREDICTOR
+  always @(posedge i_clk) begin
+    if (i_rst || (clk_ce && id_bubble)) begin
+      ex_pred      <= 0;
+      ex_pred_addr <= 0;
+      ex_pred_idx  <= 0;
+    end else if (clk_ce) begin
+      ex_pred      <= id_pred;
+      ex_pred_addr <= id_pred_addr;
+      ex_pred_idx  <= id_pred_idx;
+    end
+  end
+`endif
+
   /**
    * Branch Conditioner
    */
@@ -322,6 +1199,35 @@ module cpu (
     .o_br_en  (br_en)
   );
 
+  /**
+   * Branch prediction verification
+   *  If the branch was predicted as taken in the fetch unit then the fetch
+   *  unit has to be corrected only if the branch wasn't actually taken (then
+   *  execution continues from the return address), or if the target was
+   *  different. Not predicted branches behave just like without predictor.
+   */
+`ifdef BRANCH_PREDICTOR
+  assign br_pred_miss = (ex_pred) ? (!br_en || (alu_out != ex_pred_addr)) : br_take;
+  assign br_addr = (br_en) ? alu_out : ex_ret;
+`else
+  assign br_pred_miss = br_take;
+  assign br_addr = alu_out;
+`endif
+
+  // Returns predicted with the return address stack only check the target
+`ifdef RETURN_STACK
+  assign br_miss = (ex_ras_pred) ? (alu_out != ex_ras_addr) : br_pred_miss;
+`else
+  assign br_miss = br_pred_miss;
+`endif
+
+  // Jumps already taken in ID phase don't redirect the fetch again
+`ifdef DECODE_JAL
+  assign br_take = br_en && !ex_jal_done;
+`else
+  assign br_take = br_en;
+`endif
+
   /**
    * Arythmetic and Logic Unit
    */
@@ -334,6 +1240,16 @@ module cpu (
     .i_funct7  (ex_funct7),
     .i_alu_en  (ex_alu_en),
     .i_alu_imm (ex_alu_imm),
+`ifdef B_EXTENSION
+    .i_bm_en   (ex_bm_en),
+`endif
+`ifdef POSEDGE_ONLY
+    .i_start   (first_cycle),
+`endif
+`ifdef MULDIV_SCOREBOARD
+    .i_md_result (md_result),
+    .o_md_en     (md_en),
+`endif
     .o_busy    (alu_busy),
     .o_alu_out (alu_out)
   );
@@ -341,6 +1257,106 @@ module cpu (
   assign alu_a_mux = (ex_alu_pc)  ? ex_pc  : ex_rs1_d;
   assign alu_b_mux = (ex_alu_imm) ? ex_imm : ex_rs2_d;
 
+  /**
+   * Second issue slot ALU (DUAL_ISSUE)
+   */
+`ifdef DUAL_ISSUE
+  alu_simple alu_1 (
+    .i_clk_n   (clk_n),
+    .i_rst     (i_rst),
+    .i_in_a    ((ex1_alu_pc)  ? ex1_pc  : ex1_rs1_d),
+    .i_in_b    ((ex1_alu_imm) ? ex1_imm : ex1_rs2_d),
+    .i_funct3  (ex1_funct3),
+    .i_funct7  (ex1_funct7),
+    .i_alu_en  (ex1_alu_en),
+    .i_alu_imm (ex1_alu_imm),
+    .o_alu_out (ex1_res)
+  );
+`endif
+
+  /**
+   * Mul/Div unit
+   *  Mul/Div opcodes that don't finish in the EX phase leave it without the
+   *  write back, the unit writes the result back when the WB slot is free
+   */
+`ifdef MULDIV_SCOREBOARD
+  mdunit mdunit_i (
+    .i_clk       (i_clk),
+    .i_clk_n     (clk_n),
+    .i_clk_ce    (clk_ce),
+    .i_rst       (i_rst),
+    .i_in_a      (alu_a_mux),
+    .i_in_b      (alu_b_mux),
+    .i_funct3    (ex_funct3),
+    .i_md_en     (md_en),
+`ifdef POSEDGE_ONLY
+    .i_start     (first_cycle),
+`endif
+    .i_ex_wb_reg (ex_wb_reg),
+    .i_wb_free   (!ma_wb_en || (ma_wb_reg == 0)),
+    .o_result    (md_result),
+    .o_ex_wait   (md_ex_wait),
+    .o_hz_en     (md_hz_en),
+    .o_hz_reg    (md_hz_reg),
+    .o_wb_en     (md_wb_en),
+    .o_wb_reg    (md_wb_reg)
+  );
+`endif
+
+  /**
+   * Floating-point units
+   *  FPU opcodes go through the two stage FPU along with the pipeline (the
+   *  result is ready in the MA phase), FDIV/FSQRT opcodes leave the EX phase
+   *  without the write back and the unit writes the result back when it's
+   *  done (after the Mul/Div unit, it has the priority)
+   */
+`ifdef F_EXTENSION
+  assign ex_fd_en = ex_fpu_en && (ex_fpu_op[4:2] == 3'b111);
+
+  fpu fpu_i (
+    .i_clk      (i_clk),
+    .i_clk_ce   (clk_ce),
+    .i_rst      (i_rst),
+    .i_in_a     (ex_rs1_d),
+    .i_in_b     (ex_rs2_d),
+    .i_in_c     (ex_rs3_d),
+    .i_op       (ex_fpu_op),
+    .i_rm       (ex_funct3),
+    .i_frm      (frm),
+    .i_fpu_en   (ex_fpu_en && !ex_fd_en),
+    .i_trap     (trap_go),
+    .o_result   (fpu_result),
+    .o_busy     (fpu_busy),
+    .o_flags_en (fpu_flags_en),
+    .o_flags    (fpu_flags)
+  );
+
+  fpdiv fpdiv_i (
+    .i_clk       (i_clk),
+    .i_clk_ce    (clk_ce),
+    .i_rst       (i_rst),
+    .i_in_a      (ex_rs1_d),
+    .i_in_b      (ex_rs2_d),
+    .i_sqrt      (ex_fpu_op[0]),
+    .i_rm        (ex_funct3),
+    .i_frm       (frm),
+    .i_fd_en     (ex_fd_en),
+    .i_ex_wb_reg (ex_wb_reg),
+`ifdef MULDIV_SCOREBOARD
+    .i_wb_free   ((!ma_wb_en || (ma_wb_reg == 0)) && !md_wb_en),
+`else
+    .i_wb_free   (!ma_wb_en || (ma_wb_reg == 0)),
+`endif
+    .o_result    (fd_result),
+    .o_flags     (fd_flags),
+    .o_ex_wait   (fd_ex_wait),
+    .o_hz_en     (fd_hz_en),
+    .o_hz_reg    (fd_hz_reg),
+    .o_wb_en     (fd_wb_en),
+    .o_wb_reg    (fd_wb_reg)
+  );
+`endif
+
   /**
    * Control and Status Registers
    */
@@ -358,13 +1374,21 @@ module cpu (
   wire        csr_wr;
   wire        csr_set;
   wire        csr_clr;
+`ifdef CSR_COUNTERS
+  wire [ 6:0] csr_events;
+`endif
 
   csr csr_i (
     .i_clk     (i_clk),
+    .i_rst     (i_rst),
+    .i_ce      (clk_ce),
     .i_rd      (csr_rd),
     .i_wr      (csr_wr),
     .i_set     (csr_set),
     .i_clr     (csr_clr),
+`ifdef MULTI_CORE
+    .i_hart_id (i_hart_id),
+`endif
 `ifdef CSR_EXTERNAL_BUS
     .o_ext_addr    (csr_ext_addr),
     .i_ext_rd_data (i_csr_rd_data),
@@ -374,15 +1398,85 @@ module cpu (
 `endif
     .i_addr    (ex_imm[11:0]),
     .i_wr_data (csr_wr_data),
+`ifdef CSR_COUNTERS
+    .i_events  (csr_events),
+`ifdef DUAL_ISSUE
+    .i_instret_2 (clk_ce && ex1_wb_en && !trap_go),
+`endif
+`endif
+`ifdef TRAPS
+    .i_irq        (i_irq),
+    .i_trap_valid (trap_valid),
+    .i_ecall      (ex_ecall),
+    .i_ebreak     (ex_ebreak),
+    .i_mret       (ex_mret),
+    .i_illegal    (ex_illegal),
+    .i_pc         (ex_pc),
+    .o_trap       (trap_go),
+    .o_br_en      (trap_br_en),
+    .o_br_addr    (trap_br_addr),
+`endif
+`ifdef F_EXTENSION
+    .i_fflags_en  (fpu_flags_en || (clk_ce && fd_wb_en)),
+    .i_fflags     ((fpu_flags & {5{fpu_flags_en}}) |
+      (fd_flags & {5{clk_ce && fd_wb_en}})),
+    .o_frm        (frm),
+`endif
     .o_rd_data (csr_rd_data)
   );
 
-  assign csr_wr_data = ex_funct3[2] ? {27'h0, ex_rs1} : ex_rs1_d;
-  assign csr_wr_en   = ex_system && (ex_rs1 != 5'b00000);
-  assign csr_rd      = ex_system && (ex_wb_reg != 5'b00000);
+  assign csr_wr_data = ex_funct3[2] ? {27'h0, ex_rs1[4:0]} : ex_rs1_d;
+  // CSRRW always writes (fsflags x0 clears the flags), CSRRS and CSRRC
+  //  with x0 (or zero immediate) only read
+  assign csr_wr_en   = ex_system && !trap_go;
+  assign csr_rd      = ex_system && (ex_wb_reg[4:0] != 5'b00000);
   assign csr_wr      = csr_wr_en && (ex_funct3[1:0] == 2'b01);
-  assign csr_set     = csr_wr_en && (ex_funct3[1:0] == 2'b10);
-  assign csr_clr     = csr_wr_en && (ex_funct3[1:0] == 2'b11);
+  assign csr_set     = csr_wr_en && (ex_funct3[1:0] == 2'b10) &&
+    (ex_rs1[4:0] != 5'b00000);
+  assign csr_clr     = csr_wr_en && (ex_funct3[1:0] == 2'b11) &&
+    (ex_rs1[4:0] != 5'b00000);
+
+  // Performance counter events (see counters.v)
+`ifdef CSR_COUNTERS
+  assign csr_events = {
+    clk_ce && (ma_rd || ma_wr),      // Loads and stores
+    i_clk_ce && alu_busy,            // ALU busy cycles
+    clk_ce && br_miss,               // Branch flushes
+    clk_ce && hz_data,               // Data hazard stalls
+    clk_ce && ex_valid && !trap_go,  // Retired instructions
+    1'b0,                            // Time (alias of cycles)
+    i_clk_ce                         // Cycles
+  };
+`endif
+
+  /**
+   * Machine mode traps
+   *  ECALL, EBREAK and MRET are system opcodes with funct3 000 (told apart
+   *  by the immediate). Trapped opcode is discarded when it leaves the EX
+   *  phase. Mul/Div opcodes aren't interrupted in the scoreboard mode (the
+   *  unit may already be running them), the next opcode is, same goes for
+   *  the FDIV/FSQRT opcodes.
+   */
+`ifdef TRAPS
+  assign ex_priv    = ex_system && (ex_funct3 == 3'b000);
+  assign ex_ecall   = ex_priv && (ex_imm[11:0] == 12'h000);
+  assign ex_ebreak  = ex_priv && (ex_imm[11:0] == 12'h001);
+  assign ex_mret    = ex_priv && (ex_imm[11:0] == 12'h302);
+  assign trap_valid =
+`ifdef MULDIV_SCOREBOARD
+    !md_en &&
+`endif
+`ifdef F_EXTENSION
+    !ex_fd_en &&
+`endif
+    ex_valid;
+`endif
+`endif
+
+`ifndef TRAPS
+  assign trap_go      = 1'b0;
+  assign trap_br_en   = 1'b0;
+  assign trap_br_addr = 0;
 `endif
 
   ///////////////////////////////////////////////////////////////////////////
@@ -408,26 +1502,95 @@ module cpu (
       ma_res    <= ex_res_dat;
       ma_ret    <= ex_ret;
       ma_funct3 <= ex_funct3;
-      ma_wr     <= ex_ma_wr;
-      ma_rd     <= ex_ma_rd;
+      ma_wr     <= ex_ma_wr && !trap_go;
+      ma_rd     <= ex_ma_rd && !trap_go;
       ma_wb_reg <= ex_wb_reg;
       ma_wb_mux <= ex_wb_mux;
-      ma_wb_en  <= ex_wb_en;
+      ma_wb_en  <= ex_wb_en &&
+`ifdef MULDIV_SCOREBOARD
+        !md_ex_wait &&
+`endif
+`ifdef F_EXTENSION
+        !fd_ex_wait &&
+`endif
+        !trap_go;
     end
   end
 
+`ifdef A_EXTENSION
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      ma_atomic <= 0;
+      ma_funct5 <= 0;
+    end else if (clk_ce) begin
+      ma_atomic <= ex_atomic;
+      ma_funct5 <= ex_funct7[6:2];
+    end
+  end
+`endif
+
+  // Second issue slot
+`ifdef DUAL_ISSUE
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      ma1_res    <= 0;
+      ma1_wb_reg <= 0;
+      ma1_wb_en  <= 0;
+    end else if (clk_ce) begin
+      ma1_res    <= ex1_res;
+      ma1_wb_reg <= ex1_wb_reg;
+      ma1_wb_en  <= ex1_wb_en && !trap_go;
+    end
+  end
+`endif
+
 `ifdef INCLUDE_CSR
   assign ex_res_dat = ex_system ? csr_rd_data : alu_out;
 `else
   assign ex_res_dat = alu_out;
 `endif
 
+  /**
+   * Load data keeping
+   *  The bit shifter and the Mul/Div circuitry start at the falling edge,
+   *  after the memory answered the load in MA phase, and stall the pipeline
+   *  from then on (the read is only requested while the core isn't stalled),
+   *  so the answer is kept until the pipeline advances
+   */
+`ifdef LOAD_DATA_KEEP
+  always @(posedge clk_n) begin
+    if (i_rst) begin
+      ma_rd_sent <= 0;
+    end else begin
+      ma_rd_sent <= ma_rd_en && i_ready_d;
+    end
+  end
+
+  always @(posedge i_clk) begin
+    if (i_rst || clk_ce) begin
+      ma_rd_keep <= 0;
+      ma_rd_kept <= 0;
+    end else if (ma_rd_sent) begin
+      ma_rd_keep <= 1;
+      ma_rd_kept <= i_data_rd_d;
+    end
+  end
+
+  assign ma_rd_bus = (ma_rd_keep) ? ma_rd_kept : i_data_rd_d;
+`else
+  assign ma_rd_bus = i_data_rd_d;
+`endif
+
   /**
    * Data Memory
    */
   memory memory_i (
-    .i_data_rd   (i_data_rd_d),
+    .i_data_rd   (ma_rd_bus),
+`ifdef A_EXTENSION
+    .i_data_wr   (at_data_wr),
+`else
     .i_data_wr   (ma_rs2_d),
+`endif
     .i_shift     (ma_res[1:0]),
     .i_length    (ma_funct3[1:0]),
     .i_signed_rd (!ma_funct3[2]),
@@ -436,8 +1599,50 @@ module cpu (
     .o_we        (ma_we)
   );
 
-  assign ma_wr_en = ma_we & {4{ma_wr & clk_ce}};
-  assign ma_rd_en = ma_rd & clk_ce;
+  /**
+   * Atomic memory operations
+   *  LR.W/SC.W reservation and AMO read-modify-write (AMO holds the pipeline
+   *  in its read cycle), SC.W status and AMO read data replace the load data
+   */
+`ifdef A_EXTENSION
+  atomic atomic_i (
+    .i_clk        (i_clk),
+    .i_rst        (i_rst),
+    .i_ce         (clk_ce),
+    .i_atomic     (ma_atomic),
+    .i_rd         (ma_rd),
+    .i_wr         (ma_wr),
+    .i_funct5     (ma_funct5),
+    .i_addr       (ma_res),
+    .i_data_wr    (ma_rs2_d),
+    .i_data_rd    (i_data_rd_d),
+    .i_rd_done    (ma_rd_en && i_ready_d),
+`ifdef MULTI_CORE
+    .i_snoop_wr   (i_snoop_wr),
+    .i_snoop_addr (i_snoop_addr),
+`endif
+    .o_rd_en      (at_rd_en),
+    .o_wr_en      (at_wr_en),
+    .o_wait       (at_wait),
+    .o_lock       (at_lock),
+    .o_data_wr    (at_data_wr),
+    .o_res_en     (at_res_en),
+    .o_res        (at_res)
+  );
+
+  assign ma_ld_dat = (at_res_en) ? at_res : ma_rd_dat;
+`else
+  assign ma_ld_dat = ma_rd_dat;
+`endif
+
+  // Requests can't depend on i_ready_d (it's the answer to them)
+`ifdef A_EXTENSION
+  assign ma_wr_en = ma_we & {4{ma_wr & core_ce & at_wr_en}};
+  assign ma_rd_en = ma_rd & core_ce & at_rd_en;
+`else
+  assign ma_wr_en = ma_we & {4{ma_wr & core_ce}};
+  assign ma_rd_en = ma_rd & core_ce;
+`endif
 
   ///////////////////////////////////////////////////////////////////////////
   // WRITE BACK STAGE
@@ -451,6 +1656,20 @@ module cpu (
       wb_wb_d   <= 0;
       wb_wb_reg <= 0;
       wb_wb_en  <= 0;
+`ifdef MULDIV_SCOREBOARD
+    end else if (clk_ce && md_wb_en) begin
+      // Mul/Div unit result takes the free write back slot
+      wb_wb_d   <= md_result;
+      wb_wb_reg <= md_wb_reg;
+      wb_wb_en  <= 1'b1;
+`endif
+`ifdef F_EXTENSION
+    end else if (clk_ce && fd_wb_en) begin
+      // FDIV/FSQRT unit result takes the free write back slot
+      wb_wb_d   <= fd_result;
+      wb_wb_reg <= fd_wb_reg;
+      wb_wb_en  <= 1'b1;
+`endif
     end else if (clk_ce) begin
       wb_wb_d   <= wb_dat_mux;
       wb_wb_reg <= ma_wb_reg;
@@ -458,21 +1677,170 @@ module cpu (
     end
   end
 
+  // Second issue slot (written through the second register file port)
+`ifdef DUAL_ISSUE
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      wb1_wb_d   <= 0;
+      wb1_wb_reg <= 0;
+      wb1_wb_en  <= 0;
+    end else if (clk_ce) begin
+      wb1_wb_d   <= ma1_res;
+      wb1_wb_reg <= ma1_wb_reg;
+      wb1_wb_en  <= ma1_wb_en;
+    end
+  end
+`endif
+
+  /**
+   * FPU result (F_EXTENSION)
+   *  FPU rounds the result in WB phase, so only the source is registered
+   */
+`ifdef F_EXTENSION
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      wb_fpu <= 0;
+`ifdef MULDIV_SCOREBOARD
+    end else if (clk_ce && md_wb_en) begin
+      wb_fpu <= 0;
+`endif
+    end else if (clk_ce && fd_wb_en) begin
+      wb_fpu <= 0;
+    end else if (clk_ce) begin
+      wb_fpu <= (ma_wb_mux == 2'b11);
+    end
+  end
+
+  assign wb_res = (wb_fpu) ? fpu_result : wb_wb_d;
+`else
+  assign wb_res = wb_wb_d;
+`endif
+
+  /**
+   * Load data (POSEDGE_ONLY)
+   *  Memory is read at the end of MA phase, so the load data arrives in WB
+   *  phase, it's only valid in the first cycle of WB phase so it's held in
+   *  the register if the pipeline is stalled.
+   */
+`ifdef POSEDGE_ONLY
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      wb_shift   <= 0;
+      wb_funct3  <= 0;
+      wb_load    <= 0;
+`ifdef MULDIV_SCOREBOARD
+    end else if (clk_ce && md_wb_en) begin
+      wb_load    <= 0;
+`endif
+`ifdef F_EXTENSION
+    end else if (clk_ce && fd_wb_en) begin
+      wb_load    <= 0;
+`endif
+    end else if (clk_ce) begin
+      wb_shift   <= ma_res[1:0];
+      wb_funct3  <= ma_funct3;
+`ifdef A_EXTENSION
+      wb_load    <= (ma_wb_mux == 2'b01) && !at_res_en;
+`else
+      wb_load    <= (ma_wb_mux == 2'b01);
+`endif
+    end
+    if (first_cycle) begin
+      wb_rd_hold <= i_data_rd_d;
+    end
+  end
+
+  assign wb_rd_raw = (first_cycle) ? i_data_rd_d : wb_rd_hold;
+
+  memory memory_wb_i (
+    .i_data_rd   (wb_rd_raw),
+    .i_data_wr   (32'd0),
+    .i_shift     (wb_shift),
+    .i_length    (wb_funct3[1:0]),
+    .i_signed_rd (!wb_funct3[2]),
+    .o_data_rd   (wb_rd_dat),
+    .o_data_wr   (),
+    .o_we        ()
+  );
+
+  assign wb_dat = (wb_load) ? wb_rd_dat : wb_res;
+`else
+  assign wb_dat = wb_res;
+`endif
+
 `ifdef HARDWARE_TIPS
   (* parallel_case *)
 `endif
   always @* begin
     case (ma_wb_mux)
       default: wb_dat_mux = ma_res;
-      2'b01:   wb_dat_mux = ma_rd_dat;
+      2'b01:   wb_dat_mux = ma_ld_dat;
       2'b10:   wb_dat_mux = ma_ret;
     endcase
   end
 
+  ///////////////////////////////////////////////////////////////////////////
+  // TRACE PORT
+  ///////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Trace port
+   *  Every instruction leaving the EX phase is reported along with the number
+   *  of cycles since the previous one and the reasons of the stalls and
+   *  bubbles seen in these cycles. Bubbles caused in the cycle in which the
+   *  instruction leaves go to the next one (that's the one they delay).
+   *  With DUAL_ISSUE the instruction in the second slot is reported next to
+   *  the first one, it doesn't take any cycles of its own.
+   */
+`ifdef TRACE_PORT
+  reg  [15:0] trace_cycles;
+  reg  [ 5:0] trace_cause;
+  wire [ 5:0] trace_cause_now;
+  wire        trace_valid;
+
+  assign trace_valid = clk_ce && ex_valid;
+
+  assign trace_cause_now = {
+    core_ce && !i_ready_d,
+    i_clk_ce && alu_busy,
+    clk_ce && !i_ready_i,
+    clk_ce && br_miss,
+    clk_ce && hz_br,
+    clk_ce && hz_data
+  };
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      trace_cycles <= 1;
+      trace_cause  <= 0;
+    end else if (trace_valid) begin
+      trace_cycles <= 1;
+      trace_cause  <= trace_cause_now;
+    end else if (i_clk_ce) begin
+      if (!(&trace_cycles)) begin
+        trace_cycles <= trace_cycles + 16'd1;
+      end
+      trace_cause  <= trace_cause | trace_cause_now;
+    end
+  end
+
+  assign o_trace_valid  = trace_valid;
+  assign o_trace_pc     = ex_pc;
+  assign o_trace_ir     = ex_ir;
+  assign o_trace_cycles = trace_cycles;
+  assign o_trace_cause  = trace_cause;
+
+`ifdef DUAL_ISSUE
+  assign o_trace1_valid = trace_valid && ex1_wb_en;
+  assign o_trace1_pc    = ex1_pc;
+  assign o_trace1_ir    = ex1_ir;
+`endif
+`endif
+
   /**
    * Output assignment
    */
-  assign o_addr_i = if_pc;
+  assign o_addr_i = if_addr;
   assign o_rd_d   = ma_rd_en;
   assign o_wr_d   = ma_wr_en;
 
@@ -484,6 +1852,12 @@ module cpu (
   assign o_data_wr_d = ma_wr_dat;
 `endif
 
+`ifdef MULTI_CORE
+`ifdef A_EXTENSION
+  assign o_lock_d = at_lock;
+`endif
+`endif
+
 `ifdef CSR_EXTERNAL_BUS
   assign o_csr_addr    = csr_ext_addr;
   assign o_csr_wr_data = csr_ext_wr_data;
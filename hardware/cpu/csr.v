@@ -8,10 +8,13 @@
  * files. There is also an interface routed outside the CPU.
  *
  * i_clk         - Clock input
+ * i_rst         - Reset input
+ * i_ce          - Clock enable (CSR writes are only done when it's set)
  * i_rd          - Read enable input
  * i_wr          - Write enable input
  * i_set         - Bit set input
  * i_clr         - Bit clr input
+ * i_hart_id     - Index of the core in the cluster (MULTI_CORE only)
  *
  * o_ext_addr    - External CSR bus address bus
  * i_ext_rd_data - External CSR bus data input bus
@@ -22,11 +25,37 @@
  * i_addr        - CSR address input
  * i_wr_data     - CSR write data input
  * o_rd_data     - CSR read data output
+ *
+ * i_events      - Performance counter events (see counters.v)
+ * i_instret_2   - Two instructions retired in this cycle (DUAL_ISSUE only)
+ *
+ * Trap interface (TRAPS only, see trap.v):
+ *
+ * i_irq         - External interrupt input
+ * i_trap_valid  - Opcode in EX phase can be trapped
+ * i_ecall       - ECALL in EX phase
+ * i_ebreak      - EBREAK in EX phase
+ * i_mret        - MRET in EX phase
+ * i_illegal     - Illegal opcode in EX phase
+ * i_pc          - Address of the opcode in EX phase
+ * o_trap        - Trap is taken (opcode in EX phase is discarded)
+ * o_br_en       - Fetch redirect (trap or MRET)
+ * o_br_addr     - Fetch redirect address
+ *
+ * Floating-point CSRs (F_EXTENSION only):
+ *
+ * i_fflags_en   - Accrue the FPU exception flags
+ * i_fflags      - FPU exception flags (NV DZ OF UF NX)
+ * o_frm         - Dynamic rounding mode
  ***************************************************************************/
 `include "config.v"
 
 module csr (
   input         i_clk,
+  // verilator lint_off unused
+  input         i_rst,
+  input         i_ce,
+  // verilator lint_on unused
 
   // verilator lint_off unused
   input         i_rd,
@@ -35,6 +64,10 @@ module csr (
   input         i_set,
   input         i_clr,
 
+`ifdef MULTI_CORE
+  input  [ 7:0] i_hart_id,
+`endif
+
 `ifdef CSR_EXTERNAL_BUS
   output [11:0] o_ext_addr,
   input  [31:0] i_ext_rd_data,
@@ -45,11 +78,54 @@ module csr (
 
   input  [11:0] i_addr,
   input  [31:0] i_wr_data,
+`ifdef CSR_COUNTERS
+  input  [ 6:0] i_events,
+`ifdef DUAL_ISSUE
+  input         i_instret_2,
+`endif
+`endif
+`ifdef TRAPS
+  input         i_irq,
+  input         i_trap_valid,
+  input         i_ecall,
+  input         i_ebreak,
+  input         i_mret,
+  input         i_illegal,
+  input  [31:0] i_pc,
+  output        o_trap,
+  output        o_br_en,
+  output [31:0] o_br_addr,
+`endif
+`ifdef F_EXTENSION
+  input         i_fflags_en,
+  input  [ 4:0] i_fflags,
+  output [ 2:0] o_frm,
+`endif
   output [31:0] o_rd_data
 );
 
   // Read circuitry
+  wire [31:0] misa;
   reg  [31:0] read_data;
+  wire [31:0] ext_data;
+  wire [31:0] cnt_data;
+  wire [31:0] other_data;
+`ifdef CSR_COUNTERS
+  wire [31:0] cnt_rd_data;
+  wire        cnt_hit;
+`endif
+`ifdef TRAPS
+  wire [31:0] trap_rd_data;
+  wire        trap_hit;
+`endif
+
+`ifdef F_EXTENSION
+  // Floating-point CSRs
+  reg  [ 4:0] fflags;
+  reg  [ 2:0] frm;
+  wire        fflags_wr;
+  wire        frm_wr;
+`endif
 
   // Write circuitry
   wire        write_enable;
@@ -57,24 +133,63 @@ module csr (
   wire [31:0] clr_data;
   wire [31:0] write_data;
 
+  /**
+   * Optional extensions in misa
+   */
+  assign misa = `CSR_MISA
+`ifdef A_EXTENSION
+    | 32'h00000001
+`endif
+`ifdef B_EXTENSION
+    | 32'h00000002
+`endif
+`ifdef F_EXTENSION
+    | 32'h00000020
+`endif
+    ;
+
   /**
    * Read from currently selected CSR
    */
   always @* begin
     case (i_addr)
-      12'h301: read_data = `CSR_MISA;
+      12'h301: read_data = misa;
+`ifdef F_EXTENSION
+      12'h001: read_data = {27'd0, fflags};
+      12'h002: read_data = {29'd0, frm};
+      12'h003: read_data = {24'd0, frm, fflags};
+`endif
       12'hF11: read_data = `CSR_MVENDORID;
       12'hF12: read_data = `CSR_MARCHID;
       12'hF13: read_data = `CSR_MIMPID;
-      12'hF14: read_data = `CSR_MHARTID;
-`ifdef CSR_EXTERNAL_BUS
-      default: read_data = i_ext_rd_data;
+`ifdef MULTI_CORE
+      12'hF14: read_data = `CSR_MHARTID + {24'd0, i_hart_id};
 `else
-      default: read_data = 0;
+      12'hF14: read_data = `CSR_MHARTID;
 `endif
+      default: read_data = other_data;
     endcase
   end
 
+  // CSRs located in the other files
+`ifdef CSR_EXTERNAL_BUS
+  assign ext_data = i_ext_rd_data;
+`else
+  assign ext_data = 0;
+`endif
+
+`ifdef CSR_COUNTERS
+  assign cnt_data = (cnt_hit) ? cnt_rd_data : ext_data;
+`else
+  assign cnt_data = ext_data;
+`endif
+
+`ifdef TRAPS
+  assign other_data = (trap_hit) ? trap_rd_data : cnt_data;
+`else
+  assign other_data = cnt_data;
+`endif
+
   /**
    * Generate the write data
    */
@@ -99,10 +214,87 @@ module csr (
     end
   end
 
+  /**
+   * Floating-point CSRs
+   *  Flags of the finishing FP opcodes accrue when fflags isn't written
+   *  (system opcodes wait for the FP opcodes, so they don't overlap anyway),
+   *  fcsr (0x003) holds both of the registers
+   */
+`ifdef F_EXTENSION
+  assign fflags_wr = write_enable && i_ce &&
+    ((i_addr == 12'h001) || (i_addr == 12'h003));
+  assign frm_wr = write_enable && i_ce &&
+    ((i_addr == 12'h002) || (i_addr == 12'h003));
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      fflags <= 0;
+      frm    <= 0;
+    end else begin
+      if (fflags_wr) begin
+        fflags <= write_data[4:0];
+      end else if (i_fflags_en) begin
+        fflags <= fflags | i_fflags;
+      end
+      if (frm_wr) begin
+        frm <= (i_addr[0]) ? write_data[7:5] : write_data[2:0];
+      end
+    end
+  end
+`endif
+
+  /**
+   * Performance counters
+   */
+`ifdef CSR_COUNTERS
+  counters counters_i (
+    .i_clk     (i_clk),
+    .i_rst     (i_rst),
+    .i_wr      (write_enable && i_ce),
+    .i_addr    (i_addr),
+    .i_wr_data (write_data),
+    .i_events  (i_events),
+`ifdef DUAL_ISSUE
+    .i_instret_2 (i_instret_2),
+`endif
+    .o_rd_data (cnt_rd_data),
+    .o_hit     (cnt_hit)
+  );
+`endif
+
+  /**
+   * Machine mode traps
+   */
+`ifdef TRAPS
+  trap trap_i (
+    .i_clk     (i_clk),
+    .i_rst     (i_rst),
+    .i_ce      (i_ce),
+    .i_wr      (write_enable && i_ce),
+    .i_addr    (i_addr),
+    .i_wr_data (write_data),
+    .i_irq     (i_irq),
+    .i_valid   (i_trap_valid),
+    .i_ecall   (i_ecall),
+    .i_ebreak  (i_ebreak),
+    .i_mret    (i_mret),
+    .i_illegal (i_illegal),
+    .i_pc      (i_pc),
+    .o_trap    (o_trap),
+    .o_br_en   (o_br_en),
+    .o_br_addr (o_br_addr),
+    .o_rd_data (trap_rd_data),
+    .o_hit     (trap_hit)
+  );
+`endif
+
   /**
    * Output assignment
    */
   assign o_rd_data = read_data;
+`ifdef F_EXTENSION
+  assign o_frm     = frm;
+`endif
 
 `ifdef CSR_EXTERNAL_BUS
   assign o_ext_addr    = i_addr;
@@ -0,0 +1,386 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: dcache.v
+ *
+ * This file contains the direct mapped write-back data cache with a store
+ * buffer, placed between the data port of the CPU and the slower backing
+ * memory bus. Its size is set with DCACHE_SET_BITS, DCACHE_LINE_BITS and
+ * DCACHE_SB_BITS options in config.v. Arrays are asynchronous (distributed
+ * RAM), so loads that hit the cache are ready in the same cycle.
+ *
+ * Stores are never written into the cache directly, they are put into the
+ * store buffer (FIFO) and retire right away unless the buffer is full. The
+ * buffer is drained in the background, stores that hit the cache are
+ * written into the line (line becomes dirty), stores that miss allocate the
+ * line first (write-back of the dirty victim, then refill). Loads from the
+ * address that is still in the store buffer wait until it's drained.
+ *
+ * Addresses from DCACHE_UNCACHED up are not cached (I/O space), stores go
+ * through the store buffer in order, loads wait for the store buffer to be
+ * empty and then read the bus directly.
+ *
+ * Backing bus works on the rising edge of the clock: address, data and
+ * request are held until the memory answers with i_mem_ready, then the
+ * next request may start at once, memory can take as many cycles as it
+ * needs (zero wait state memory may just return the request as ready).
+ *
+ * i_clk         - Clock input
+ * i_rst         - Reset input
+ *
+ * i_addr        - CPU data address
+ * i_rd          - CPU read request
+ * i_wr          - CPU write request (byte enables)
+ * i_data_wr     - CPU write data (already shifted to the byte lanes)
+ * o_data_rd     - CPU read data (whole word)
+ * o_ready       - Request is done (load data is valid or store accepted)
+ *
+ * o_mem_addr    - Backing memory address
+ * o_mem_data_wr - Backing memory write data
+ * o_mem_wr      - Backing memory write request (byte enables)
+ * o_mem_rd      - Backing memory read request
+ * i_mem_data_rd - Backing memory read data
+ * i_mem_ready   - Backing memory request is done
+ *
+ * o_hits        - Number of loads that hit the cache
+ * o_misses      - Number of line refills
+ ***************************************************************************/
+`include "config.v"
+
+module dcache (
+  input         i_clk,
+  input         i_rst,
+
+  input  [31:0] i_addr,
+  input         i_rd,
+  input  [ 3:0] i_wr,
+  input  [31:0] i_data_wr,
+  output [31:0] o_data_rd,
+  output        o_ready,
+
+  output [31:0] o_mem_addr,
+  output [31:0] o_mem_data_wr,
+  output [ 3:0] o_mem_wr,
+  output        o_mem_rd,
+  input  [31:0] i_mem_data_rd,
+  input         i_mem_ready,
+
+  output [31:0] o_hits,
+  output [31:0] o_misses
+);
+
+  localparam SETS = (1 << `DCACHE_SET_BITS);
+  localparam WORDS = (1 << `DCACHE_LINE_BITS);
+  localparam OFFSET_BITS = `DCACHE_LINE_BITS + 2;
+  localparam INDEX_BITS = `DCACHE_SET_BITS + `DCACHE_LINE_BITS;
+  localparam TAG_BITS = 32 - `DCACHE_SET_BITS - OFFSET_BITS;
+  localparam SB_SIZE = (1 << `DCACHE_SB_BITS);
+
+  localparam [2:0]
+    S_IDLE    = 0,
+    S_EVICT   = 1,
+    S_REFILL  = 2,
+    S_IO_RD   = 3,
+    S_IO_DONE = 4,
+    S_IO_WR   = 5;
+
+  // Cache arrays
+`ifdef HARDWARE_TIPS
+  (* ram_style = "distributed" *)
+`endif
+  reg   [7:0] data_0 [0:SETS*WORDS-1];
+`ifdef HARDWARE_TIPS
+  (* ram_style = "distributed" *)
+`endif
+  reg   [7:0] data_1 [0:SETS*WORDS-1];
+`ifdef HARDWARE_TIPS
+  (* ram_style = "distributed" *)
+`endif
+  reg   [7:0] data_2 [0:SETS*WORDS-1];
+`ifdef HARDWARE_TIPS
+  (* ram_style = "distributed" *)
+`endif
+  reg   [7:0] data_3 [0:SETS*WORDS-1];
+`ifdef HARDWARE_TIPS
+  (* ram_style = "distributed" *)
+`endif
+  reg  [TAG_BITS-1:0] tag [0:SETS-1];
+  reg  [SETS-1:0] valid;
+  reg  [SETS-1:0] dirty;
+
+  // Array access
+  wire [INDEX_BITS-1:0] rd_idx;
+  wire [31:0] rd_data;
+  wire [INDEX_BITS-1:0] wr_idx;
+  wire [31:0] wr_data;
+  wire  [3:0] wr_en;
+
+  // Store buffer
+  reg  [29:0] sb_addr [0:SB_SIZE-1];
+  reg  [31:0] sb_data [0:SB_SIZE-1];
+  reg   [3:0] sb_be   [0:SB_SIZE-1];
+  reg  [SB_SIZE-1:0] sb_valid;
+  reg  [`DCACHE_SB_BITS:0] sb_head;
+  reg  [`DCACHE_SB_BITS:0] sb_tail;
+  wire [`DCACHE_SB_BITS-1:0] sb_h;
+  wire [`DCACHE_SB_BITS-1:0] sb_t;
+  wire        sb_empty;
+  wire        sb_full;
+  wire        sb_push;
+  wire        sb_pop;
+  reg         sb_match;
+
+  // Store buffer head (the oldest store)
+  wire [31:0] head_addr;
+  wire [`DCACHE_SET_BITS-1:0] head_set;
+  wire        head_io;
+  wire        head_hit;
+  wire        drain_hit;
+
+  // CPU request
+  wire [`DCACHE_SET_BITS-1:0] cpu_set;
+  wire        cpu_io;
+  wire        cpu_hit;
+  wire        ld_ready;
+  wire        st_ready;
+
+  // State machine
+  reg   [2:0] state;
+  reg  [31:0] line_addr;
+  reg  [31:0] fsm_addr;
+  reg  [31:0] io_data;
+  wire [`DCACHE_SET_BITS-1:0] line_set;
+  wire        fsm_last;
+
+  // Statistics
+  reg  [31:0] hits;
+  reg  [31:0] misses;
+
+
+  /**
+   * Cache arrays
+   *  Reads are asynchronous, read address comes from the CPU except for
+   *  the victim write-back, writes come from the store buffer (drain) or
+   *  from the backing memory (refill).
+   */
+  always @(posedge i_clk) begin
+    if (wr_en[0]) data_0[wr_idx] <= wr_data[ 7: 0];
+    if (wr_en[1]) data_1[wr_idx] <= wr_data[15: 8];
+    if (wr_en[2]) data_2[wr_idx] <= wr_data[23:16];
+    if (wr_en[3]) data_3[wr_idx] <= wr_data[31:24];
+  end
+
+  // Tag is written with the last word of the refill
+  always @(posedge i_clk) begin
+    if (state == S_REFILL && i_mem_ready && fsm_last) begin
+      tag[line_set] <= line_addr[31:32-TAG_BITS];
+    end
+  end
+
+  assign rd_idx = (state == S_EVICT) ?
+    fsm_addr[2 +: INDEX_BITS] : i_addr[2 +: INDEX_BITS];
+  assign rd_data = {
+    data_3[rd_idx],
+    data_2[rd_idx],
+    data_1[rd_idx],
+    data_0[rd_idx]
+  };
+
+  assign wr_idx = (drain_hit) ?
+    head_addr[2 +: INDEX_BITS] : fsm_addr[2 +: INDEX_BITS];
+  assign wr_data = (drain_hit) ? sb_data[sb_h] : i_mem_data_rd;
+  assign wr_en =
+    (drain_hit) ? sb_be[sb_h] :
+    (state == S_REFILL && i_mem_ready) ? 4'b1111 : 4'b0000;
+
+  /**
+   * Store buffer
+   *  Head and tail pointers have an additional bit to tell the full buffer
+   *  from the empty one, every entry has a valid bit for the load matching.
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      sb_valid <= 0;
+      sb_head  <= 0;
+      sb_tail  <= 0;
+    end else begin
+      if (sb_push) begin
+        sb_addr[sb_t]  <= i_addr[31:2];
+        sb_data[sb_t]  <= i_data_wr;
+        sb_be[sb_t]    <= i_wr;
+        sb_valid[sb_t] <= 1'b1;
+        sb_tail        <= sb_tail + 1'd1;
+      end
+      if (sb_pop) begin
+        sb_valid[sb_h] <= 1'b0;
+        sb_head        <= sb_head + 1'd1;
+      end
+    end
+  end
+
+  assign sb_h = sb_head[`DCACHE_SB_BITS-1:0];
+  assign sb_t = sb_tail[`DCACHE_SB_BITS-1:0];
+  assign sb_empty = (sb_head == sb_tail);
+  assign sb_full = (sb_h == sb_t) && !sb_empty;
+  assign sb_push = |i_wr && !sb_full;
+  assign sb_pop = drain_hit || (state == S_IO_WR && i_mem_ready);
+
+  // Load address matching any of the buffered stores (same word)
+  always @* begin
+    sb_match = 0;
+    for (integer i = 0; i < SB_SIZE; i = i + 1) begin
+      if (sb_valid[i] && (sb_addr[i] == i_addr[31:2])) sb_match = 1;
+    end
+  end
+
+  // Oldest store is written into the cache if its line is present
+  assign head_addr = { sb_addr[sb_h], 2'b00 };
+  assign head_set = head_addr[OFFSET_BITS +: `DCACHE_SET_BITS];
+  assign head_io = (head_addr >= `DCACHE_UNCACHED);
+  assign head_hit = valid[head_set] &&
+    (tag[head_set] == head_addr[31:32-TAG_BITS]);
+  assign drain_hit = (state == S_IDLE) && !sb_empty && !head_io && head_hit;
+
+  /**
+   * CPU request
+   */
+  assign cpu_set = i_addr[OFFSET_BITS +: `DCACHE_SET_BITS];
+  assign cpu_io = (i_addr >= `DCACHE_UNCACHED);
+  assign cpu_hit = valid[cpu_set] &&
+    (tag[cpu_set] == i_addr[31:32-TAG_BITS]);
+
+  assign ld_ready = (cpu_io) ? (state == S_IO_DONE) :
+    ((state == S_IDLE) && cpu_hit && !sb_match);
+  assign st_ready = !sb_full;
+
+  /**
+   * State machine
+   *  Drain of the store buffer hits has the priority (it doesn't need the
+   *  state machine), then the load misses, uncached loads (only when the
+   *  store buffer is empty), uncached stores and store misses. Line refill
+   *  is preceded by the write-back of the victim line if it's dirty.
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      state     <= S_IDLE;
+      line_addr <= 0;
+      fsm_addr  <= 0;
+      io_data   <= 0;
+      valid     <= 0;
+      dirty     <= 0;
+      misses    <= 0;
+    end else begin
+      case (state)
+        S_IDLE: begin
+          if (drain_hit) begin
+            dirty[head_set] <= 1'b1;
+          end else if (i_rd && !cpu_io && !cpu_hit && !sb_match) begin
+            line_addr <= { i_addr[31:OFFSET_BITS], {OFFSET_BITS{1'b0}} };
+            misses <= misses + 32'd1;
+            if (valid[cpu_set] && dirty[cpu_set]) begin
+              state <= S_EVICT;
+              fsm_addr <= { tag[cpu_set], cpu_set, {OFFSET_BITS{1'b0}} };
+            end else begin
+              state <= S_REFILL;
+              fsm_addr <= { i_addr[31:OFFSET_BITS], {OFFSET_BITS{1'b0}} };
+              valid[cpu_set] <= 1'b0;
+            end
+          end else if (i_rd && cpu_io && sb_empty) begin
+            state <= S_IO_RD;
+            fsm_addr <= { i_addr[31:2], 2'b00 };
+          end else if (!sb_empty && head_io) begin
+            state <= S_IO_WR;
+          end else if (!sb_empty) begin
+            line_addr <= { head_addr[31:OFFSET_BITS], {OFFSET_BITS{1'b0}} };
+            misses <= misses + 32'd1;
+            if (valid[head_set] && dirty[head_set]) begin
+              state <= S_EVICT;
+              fsm_addr <= { tag[head_set], head_set, {OFFSET_BITS{1'b0}} };
+            end else begin
+              state <= S_REFILL;
+              fsm_addr <= { head_addr[31:OFFSET_BITS], {OFFSET_BITS{1'b0}} };
+              valid[head_set] <= 1'b0;
+            end
+          end
+        end
+
+        S_EVICT: begin
+          if (i_mem_ready) begin
+            fsm_addr <= fsm_addr + 32'd4;
+            if (fsm_last) begin
+              state <= S_REFILL;
+              fsm_addr <= line_addr;
+              valid[line_set] <= 1'b0;
+              dirty[line_set] <= 1'b0;
+            end
+          end
+        end
+
+        S_REFILL: begin
+          if (i_mem_ready) begin
+            fsm_addr <= fsm_addr + 32'd4;
+            if (fsm_last) begin
+              state <= S_IDLE;
+              valid[line_set] <= 1'b1;
+              dirty[line_set] <= 1'b0;
+            end
+          end
+        end
+
+        S_IO_RD: begin
+          if (i_mem_ready) begin
+            state <= S_IO_DONE;
+            io_data <= i_mem_data_rd;
+          end
+        end
+
+        S_IO_DONE: begin
+          if (i_rd && cpu_io) begin
+            state <= S_IDLE;
+          end
+        end
+
+        S_IO_WR: begin
+          if (i_mem_ready) begin
+            state <= S_IDLE;
+          end
+        end
+
+        default: begin
+          state <= S_IDLE;
+        end
+      endcase
+    end
+  end
+
+  assign line_set = line_addr[OFFSET_BITS +: `DCACHE_SET_BITS];
+  assign fsm_last = &fsm_addr[2 +: `DCACHE_LINE_BITS];
+
+  /**
+   * Statistics
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      hits <= 0;
+    end else if (i_rd && !cpu_io && ld_ready) begin
+      hits <= hits + 32'd1;
+    end
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_data_rd = (cpu_io) ? io_data : rd_data;
+  assign o_ready = (|i_wr) ? st_ready : (i_rd) ? ld_ready : 1'b1;
+
+  assign o_mem_addr = (state == S_IO_WR) ? head_addr : fsm_addr;
+  assign o_mem_data_wr = (state == S_IO_WR) ? sb_data[sb_h] : rd_data;
+  assign o_mem_wr =
+    (state == S_EVICT) ? 4'b1111 :
+    (state == S_IO_WR) ? sb_be[sb_h] : 4'b0000;
+  assign o_mem_rd = (state == S_REFILL) || (state == S_IO_RD);
+
+  assign o_hits = hits;
+  assign o_misses = misses;
+
+endmodule
@@ -11,6 +11,10 @@
  * on the format immediate decoded earlier (immediate_x) is selected. Finally
  * from the operation signal internal CPU control signals are generated and
  * (when using C set) the register select and funct signals are multiplexed.
+ * With F_EXTENSION the register indexes have the 6th bit that selects the
+ * FP register file (f0 isn't zero), FP loads and stores go through the
+ * normal memory path, all other FP opcodes go to the FPU (see fpu.v) and
+ * write back its result (write back source 3).
  *
  * i_opcode_in - Instruction from fetch unit
  *
@@ -23,11 +27,18 @@
  * o_rd        - RD register
  * o_hz_rs1    - Data hazard enable for RS1
  * o_hz_rs2    - Data hazard enable for RS2
+ * o_rs3       - RS3 register (F_EXTENSION only)
+ * o_hz_rs3    - Data hazard enable for RS3 (F_EXTENSION only)
+ * o_fpu_en    - FPU operation (F_EXTENSION only)
+ * o_fpu_op    - FPU operation selection (see fpu.v, 1C FDIV, 1D FSQRT)
  * o_branch    - Branch enable (conditional jump)
  * o_jump      - Jump enable (unconditional branch)
  * o_alu_pc    - Use PC as ALU A input
  * o_alu_imm   - Use immediate as ALU B input
  * o_alu_en    - ALU enable (If disabled ALU performs addition)
+ * o_bm_en     - Bit-manipulation operation (B_EXTENSION only)
+ * o_atomic    - Atomic memory operation (A_EXTENSION only)
+ * o_illegal   - Opcode isn't valid (TRAPS only, bubbles aren't illegal)
  * o_ma_wr     - Memory write enable
  * o_ma_rd     - Memory read enable
  * o_wb_mux    - Write back source selection
@@ -44,19 +55,35 @@ module decoder (
 
   output        o_system,
 
-  output [ 4:0] o_rs1,
-  output [ 4:0] o_rs2,
-  output [ 4:0] o_rd,
+  output [`REG_BITS-1:0] o_rs1,
+  output [`REG_BITS-1:0] o_rs2,
+  output [`REG_BITS-1:0] o_rd,
 
   output        o_hz_rs1,
   output        o_hz_rs2,
 
+`ifdef F_EXTENSION
+  output [ 5:0] o_rs3,
+  output        o_hz_rs3,
+  output        o_fpu_en,
+  output [ 4:0] o_fpu_op,
+`endif
+
   output        o_branch,
   output        o_jump,
 
   output        o_alu_pc,
   output        o_alu_imm,
   output        o_alu_en,
+`ifdef B_EXTENSION
+  output        o_bm_en,
+`endif
+`ifdef A_EXTENSION
+  output        o_atomic,
+`endif
+`ifdef TRAPS
+  output        o_illegal,
+`endif
 
   output        o_ma_wr,
   output        o_ma_rd,
@@ -99,6 +126,16 @@ module decoder (
   wire op_jalr       = quad3 && (opcode == 5'b11001);
   wire op_jal        = quad3 && (opcode == 5'b11011);
   wire op_system     = quad3 && (opcode == 5'b11100);
+  wire op_misc_mem   = quad3 && (opcode == 5'b00011);
+`ifdef A_EXTENSION
+  wire op_amo        = quad3 && (opcode == 5'b01011) && (funct3 == 3'b010);
+`endif
+`ifdef F_EXTENSION
+  wire op_load_fp    = quad3 && (opcode == 5'b00001) && (funct3 == 3'b010);
+  wire op_store_fp   = quad3 && (opcode == 5'b01001) && (funct3 == 3'b010);
+  wire op_fmadd      = quad3 && (opcode[4:2] == 3'b100) && (funct7[1:0] == 2'b00);
+  wire op_op_fp      = quad3 && (opcode == 5'b10100) && (funct7[1:0] == 2'b00);
+`endif
 `ifdef C_EXTENSION
   wire quad0         = (i_opcode_in[1:0] == 2'b00);
   wire quad1         = (i_opcode_in[1:0] == 2'b01);
@@ -118,6 +155,17 @@ module decoder (
   wire op_clwsp      = quad2 && (copcode == 3'b010);
   wire op_cswsp      = quad2 && (copcode == 3'b110);
   wire op_cjr_mv_add = quad2 && (copcode == 3'b100);
+`ifdef F_EXTENSION
+  wire op_cflw       = quad0 && (copcode == 3'b011);
+  wire op_cfsw       = quad0 && (copcode == 3'b111);
+  wire op_cflwsp     = quad2 && (copcode == 3'b011);
+  wire op_cfswsp     = quad2 && (copcode == 3'b111);
+`else
+  wire op_cflw       = 1'b0;
+  wire op_cfsw       = 1'b0;
+  wire op_cflwsp     = 1'b0;
+  wire op_cfswsp     = 1'b0;
+`endif
 `endif
 
   /**
@@ -137,7 +185,151 @@ module decoder (
   wire op_cmv       = op_cjr_mv_add &&  |rs2cl && !i_opcode_in[12];
   wire op_cadd      = op_cjr_mv_add &&  |rs2cl &&  i_opcode_in[12];
   wire op_cjr       = op_cjr_mv_add && ~|rs2cl && !i_opcode_in[12];
-  wire op_cjalr     = op_cjr_mv_add && ~|rs2cl &&  i_opcode_in[12];
+  wire op_cjalr     = op_cjr_mv_add && ~|rs2cl &&  i_opcode_in[12] && |rs1cl;
+  wire op_cebreak   = op_cjr_mv_add && ~|rs2cl &&  i_opcode_in[12] && ~|rs1cl;
+`endif
+
+  /**
+   * Atomic operation decoding
+   *  LR.W only reads the memory, SC.W only writes it, AMOs do both, all of
+   *  them take the address from RS1 (immediate is zero) and write the result
+   *  to RD like a load (see atomic.v)
+   */
+`ifdef A_EXTENSION
+  wire [4:0] funct5 = i_opcode_in[31:27];
+  wire op_lr      = op_amo && (funct5 == 5'b00010) && (rs2 == 5'b00000);
+  wire op_sc      = op_amo && (funct5 == 5'b00011);
+  wire op_rmw     = op_amo &&
+    ((funct5[1:0] == 2'b00) || (funct5 == 5'b00001));
+  wire op_atomic  = op_lr || op_sc || op_rmw;
+  wire atomic_rd  = op_lr || op_rmw;
+  wire atomic_wr  = op_sc || op_rmw;
+`else
+  wire op_atomic  = 1'b0;
+  wire atomic_rd  = 1'b0;
+  wire atomic_wr  = 1'b0;
+`endif
+
+  /**
+   * Floating-point operation decoding
+   *  Rounding modes 5 and 6 are reserved (dynamic mode is checked in the
+   *  FPU), FDIV and FSQRT go to the separate unit, but they're decoded as
+   *  the FPU opcodes. Conversions from integer and FMV.W.X read the integer
+   *  RS1, compares, conversions to integer, FMV.X.W and FCLASS write the
+   *  integer RD.
+   */
+`ifdef F_EXTENSION
+  wire [4:0] fp_funct5 = i_opcode_in[31:27];
+  wire fp_rm_valid = (funct3 != 3'b101) && (funct3 != 3'b110);
+  wire fp_rs2_0    = (rs2 == 5'b00000);
+  wire fp_rs2_01   = (rs2[4:1] == 4'b0000);
+  wire fp_fma      = op_fmadd && fp_rm_valid;
+  wire fp_arith    = op_op_fp && (fp_funct5[4:2] == 3'b000) && fp_rm_valid;
+  wire fp_sqrt     = op_op_fp && (fp_funct5 == 5'b01011) && fp_rs2_0 &&
+    fp_rm_valid;
+  wire fp_sgnj     = op_op_fp && (fp_funct5 == 5'b00100) && (funct3 < 3'd3);
+  wire fp_minmax   = op_op_fp && (fp_funct5 == 5'b00101) && (funct3 < 3'd2);
+  wire fp_cmp      = op_op_fp && (fp_funct5 == 5'b10100) && (funct3 < 3'd3);
+  wire fp_cvtws    = op_op_fp && (fp_funct5 == 5'b11000) && fp_rs2_01 &&
+    fp_rm_valid;
+  wire fp_cvtsw    = op_op_fp && (fp_funct5 == 5'b11010) && fp_rs2_01 &&
+    fp_rm_valid;
+  wire fp_mvx      = op_op_fp && (fp_funct5 == 5'b11100) && fp_rs2_0 &&
+    (funct3[2:1] == 2'b00);
+  wire fp_mvw      = op_op_fp && (fp_funct5 == 5'b11110) && fp_rs2_0 &&
+    (funct3 == 3'b000);
+  wire fpu_en      = fp_fma || fp_arith || fp_sqrt || fp_sgnj || fp_minmax ||
+    fp_cmp || fp_cvtws || fp_cvtsw || fp_mvx || fp_mvw;
+`ifdef C_EXTENSION
+  wire fp_load     = op_load_fp || op_cflw || op_cflwsp;
+  wire fp_store    = op_store_fp || op_cfsw || op_cfswsp;
+`else
+  wire fp_load     = op_load_fp;
+  wire fp_store    = op_store_fp;
+`endif
+  wire rs1_fp      = fpu_en && !(fp_cvtsw || fp_mvw);
+  wire rs2_fp      = fpu_en || fp_store;
+  wire rd_fp       = (fpu_en && !(fp_cmp || fp_cvtws || fp_mvx)) || fp_load;
+  wire fp_hz_rs2   = fp_fma || fp_arith || fp_sgnj || fp_minmax || fp_cmp;
+
+  reg [4:0] fpu_op;
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case (1'b1)
+      fp_fma:    fpu_op = {3'b001, i_opcode_in[3:2]};
+      fp_arith:  fpu_op = (fp_funct5[1:0] == 2'b11) ? 5'b11100 :
+        {3'b000, fp_funct5[1:0]};
+      fp_sqrt:   fpu_op = 5'b11101;
+      fp_sgnj:   fpu_op = {3'b010, funct3[1:0]};
+      fp_minmax: fpu_op = {4'b0110, funct3[0]};
+      fp_cmp:    fpu_op = {3'b100, funct3[1:0]};
+      fp_cvtws:  fpu_op = {4'b1010, rs2[0]};
+      fp_cvtsw:  fpu_op = {4'b1011, rs2[0]};
+      fp_mvx:    fpu_op = {4'b1100, funct3[0]};
+      default:   fpu_op = 5'b11010;
+    endcase
+  end
+`else
+  wire fpu_en      = 1'b0;
+  wire fp_load     = 1'b0;
+  wire fp_store    = 1'b0;
+  wire fp_hz_rs2   = 1'b0;
+`endif
+
+  /**
+   * Bit-manipulation operation decoding
+   *  Only the Zba, Zbb and Zbs encodings go to the bit-manipulation unit,
+   *  unary operations (and ZEXT.H, ORC.B, REV8) also need the right RS2
+   *  field. OP and OP-IMM encodings that are neither base I, M nor
+   *  bit-manipulation opcodes are illegal.
+   */
+`ifdef B_EXTENSION
+  wire funct7_base = (funct7 == 7'b0000000);
+  wire funct7_alt  = (funct7 == 7'b0100000);
+  wire funct7_md   = (funct7 == 7'b0000001);
+  wire funct7_sh   = (funct7 == 7'b0010000);
+  wire funct7_mm   = (funct7 == 7'b0000101);
+  wire funct7_zext = (funct7 == 7'b0000100);
+  wire funct7_rot  = (funct7 == 7'b0110000);
+  wire funct7_set  = (funct7 == 7'b0010100);
+  wire funct7_clr  = (funct7 == 7'b0100100);
+  wire funct7_inv  = (funct7 == 7'b0110100);
+  wire funct3_add  = (funct3 == 3'b000);
+  wire funct3_sl   = (funct3 == 3'b001);
+  wire funct3_sr   = (funct3 == 3'b101);
+  wire funct3_sh   = funct3_sl || funct3_sr;
+  wire bm_unary    = (rs2[4:3] == 2'b00) && (rs2[1:0] != 2'b11) &&
+    (rs2[2:0] != 3'b110);
+  // ANDN ORN XNOR, SHxADD, MIN(U) MAX(U), ZEXT.H, ROL ROR, BSET, BCLR BEXT,
+  //  BINV
+  wire bm_op       = op_op && (
+    (funct7_alt  && funct3[2] && (funct3 != 3'b101)) ||
+    (funct7_sh   && !funct3[0] && !funct3_add) ||
+    (funct7_mm   && funct3[2]) ||
+    (funct7_zext && (funct3 == 3'b100) && (rs2 == 5'b00000)) ||
+    (funct7_rot  && funct3_sh) ||
+    (funct7_set  && funct3_sl) ||
+    (funct7_clr  && funct3_sh) ||
+    (funct7_inv  && funct3_sl));
+  // CLZ CTZ CPOP SEXT.B SEXT.H, RORI, ORC.B, REV8, BSETI, BCLRI BEXTI, BINVI
+  wire bm_op_imm   = op_op_imm && (
+    (funct7_rot  && funct3_sl && bm_unary) ||
+    (funct7_rot  && funct3_sr) ||
+    (funct7_set  && funct3_sr && (rs2 == 5'b00111)) ||
+    (funct7_inv  && funct3_sr && (rs2 == 5'b11000)) ||
+    (funct7_set  && funct3_sl) ||
+    (funct7_clr  && funct3_sh) ||
+    (funct7_inv  && funct3_sl));
+  wire base_op     = funct7_base || funct7_md ||
+    (funct7_alt && (funct3_add || funct3_sr));
+  wire base_op_imm = !funct3_sh || funct7_base || (funct7_alt && funct3_sr);
+  wire bm_en       = bm_op || bm_op_imm;
+  wire bm_illegal  = (op_op && !base_op && !bm_op) ||
+    (op_op_imm && !base_op_imm && !bm_op_imm);
+`else
+  wire bm_illegal  = 1'b0;
 `endif
 
   /**
@@ -146,24 +338,37 @@ module decoder (
   wire format_u = op_auipc || op_lui;
   wire format_j = op_jal;
   wire format_b = op_branch;
+`ifdef F_EXTENSION
+  wire format_s = op_store || op_store_fp;
+  wire format_i = op_load || op_load_fp || op_op_imm || op_jalr || op_system;
+`else
   wire format_s = op_store;
-  wire format_r = op_op;
   wire format_i = op_load || op_op_imm || op_jalr || op_system;
+`endif
+  wire format_r = op_op;
+`ifdef C_EXTENSION
+  // C.EBREAK is passed on as EBREAK (system opcode with immediate 1)
+  wire system = op_system || op_cebreak;
+`else
+  wire system = op_system;
+`endif
 `ifdef C_EXTENSION
   wire format_ciw   = op_caddi4spn;
   wire format_ci    = op_caddi || op_cli || op_candi || op_cslli ||
     op_csrai || op_csrli;
   wire format_cu    = op_clui;
   wire format_c16sp = op_caddi16sp;
-  wire format_cls   = op_clw || op_csw;
+  wire format_cls   = op_clw || op_csw || op_cflw || op_cfsw;
   wire format_cj    = op_cj || op_cjal;
   wire format_cb    = op_cbeqz || op_cbnez;
-  wire format_cssp  = op_cswsp;
-  wire format_clsp  = op_clwsp;
+  wire format_cssp  = op_cswsp || op_cfswsp;
+  wire format_clsp  = op_clwsp || op_cflwsp;
 `endif
 
   /**
    * Opcode validation
+   *  FENCE and FENCE.I are valid, but they don't do anything (memory
+   *  accesses are done in order)
    */
   wire opcode_valid = (
   `ifdef C_EXTENSION
@@ -181,13 +386,16 @@ module decoder (
   `else
     i_opcode_in[1:0] == 2'b11) && (
   `endif
+    op_atomic ||
+    fpu_en ||
+    op_misc_mem ||
     format_u ||
     format_j ||
     format_b ||
     format_i ||
     format_s ||
     format_r
-  );
+  ) && !bm_illegal;
 
   /**
    * Immediate decoding
@@ -344,6 +552,7 @@ module decoder (
       format_cb:    immediate_mux = immediate_cb;
       format_cssp:  immediate_mux = immediate_cssp;
       format_clsp:  immediate_mux = immediate_clsp;
+      op_cebreak:   immediate_mux = 32'h00000001;
 `endif
       format_u:     immediate_mux = immediate_u;
       format_j:     immediate_mux = immediate_j;
@@ -358,10 +567,10 @@ module decoder (
    * Internal CPU signals
    */
 `ifdef C_EXTENSION
-  // Combined Store Signal (Sx C.SW C.SWSP)
-  wire c_op_store = op_store || op_csw || op_cswsp;
-  // Combined Load Signal (Lx C.LW C.LWSP)
-  wire c_op_load  = op_load || op_clw || op_clwsp;
+  // Combined Store Signal (Sx C.SW C.SWSP and FP stores)
+  wire c_op_store = op_store || op_csw || op_cswsp || fp_store;
+  // Combined Load Signal (Lx C.LW C.LWSP and FP loads)
+  wire c_op_load  = op_load || op_clw || op_clwsp || fp_load;
   // Combined immediate op (All IMM_OPs, C.SLLI and C.ALU excluding arythmetic)
   wire c_op_op_imm = op_op_imm || (op_calu && !op_caryth) || op_cslli;
   // Combined OP (All OPs, C. arythmetic and C.ADD)
@@ -379,18 +588,19 @@ module decoder (
   // Only ALU operations require it to be enabled, do the ADD when disabled
   wire alu_en = c_op_op || c_op_op_imm;
   // Select the write back input
-  wire [1:0] wb_mux = {c_jal || c_jalr, c_op_load};
+  wire [1:0] wb_mux = {c_jal || c_jalr || fpu_en,
+    c_op_load || op_atomic || fpu_en};
   // Store changes CPU state, so we make sure opcode is VALID
-  wire ma_wr = c_op_store && opcode_valid;
+  wire ma_wr = (c_op_store || atomic_wr) && opcode_valid;
   // Load changes CPU state, so we make sure opcode is VALID
-  wire ma_rd = c_op_load && opcode_valid;
+  wire ma_rd = (c_op_load || atomic_rd) && opcode_valid;
   // Stores and branches don't generate a result, everything else discards it
   // When opcode is not valid then just discard the result
   wire wb_en = !(c_op_store || c_branch) && opcode_valid;
   // Only LUI, AUIPC, JALs and C.MV don't use the RS1 input
   wire hz_rs1 = !(op_lui || op_auipc || c_jal || op_cmv);
   // Only arythmetic OPs, branch conditions and stores use RS2 register
-  wire hz_rs2 = c_branch || c_op_store || c_op_op;
+  wire hz_rs2 = c_branch || c_op_store || c_op_op || atomic_wr || fp_hz_rs2;
   // Combined jump output for fetch unit
   wire jump = c_jal || c_jalr;
   // Combined branch output for fetch unit
@@ -403,33 +613,35 @@ module decoder (
   // Only ALU operations require it to be enabled, do the ADD when disabled
   wire alu_en = op_op || op_op_imm;
   // Select the write back input
-  wire [1:0] wb_mux = {op_jal || op_jalr, op_load};
+  wire [1:0] wb_mux = {op_jal || op_jalr || fpu_en,
+    op_load || fp_load || op_atomic || fpu_en};
   // Store changes CPU state, so we make sure opcode is VALID
-  wire ma_wr = op_store && opcode_valid;
+  wire ma_wr = (op_store || fp_store || atomic_wr) && opcode_valid;
   // Load changes CPU state, so we make sure opcode is VALID
-  wire ma_rd = op_load && opcode_valid;
+  wire ma_rd = (op_load || fp_load || atomic_rd) && opcode_valid;
   // Stores and branches don't generate a result, everything else discards it
   // When opcode is not valid then just discard the result
-  wire wb_en = !(op_store || op_branch) && opcode_valid;
+  wire wb_en = !(op_store || fp_store || op_branch) && opcode_valid;
   // Only LUI, AUIPC and JALs don't use the RS1 input
   wire hz_rs1 = !(op_lui || op_auipc || op_jal);
   // Only arythmetic OPs, branch conditions and stores use RS2 register
-  wire hz_rs2 = op_branch || op_store || op_op;
+  wire hz_rs2 = op_branch || op_store || fp_store || op_op || atomic_wr ||
+    fp_hz_rs2;
   // Combined jump output for fetch unit
   wire jump = op_jal || op_jalr;
   // Combined branch output for fetch unit
   wire branch = op_branch;
 `endif
 
-
 `ifdef C_EXTENSION
   reg [4:0] rs1_mux;
   wire rs1_normal = quad3;
-  wire rs1_sp = op_caddi4spn || op_clwsp || op_cswsp;
+  wire rs1_sp = op_caddi4spn || op_clwsp || op_cswsp || op_cflwsp ||
+    op_cfswsp;
   wire rs1_rs1l = op_caddi16sp || op_caddi || op_cslli || op_cjr ||
     op_cjalr || op_cadd;
   wire rs1_rs1s = op_clw || op_csw || op_csrai || op_csrli || op_candi ||
-    op_caryth || op_cbeqz || op_cbnez;
+    op_caryth || op_cbeqz || op_cbnez || op_cflw || op_cfsw;
 `ifdef HARDWARE_TIPS
   (* parallel_case *)
 `endif
@@ -444,8 +656,8 @@ module decoder (
 
   reg [4:0] rs2_mux;
   wire rs2_normal = quad3;
-  wire rs2_rs2s = op_csw || op_caryth;
-  wire rs2_rs2l = op_cadd || op_cmv || op_cswsp;
+  wire rs2_rs2s = op_csw || op_caryth || op_cfsw;
+  wire rs2_rs2l = op_cadd || op_cmv || op_cswsp || op_cfswsp;
 `ifdef HARDWARE_TIPS
   (* parallel_case *)
 `endif
@@ -460,9 +672,9 @@ module decoder (
 
   reg [4:0] rd_mux;
   wire rd_normal = quad3;
-  wire rd_rs2s = op_caddi4spn || op_clw;
+  wire rd_rs2s = op_caddi4spn || op_clw || op_cflw;
   wire rd_rs1l = op_caddi16sp || op_caddi || op_cli || op_clui || op_cslli ||
-    op_cadd || op_cmv || op_clwsp;
+    op_cadd || op_cmv || op_clwsp || op_cflwsp;
   wire rd_rs1s = op_csrai || op_csrli || op_candi || op_caryth;
 `ifdef HARDWARE_TIPS
   (* parallel_case *)
@@ -529,21 +741,43 @@ module decoder (
   assign o_funct3     = funct3_mux;
   assign o_funct7     = funct7_mux;
 
-  assign o_system     = op_system;
+  assign o_system     = system;
 
+`ifdef F_EXTENSION
+  assign o_rs1        = {rs1_fp, rs1_mux};
+  assign o_rs2        = {rs2_fp, rs2_mux};
+  assign o_rd         = {rd_fp, rd_mux};
+`else
   assign o_rs1        = rs1_mux;
   assign o_rs2        = rs2_mux;
   assign o_rd         = rd_mux;
+`endif
 
   assign o_hz_rs1     = hz_rs1;
   assign o_hz_rs2     = hz_rs2;
 
+`ifdef F_EXTENSION
+  assign o_rs3        = {1'b1, i_opcode_in[31:27]};
+  assign o_hz_rs3     = fp_fma;
+  assign o_fpu_en     = fpu_en && opcode_valid;
+  assign o_fpu_op     = fpu_op;
+`endif
+
   assign o_branch     = branch;
   assign o_jump       = jump;
 
   assign o_alu_pc     = alu_pc;
   assign o_alu_imm    = alu_imm;
   assign o_alu_en     = alu_en;
+`ifdef B_EXTENSION
+  assign o_bm_en      = bm_en;
+`endif
+`ifdef A_EXTENSION
+  assign o_atomic     = op_atomic;
+`endif
+`ifdef TRAPS
+  assign o_illegal    = !opcode_valid && |i_opcode_in;
+`endif
 
   assign o_ma_wr      = ma_wr;
   assign o_ma_rd      = ma_rd;
@@ -11,41 +11,377 @@
  * i_clk_ce  - Clock enable
  * i_rst     - Reset input
  * i_data_in - Data from program memory
+ * i_ready   - Data from program memory is valid (used to freeze PC and ID)
  * i_hz_data - Data hazard (used to freeze PC and ID registers)
- * i_br_en   - Branch enable
+ * i_br_en   - Branch enable (also branch misprediction with predictor)
  * i_br_addr - Branch address
  *
- * o_if_pc   - Program counter in IF phase (used for program memory reads)
+ * i_bp_en    - Branch predictor update enable (branch resolved in EX)
+ * i_bp_jump  - Resolved branch is an unconditional jump
+ * i_bp_taken - Resolved branch was taken
+ * i_bp_pc    - Address of the resolved branch
+ * i_bp_addr  - Target address of the resolved branch
+ * i_bp_idx   - Predictor index of the resolved branch
+ *
+ * i_ras_push  - Push the return address (call leaves the ID phase)
+ * i_ras_pop   - Pop the return address (return leaves the ID phase)
+ * i_ras_addr  - Return address to push
+ * o_ras_top   - Return address on the top of the stack
+ * o_ras_valid - Return address stack isn't empty
+ *
+ * With FETCH_QUEUE the instruction in ID phase is the head of the fetch
+ * queue and the branch predictor is looked up with its address (predicted
+ * branches redirect the fetch when they leave the ID phase). With
+ * DUAL_ISSUE the instruction after it is handed to the second issue slot
+ * (its address is o_id_ret):
+ *
+ * i_id1_issue - Second instruction leaves the ID phase too
+ * i_fetch_ce  - Fetch clock enable (FETCH_QUEUE), it's i_clk_ce without the
+ *               data memory and ALU waits, the queue keeps filling while the
+ *               rest of the pipeline is stalled
+ * o_id1_ir    - Second instruction in ID phase
+ * o_id1_valid - Second instruction is in the queue
+ *
+ * o_if_pc   - Program counter in IF phase
+ * o_if_addr - Program memory address (program counter in IF phase, or the
+ *             program counter of the next cycle with POSEDGE_ONLY, as the
+ *             memory is read synchronously on the rising edge)
  * o_id_pc   - Program counter in ID phase (used for branch calculation)
  * o_id_ret  - Return address in ID phase (used for JAL and JALR)
  * o_id_ir   - Instruction in ID phase (guess what this is used for)
+ *
+ * o_id_pred      - Instruction in ID phase was predicted as taken
+ * o_id_pred_addr - Predicted target of the instruction in ID phase
+ * o_id_pred_idx  - Predictor index of the instruction in ID phase
  ***************************************************************************/
  `include "config.v"
+`ifdef BRANCH_PREDICTOR
+`include "predictor.v"
+`endif
 
 module fetch (
   input         i_clk,
   input         i_clk_ce,
   input         i_rst,
   input  [31:0] i_data_in,
+  input         i_ready,
+`ifdef FETCH_QUEUE
+  input         i_fetch_ce,
+`endif
 
   input         i_hz_data,
   input         i_br_en,
   input  [31:0] i_br_addr,
 
+`ifdef BRANCH_PREDICTOR
+  input         i_bp_en,
+  input         i_bp_jump,
+  input         i_bp_taken,
+  input  [31:0] i_bp_pc,
+  input  [31:0] i_bp_addr,
+  input  [`BP_PHT_BITS-1:0] i_bp_idx,
+
+  output        o_id_pred,
+  output [31:0] o_id_pred_addr,
+  output [`BP_PHT_BITS-1:0] o_id_pred_idx,
+`endif
+
+`ifdef RETURN_STACK
+  input         i_ras_push,
+  input         i_ras_pop,
+  input  [31:0] i_ras_addr,
+  output [31:0] o_ras_top,
+  output        o_ras_valid,
+`endif
+
   output [31:0] o_if_pc,
+  output [31:0] o_if_addr,
   output [31:0] o_id_pc,
   output [31:0] o_id_ret,
   output [31:0] o_id_ir,
 
+`ifdef DUAL_ISSUE
+  input         i_id1_issue,
+  output [31:0] o_id1_ir,
+  output        o_id1_valid,
+`endif
+
   output        o_hz_br
 );
 
+  /*
+   * Branch predictor
+   *  Predictor is looked up with the current program counter, if the branch
+   *  is predicted as taken the program counter is loaded with the predicted
+   *  target right away (without any bubbles). Prediction travels along with
+   *  the opcode, so it can be verified in EX phase, on misprediction EX
+   *  phase generates i_br_en with the correct address.
+   */
+`ifdef BRANCH_PREDICTOR
+  wire [31:0] bp_pc;
+  wire        bp_pred;
+  wire [31:0] bp_pred_addr;
+  wire [`BP_PHT_BITS-1:0] bp_pred_idx;
+
+  predictor predictor_i (
+    .i_clk       (i_clk),
+    .i_rst       (i_rst),
+    .i_if_pc     (bp_pc),
+    .o_pred      (bp_pred),
+    .o_pred_addr (bp_pred_addr),
+    .o_pred_idx  (bp_pred_idx),
+    .i_upd_en    (i_bp_en),
+    .i_upd_jump  (i_bp_jump),
+    .i_upd_taken (i_bp_taken),
+    .i_upd_pc    (i_bp_pc),
+    .i_upd_addr  (i_bp_addr),
+    .i_upd_idx   (i_bp_idx)
+  );
+`endif
+
+  /*
+   * Return address stack
+   *  Circular buffer, the oldest entries are overwritten when it overflows.
+   *  Call that also returns (JALR x1, x5 or the other way around) replaces
+   *  the top entry.
+   */
+`ifdef RETURN_STACK
+  localparam RAS_SIZE = (1 << `RAS_BITS);
+
+  reg  [31:0] ras_data [0:RAS_SIZE-1];
+  reg  [`RAS_BITS-1:0] ras_ptr;
+  reg  [`RAS_BITS:0] ras_cnt;
+  wire [`RAS_BITS-1:0] ras_ptr_inc;
+  wire [`RAS_BITS-1:0] ras_ptr_dec;
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      ras_ptr <= 0;
+      ras_cnt <= 0;
+    end else if (i_clk_ce) begin
+      if (i_ras_push && i_ras_pop) begin
+        ras_data[ras_ptr] <= i_ras_addr;
+      end else if (i_ras_push) begin
+        ras_data[ras_ptr_inc] <= i_ras_addr;
+        ras_ptr <= ras_ptr_inc;
+        if (ras_cnt != RAS_SIZE) begin
+          ras_cnt <= ras_cnt + 1;
+        end
+      end else if (i_ras_pop) begin
+        ras_ptr <= ras_ptr_dec;
+        if (ras_cnt != 0) begin
+          ras_cnt <= ras_cnt - 1;
+        end
+      end
+    end
+  end
+
+  assign ras_ptr_inc = ras_ptr + 1;
+  assign ras_ptr_dec = ras_ptr - 1;
+
+  assign o_ras_top   = ras_data[ras_ptr];
+  assign o_ras_valid = |ras_cnt;
+`endif
+
   /*
    * C extension fetch unit
    *  This version supports both 16bit and 32bit opcodes, 32bit opcodes
    *  don't have to be aligned to 4-byte boundries.
    */
 `ifdef C_EXTENSION
+  /*
+   * Fetch queue
+   *  Words from the program memory are split into halfwords and put into
+   *  the small queue (4 halfwords), the instruction in ID phase is always at
+   *  the head of the queue, so both 16 bit and 32 bit opcodes can be handed
+   *  to the decoder every cycle, no matter what their alignment is. Fetch
+   *  keeps going while the ID phase is stalled, until the queue is full.
+   */
+`ifdef FETCH_QUEUE
+  // Fetch address (address of the next halfword put into the queue)
+  reg  [31:0] fetch_pc;
+  wire [31:0] fetch_next;
+  wire        fetch_en;
+  wire [ 1:0] push_cnt;
+  wire [15:0] push_0;
+  wire [15:0] push_1;
+  wire [31:0] if_addr;
+
+  // Queue
+  reg  [15:0] q_data [0:3];
+  reg  [ 2:0] q_cnt;
+  reg  [31:0] q_pc;
+  wire [15:0] q_rem [0:3];
+  wire [ 2:0] rem_cnt;
+
+  // Instruction at the head of the queue (ID phase)
+  wire        id_c;
+  wire        id_valid;
+  wire        take;
+  wire [ 2:0] take_cnt;
+  wire [ 2:0] pop_cnt;
+  wire        pred_t0;
+  wire        redirect;
+
+  // Instruction after it (second issue slot)
+`ifdef DUAL_ISSUE
+  wire [15:0] id1_lo;
+  wire [15:0] id1_hi;
+  wire        id1_c;
+  wire        id1_valid;
+`endif
+
+  /**
+   * Fetch address
+   *  Word is fetched only if it's going to fit into the queue after the
+   *  instruction from the ID phase is taken out. After a branch to the
+   *  address that isn't word aligned only the upper half of the word is used.
+   *  Fetch runs on its own clock enable, branches and the ID phase only take
+   *  effect when the whole pipeline advances (i_clk_ce).
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      fetch_pc <= `RESET_VECTOR;
+    end else if (i_fetch_ce) begin
+      fetch_pc <= fetch_next;
+    end
+  end
+
+  assign fetch_en = i_ready && ((q_cnt - pop_cnt) <= 3'd2);
+
+  assign fetch_next =
+    (i_clk_ce && i_br_en)  ? i_br_addr :
+`ifdef BRANCH_PREDICTOR
+    (i_clk_ce && redirect) ? bp_pred_addr :
+`endif
+    (fetch_en) ? {fetch_pc[31:2] + 30'd1, 2'b00} : fetch_pc;
+
+  // Program memory address (the value the fetch address will have next)
+`ifdef POSEDGE_ONLY
+  assign if_addr =
+    (i_rst) ? `RESET_VECTOR :
+    (i_fetch_ce) ? fetch_next : fetch_pc;
+`else
+  assign if_addr = fetch_pc;
+`endif
+
+  assign push_cnt = (fetch_pc[1]) ? 2'd1 : 2'd2;
+  assign push_0   = (fetch_pc[1]) ? i_data_in[31:16] : i_data_in[15:0];
+  assign push_1   = i_data_in[31:16];
+
+  /**
+   * Queue
+   *  Instruction leaving the ID phase is shifted out, the fetched halfwords
+   *  are appended right after the remaining ones. With DUAL_ISSUE up to four
+   *  halfwords are shifted out (the halfwords past the end don't matter).
+   */
+`ifdef DUAL_ISSUE
+  for (genvar i = 0; i < 4; i = i + 1) begin
+    assign q_rem[i] = q_data[(i + pop_cnt) & 3];
+  end
+`else
+  for (genvar i = 0; i < 4; i = i + 1) begin
+    if (i < 2) begin
+      assign q_rem[i] =
+        (pop_cnt == 3'd2) ? q_data[i+2] :
+        (pop_cnt == 3'd1) ? q_data[i+1] : q_data[i];
+    end else if (i < 3) begin
+      assign q_rem[i] = (pop_cnt == 3'd0) ? q_data[i] : q_data[i+1];
+    end else begin
+      assign q_rem[i] = q_data[i];
+    end
+  end
+`endif
+
+  // Instruction leaves the queue only when the pipeline advances
+  assign pop_cnt = (i_clk_ce) ? take_cnt : 3'd0;
+  assign rem_cnt = q_cnt - pop_cnt;
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      q_cnt <= 0;
+      q_pc  <= `RESET_VECTOR;
+    end else if (i_clk_ce && (i_br_en || redirect)) begin
+      q_cnt <= 0;
+      q_pc  <= fetch_next;
+    end else if (i_fetch_ce) begin
+      q_cnt <= rem_cnt + ((fetch_en) ? {1'b0, push_cnt} : 3'd0);
+      q_pc  <= q_pc + {28'd0, pop_cnt, 1'b0};
+    end
+  end
+
+  always @(posedge i_clk) begin
+    if (i_fetch_ce) begin
+      for (integer i = 0; i < 4; i = i + 1) begin
+        if (fetch_en && (i[2:0] == rem_cnt)) begin
+          q_data[i] <= push_0;
+        end else if (fetch_en && (push_cnt == 2'd2) && (i[2:0] == rem_cnt + 3'd1)) begin
+          q_data[i] <= push_1;
+        end else begin
+          q_data[i] <= q_rem[i];
+        end
+      end
+    end
+  end
+
+  /**
+   * Instruction in ID phase
+   *  It leaves the queue when it goes to the EX phase, if it was predicted
+   *  as taken the queue is flushed and fetch continues from the target.
+   */
+  assign id_c     = (q_data[0][1:0] != 2'b11);
+  assign id_valid = (q_cnt >= 3'd2) || ((q_cnt == 3'd1) && id_c);
+  assign take     = id_valid && !i_hz_data && !i_br_en;
+`ifdef DUAL_ISSUE
+  assign take_cnt = (!take) ? 3'd0 : ((id_c) ? 3'd1 : 3'd2) +
+    ((!i_id1_issue) ? 3'd0 : (id1_c) ? 3'd1 : 3'd2);
+`else
+  assign take_cnt = (!take) ? 3'd0 : (id_c) ? 3'd1 : 3'd2;
+`endif
+
+  /**
+   * Second instruction in ID phase (DUAL_ISSUE)
+   *  It starts right after the first one, it's valid if all of its
+   *  halfwords are in the queue.
+   */
+`ifdef DUAL_ISSUE
+  assign id1_lo    = (id_c) ? q_data[1] : q_data[2];
+  assign id1_hi    = (id_c) ? q_data[2] : q_data[3];
+  assign id1_c     = (id1_lo[1:0] != 2'b11);
+  assign id1_valid = id_valid && (q_cnt >=
+    ((id_c) ? 3'd1 : 3'd2) + ((id1_c) ? 3'd1 : 3'd2));
+`endif
+
+`ifdef BRANCH_PREDICTOR
+  assign pred_t0  = bp_pred && id_valid;
+  assign redirect = pred_t0 && take;
+  assign bp_pc    = q_pc;
+
+  assign o_id_pred      = pred_t0;
+  assign o_id_pred_addr = bp_pred_addr;
+  assign o_id_pred_idx  = bp_pred_idx;
+`else
+  assign pred_t0  = 0;
+  assign redirect = 0;
+`endif
+
+  /**
+   * Output assignments
+   */
+  assign o_if_pc   = fetch_pc;
+  assign o_if_addr = if_addr;
+  assign o_id_pc   = q_pc;
+  assign o_id_ir   = {q_data[1], q_data[0]};
+  assign o_id_ret  = q_pc + ((id_c) ? 32'h2 : 32'h4);
+
+`ifdef DUAL_ISSUE
+  assign o_id1_ir    = {id1_hi, id1_lo};
+  assign o_id1_valid = id1_valid;
+`endif
+
+  assign o_hz_br = !id_valid;
+
+`else
   // Program counter
   reg  [31:0] if_pc;
   wire [31:0] pc_mux;
@@ -55,6 +391,9 @@ module fetch (
   wire        data_t0_ch;
   wire        pc_next_c;
   wire [31:0] pc_next;
+  wire        pred_t0;
+  wire        if_en;
+  wire [31:0] if_addr;
 
   // Instruction registers
   reg  [31:0] data_t1;
@@ -77,6 +416,16 @@ module fetch (
   wire [31:0] ret_out;
   wire        valid_out;
 
+  // Prediction registers
+`ifdef BRANCH_PREDICTOR
+  reg         pred_t1;
+  reg         pred_t2;
+  reg  [31:0] pred_addr_t1;
+  reg  [31:0] pred_addr_t2;
+  reg  [`BP_PHT_BITS-1:0] pred_idx_t1;
+  reg  [`BP_PHT_BITS-1:0] pred_idx_t2;
+`endif
+
 
   /**
    * Program counter and branch hazard
@@ -87,14 +436,33 @@ module fetch (
       if_pc <= `RESET_VECTOR;
     end else begin
       // Update if pc should be updated
-      if (i_clk_ce && (!i_hz_data || i_br_en)) begin
+      if (i_clk_ce && (if_en || i_br_en)) begin
         if_pc <= pc_mux;
       end
     end
   end
 
-  // If branching pc input should be branch address
-  assign pc_mux = (i_br_en)? i_br_addr : pc_next;
+  // Fetch advances if there's no data hazard and the opcode has arrived
+  assign if_en = !i_hz_data && i_ready;
+
+  // Program memory address (the value program counter will have next)
+`ifdef POSEDGE_ONLY
+  assign if_addr =
+    (i_rst) ? `RESET_VECTOR :
+    (i_clk_ce && (if_en || i_br_en)) ? pc_mux : if_pc;
+`else
+  assign if_addr = if_pc;
+`endif
+
+  // If branching pc input should be branch address, if branch is predicted
+  //  as taken pc input should be predicted address
+`ifdef BRANCH_PREDICTOR
+  assign pc_mux =
+    (i_br_en) ? i_br_addr :
+    (pred_t0) ? bp_pred_addr : pc_next;
+`else
+  assign pc_mux = (i_br_en) ? i_br_addr : pc_next;
+`endif
 
   // This timing signals makes next expressions a bit clearer
   assign pc_t0 = if_pc;
@@ -108,6 +476,14 @@ module fetch (
   assign pc_next_c = (data_t0_cl && !pc_t0[1]) || (pc_t0[1] && data_t0_ch);
   assign pc_next = pc_t0 + ((pc_next_c) ? 32'h2 : 32'h4);
 
+  // Unaligned 32 bit opcodes need the next word to be fetched, so they are
+  //  never predicted, they'll be handled by the EX phase.
+`ifdef BRANCH_PREDICTOR
+  assign pred_t0 = bp_pred && !(pc_t0[1] && !data_t0_ch);
+`else
+  assign pred_t0 = 0;
+`endif
+
   /**
    * Data registers
    *  These registers can work in two modes: t1 mode and t2 mode.
@@ -131,7 +507,7 @@ module fetch (
       ret_t2   <= 0;
       t2_mode  <= 0;
     end else begin
-      if (i_clk_ce && (!i_hz_data || i_br_en)) begin
+      if (i_clk_ce && (if_en || i_br_en)) begin
         data_t1  <= data_t0;
         data_t2  <= data_t1;
         valid_t1 <= 1'b1;
@@ -151,6 +527,32 @@ module fetch (
     end
   end
 
+  // Prediction goes through the same registers as the opcode
+`ifdef BRANCH_PREDICTOR
+  always @(posedge i_clk) begin
+    if (i_rst || (i_clk_ce && i_br_en)) begin
+      pred_t1      <= 0;
+      pred_t2      <= 0;
+      pred_addr_t1 <= 0;
+      pred_addr_t2 <= 0;
+      pred_idx_t1  <= 0;
+      pred_idx_t2  <= 0;
+    end else if (i_clk_ce && if_en) begin
+      pred_t1      <= pred_t0;
+      pred_t2      <= pred_t1;
+      pred_addr_t1 <= bp_pred_addr;
+      pred_addr_t2 <= pred_addr_t1;
+      pred_idx_t1  <= bp_pred_idx;
+      pred_idx_t2  <= pred_idx_t1;
+    end
+  end
+
+  assign o_id_pred      = (t2_mode) ? pred_t2      : pred_t1;
+  assign o_id_pred_addr = (t2_mode) ? pred_addr_t2 : pred_addr_t1;
+  assign o_id_pred_idx  = (t2_mode) ? pred_idx_t2  : pred_idx_t1;
+  assign bp_pc          = if_pc;
+`endif
+
   // This signal tells the fetch unit to switch to t2 mode
   //  If C_FETCH_T2 is defined fetch unit will automatically enter t2 mode
   //  no matter what opcode it receives.
@@ -180,12 +582,14 @@ module fetch (
   /**
    * Output assignments
    */
-  assign o_if_pc  = if_pc;
-  assign o_id_pc  = pc_out;
-  assign o_id_ir  = data_out;
-  assign o_id_ret = ret_out;
+  assign o_if_pc   = if_pc;
+  assign o_if_addr = if_addr;
+  assign o_id_pc   = pc_out;
+  assign o_id_ir   = data_out;
+  assign o_id_ret  = ret_out;
 
   assign o_hz_br = !valid_out;
+`endif
 
   /*
    * Base I fetch unit
@@ -198,12 +602,21 @@ module fetch (
   reg  [31:0] if_pc;
   wire [31:0] pc_next;
   wire [31:0] pc_mux;
+  wire        if_en;
+  wire [31:0] if_addr;
 
   // Instruction registers
   reg  [31:0] id_ret;
   reg  [31:0] id_pc;
   reg  [31:0] id_ir;
 
+  // Prediction registers
+`ifdef BRANCH_PREDICTOR
+  reg         id_pred;
+  reg  [31:0] id_pred_addr;
+  reg  [`BP_PHT_BITS-1:0] id_pred_idx;
+`endif
+
 
   /**
    * Program counter and branch hazard
@@ -214,12 +627,12 @@ module fetch (
       if_pc <= `RESET_VECTOR;
       hz_br <= 0;
     end else begin
-      // Clear branch hazard if set
-      if (i_clk_ce && hz_br) begin
+      // Clear branch hazard if set (when the first opcode arrives)
+      if (i_clk_ce && hz_br && i_ready) begin
         hz_br <= 0;
       end
       // Update the pc
-      if (i_clk_ce && (!i_hz_data || i_br_en)) begin
+      if (i_clk_ce && (if_en || i_br_en)) begin
         if_pc <= pc_mux;
         // Set hazard if branch taken
         if (i_br_en) begin
@@ -229,8 +642,26 @@ module fetch (
     end
   end
 
+  // Fetch advances if there's no data hazard and the opcode has arrived
+  assign if_en = !i_hz_data && i_ready;
+
+  // Program memory address (the value program counter will have next)
+`ifdef POSEDGE_ONLY
+  assign if_addr =
+    (i_rst) ? `RESET_VECTOR :
+    (i_clk_ce && (if_en || i_br_en)) ? pc_mux : if_pc;
+`else
+  assign if_addr = if_pc;
+`endif
+
   assign pc_next = if_pc + 32'h4;
+`ifdef BRANCH_PREDICTOR
+  assign pc_mux =
+    (i_br_en) ? i_br_addr :
+    (bp_pred) ? bp_pred_addr : pc_next;
+`else
   assign pc_mux = (i_br_en) ? i_br_addr : pc_next;
+`endif
 
 
   /**
@@ -244,7 +675,7 @@ module fetch (
       id_ret <= 0;
       id_pc  <= 0;
       id_ir  <= 0;
-    end else if (i_clk_ce && !i_hz_data) begin
+    end else if (i_clk_ce && if_en) begin
       id_ret <= pc_next;
       id_pc  <= if_pc;
       id_ir  <= i_data_in;
@@ -254,14 +685,35 @@ module fetch (
     end
   end
 
+  // Prediction is stored alongside the opcode
+`ifdef BRANCH_PREDICTOR
+  always @(posedge i_clk) begin
+    if (i_rst || (i_clk_ce && i_br_en)) begin
+      id_pred      <= 0;
+      id_pred_addr <= 0;
+      id_pred_idx  <= 0;
+    end else if (i_clk_ce && if_en) begin
+      id_pred      <= bp_pred;
+      id_pred_addr <= bp_pred_addr;
+      id_pred_idx  <= bp_pred_idx;
+    end
+  end
+
+  assign o_id_pred      = id_pred;
+  assign o_id_pred_addr = id_pred_addr;
+  assign o_id_pred_idx  = id_pred_idx;
+  assign bp_pc          = if_pc;
+`endif
+
 
   /**
    * Output assignments
    */
-  assign o_if_pc  = if_pc;
-  assign o_id_pc  = id_pc;
-  assign o_id_ir  = id_ir;
-  assign o_id_ret = id_ret;
+  assign o_if_pc   = if_pc;
+  assign o_if_addr = if_addr;
+  assign o_id_pc   = id_pc;
+  assign o_id_ir   = id_ir;
+  assign o_id_ret  = id_ret;
 
   assign o_hz_br = hz_br;
 `endif
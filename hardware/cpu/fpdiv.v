@@ -0,0 +1,299 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: fpdiv.v
+ *
+ * This file contains the FDIV/FSQRT functional unit of the F extension, it
+ * works like the Mul/Div unit in the scoreboard mode (see mdunit.v) except
+ * that the opcode never finishes in the EX phase: the operands are unpacked
+ * and latched when the opcode leaves the EX phase (special cases are
+ * resolved right away), the opcode continues down the pipeline without the
+ * write back and the unit writes the rounded result back on its own using
+ * a free slot in the WB phase. Hazard unit stalls only the opcodes that
+ * depend on the pending result (and the next FDIV/FSQRT).
+ *
+ * Division is a restoring one, it calculates 27 quotient bits (one per
+ * cycle), square root is calculated digit by digit, 26 root bits (one per
+ * cycle), the remainder goes to the sticky bit in both cases.
+ *
+ * i_clk       - Clock input
+ * i_clk_ce    - Clock enable (pipeline advance)
+ * i_rst       - Reset input
+ *
+ * i_in_a      - Dividend/radicand (from the EX phase)
+ * i_in_b      - Divisor (from the EX phase)
+ * i_sqrt      - Square root (division otherwise)
+ * i_rm        - Rounding mode field of the opcode (funct3)
+ * i_frm       - Dynamic rounding mode (frm CSR)
+ * i_fd_en     - FDIV/FSQRT opcode in the EX phase
+ * i_ex_wb_reg - RD register in EX phase
+ * i_wb_free   - There's no write back in the MA phase (slot is free)
+ *
+ * o_result    - Rounded result
+ * o_flags     - Exception flags (NV DZ OF UF NX)
+ * o_ex_wait   - EX phase opcode's write back is deferred
+ * o_hz_en     - Unit is (or may soon be) occupied, used for hazards
+ * o_hz_reg    - RD register of the pending (or EX phase) opcode
+ * o_wb_en     - Write back the pending result at this clock edge
+ * o_wb_reg    - RD register of the pending result
+ ***************************************************************************/
+`include "config.v"
+`include "fpunpack.v"
+`include "fpround.v"
+
+module fpdiv (
+  input         i_clk,
+  input         i_clk_ce,
+  input         i_rst,
+
+  input  [31:0] i_in_a,
+  input  [31:0] i_in_b,
+  input         i_sqrt,
+  input  [ 2:0] i_rm,
+  input  [ 2:0] i_frm,
+  input         i_fd_en,
+  input  [`REG_BITS-1:0] i_ex_wb_reg,
+  input         i_wb_free,
+
+  output [31:0] o_result,
+  output [ 4:0] o_flags,
+  output        o_ex_wait,
+  output        o_hz_en,
+  output [`REG_BITS-1:0] o_hz_reg,
+  output        o_wb_en,
+  output [`REG_BITS-1:0] o_wb_reg
+);
+
+
+  // Unpacked operands
+  wire        a_sign;
+  wire [ 9:0] a_exp;
+  wire [23:0] a_sig;
+  wire        a_zero;
+  wire        a_inf;
+  wire        a_nan;
+  wire        a_snan;
+  wire        b_sign;
+  wire [ 9:0] b_exp;
+  wire [23:0] b_sig;
+  wire        b_zero;
+  wire        b_inf;
+  wire        b_nan;
+  wire        b_snan;
+
+  // Special cases
+  wire        div_nv;
+  wire        div_dz;
+  reg  [31:0] div_spec;
+  wire        div_special;
+  wire        sqrt_nv;
+  reg  [31:0] sqrt_spec;
+  wire        sqrt_special;
+  wire signed [9:0] sqrt_t;
+  wire [ 9:0] sqrt_exp;
+  wire [24:0] sqrt_x;
+
+  // Pending opcode registers
+  reg         fd_pend;
+  reg  [`REG_BITS-1:0] fd_reg;
+  reg         fd_sqrt;
+  reg  [ 2:0] fd_rm;
+  reg         fd_special;
+  reg  [31:0] fd_spec_res;
+  reg  [ 4:0] fd_spec_flags;
+  reg         fd_sign;
+  reg  [ 9:0] fd_exp;
+  reg  [ 4:0] fd_cnt;
+
+  // Iteration registers
+  reg  [23:0] div_d;
+  reg  [27:0] rem;
+  reg  [26:0] quo;
+  reg  [51:0] sq_y;
+  wire        div_ge;
+  wire [25:0] div_sub;
+  wire [29:0] sq_rem;
+  wire [29:0] sq_trial;
+  wire        sq_ge;
+  wire [29:0] sq_sub;
+
+  // Rounding
+  wire [ 9:0] r_exp;
+  wire [25:0] r_sig;
+  wire [31:0] rnd_res;
+  wire        rnd_of;
+  wire        rnd_uf;
+  wire        rnd_nx;
+
+
+  /**
+   * Operand unpacking
+   */
+  fpunpack unpack_a (
+    .i_in   (i_in_a),
+    .o_sign (a_sign),
+    .o_exp  (a_exp),
+    .o_sig  (a_sig),
+    .o_zero (a_zero),
+    // verilator lint_off PINCONNECTEMPTY
+    .o_subn (),
+    // verilator lint_on PINCONNECTEMPTY
+    .o_inf  (a_inf),
+    .o_nan  (a_nan),
+    .o_snan (a_snan)
+  );
+
+  fpunpack unpack_b (
+    .i_in   (i_in_b),
+    .o_sign (b_sign),
+    .o_exp  (b_exp),
+    .o_sig  (b_sig),
+    .o_zero (b_zero),
+    // verilator lint_off PINCONNECTEMPTY
+    .o_subn (),
+    // verilator lint_on PINCONNECTEMPTY
+    .o_inf  (b_inf),
+    .o_nan  (b_nan),
+    .o_snan (b_snan)
+  );
+
+  /**
+   * Division special cases
+   *  inf/inf and 0/0 are invalid, finite/0 is the division by zero
+   */
+  assign div_nv = a_snan || b_snan || (a_inf && b_inf) || (a_zero && b_zero);
+  assign div_dz = b_zero && !a_zero && !a_inf && !a_nan;
+  assign div_special = a_nan || b_nan || a_inf || a_zero || b_inf || b_zero;
+
+  always @* begin
+    if (a_nan || b_nan || div_nv) begin
+      div_spec = 32'h7FC00000;
+    end else if (a_inf || b_zero) begin
+      div_spec = {a_sign ^ b_sign, 31'h7F800000};
+    end else begin
+      div_spec = {a_sign ^ b_sign, 31'd0};
+    end
+  end
+
+  /**
+   * Square root special cases
+   *  Root of a negative number (except -0) is invalid
+   */
+  assign sqrt_nv = a_snan || (a_sign && !a_zero && !a_nan);
+  assign sqrt_special = a_nan || a_zero || a_inf || a_sign;
+
+  always @* begin
+    if (a_nan || sqrt_nv) begin
+      sqrt_spec = 32'h7FC00000;
+    end else begin
+      sqrt_spec = i_in_a;
+    end
+  end
+
+  /**
+   * Square root operand
+   *  With the odd unbiased exponent the radicand is doubled, so the exponent
+   *  can be halved, the root is in [1, 2) in both cases
+   */
+  assign sqrt_t = a_exp - 10'd127;
+  assign sqrt_exp = (sqrt_t >>> 1) + 10'sd127;
+  assign sqrt_x = (sqrt_t[0]) ? {a_sig, 1'b0} : {1'b0, a_sig};
+
+  /**
+   * Pending opcode registers
+   *  Opcode is latched when it leaves the EX phase, it stays pending until
+   *  its result is written back, iterations don't wait for the pipeline
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      fd_pend       <= 0;
+      fd_reg        <= 0;
+      fd_cnt        <= 0;
+    end else if (i_clk_ce && i_fd_en) begin
+      fd_pend       <= 1'b1;
+      fd_reg        <= i_ex_wb_reg;
+      fd_sqrt       <= i_sqrt;
+      fd_rm         <= (i_rm == 3'b111) ? i_frm : i_rm;
+      if (i_sqrt) begin
+        fd_special    <= sqrt_special;
+        fd_spec_res   <= sqrt_spec;
+        fd_spec_flags <= {sqrt_nv, 4'd0};
+        fd_sign       <= 1'b0;
+        fd_exp        <= sqrt_exp;
+        fd_cnt        <= (sqrt_special) ? 5'd0 : 5'd26;
+      end else begin
+        fd_special    <= div_special;
+        fd_spec_res   <= div_spec;
+        fd_spec_flags <= {div_nv, div_dz, 3'd0};
+        fd_sign       <= a_sign ^ b_sign;
+        fd_exp        <= a_exp - b_exp + 10'd127;
+        fd_cnt        <= (div_special) ? 5'd0 : 5'd27;
+      end
+      div_d         <= b_sig;
+      rem           <= (i_sqrt) ? 28'd0 : {4'd0, a_sig};
+      quo           <= 0;
+      sq_y          <= {sqrt_x, 27'd0};
+    end else begin
+      if (i_clk_ce && o_wb_en) begin
+        fd_pend       <= 1'b0;
+      end
+      if (fd_cnt != 5'd0) begin
+        fd_cnt        <= fd_cnt - 5'd1;
+        quo           <= {quo[25:0], (fd_sqrt) ? sq_ge : div_ge};
+        if (fd_sqrt) begin
+          rem           <= (sq_ge) ? sq_sub[27:0] : sq_rem[27:0];
+          sq_y          <= {sq_y[49:0], 2'b00};
+        end else begin
+          rem           <= {2'b00, (div_ge) ? div_sub[24:0] : rem[24:0], 1'b0};
+        end
+      end
+    end
+  end
+
+  /**
+   * Iteration step
+   *  Division subtracts the divisor from the partial remainder, square root
+   *  brings down two radicand bits and subtracts the trial root (4R + 1)
+   */
+  assign div_sub = rem[25:0] - {2'b00, div_d};
+  assign div_ge = (rem[25:0] >= {2'b00, div_d});
+
+  assign sq_rem = {rem, sq_y[51:50]};
+  assign sq_trial = {2'b00, quo[25:0], 2'b01};
+  assign sq_ge = (sq_rem >= sq_trial);
+  assign sq_sub = sq_rem - sq_trial;
+
+  /**
+   * Rounding
+   *  Quotient is in (0.5, 2), so it has either 27 or 26 significant bits
+   */
+  assign r_exp = (fd_sqrt) ? fd_exp : (fd_exp - {9'd0, !quo[26]});
+  assign r_sig =
+    (fd_sqrt)  ? {quo[25:1], quo[0] || (rem != 28'd0)} :
+    (quo[26])  ? {quo[26:2], quo[1] || quo[0] || (rem != 28'd0)} :
+    {quo[25:1], quo[0] || (rem != 28'd0)};
+
+  fpround fpround_i (
+    .i_sign   (fd_sign),
+    .i_exp    (r_exp),
+    .i_sig    (r_sig),
+    .i_rm     (fd_rm),
+    .o_result (rnd_res),
+    .o_of     (rnd_of),
+    .o_uf     (rnd_uf),
+    .o_nx     (rnd_nx)
+  );
+
+  /**
+   * Output assignment
+   */
+  assign o_result  = (fd_special) ? fd_spec_res : rnd_res;
+  assign o_flags   = (fd_special) ? fd_spec_flags :
+    {2'b00, rnd_of, rnd_uf, rnd_nx};
+  assign o_ex_wait = i_fd_en;
+  assign o_hz_en   = fd_pend || i_fd_en;
+  assign o_hz_reg  = (fd_pend) ? fd_reg : i_ex_wb_reg;
+  assign o_wb_en   = fd_pend && (fd_cnt == 5'd0) && i_wb_free;
+  assign o_wb_reg  = fd_reg;
+
+endmodule
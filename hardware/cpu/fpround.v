@@ -0,0 +1,144 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: fpround.v
+ *
+ * This file contains the single-precision rounder used by the FP units. The
+ * input is the normalized significand with the guard and sticky bits, value
+ * is sig / 2^25 * 2^(exp - 127). Numbers with the exponent below one are
+ * shifted right (subnormal result), the rounding increment is added to the
+ * packed exponent and mantissa, so the carry out of the mantissa goes
+ * straight into the exponent (subnormal becomes normal, normal becomes
+ * infinity). Underflow is detected after rounding (like RISC-V requires),
+ * overflow returns infinity or the largest finite number depending on the
+ * rounding mode.
+ *
+ * i_sign   - Sign
+ * i_exp    - Biased exponent (signed)
+ * i_sig    - Significand (leading one at bit 25, guard bit, sticky bit), zero
+ *            if the result is zero
+ * i_rm     - Rounding mode (RNE RTZ RDN RUP RMM, others work as RNE)
+ *
+ * o_result - Packed single-precision result
+ * o_of     - Overflow flag
+ * o_uf     - Underflow flag
+ * o_nx     - Inexact flag
+ ***************************************************************************/
+`ifndef FPROUND_V
+`define FPROUND_V
+`include "config.v"
+
+module fpround (
+  input         i_sign,
+  input  [ 9:0] i_exp,
+  input  [25:0] i_sig,
+  input  [ 2:0] i_rm,
+
+  output [31:0] o_result,
+  output        o_of,
+  output        o_uf,
+  output        o_nx
+);
+
+
+  // Denormalization
+  wire signed [9:0] exp_s;
+  wire        zero;
+  wire        tiny;
+  wire        huge;
+  wire [ 9:0] sh_raw;
+  wire [ 4:0] sh;
+  wire [52:0] wide;
+  wire [25:0] sig;
+
+  // Rounding
+  wire [23:0] mant;
+  wire        guard;
+  wire        sticky;
+  reg         inc;
+  reg         inc_u;
+  wire [ 7:0] exp;
+  wire [31:0] packed;
+
+  // Exceptions
+  wire        inexact;
+  wire        overflow;
+  wire        of_max;
+  wire        tiny_ar;
+
+
+  /**
+   * Denormalization
+   *  Numbers below the smallest normal one are shifted right, everything
+   *  shifted out goes to the sticky bit
+   */
+  assign exp_s = i_exp;
+  assign zero = !i_sig[25];
+  assign tiny = (exp_s < 10'sd1);
+  assign huge = (exp_s > 10'sd254);
+  assign sh_raw = 10'd1 - i_exp;
+  assign sh = (!tiny) ? 5'd0 : (sh_raw > 10'd27) ? 5'd27 : sh_raw[4:0];
+  assign wide = {i_sig, 27'd0} >> sh;
+  assign sig = {wide[52:28], wide[27] || |wide[26:0]};
+
+  /**
+   * Rounding
+   */
+  assign mant = sig[25:2];
+  assign guard = sig[1];
+  assign sticky = sig[0];
+  assign exp = (tiny) ? 8'd0 : i_exp[7:0];
+
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case (i_rm)
+      3'b001:  inc = 1'b0;
+      3'b010:  inc =  i_sign && (guard || sticky);
+      3'b011:  inc = !i_sign && (guard || sticky);
+      3'b100:  inc = guard;
+      default: inc = guard && (sticky || mant[0]);
+    endcase
+  end
+
+  assign packed = {1'b0, exp, mant[22:0]} + {31'd0, inc};
+
+  /**
+   * Exceptions
+   *  Result is tiny after rounding unless it's just below the smallest
+   *  normal number and rounding with unbounded exponent carries out
+   */
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case (i_rm)
+      3'b001:  inc_u = 1'b0;
+      3'b010:  inc_u =  i_sign && (i_sig[1] || i_sig[0]);
+      3'b011:  inc_u = !i_sign && (i_sig[1] || i_sig[0]);
+      3'b100:  inc_u = i_sig[1];
+      default: inc_u = i_sig[1] && (i_sig[0] || i_sig[2]);
+    endcase
+  end
+
+  assign inexact = !zero && (guard || sticky || overflow);
+  assign overflow = !zero && (huge || (packed[30:23] == 8'hFF));
+  assign of_max = (i_rm == 3'b001) || ((i_rm == 3'b010) && !i_sign) ||
+    ((i_rm == 3'b011) && i_sign);
+  assign tiny_ar = tiny && !((exp_s == 10'sd0) && (&i_sig[25:2]) && inc_u);
+
+  /**
+   * Output assignment
+   */
+  assign o_result =
+    (zero)     ? {i_sign, 31'd0} :
+    (overflow) ? {i_sign, (of_max) ? 31'h7F7FFFFF : 31'h7F800000} :
+    {i_sign, packed[30:0]};
+  assign o_of = overflow;
+  assign o_uf = !zero && tiny_ar && (guard || sticky);
+  assign o_nx = inexact;
+
+endmodule
+
+`endif
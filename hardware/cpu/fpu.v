@@ -0,0 +1,618 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: fpu.v
+ *
+ * This file contains the single-precision FPU of the F extension (except
+ * for FDIV and FSQRT, see fpdiv.v). It's a three stage pipeline running
+ * along with the CPU pipeline: the first stage is in the EX phase, it
+ * unpacks the operands, multiplies the significands and resolves the special
+ * cases and all the simple opcodes (sign injection, min/max, compare,
+ * classify, moves and the conversion to integer), the second stage is in the
+ * MA phase, it aligns and adds the addend and normalizes the result, the
+ * third stage is in the WB phase, it rounds the result. Result is available
+ * in the WB phase (opcodes that need it wait while it's in the MA phase).
+ *
+ * All arithmetic opcodes are done as a fused multiply-add:
+ *  FMADD/FMSUB/FNMSUB/FNMADD - (+/-)(A * B) + (+/-)C
+ *  FADD/FSUB                 - A + (+/-)B (A is the product)
+ *  FMUL                      - A * B (no addend)
+ *  FCVT.S.W[U]               - Integer is the product (no addend)
+ * Product is exact (48 bits), the addend is aligned to the larger exponent
+ * in a 51 bit frame with the sticky bit, so the result is rounded only once.
+ * NaN results are always canonical (0x7FC00000).
+ *
+ * Opcode selection (from the decoder):
+ *  00 FADD       01 FSUB       02 FMUL
+ *  04 FMADD      05 FMSUB      06 FNMSUB     07 FNMADD
+ *  08 FSGNJ      09 FSGNJN     0A FSGNJX
+ *  0C FMIN       0D FMAX
+ *  10 FLE        11 FLT        12 FEQ
+ *  14 FCVT.W.S   15 FCVT.WU.S  16 FCVT.S.W   17 FCVT.S.WU
+ *  18 FMV.X.W    19 FCLASS     1A FMV.W.X
+ *
+ * i_clk      - Clock input
+ * i_clk_ce   - Clock enable (pipeline advance)
+ * i_rst      - Reset input
+ *
+ * i_in_a     - Operand A (RS1, integer for FCVT.S.W[U] and FMV.W.X)
+ * i_in_b     - Operand B (RS2)
+ * i_in_c     - Operand C (RS3)
+ * i_op       - Opcode selection
+ * i_rm       - Rounding mode field of the opcode (funct3)
+ * i_frm      - Dynamic rounding mode (frm CSR)
+ * i_fpu_en   - FPU opcode in the EX phase
+ * i_trap     - Opcode in the EX phase is trapped
+ *
+ * o_result   - Result (WB phase)
+ * o_busy     - FPU opcode in the MA or WB phase
+ * o_flags_en - Accrue the exception flags at this clock edge
+ * o_flags    - Exception flags (NV DZ OF UF NX)
+ ***************************************************************************/
+`include "config.v"
+`include "fpunpack.v"
+`include "fpround.v"
+
+module fpu (
+  input         i_clk,
+  input         i_clk_ce,
+  input         i_rst,
+
+  input  [31:0] i_in_a,
+  input  [31:0] i_in_b,
+  input  [31:0] i_in_c,
+  input  [ 4:0] i_op,
+  input  [ 2:0] i_rm,
+  input  [ 2:0] i_frm,
+  input         i_fpu_en,
+  input         i_trap,
+
+  output [31:0] o_result,
+  output        o_busy,
+  output        o_flags_en,
+  output [ 4:0] o_flags
+);
+
+
+  // Unpacked operands
+  wire        a_sign;
+  wire [ 9:0] a_exp;
+  wire [23:0] a_sig;
+  wire        a_zero;
+  wire        a_subn;
+  wire        a_inf;
+  wire        a_nan;
+  wire        a_snan;
+  wire        b_sign;
+  wire [ 9:0] b_exp;
+  wire [23:0] b_sig;
+  wire        b_zero;
+  wire        b_inf;
+  wire        b_nan;
+  wire        b_snan;
+  wire        c_sign_in;
+  wire [ 9:0] c_exp_in;
+  wire [23:0] c_sig_in;
+  wire        c_zero_in;
+  wire        c_inf_in;
+  wire        c_nan_in;
+  wire        c_snan_in;
+
+  // Opcode decoding
+  wire [ 2:0] rm;
+  wire        op_add;
+  wire        op_mul;
+  wire        op_fma;
+  wire        op_sgnj;
+  wire        op_minmax;
+  wire        op_cmp;
+  wire        op_cvtws;
+  wire        op_cvtsw;
+  wire        op_class;
+  wire        op_arith;
+
+  // Product (first addend of FADD/FSUB) and addend
+  wire [47:0] prod;
+  wire        p_sign;
+  wire        p_zero;
+  wire        p_inf;
+  wire        p_inv;
+  wire [ 9:0] p_exp;
+  wire [47:0] p_sig;
+  wire        c_none;
+  wire        c_sign;
+  wire        c_zero;
+  wire        c_inf;
+  wire [31:0] c_packed;
+  wire [ 9:0] c_exp;
+  wire [23:0] c_sig;
+
+  // Arithmetic special cases
+  wire        nan_in;
+  wire        snan_in;
+  wire        ar_clash;
+  wire        ar_nan;
+  wire        ar_nv;
+  wire        ar_special;
+  wire        zero_sign;
+  reg  [31:0] ar_res;
+
+  // Integer to float conversion
+  wire        int_neg;
+  wire [31:0] int_abs;
+  reg  [ 4:0] int_lz;
+  wire [ 9:0] int_exp;
+  wire [47:0] int_sig;
+
+  // Simple opcodes
+  reg  [31:0] sgnj_res;
+  wire        lt_raw;
+  wire        both_zero;
+  wire        cmp_lt;
+  wire        cmp_eq;
+  reg         cmp_res;
+  wire        cmp_nv;
+  wire [31:0] minmax_res;
+  wire        a_normal;
+  wire [ 9:0] class_res;
+
+  // Float to integer conversion
+  wire signed [9:0] cv_ue;
+  wire [ 5:0] cv_sh;
+  wire [63:0] cv_frame;
+  wire [31:0] cv_int;
+  wire        cv_g;
+  wire        cv_s;
+  reg         cv_inc;
+  wire [32:0] cv_mag;
+  wire        cv_ovf;
+  wire [31:0] cv_sat;
+  wire [31:0] cv_res;
+
+  // Stage 1 result
+  wire        go_s2;
+  reg  [31:0] spec_res;
+  reg  [ 4:0] spec_flags;
+
+  // Stage 2 registers
+  reg         s2_valid;
+  reg         s2_special;
+  reg  [31:0] s2_spec_res;
+  reg  [ 4:0] s2_spec_flags;
+  reg  [ 2:0] s2_rm;
+  reg         s2_p_sign;
+  reg  [ 9:0] s2_p_exp;
+  reg  [47:0] s2_p_sig;
+  reg         s2_c_sign;
+  reg  [ 9:0] s2_c_exp;
+  reg  [23:0] s2_c_sig;
+  reg         s2_c_zero;
+
+  // Alignment and addition
+  wire [10:0] diff;
+  wire        p_big;
+  wire [10:0] sh_abs;
+  wire [ 5:0] sh;
+  wire [47:0] m_big;
+  wire [47:0] m_small;
+  wire [ 9:0] e_big;
+  wire        s_big;
+  wire        eff_sub;
+  wire [101:0] small_wide;
+  wire [50:0] small_f;
+  wire [50:0] big_f;
+  wire [50:0] sum;
+  wire        sum_neg;
+  wire [50:0] mag;
+
+  // Normalization
+  reg  [ 5:0] lz;
+  wire [50:0] norm;
+  wire        exact_zero;
+  wire [ 9:0] r_exp;
+  wire [25:0] r_sig;
+  wire        r_sign;
+
+  // Stage 3 registers and rounding
+  reg         s3_valid;
+  reg         s3_special;
+  reg  [31:0] s3_spec_res;
+  reg  [ 4:0] s3_spec_flags;
+  reg  [ 2:0] s3_rm;
+  reg         s3_sign;
+  reg  [ 9:0] s3_exp;
+  reg  [25:0] s3_sig;
+  wire [31:0] rnd_res;
+  wire        rnd_of;
+  wire        rnd_uf;
+  wire        rnd_nx;
+
+
+  ///////////////////////////////////////////////////////////////////////////
+  // STAGE 1 (EX PHASE)
+  ///////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Operand unpacking
+   */
+  fpunpack unpack_a (
+    .i_in   (i_in_a),
+    .o_sign (a_sign),
+    .o_exp  (a_exp),
+    .o_sig  (a_sig),
+    .o_zero (a_zero),
+    .o_subn (a_subn),
+    .o_inf  (a_inf),
+    .o_nan  (a_nan),
+    .o_snan (a_snan)
+  );
+
+  // verilator lint_off PINCONNECTEMPTY
+  fpunpack unpack_b (
+    .i_in   (i_in_b),
+    .o_sign (b_sign),
+    .o_exp  (b_exp),
+    .o_sig  (b_sig),
+    .o_zero (b_zero),
+    .o_subn (),
+    .o_inf  (b_inf),
+    .o_nan  (b_nan),
+    .o_snan (b_snan)
+  );
+
+  fpunpack unpack_c (
+    .i_in   (i_in_c),
+    .o_sign (c_sign_in),
+    .o_exp  (c_exp_in),
+    .o_sig  (c_sig_in),
+    .o_zero (c_zero_in),
+    .o_subn (),
+    .o_inf  (c_inf_in),
+    .o_nan  (c_nan_in),
+    .o_snan (c_snan_in)
+  );
+  // verilator lint_on PINCONNECTEMPTY
+
+  /**
+   * Opcode decoding
+   *  Dynamic rounding mode with the invalid frm value works as RNE
+   */
+  assign rm = (i_rm == 3'b111) ? i_frm : i_rm;
+
+  assign op_add    = (i_op[4:1] == 4'b0000);
+  assign op_mul    = (i_op == 5'b00010);
+  assign op_fma    = (i_op[4:2] == 3'b001);
+  assign op_sgnj   = (i_op[4:2] == 3'b010);
+  assign op_minmax = (i_op[4:1] == 4'b0110);
+  assign op_cmp    = (i_op[4:2] == 3'b100);
+  assign op_cvtws  = (i_op[4:1] == 4'b1010);
+  assign op_cvtsw  = (i_op[4:1] == 4'b1011);
+  assign op_class  = (i_op == 5'b11001);
+  assign op_arith  = op_add || op_mul || op_fma;
+
+  /**
+   * Product and addend
+   *  FADD/FSUB pass A as the product and B as the addend, FMUL and the
+   *  integer conversion have no addend. Product of normalized significands
+   *  is in [1, 4), it's normalized to the leading one at bit 47.
+   */
+  assign prod = {24'd0, a_sig} * {24'd0, b_sig};
+
+  assign p_sign = (op_add) ? a_sign : (a_sign ^ b_sign ^ (op_fma && i_op[1]));
+  assign p_zero = (op_add) ? a_zero : (a_zero || b_zero);
+  assign p_inf  = (op_add) ? a_inf  : (a_inf || b_inf);
+  assign p_inv  = !op_add && ((a_inf && b_zero) || (a_zero && b_inf));
+  assign p_exp  =
+    (op_cvtsw) ? int_exp :
+    (op_add)   ? a_exp : (a_exp + b_exp - 10'd126 - {9'd0, !prod[47]});
+  assign p_sig  =
+    (op_cvtsw) ? int_sig :
+    (op_add)   ? {a_sig, 24'd0} :
+    (prod[47]) ? prod : {prod[46:0], 1'b0};
+
+  assign c_none   = !(op_add || op_fma);
+  assign c_sign   = ((op_add) ? b_sign : c_sign_in) ^ i_op[0];
+  assign c_zero   = (op_add) ? b_zero : c_zero_in;
+  assign c_inf    = (op_add) ? b_inf  : c_inf_in;
+  assign c_packed = (op_add) ? i_in_b : i_in_c;
+  assign c_exp    = (op_add) ? b_exp  : c_exp_in;
+  assign c_sig    = (op_add) ? b_sig  : c_sig_in;
+
+  /**
+   * Arithmetic special cases
+   *  NaN operands, invalid operations (inf * 0, inf - inf), infinities and
+   *  zero products don't need the second stage. Sum of the zeros of the
+   *  different signs is -0 only when rounding down.
+   */
+  assign nan_in   = a_nan || b_nan || (op_fma && c_nan_in);
+  assign snan_in  = a_snan || b_snan || (op_fma && c_snan_in);
+  assign ar_clash = !nan_in && p_inf && !c_none && c_inf && (p_sign != c_sign);
+  assign ar_nan   = nan_in || p_inv || ar_clash;
+  assign ar_nv    = snan_in || p_inv || ar_clash;
+  assign ar_special = ar_nan || p_inf || (!c_none && c_inf) || p_zero;
+  assign zero_sign =
+    (c_none || (p_sign == c_sign)) ? p_sign : (rm == 3'b010);
+
+  always @* begin
+    if (ar_nan) begin
+      ar_res = 32'h7FC00000;
+    end else if (p_inf) begin
+      ar_res = {p_sign, 31'h7F800000};
+    end else if (!c_none && c_inf) begin
+      ar_res = {c_sign, 31'h7F800000};
+    end else if (c_none || c_zero) begin
+      ar_res = {zero_sign, 31'd0};
+    end else begin
+      ar_res = {c_sign, c_packed[30:0]};
+    end
+  end
+
+  /**
+   * Integer to float conversion
+   *  Integer is normalized like the product, value is abs * 2^(31 - lz)
+   */
+  assign int_neg = !i_op[0] && i_in_a[31];
+  assign int_abs = (int_neg) ? -i_in_a : i_in_a;
+
+  always @* begin
+    int_lz = 5'd0;
+    for (integer i = 0; i < 32; i = i + 1) begin
+      if (int_abs[i]) int_lz = 5'd31 - i[4:0];
+    end
+  end
+
+  assign int_exp = 10'd158 - {5'd0, int_lz};
+  assign int_sig = {int_abs << int_lz, 16'd0};
+
+  /**
+   * Sign injection
+   */
+  always @* begin
+    case (i_op[1:0])
+      2'b00:   sgnj_res = {b_sign, i_in_a[30:0]};
+      2'b01:   sgnj_res = {!b_sign, i_in_a[30:0]};
+      default: sgnj_res = {a_sign ^ b_sign, i_in_a[30:0]};
+    endcase
+  end
+
+  /**
+   * Comparison
+   *  Raw order has -0 below +0 (used by FMIN/FMAX), comparisons treat them
+   *  as equal. FEQ only signals on signaling NaNs, FLT/FLE on all NaNs.
+   */
+  assign lt_raw = (a_sign != b_sign) ? a_sign :
+    (i_in_a[30:0] != i_in_b[30:0]) && ((i_in_a[30:0] < i_in_b[30:0]) ^ a_sign);
+  assign both_zero = a_zero && b_zero;
+  assign cmp_lt = lt_raw && !both_zero;
+  assign cmp_eq = (i_in_a == i_in_b) || both_zero;
+
+  always @* begin
+    case (i_op[1:0])
+      2'b00:   cmp_res = cmp_lt || cmp_eq;
+      2'b01:   cmp_res = cmp_lt;
+      default: cmp_res = cmp_eq;
+    endcase
+  end
+
+  assign cmp_nv = (i_op[1]) ? (a_snan || b_snan) : (a_nan || b_nan);
+
+  assign minmax_res =
+    (a_nan && b_nan)     ? 32'h7FC00000 :
+    (a_nan)              ? i_in_b :
+    (b_nan)              ? i_in_a :
+    (lt_raw ^ i_op[0])   ? i_in_a : i_in_b;
+
+  /**
+   * Classification
+   */
+  assign a_normal = !(a_zero || a_subn || a_inf || a_nan);
+  assign class_res = {
+    a_nan && !a_snan,
+    a_snan,
+    !a_sign && a_inf,
+    !a_sign && a_normal,
+    !a_sign && a_subn,
+    !a_sign && a_zero,
+    a_sign && a_zero,
+    a_sign && a_subn,
+    a_sign && a_normal,
+    a_sign && a_inf
+  };
+
+  /**
+   * Float to integer conversion
+   *  Number is placed in a fixed point frame with 32 integer and 32 fraction
+   *  bits, numbers below 2^-9 only set the sticky bit, numbers above 2^31
+   *  saturate. NaN saturates to the largest positive integer.
+   */
+  assign cv_ue = a_exp - 10'd127;
+  assign cv_sh = cv_ue[5:0] + 6'd9;
+  assign cv_frame = (cv_ue < -10'sd9) ? {63'd0, !a_zero} :
+    ({40'd0, a_sig} << cv_sh);
+  assign cv_int = cv_frame[63:32];
+  assign cv_g = cv_frame[31];
+  assign cv_s = |cv_frame[30:0];
+
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case (rm)
+      3'b001:  cv_inc = 1'b0;
+      3'b010:  cv_inc =  a_sign && (cv_g || cv_s);
+      3'b011:  cv_inc = !a_sign && (cv_g || cv_s);
+      3'b100:  cv_inc = cv_g;
+      default: cv_inc = cv_g && (cv_s || cv_int[0]);
+    endcase
+  end
+
+  assign cv_mag = {1'b0, cv_int} + {32'd0, cv_inc};
+  assign cv_ovf = (cv_ue > 10'sd31) || ((i_op[0]) ?
+    (cv_mag[32] || (a_sign && (cv_mag != 33'd0))) :
+    (cv_mag > {1'b0, 32'h7FFFFFFF} + {32'd0, a_sign}));
+  assign cv_sat = (a_sign && !a_nan) ?
+    ((i_op[0]) ? 32'h00000000 : 32'h80000000) :
+    ((i_op[0]) ? 32'hFFFFFFFF : 32'h7FFFFFFF);
+  assign cv_res = (cv_ovf) ? cv_sat :
+    (a_sign) ? -cv_mag[31:0] : cv_mag[31:0];
+
+  /**
+   * Stage 1 result
+   *  Everything but the regular arithmetic results and non-zero integer
+   *  conversions is done here
+   */
+  assign go_s2 = (op_arith && !ar_special) || (op_cvtsw && (int_abs != 0));
+
+  always @* begin
+    spec_flags = 5'd0;
+    case (1'b1)
+      op_arith: begin
+        spec_res = ar_res;
+        spec_flags = {ar_nv, 4'd0};
+      end
+      op_sgnj: begin
+        spec_res = sgnj_res;
+      end
+      op_minmax: begin
+        spec_res = minmax_res;
+        spec_flags = {a_snan || b_snan, 4'd0};
+      end
+      op_cmp: begin
+        spec_res = {31'd0, cmp_res && !a_nan && !b_nan};
+        spec_flags = {cmp_nv, 4'd0};
+      end
+      op_cvtws: begin
+        spec_res = cv_res;
+        spec_flags = {cv_ovf, 3'd0, !cv_ovf && (cv_g || cv_s)};
+      end
+      op_class: begin
+        spec_res = {22'd0, class_res};
+      end
+      default: begin
+        // FMV.X.W, FMV.W.X and the zero integer conversion
+        spec_res = (op_cvtsw) ? 32'd0 : i_in_a;
+      end
+    endcase
+  end
+
+  /**
+   * Stage 2 registers
+   *  Trapped opcode doesn't accrue the flags
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      s2_valid      <= 0;
+      s2_special    <= 0;
+    end else if (i_clk_ce) begin
+      s2_valid      <= i_fpu_en && !i_trap;
+      s2_special    <= !go_s2;
+      s2_spec_res   <= spec_res;
+      s2_spec_flags <= spec_flags;
+      s2_rm         <= rm;
+      s2_p_sign     <= (op_cvtsw) ? int_neg : p_sign;
+      s2_p_exp      <= p_exp;
+      s2_p_sig      <= p_sig;
+      s2_c_sign     <= c_sign;
+      s2_c_exp      <= c_exp;
+      s2_c_sig      <= c_sig;
+      s2_c_zero     <= c_none || c_zero;
+    end
+  end
+
+  ///////////////////////////////////////////////////////////////////////////
+  // STAGE 2 (MA PHASE)
+  ///////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Alignment
+   *  Smaller operand is shifted right in the 51 bit frame (carry, 48 bits,
+   *  2 guard bits), bits shifted out go to the sticky bit. When the exponents
+   *  are equal the addend may be the larger one, then the difference is
+   *  negated (no bits were shifted out, so it's exact).
+   */
+  assign diff = {s2_p_exp[9], s2_p_exp} - {s2_c_exp[9], s2_c_exp};
+  assign p_big = s2_c_zero || !diff[10];
+  assign sh_abs = (p_big) ? diff : -diff;
+  assign sh = (s2_c_zero) ? 6'd0 : (sh_abs > 11'd52) ? 6'd52 : sh_abs[5:0];
+
+  assign m_big   = (p_big) ? s2_p_sig : {s2_c_sig, 24'd0};
+  assign m_small = (s2_c_zero) ? 48'd0 : (p_big) ? {s2_c_sig, 24'd0} : s2_p_sig;
+  assign e_big   = (p_big) ? s2_p_exp : s2_c_exp;
+  assign s_big   = (p_big) ? s2_p_sign : s2_c_sign;
+  assign eff_sub = s2_p_sign ^ s2_c_sign;
+
+  assign small_wide = {1'b0, m_small, 2'b00, 51'd0} >> sh;
+  assign small_f = {small_wide[101:52], small_wide[51] || |small_wide[50:0]};
+  assign big_f   = {1'b0, m_big, 2'b00};
+
+  /**
+   * Addition
+   */
+  assign sum = (eff_sub) ? (big_f - small_f) : (big_f + small_f);
+  assign sum_neg = eff_sub && sum[50];
+  assign mag = (sum_neg) ? -sum : sum;
+
+  /**
+   * Normalization
+   *  The last matching bit wins, so the highest one is found
+   */
+  always @* begin
+    lz = 6'd0;
+    for (integer i = 0; i < 51; i = i + 1) begin
+      if (mag[i]) lz = 6'd50 - i[5:0];
+    end
+  end
+
+  assign norm = mag << lz;
+  assign exact_zero = (mag == 51'd0);
+  assign r_exp = e_big + 10'd1 - {4'd0, lz};
+  assign r_sig = (exact_zero) ? 26'd0 : {norm[50:26], |norm[25:0]};
+  assign r_sign = (exact_zero) ? (s2_rm == 3'b010) : (s_big ^ sum_neg);
+
+  /**
+   * Stage 3 registers
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      s3_valid      <= 0;
+      s3_special    <= 0;
+    end else if (i_clk_ce) begin
+      s3_valid      <= s2_valid;
+      s3_special    <= s2_special;
+      s3_spec_res   <= s2_spec_res;
+      s3_spec_flags <= s2_spec_flags;
+      s3_rm         <= s2_rm;
+      s3_sign       <= r_sign;
+      s3_exp        <= r_exp;
+      s3_sig        <= r_sig;
+    end
+  end
+
+  ///////////////////////////////////////////////////////////////////////////
+  // STAGE 3 (WB PHASE)
+  ///////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Rounding
+   */
+  fpround fpround_i (
+    .i_sign   (s3_sign),
+    .i_exp    (s3_exp),
+    .i_sig    (s3_sig),
+    .i_rm     (s3_rm),
+    .o_result (rnd_res),
+    .o_of     (rnd_of),
+    .o_uf     (rnd_uf),
+    .o_nx     (rnd_nx)
+  );
+
+  /**
+   * Output assignment
+   */
+  assign o_result   = (s3_special) ? s3_spec_res : rnd_res;
+  assign o_busy     = s2_valid || s3_valid;
+  assign o_flags_en = i_clk_ce && s3_valid;
+  assign o_flags    = (s3_special) ? s3_spec_flags :
+    {2'b00, rnd_of, rnd_uf, rnd_nx};
+
+endmodule
@@ -0,0 +1,85 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: fpunpack.v
+ *
+ * This file contains the single-precision operand unpacker used by the FP
+ * units. Subnormal numbers are normalized, so the significand always has
+ * the leading one at bit 23 (unless it's zero) and the exponent can go
+ * below one. Value of the number is sig / 2^23 * 2^(exp - 127).
+ *
+ * i_in     - Packed single-precision number
+ *
+ * o_sign   - Sign
+ * o_exp    - Biased exponent (signed, -22 to 255)
+ * o_sig    - Normalized significand (with the leading one)
+ * o_zero   - Number is zero
+ * o_subn   - Number is subnormal
+ * o_inf    - Number is infinity
+ * o_nan    - Number is NaN (quiet or signaling)
+ * o_snan   - Number is signaling NaN
+ ***************************************************************************/
+`ifndef FPUNPACK_V
+`define FPUNPACK_V
+`include "config.v"
+
+module fpunpack (
+  input  [31:0] i_in,
+
+  output        o_sign,
+  output [ 9:0] o_exp,
+  output [23:0] o_sig,
+  output        o_zero,
+  output        o_subn,
+  output        o_inf,
+  output        o_nan,
+  output        o_snan
+);
+
+
+  // Fields
+  wire [ 7:0] exp;
+  wire [22:0] mant;
+  wire        exp_zero;
+  wire        exp_ones;
+  wire [23:0] sig;
+
+  // Normalization
+  reg  [ 4:0] lz;
+
+
+  /**
+   * Fields
+   */
+  assign exp = i_in[30:23];
+  assign mant = i_in[22:0];
+  assign exp_zero = (exp == 8'h00);
+  assign exp_ones = (exp == 8'hFF);
+  assign sig = {!exp_zero, mant};
+
+  /**
+   * Normalization (only subnormals have leading zeros)
+   *  The last matching bit wins, so the highest one is found
+   */
+  always @* begin
+    lz = 5'd0;
+    for (integer i = 0; i < 24; i = i + 1) begin
+      if (sig[i]) lz = 5'd23 - i[4:0];
+    end
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_sign = i_in[31];
+  assign o_exp  = {2'b00, exp | {7'd0, exp_zero}} - {5'd0, lz};
+  assign o_sig  = sig << lz;
+  assign o_zero = exp_zero && (mant == 23'd0);
+  assign o_subn = exp_zero && (mant != 23'd0);
+  assign o_inf  = exp_ones && (mant == 23'd0);
+  assign o_nan  = exp_ones && (mant != 23'd0);
+  assign o_snan = o_nan && !mant[22];
+
+endmodule
+
+`endif
@@ -0,0 +1,102 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: fregs.v
+ *
+ * Floating-point register array (F extension), it works just like the
+ * integer one (see regs.v) but it has the third read port for the FMA
+ * opcodes (RS3) and f0 is a normal register. With POSEDGE_ONLY the array is
+ * written on the rising edge and read asynchronously.
+ *
+ * i_clk       - Clock input
+ * i_ce        - Clock enable input
+ * i_addr_rd_a - Read address 1 (RS1)
+ * i_addr_rd_b - Read address 2 (RS2)
+ * i_addr_rd_c - Read address 3 (RS3)
+ * i_we        - Write enable input
+ * i_addr_wr   - Write address (RD)
+ * i_dat_wr    - Write data (RD)
+ *
+ * o_dat_rd_a  - Read data 1 (RS1)
+ * o_dat_rd_b  - Read data 2 (RS2)
+ * o_dat_rd_c  - Read data 3 (RS3)
+ ***************************************************************************/
+`include "config.v"
+
+module fregs (
+  input         i_clk,
+  input         i_ce,
+
+  input  [ 4:0] i_addr_rd_a,
+  input  [ 4:0] i_addr_rd_b,
+  input  [ 4:0] i_addr_rd_c,
+
+  input         i_we,
+  input  [ 4:0] i_addr_wr,
+  input  [31:0] i_dat_wr,
+
+  output [31:0] o_dat_rd_a,
+  output [31:0] o_dat_rd_b,
+  output [31:0] o_dat_rd_c
+);
+
+  // Register array
+`ifdef HARDWARE_TIPS
+`ifdef REGS_DISTRIBUTED
+  (* ram_style = "distributed" *)
+`else
+  (* ram_style = "block" *)
+`endif
+`endif
+  reg [31:0] registers [0:31];
+`ifndef POSEDGE_ONLY
+  reg [31:0] dat_rd_a_reg = 0;
+  reg [31:0] dat_rd_b_reg = 0;
+  reg [31:0] dat_rd_c_reg = 0;
+`endif
+
+  // Register array initialization (filling with zeros), this is required for
+  //  the simulation to eliminate undefined values at the start
+`ifndef HARDWARE_TIPS
+  initial begin
+    for (integer i = 0; i < 32; i=i+1) begin
+      registers[i] = 32'd0;
+    end
+  end
+`endif
+
+`ifdef POSEDGE_ONLY
+  // Register write process
+  always @(posedge i_clk) begin
+    if (i_ce && i_we) begin
+      registers[i_addr_wr] <= i_dat_wr;
+    end
+  end
+
+  /**
+   * Output assgnment
+   */
+  assign o_dat_rd_a = registers[i_addr_rd_a];
+  assign o_dat_rd_b = registers[i_addr_rd_b];
+  assign o_dat_rd_c = registers[i_addr_rd_c];
+`else
+  // Register read/write process
+  always @(posedge i_clk) begin
+    dat_rd_a_reg <= registers[i_addr_rd_a];
+    dat_rd_b_reg <= registers[i_addr_rd_b];
+    dat_rd_c_reg <= registers[i_addr_rd_c];
+
+    if (i_ce && i_we) begin
+      registers[i_addr_wr] <= i_dat_wr;
+    end
+  end
+
+  /**
+   * Output assgnment
+   */
+  assign o_dat_rd_a = dat_rd_a_reg;
+  assign o_dat_rd_b = dat_rd_b_reg;
+  assign o_dat_rd_c = dat_rd_c_reg;
+`endif
+
+endmodule
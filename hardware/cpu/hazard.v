@@ -23,11 +23,47 @@
  * i_ex_wb_mux - Write back source in EX phase
  * i_ma_wb_mux - Write back source in MA phase
  * i_ex_ret    - Data in EX return address register
- * i_ma_rd_dat - Load data in MA circuitry
+ * i_ex_res    - Result of the EX phase (ALU or CSR)
+ * i_ma_rd_dat - Load data in MA circuitry (unused with POSEDGE_ONLY)
  * i_ma_res    - Data in ALU result in MA phase
  * i_ma_ret    - Data in MA return address register
  * i_wb_wb_d   - Data in WB phase write back register
  *
+ * i_rd        - Current RD register
+ * i_wb_en     - Current opcode writes back
+ * i_md_en     - Current opcode is Mul/Div opcode
+ * i_md_hz_en  - Mul/Div unit is occupied
+ * i_md_hz_reg - RD register of the Mul/Div unit opcode
+ *
+ * With F_EXTENSION the registers have the 6th bit (FP register file), FPU
+ * results (write back source 3) are rounded in WB phase, so they're only
+ * forwarded from there, and the FDIV/FSQRT unit uses the scoreboard like the
+ * Mul/Div unit does:
+ *
+ * i_system    - Current opcode is a system opcode (CSR access)
+ * i_fp_busy   - FP opcode is in the pipeline (fflags not up to date)
+ * i_fd_en     - Current opcode is FDIV/FSQRT opcode
+ * i_fd_hz_en  - FDIV/FSQRT unit is occupied
+ * i_fd_hz_reg - RD register of the FDIV/FSQRT unit opcode
+ *
+ * With DUAL_ISSUE (one instance per issue slot) the second pipe only
+ * carries ALU results, so they're forwarded like the results of the first
+ * one, in the same phase the second pipe has the younger instruction:
+ *
+ * i_ex1_wb_reg  - RD register in EX phase of the second pipe
+ * i_ma1_wb_reg  - RD register in MA phase of the second pipe
+ * i_wb1_wb_reg  - RD register in WB phase of the second pipe
+ * i_ex1_wb_en   - Write back in EX phase of the second pipe
+ * i_ma1_wb_en   - Write back in MA phase of the second pipe
+ * i_wb1_wb_en   - Write back in WB phase of the second pipe
+ * i_ex1_res     - ALU result in EX phase of the second pipe
+ * i_ma1_res     - ALU result in MA phase of the second pipe
+ * i_wb1_wb_d    - Data in WB phase of the second pipe
+ * i_pair_rd     - RD register of the opcode in the first slot (pairing)
+ * i_pair_wb_en  - Opcode in the first slot writes back
+ * o_hz_pair     - Opcode reads the result of the first slot (can't be
+ *                 issued along with it)
+ *
  * o_rs1_d     - Forwarded data from RS1
  * o_rs2_d     - Forwarded data from RS2
  * o_hz_data   - Unforwardable hazard output (also normal hazard when
@@ -39,12 +75,12 @@ module hazard (
   input         i_hz_rs1,
   input         i_hz_rs2,
 
-  input   [4:0] i_rs1,
-  input   [4:0] i_rs2,
+  input  [`REG_BITS-1:0] i_rs1,
+  input  [`REG_BITS-1:0] i_rs2,
 
-  input   [4:0] i_ex_wb_reg,
-  input   [4:0] i_ma_wb_reg,
-  input   [4:0] i_wb_wb_reg,
+  input  [`REG_BITS-1:0] i_ex_wb_reg,
+  input  [`REG_BITS-1:0] i_ma_wb_reg,
+  input  [`REG_BITS-1:0] i_wb_wb_reg,
 
   input         i_ex_wb_en,
   input         i_ma_wb_en,
@@ -55,12 +91,53 @@ module hazard (
   input   [1:0] i_ma_wb_mux,
 
   input  [31:0] i_ex_ret,
+`ifdef HAZARD_EX_FORWARDING
+  input  [31:0] i_ex_res,
+`endif
   input  [31:0] i_ma_rd_dat,
   input  [31:0] i_ma_res,
   input  [31:0] i_ma_ret,
   input  [31:0] i_wb_wb_d,
 `endif
 
+`ifdef HAZARD_SCOREBOARD
+  input  [`REG_BITS-1:0] i_rd,
+  input         i_wb_en,
+`endif
+
+`ifdef MULDIV_SCOREBOARD
+  input         i_md_en,
+  input         i_md_hz_en,
+  input  [`REG_BITS-1:0] i_md_hz_reg,
+`endif
+
+`ifdef F_EXTENSION
+  input         i_system,
+  input         i_fp_busy,
+  input         i_fd_en,
+  input         i_fd_hz_en,
+  input  [`REG_BITS-1:0] i_fd_hz_reg,
+`endif
+
+`ifdef DUAL_ISSUE
+  input  [`REG_BITS-1:0] i_ex1_wb_reg,
+  input  [`REG_BITS-1:0] i_ma1_wb_reg,
+  input  [`REG_BITS-1:0] i_wb1_wb_reg,
+  input         i_ex1_wb_en,
+  input         i_ma1_wb_en,
+  input         i_wb1_wb_en,
+`ifdef HAZARD_DATA_FORWARDNG
+`ifdef HAZARD_EX_FORWARDING
+  input  [31:0] i_ex1_res,
+`endif
+  input  [31:0] i_ma1_res,
+  input  [31:0] i_wb1_wb_d,
+`endif
+  input  [`REG_BITS-1:0] i_pair_rd,
+  input         i_pair_wb_en,
+  output        o_hz_pair,
+`endif
+
   input  [31:0] i_rs1_raw_d,
   input  [31:0] i_rs2_raw_d,
 
@@ -75,7 +152,8 @@ module hazard (
    * If hazard data forwarding is enabled hazard unit tries to forward the
    *  data from the pipeline, if it cannot be done data hazard is generated,
    *  using MUX6 to do the switching isn't ideal but it's the least bad
-   *  option that I have
+   *  option that I have. When more than one phase writes the register the
+   *  youngest one (closest to ID) wins, so older hazards are masked.
    */
 
   // Hazard enables for read registers
@@ -106,11 +184,20 @@ module hazard (
   wire        hz_ex_ret2;
   wire        hz_ex_rd2;
 
+  // Hazards in the second pipe (DUAL_ISSUE, zero otherwise)
+  wire        hz2_wb1;
+  wire        hz2_wb2;
+  wire        hz2_ma1;
+  wire        hz2_ma2;
+  wire        hz2_ex1;
+  wire        hz2_ex2;
+
   // Forwarding to read registers
   reg  [31:0] rs1_d;
   reg  [31:0] rs2_d;
 
   // Unrecoverable hazard
+  wire        hz_ma_ld;
   wire        hz_data;
 
 
@@ -119,28 +206,55 @@ module hazard (
   assign rs2_hz_en = i_hz_rs2 && |i_rs2;
 
   // Hazards at write back phase
-  assign hz_wb1 = rs1_hz_en && (i_rs1 == i_wb_wb_reg) && i_wb_wb_en;
-  assign hz_wb2 = rs2_hz_en && (i_rs2 == i_wb_wb_reg) && i_wb_wb_en;
+  assign hz_wb1 = rs1_hz_en && (i_rs1 == i_wb_wb_reg) && i_wb_wb_en &&
+    !hz2_wb1 && !hz_ma1 && !hz2_ma1 && !hz_ex1 && !hz2_ex1;
+  assign hz_wb2 = rs2_hz_en && (i_rs2 == i_wb_wb_reg) && i_wb_wb_en &&
+    !hz2_wb2 && !hz_ma2 && !hz2_ma2 && !hz_ex2 && !hz2_ex2;
 
-  // Hazards at memory access phase
-  assign hz_ma1     = rs1_hz_en && (i_rs1 == i_ma_wb_reg) && i_ma_wb_en;
-  assign hz_ma2     = rs2_hz_en && (i_rs2 == i_ma_wb_reg) && i_ma_wb_en;
+  // Hazards at memory access phase (load and FPU data have the LSB set)
+  assign hz_ma1     = rs1_hz_en && (i_rs1 == i_ma_wb_reg) && i_ma_wb_en &&
+    !hz2_ma1 && !hz_ex1 && !hz2_ex1;
+  assign hz_ma2     = rs2_hz_en && (i_rs2 == i_ma_wb_reg) && i_ma_wb_en &&
+    !hz2_ma2 && !hz_ex2 && !hz2_ex2;
   assign hz_ma_res1 = hz_ma1 && (i_ma_wb_mux == 2'b00);
   assign hz_ma_ret1 = hz_ma1 && (i_ma_wb_mux == 2'b10);
-  assign hz_ma_rd1  = hz_ma1 && (i_ma_wb_mux == 2'b01);
+  assign hz_ma_rd1  = hz_ma1 && i_ma_wb_mux[0];
   assign hz_ma_res2 = hz_ma2 && (i_ma_wb_mux == 2'b00);
   assign hz_ma_ret2 = hz_ma2 && (i_ma_wb_mux == 2'b10);
-  assign hz_ma_rd2  = hz_ma2 && (i_ma_wb_mux == 2'b01);
+  assign hz_ma_rd2  = hz_ma2 && i_ma_wb_mux[0];
 
   // Hazards at execute phase
-  assign hz_ex1     = rs1_hz_en && (i_rs1 == i_ex_wb_reg) && i_ex_wb_en;
-  assign hz_ex2     = rs2_hz_en && (i_rs2 == i_ex_wb_reg) && i_ex_wb_en;
+  assign hz_ex1     = rs1_hz_en && (i_rs1 == i_ex_wb_reg) && i_ex_wb_en &&
+    !hz2_ex1;
+  assign hz_ex2     = rs2_hz_en && (i_rs2 == i_ex_wb_reg) && i_ex_wb_en &&
+    !hz2_ex2;
   assign hz_ex_res1 = hz_ex1 && (i_ex_wb_mux == 2'b00);
   assign hz_ex_ret1 = hz_ex1 && (i_ex_wb_mux == 2'b10);
-  assign hz_ex_rd1  = hz_ex1 && (i_ex_wb_mux == 2'b01);
+  assign hz_ex_rd1  = hz_ex1 && i_ex_wb_mux[0];
   assign hz_ex_res2 = hz_ex2 && (i_ex_wb_mux == 2'b00);
   assign hz_ex_ret2 = hz_ex2 && (i_ex_wb_mux == 2'b10);
-  assign hz_ex_rd2  = hz_ex2 && (i_ex_wb_mux == 2'b01);
+  assign hz_ex_rd2  = hz_ex2 && i_ex_wb_mux[0];
+
+  // Hazards in the second pipe (younger than the first one in every phase)
+`ifdef DUAL_ISSUE
+  assign hz2_wb1 = rs1_hz_en && (i_rs1 == i_wb1_wb_reg) && i_wb1_wb_en &&
+    !hz_ma1 && !hz2_ma1 && !hz_ex1 && !hz2_ex1;
+  assign hz2_wb2 = rs2_hz_en && (i_rs2 == i_wb1_wb_reg) && i_wb1_wb_en &&
+    !hz_ma2 && !hz2_ma2 && !hz_ex2 && !hz2_ex2;
+  assign hz2_ma1 = rs1_hz_en && (i_rs1 == i_ma1_wb_reg) && i_ma1_wb_en &&
+    !hz_ex1 && !hz2_ex1;
+  assign hz2_ma2 = rs2_hz_en && (i_rs2 == i_ma1_wb_reg) && i_ma1_wb_en &&
+    !hz_ex2 && !hz2_ex2;
+  assign hz2_ex1 = rs1_hz_en && (i_rs1 == i_ex1_wb_reg) && i_ex1_wb_en;
+  assign hz2_ex2 = rs2_hz_en && (i_rs2 == i_ex1_wb_reg) && i_ex1_wb_en;
+`else
+  assign hz2_wb1 = 0;
+  assign hz2_wb2 = 0;
+  assign hz2_ma1 = 0;
+  assign hz2_ma2 = 0;
+  assign hz2_ex1 = 0;
+  assign hz2_ex2 = 0;
+`endif
 
   // Forwarding to rs1
 `ifdef HARDWARE_TIPS
@@ -149,10 +263,22 @@ module hazard (
   always @* begin
     case (1'b1)
       hz_wb1:     rs1_d = i_wb_wb_d;
+`ifdef DUAL_ISSUE
+      hz2_wb1:    rs1_d = i_wb1_wb_d;
+      hz2_ma1:    rs1_d = i_ma1_res;
+`ifdef HAZARD_EX_FORWARDING
+      hz2_ex1:    rs1_d = i_ex1_res;
+`endif
+`endif
       hz_ma_res1: rs1_d = i_ma_res;
       hz_ma_ret1: rs1_d = i_ma_ret;
+`ifndef POSEDGE_ONLY
       hz_ma_rd1:  rs1_d = i_ma_rd_dat;
+`endif
       hz_ex_ret1: rs1_d = i_ex_ret;
+`ifdef HAZARD_EX_FORWARDING
+      hz_ex_res1: rs1_d = i_ex_res;
+`endif
       default:    rs1_d = i_rs1_raw_d;
     endcase
   end
@@ -164,16 +290,44 @@ module hazard (
   always @* begin
     case (1'b1)
       hz_wb2:     rs2_d = i_wb_wb_d;
+`ifdef DUAL_ISSUE
+      hz2_wb2:    rs2_d = i_wb1_wb_d;
+      hz2_ma2:    rs2_d = i_ma1_res;
+`ifdef HAZARD_EX_FORWARDING
+      hz2_ex2:    rs2_d = i_ex1_res;
+`endif
+`endif
       hz_ma_res2: rs2_d = i_ma_res;
       hz_ma_ret2: rs2_d = i_ma_ret;
+`ifndef POSEDGE_ONLY
       hz_ma_rd2:  rs2_d = i_ma_rd_dat;
+`endif
       hz_ex_ret2: rs2_d = i_ex_ret;
+`ifdef HAZARD_EX_FORWARDING
+      hz_ex_res2: rs2_d = i_ex_res;
+`endif
       default:    rs2_d = i_rs2_raw_d;
     endcase
   end
 
   // Critical unrecoverable hazards
-  assign hz_data = hz_ex_rd1 || hz_ex_rd2 || hz_ex_res1 || hz_ex_res2;
+  //  With POSEDGE_ONLY the load data arrives in WB phase so the loads in
+  //  MA phase can't be forwarded either, neither can the FPU results
+`ifdef HAZARD_EX_FORWARDING
+  assign hz_data = hz_ex_rd1 || hz_ex_rd2 || hz_ma_ld;
+`else
+  assign hz_data = hz_ex_rd1 || hz_ex_rd2 || hz_ex_res1 || hz_ex_res2 ||
+    hz2_ex1 || hz2_ex2 || hz_ma_ld;
+`endif
+`ifdef POSEDGE_ONLY
+  assign hz_ma_ld = hz_ma_rd1 || hz_ma_rd2;
+`else
+`ifdef F_EXTENSION
+  assign hz_ma_ld = (hz_ma_rd1 || hz_ma_rd2) && i_ma_wb_mux[1];
+`else
+  assign hz_ma_ld = 0;
+`endif
+`endif
 
 `else
   /*
@@ -195,16 +349,85 @@ module hazard (
     ((i_rs2 == i_ex_wb_reg) && i_ex_wb_en) ||
     ((i_rs2 == i_ma_wb_reg) && i_ma_wb_en) ||
     ((i_rs2 == i_wb_wb_reg) && i_wb_wb_en));
+`ifdef DUAL_ISSUE
+  wire        hz2_dat_rs1;
+  wire        hz2_dat_rs2;
+
+  assign hz2_dat_rs1 = i_hz_rs1 && (|i_rs1) && (
+    ((i_rs1 == i_ex1_wb_reg) && i_ex1_wb_en) ||
+    ((i_rs1 == i_ma1_wb_reg) && i_ma1_wb_en) ||
+    ((i_rs1 == i_wb1_wb_reg) && i_wb1_wb_en));
+  assign hz2_dat_rs2 = i_hz_rs2 && (|i_rs2) && (
+    ((i_rs2 == i_ex1_wb_reg) && i_ex1_wb_en) ||
+    ((i_rs2 == i_ma1_wb_reg) && i_ma1_wb_en) ||
+    ((i_rs2 == i_wb1_wb_reg) && i_wb1_wb_en));
+  assign hz_data = hz_dat_rs1 || hz_dat_rs2 || hz2_dat_rs1 || hz2_dat_rs2;
+`else
   assign hz_data = hz_dat_rs1 || hz_dat_rs2;
+`endif
 
   // Pass through for registers direcly, they won't be used on hazard anyway
   assign rs1_d = i_rs1_raw_d;
   assign rs2_d = i_rs2_raw_d;
 `endif
 
+`ifdef MULDIV_SCOREBOARD
+  /*
+   * Mul/Div scoreboard hazards
+   *  Result of the Mul/Div unit can't be forwarded until it's written back,
+   *  so the opcodes reading or writing its RD register are stalled, and so
+   *  is the next Mul/Div opcode (there's only one unit).
+   */
+  wire        hz_md;
+
+  assign hz_md = i_md_hz_en && (i_md_en ||
+    (i_hz_rs1 && |i_rs1 && (i_rs1 == i_md_hz_reg)) ||
+    (i_hz_rs2 && |i_rs2 && (i_rs2 == i_md_hz_reg)) ||
+    (i_wb_en && |i_rd && (i_rd == i_md_hz_reg)));
+`endif
+
+`ifdef F_EXTENSION
+  /*
+   * FDIV/FSQRT scoreboard hazards
+   *  Same as the Mul/Div ones, system opcodes also wait for all the FP
+   *  opcodes to finish, so the CSR accesses see the accrued flags.
+   */
+  wire        hz_fd;
+
+  assign hz_fd = (i_fd_hz_en && (i_fd_en ||
+    (i_hz_rs1 && |i_rs1 && (i_rs1 == i_fd_hz_reg)) ||
+    (i_hz_rs2 && |i_rs2 && (i_rs2 == i_fd_hz_reg)) ||
+    (i_wb_en && |i_rd && (i_rd == i_fd_hz_reg)))) ||
+    (i_system && i_fp_busy);
+`endif
+
+  /*
+   * Pairing hazard (DUAL_ISSUE)
+   *  Opcode in the second slot can't read the result of the opcode in the
+   *  first slot, they'd be in the same phase. Writes to the same register
+   *  are fine, the second slot always wins (it's the younger opcode).
+   */
+`ifdef DUAL_ISSUE
+  assign o_hz_pair = i_pair_wb_en && |i_pair_rd && (
+    (i_hz_rs1 && (i_rs1 == i_pair_rd)) ||
+    (i_hz_rs2 && (i_rs2 == i_pair_rd)));
+`endif
+
   assign o_rs1_d = rs1_d;
   assign o_rs2_d = rs2_d;
+`ifdef F_EXTENSION
+`ifdef MULDIV_SCOREBOARD
+  assign o_hz_data = hz_data || hz_md || hz_fd;
+`else
+  assign o_hz_data = hz_data || hz_fd;
+`endif
+`else
+`ifdef MULDIV_SCOREBOARD
+  assign o_hz_data = hz_data || hz_md;
+`else
   assign o_hz_data = hz_data;
+`endif
+`endif
 
 endmodule
 
@@ -0,0 +1,283 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: icache.v
+ *
+ * This file contains the instruction cache placed between the instruction
+ * port of the CPU and the slower backing memory bus. The cache is either
+ * direct mapped or 2-way set associative (with LRU replacement), its size
+ * is set with ICACHE_WAYS, ICACHE_SET_BITS and ICACHE_LINE_BITS options in
+ * config.v. Arrays are read on the falling edge of the clock, just like the
+ * single-cycle memory, so on a hit the data arrives in the same cycle. On a
+ * miss o_ready is cleared and the whole line is refilled word by word, the
+ * refill is never aborted (even if the CPU branches away in the meantime).
+ * Cache is invalidated only on reset.
+ *
+ * With POSEDGE_ONLY the arrays are read on the rising edge with the address
+ * of the next cycle (like the synchronous memory), the lookup is done with
+ * the registered address, and the lookup after the refill waits one cycle
+ * for the arrays to be read again.
+ *
+ * Backing bus works on the rising edge of the clock: address and read
+ * request are held until the memory answers with i_mem_ready, data is taken
+ * at the same clock edge, memory can take as many cycles as it needs.
+ *
+ * i_clk        - Clock input
+ * i_rst        - Reset input
+ *
+ * i_addr       - CPU instruction address (next one with POSEDGE_ONLY)
+ * o_data       - CPU instruction data
+ * o_ready      - Data is valid (hit), fetch has to wait if cleared
+ *
+ * o_mem_addr   - Backing memory address
+ * o_mem_rd     - Backing memory read request
+ * i_mem_data   - Backing memory data
+ * i_mem_ready  - Backing memory data is valid (ends the request)
+ *
+ * o_hits       - Cycles in which the fetch address hit the cache
+ * o_misses     - Number of line refills
+ ***************************************************************************/
+`include "config.v"
+
+module icache (
+  input         i_clk,
+  input         i_rst,
+
+  input  [31:0] i_addr,
+  output [31:0] o_data,
+  output        o_ready,
+
+  output [31:0] o_mem_addr,
+  output        o_mem_rd,
+  input  [31:0] i_mem_data,
+  input         i_mem_ready,
+
+  output [31:0] o_hits,
+  output [31:0] o_misses
+);
+
+  localparam WAYS = `ICACHE_WAYS;
+  localparam SETS = (1 << `ICACHE_SET_BITS);
+  localparam WORDS = (1 << `ICACHE_LINE_BITS);
+  localparam OFFSET_BITS = `ICACHE_LINE_BITS + 2;
+  localparam INDEX_BITS = `ICACHE_SET_BITS + `ICACHE_LINE_BITS;
+  localparam TAG_BITS = 32 - `ICACHE_SET_BITS - OFFSET_BITS;
+
+  // Address decoding
+  wire [31:0] addr;
+  wire [`ICACHE_SET_BITS-1:0] addr_set;
+  wire [TAG_BITS-1:0] addr_tag;
+  wire [`ICACHE_SET_BITS-1:0] rd_set;
+  wire [INDEX_BITS-1:0] rd_idx;
+`ifdef POSEDGE_ONLY
+  reg  [31:0] addr_reg;
+`endif
+
+  // Lookup
+  wire  [WAYS-1:0] hit_way;
+  wire [31:0] data_way [0:WAYS-1];
+  wire        hit;
+  wire        hit_1;
+
+  // Refill state
+  reg         refill;
+  reg  [31:0] fill_addr;
+  reg         fill_way;
+  wire        miss;
+  wire        fill_last;
+  wire        fill_we;
+  wire        victim;
+`ifdef POSEDGE_ONLY
+  reg         fill_end;
+`endif
+
+  // Replacement (2-way only, bit is the way to replace next)
+  reg  [SETS-1:0] lru;
+
+  // Statistics
+  reg  [31:0] hits;
+  reg  [31:0] misses;
+
+
+  /**
+   * Address decoding
+   *  Arrays are read with the CPU address, lookup is done with the address
+   *  that the read data belongs to (registered one with POSEDGE_ONLY)
+   */
+`ifdef POSEDGE_ONLY
+  always @(posedge i_clk) begin
+    addr_reg <= i_addr;
+  end
+
+  assign addr = addr_reg;
+`else
+  assign addr = i_addr;
+`endif
+
+  assign addr_set = addr[OFFSET_BITS +: `ICACHE_SET_BITS];
+  assign addr_tag = addr[31:32-TAG_BITS];
+  assign rd_set = i_addr[OFFSET_BITS +: `ICACHE_SET_BITS];
+  assign rd_idx = i_addr[2 +: INDEX_BITS];
+
+  /**
+   * Cache ways
+   *  Each way has its own data, tag and valid arrays, they are all read on
+   *  the falling edge (rising with POSEDGE_ONLY) and written on the rising
+   *  edge (during the refill).
+   */
+  genvar w;
+  generate
+    for (w = 0; w < WAYS; w = w + 1) begin : way
+`ifdef HARDWARE_TIPS
+      (* ram_style = "block" *)
+`endif
+      reg  [31:0] data [0:SETS*WORDS-1];
+`ifdef HARDWARE_TIPS
+      (* ram_style = "distributed" *)
+`endif
+      reg  [TAG_BITS-1:0] tag [0:SETS-1];
+      reg  [SETS-1:0] valid;
+      reg  [31:0] data_r;
+      reg  [TAG_BITS-1:0] tag_r;
+      reg         valid_r;
+      wire        we;
+
+      // Read process
+`ifdef POSEDGE_ONLY
+      always @(posedge i_clk) begin
+`else
+      always @(negedge i_clk) begin
+`endif
+        data_r  <= data[rd_idx];
+        tag_r   <= tag[rd_set];
+        valid_r <= valid[rd_set];
+      end
+
+      // Write process
+      always @(posedge i_clk) begin
+        if (we) begin
+          data[fill_addr[2 +: INDEX_BITS]] <= i_mem_data;
+        end
+        if (we && fill_last) begin
+          tag[fill_addr[OFFSET_BITS +: `ICACHE_SET_BITS]] <=
+            fill_addr[31:32-TAG_BITS];
+        end
+      end
+
+      // Valid bits (line is invalid while it's being refilled)
+      always @(posedge i_clk) begin
+        if (i_rst) begin
+          valid <= 0;
+        end else if (miss && (victim == w)) begin
+          valid[addr_set] <= 1'b0;
+        end else if (we && fill_last) begin
+          valid[fill_addr[OFFSET_BITS +: `ICACHE_SET_BITS]] <= 1'b1;
+        end
+      end
+
+      assign we = fill_we && (fill_way == w);
+      assign hit_way[w] = valid_r && (tag_r == addr_tag);
+      assign data_way[w] = data_r;
+    end
+  endgenerate
+
+  /**
+   * Lookup
+   */
+  assign hit = |hit_way;
+  assign hit_1 = (WAYS > 1) && hit_way[WAYS-1];
+  assign o_data = data_way[hit_1];
+`ifdef POSEDGE_ONLY
+  assign o_ready = hit && !refill && !fill_end;
+`else
+  assign o_ready = hit && !refill;
+`endif
+
+  /**
+   * Refill state machine
+   *  Miss starts the refill of the whole line, the line being refilled is
+   *  invalidated at the start so that it can't hit with the partial data.
+   *  Words are requested one by one starting from the beginning of the line.
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      refill    <= 0;
+      fill_addr <= 0;
+      fill_way  <= 0;
+    end else begin
+      if (miss) begin
+        refill    <= 1'b1;
+        fill_addr <= { addr[31:OFFSET_BITS], {OFFSET_BITS{1'b0}} };
+        fill_way  <= victim;
+      end else if (fill_we) begin
+        fill_addr <= fill_addr + 32'd4;
+        if (fill_last) begin
+          refill  <= 1'b0;
+        end
+      end
+    end
+  end
+
+  // Refilled line is read again before the next lookup
+`ifdef POSEDGE_ONLY
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      fill_end <= 0;
+    end else begin
+      fill_end <= fill_we && fill_last;
+    end
+  end
+`endif
+
+  // Miss starts the refill
+`ifdef POSEDGE_ONLY
+  assign miss = !refill && !fill_end && !hit;
+`else
+  assign miss = !refill && !hit;
+`endif
+  assign fill_we = refill && i_mem_ready;
+  assign fill_last = &fill_addr[2 +: `ICACHE_LINE_BITS];
+
+  /**
+   * Replacement
+   *  In the 2-way cache every set has a bit pointing at the way that wasn't
+   *  used recently, it's updated on every hit and on every refill.
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      lru <= 0;
+    end else if (o_ready) begin
+      lru[addr_set] <= !hit_1;
+    end else if (miss) begin
+      lru[addr_set] <= !victim;
+    end
+  end
+
+  assign victim = (WAYS > 1) && lru[addr_set];
+
+  /**
+   * Statistics
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      hits   <= 0;
+      misses <= 0;
+    end else begin
+      if (o_ready) begin
+        hits <= hits + 32'd1;
+      end
+      if (miss) begin
+        misses <= misses + 32'd1;
+      end
+    end
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_mem_addr = fill_addr;
+  assign o_mem_rd = refill;
+  assign o_hits = hits;
+  assign o_misses = misses;
+
+endmodule
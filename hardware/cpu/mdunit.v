@@ -0,0 +1,134 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: mdunit.v
+ *
+ * This file contains the Mul/Div functional unit used in the scoreboard
+ * mode. The operation is started in the EX phase just like in the ALU, if
+ * it finishes in time it leaves the EX phase as a normal ALU operation. If
+ * it doesn't, the operands and the destination register are latched, the
+ * opcode continues down the pipeline without the write back and the unit
+ * writes the result back on its own when it's done, using a free slot in
+ * the WB phase. Hazard unit stalls the opcodes that depend on the pending
+ * result, other ones keep flowing through the pipeline.
+ *
+ * i_clk       - Clock input
+ * i_clk_n     - Inverted clock input
+ * i_clk_ce    - Clock enable (pipeline advance)
+ * i_rst       - Reset input
+ *
+ * i_in_a      - Data input A (from the EX phase)
+ * i_in_b      - Data input B (from the EX phase)
+ * i_funct3    - Mul/Div function selector (from the EX phase)
+ * i_md_en     - Mul/Div opcode in the EX phase
+ * i_start     - First cycle of the opcode in EX phase (POSEDGE_ONLY only)
+ * i_ex_wb_reg - RD register in the EX phase
+ * i_wb_free   - There's no write back in the MA phase (slot is free)
+ *
+ * o_result    - Mul/Div result
+ * o_ex_wait   - EX phase opcode didn't finish, its write back is deferred
+ * o_hz_en     - Unit is (or may soon be) occupied, used for hazards
+ * o_hz_reg    - RD register of the pending (or EX phase) opcode
+ * o_wb_en     - Write back the pending result at this clock edge
+ * o_wb_reg    - RD register of the pending result
+ ***************************************************************************/
+`include "config.v"
+`include "muldiv.v"
+
+module mdunit (
+  input         i_clk,
+  input         i_clk_n,
+  input         i_clk_ce,
+  input         i_rst,
+
+  input  [31:0] i_in_a,
+  input  [31:0] i_in_b,
+  input  [ 2:0] i_funct3,
+  input         i_md_en,
+`ifdef POSEDGE_ONLY
+  input         i_start,
+`endif
+  input  [`REG_BITS-1:0] i_ex_wb_reg,
+  input         i_wb_free,
+
+  output [31:0] o_result,
+  output        o_ex_wait,
+  output        o_hz_en,
+  output [`REG_BITS-1:0] o_hz_reg,
+  output        o_wb_en,
+  output [`REG_BITS-1:0] o_wb_reg
+);
+
+
+  // Pending opcode registers
+  reg  [31:0] md_a;
+  reg  [31:0] md_b;
+  reg  [ 2:0] md_funct3;
+  reg  [`REG_BITS-1:0] md_reg;
+  reg         md_pend;
+
+  // Mul/Div inputs and outputs
+  wire [31:0] in_a;
+  wire [31:0] in_b;
+  wire [ 2:0] funct3;
+  wire        md_busy;
+
+  /**
+   * Mul/Div circuitry
+   *  While the result is pending the inputs come from the latched registers,
+   *  otherwise they come directly from the EX phase (so short operations
+   *  finish in the EX phase like before).
+   */
+  muldiv muldiv_i (
+    .i_clk_n   (i_clk_n),
+    .i_rst     (i_rst),
+    .i_in_a    (in_a),
+    .i_in_b    (in_b),
+    .i_funct3  (funct3),
+    .i_md_en   (i_md_en && !md_pend),
+`ifdef POSEDGE_ONLY
+    .i_start   (i_start),
+`endif
+    .o_result  (o_result),
+    .o_busy    (md_busy)
+  );
+
+  assign in_a = (md_pend) ? md_a : i_in_a;
+  assign in_b = (md_pend) ? md_b : i_in_b;
+  assign funct3 = (md_pend) ? md_funct3 : i_funct3;
+
+  /**
+   * Pending opcode registers
+   *  Opcode that is still busy when it leaves the EX phase becomes pending,
+   *  it stays pending until its result is written back.
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      md_a      <= 0;
+      md_b      <= 0;
+      md_funct3 <= 0;
+      md_reg    <= 0;
+      md_pend   <= 0;
+    end else if (i_clk_ce) begin
+      if (o_ex_wait) begin
+        md_a      <= i_in_a;
+        md_b      <= i_in_b;
+        md_funct3 <= i_funct3;
+        md_reg    <= i_ex_wb_reg;
+        md_pend   <= 1'b1;
+      end else if (o_wb_en) begin
+        md_pend   <= 1'b0;
+      end
+    end
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_ex_wait = i_md_en && !md_pend && md_busy;
+  assign o_hz_en = md_pend || i_md_en;
+  assign o_hz_reg = (md_pend) ? md_reg : i_ex_wb_reg;
+  assign o_wb_en = md_pend && !md_busy && i_wb_free;
+  assign o_wb_reg = md_reg;
+
+endmodule
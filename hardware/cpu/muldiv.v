@@ -4,11 +4,14 @@
  * File: muldiv.v
  *
  * This file contains multiplier and divider circuitry for the M extension.
- * Based on the configuration data multiplier is either combitional or
- * sequential. Combinational multiplier comes with a long propagation delay
- * so there's an option to add a register that generates alu_busy signal
- * for one cycle while the signal propagates. Another bottleneck are the
- * input registers, there's an option to enable input buffer registers.
+ * Based on the configuration data multiplier is either a sequential
+ * shift-and-add multiplier (1 bit per cycle), a sequential radix-4
+ * multiplier (2 bits per cycle) or a 3 stage pipelined multiplier that maps
+ * onto the DSP slices. All of them work on unsigned operands, the sign is
+ * applied to the product afterwards, so MULH/MULHSU/MULHU work the same way
+ * in every configuration. Divider is either a sequential one that always
+ * takes 32 cycles or a fast one that resolves the trivial cases in a single
+ * cycle and calculates only the significant bits, two bits per cycle.
  *
  * i_clk_n  - Inverted clock input
  * i_rst    - Reset input
@@ -16,6 +19,7 @@
  * i_in_b   - Data input B (multiplier/divisor)
  * i_funct3 - Mul/Div function selector
  * i_md_en  - Mul/Div operation enable (required to start the operation)
+ * i_start  - First cycle of the opcode in EX phase (POSEDGE_ONLY only)
  *
  * o_result - Mul/Div result
  * o_busy   - Mul/Div busy signal (remains '1' until bit operation finishes)
@@ -31,6 +35,9 @@ module muldiv (
 
   input  [ 2:0] i_funct3,
   input         i_md_en,
+`ifdef POSEDGE_ONLY
+  input         i_start,
+`endif
 
   output [31:0] o_result,
   output        o_busy
@@ -103,6 +110,130 @@ module muldiv (
   assign in_b = (b_se) ? b_s : i_in_b;
   assign md_en = i_md_en;
 
+`ifdef MUL_DSP
+  /*
+   * Multiplier is a pipelined hardware multiplier, first stage latches the
+   *  operands, second stage multiplies them (this maps onto DSP48A1 slices
+   *  with their input and output registers) and the third stage applies
+   *  the sign and selects the upper or lower half of the product.
+   *  Pipeline bits track the stages, a new operation is only started when
+   *  the first two stages are empty, so the operation held in the EX phase
+   *  isn't started again after it's done.
+   */
+  // A register - multiplicand
+  // B register - multiplier
+  // MUL register - product
+  // RES register - sign corrected result
+  // PIPE register - stage valid bits
+  reg  [31:0] mul_a_reg;
+  reg  [31:0] mul_b_reg;
+`ifdef HARDWARE_TIPS
+  (* use_dsp48 = "yes" *)
+`endif
+  reg  [63:0] mul_mul;
+  reg  [31:0] mul_res;
+  reg   [2:0] mul_pipe;
+  wire        mul_busy;
+  wire        mul_en;
+  wire        mul_start;
+
+  always @(posedge i_clk_n) begin
+    if (i_rst) begin
+      mul_a_reg <= 0;
+      mul_b_reg <= 0;
+      mul_mul <= 0;
+      mul_res <= 0;
+      mul_pipe <= 0;
+    end else begin
+      if (mul_start) begin
+        mul_a_reg <= in_a;
+        mul_b_reg <= in_b;
+      end
+      mul_mul <= {32'd0, mul_a_reg} * {32'd0, mul_b_reg};
+      mul_res <= (|i_funct3[1:0]) ? mul_q[63:32] : mul_q[31:0];
+      mul_pipe <= { mul_pipe[1:0], mul_start };
+    end
+  end
+
+  // Busy and enable signal
+`ifdef POSEDGE_ONLY
+  assign mul_start = mul_en && i_start;
+`else
+  assign mul_start = mul_en && ~|mul_pipe[1:0];
+`endif
+  assign mul_busy = |mul_pipe[1:0];
+  assign mul_en = md_en && !i_funct3[2];
+
+  // Multiplier "postprocessing"
+  //  If result sign is negative then the result is in inverted, this is
+  //  done before the result register so it's not in the critical path
+  assign mul_q = (mul_s) ? (0 - mul_mul) : mul_mul;
+  assign mul = mul_res;
+
+`else
+`ifdef MUL_RADIX4
+  /*
+   * Multiplier is a radix-4 shift-and-add multiplier, at every clock cycle
+   *  0, A, 2A or 3A is added to the result based on the two lowest bits in
+   *  B register, after that A (and 3A) is shifted left by two and B is
+   *  shifted right by two, we keep adding until all ones are shifted out
+   *  of B register. 3A is calculated once during the preload.
+   */
+  // A register - multiplicand
+  // A3 register - multiplicand times 3
+  // B register - multiplier
+  // MUL register - accumulator (product)
+  reg  [63:0] mul_a_reg;
+  reg  [63:0] mul_a3_reg;
+  reg  [31:0] mul_b_reg;
+  reg  [63:0] mul_mul;
+  reg  [63:0] mul_add;
+  wire        mul_busy;
+  wire        mul_en;
+
+  always @(posedge i_clk_n) begin
+    if (i_rst) begin
+      mul_a_reg <= 0;
+      mul_a3_reg <= 0;
+      mul_b_reg <= 0;
+      mul_mul <= 0;
+    end else begin
+`ifdef POSEDGE_ONLY
+      if (mul_en && i_start) begin
+`else
+      if (mul_en && ~|mul_b_reg) begin
+`endif
+        // Initial register preload
+        mul_a_reg <= { 32'd0, in_a };
+        mul_a3_reg <= { 32'd0, in_a } + { 31'd0, in_a, 1'b0 };
+        mul_b_reg <= in_b;
+        mul_mul <= 0;
+      end else begin
+        // Actual bit shifting and adding
+        if (|mul_b_reg) begin
+          mul_mul <= mul_mul + mul_add;
+          mul_a_reg <= { mul_a_reg[61:0], 2'b00 };
+          mul_a3_reg <= { mul_a3_reg[61:0], 2'b00 };
+          mul_b_reg <= { 2'b00, mul_b_reg[31:2] };
+        end
+      end
+    end
+  end
+
+  // Partial product selection
+`ifdef HARDWARE_TIPS
+  (* parallel_case *)
+`endif
+  always @* begin
+    case (mul_b_reg[1:0])
+      2'b00: mul_add = 64'd0;
+      2'b01: mul_add = mul_a_reg;
+      2'b10: mul_add = { mul_a_reg[62:0], 1'b0 };
+      2'b11: mul_add = mul_a3_reg;
+    endcase
+  end
+
+`else
   /*
    * Multiplier is a shift-and-add multiplier, at every clock cycle
    *  A operand is added to result if the zeroth bit in B register is set
@@ -124,7 +255,11 @@ module muldiv (
       mul_b_reg <= 0;
       mul_mul <= 0;
     end else begin
+`ifdef POSEDGE_ONLY
+      if (mul_en && i_start) begin
+`else
       if (mul_en && ~|mul_b_reg) begin
+`endif
         // Initial register preload
         mul_a_reg <= { 32'd0, in_a };
         mul_b_reg <= in_b;
@@ -141,6 +276,7 @@ module muldiv (
       end
     end
   end
+`endif
 
   // Busy and enable signal
   assign mul_busy = |mul_b_reg;
@@ -150,6 +286,7 @@ module muldiv (
   //  If result sign is negative then the result is in inverted
   assign mul_q = (mul_s) ? (0 - mul_mul) : mul_mul;
   assign mul = (|i_funct3[1:0]) ? mul_q[63:32] : mul_q[31:0];
+`endif
 
   /*
    * Divider
@@ -164,6 +301,105 @@ module muldiv (
   // Q register - accumulator (result)
   // Divider counter
 
+`ifdef DIV_FAST
+  /*
+   * Fast divider
+   *  Division by zero, division by one (this also covers the signed
+   *  overflow) and dividends smaller than the divisor are resolved during
+   *  the preload, busy signal isn't asserted for them. Otherwise dividend
+   *  is shifted left past the steps that can only produce the leading
+   *  zeros of the quotient (found with leading zero counts of both inputs)
+   *  and two steps of the division are done at every clock cycle.
+   */
+  reg   [5:0] div_lz_a;
+  reg   [5:0] div_lz_b;
+  wire  [5:0] div_skip;
+  wire        div_zero;
+  wire        div_one;
+  wire        div_small;
+  wire [31:0] div_sub1;
+  wire        div_cmp1;
+  wire [63:0] div_a1;
+
+  // Leading zero counters (last assignment wins so highest set bit counts)
+  always @* begin
+    div_lz_a = 0;
+    div_lz_b = 0;
+    for (integer i = 0; i < 32; i = i + 1) begin
+      if (in_a[i]) div_lz_a = 6'd31 - i[5:0];
+      if (in_b[i]) div_lz_b = 6'd31 - i[5:0];
+    end
+  end
+
+  // Quotient has at most (lz_b - lz_a + 1) bits, the number of skipped
+  //  steps is rounded down to even number so the counter stops at 32
+  assign div_skip = (div_lz_a + 6'd31 - div_lz_b) & 6'b111110;
+
+  // Short-circuit conditions
+  assign div_zero = ~|in_b;
+  assign div_one = (in_b == 32'd1);
+  assign div_small = (in_a < in_b);
+
+  always @(posedge i_clk_n) begin
+    if (i_rst) begin
+      // Reset
+      div_a <= 0;
+      div_b <= 0;
+      div_q <= 0;
+      div_cnt <= 6'b100000;
+    end else begin
+`ifdef POSEDGE_ONLY
+      if (div_en && i_start) begin
+`else
+      if (div_en) begin
+`endif
+        // Register preload
+        div_b <= in_b;
+        if (div_zero) begin
+          // Quotient is -1 (after sign correction), reminder is dividend
+          div_a <= { in_a, 32'd0 };
+          div_q <= { {31{!div_s}}, 1'b1 };
+          div_cnt <= 6'b100000;
+        end else if (div_one) begin
+          // Quotient is dividend, reminder is zero
+          div_a <= 0;
+          div_q <= in_a;
+          div_cnt <= 6'b100000;
+        end else if (div_small) begin
+          // Quotient is zero, reminder is dividend
+          div_a <= { in_a, 32'd0 };
+          div_q <= 0;
+          div_cnt <= 6'b100000;
+        end else begin
+          div_a <= { 32'd0, in_a } << div_skip;
+          div_q <= 0;
+          div_cnt <= div_skip;
+        end
+      end
+      if (!div_cnt[5]) begin
+        // Actual division (two steps)
+        div_cnt <= div_cnt + 6'd2;
+        div_q <= { div_q[29:0], div_cmp1, div_cmp };
+        if (div_cmp) begin
+          div_a <= { div_sub[31:0], div_a1[30:0], 1'b0 };
+        end else begin
+          div_a <= { div_a1[62:0], 1'b0 };
+        end
+      end
+    end
+  end
+
+  // First step comparator and subtractor
+  assign div_sub1 = div_a[62:31] - div_b;
+  assign div_cmp1 = (div_a[62:31] >= div_b);
+  assign div_a1 = (div_cmp1) ? { div_sub1[31:0], div_a[30:0], 1'b0 } :
+    { div_a[62:0], 1'b0 };
+
+  // Second step comparator and subtractor
+  assign div_sub = div_a1[62:31] - div_b;
+  assign div_cmp = (div_a1[62:31] >= div_b);
+
+`else
   always @(posedge i_clk_n) begin
     if (i_rst) begin
       // Reset
@@ -172,7 +408,11 @@ module muldiv (
       div_q <= 0;
       div_cnt <= 6'b100000;
     end else begin
+`ifdef POSEDGE_ONLY
+      if (div_en && i_start) begin
+`else
       if (div_en) begin
+`endif
         // Register preload
         div_a <= { 32'd0, in_a };
         div_b <= in_b;
@@ -181,7 +421,7 @@ module muldiv (
       end
       if (!div_cnt[5]) begin
         // Actual division
-        div_cnt <= div_cnt + 5'd1;
+        div_cnt <= div_cnt + 6'd1;
         div_q <= { div_q[30:0], div_cmp };
         if (div_cmp) begin
           div_a <= { div_sub[31:0], div_a[30:0], 1'b0 };
@@ -195,6 +435,7 @@ module muldiv (
   // Divider comparator and subtractor
   assign div_sub = div_a[62:31] - div_b;
   assign div_cmp = (div_a[62:31] >= div_b);
+`endif
 
   // Busy and enable signals
   assign div_busy = !div_cnt[5];
@@ -209,8 +450,14 @@ module muldiv (
   assign div = (div_rem_s) ? (0 - div_res) : div_res;
 
   // Final result MUX and busy signal
+  //  With POSEDGE_ONLY the operation is loaded at the end of the first
+  //  cycle, so busy is also set during that cycle
   assign o_result = (i_funct3[2]) ? div : mul;
 
+`ifdef POSEDGE_ONLY
+  assign o_busy = mul_busy || div_busy || (md_en && i_start);
+`else
   assign o_busy = mul_busy || div_busy;
+`endif
 
 endmodule
@@ -0,0 +1,168 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: predictor.v
+ *
+ * This file contains the branch predictor used by the fetch unit. It's made
+ * out of a small direct mapped branch target buffer (BTB) that remembers the
+ * targets of taken branches and jumps, and a direction predictor that is
+ * either a 2-bit saturating counter stored in every BTB entry or a gshare
+ * pattern history table (PHT) indexed with PC xored with global history.
+ * Lookup is fully combinational (done in the IF phase), the update comes
+ * from the EX phase once the branch is resolved.
+ *
+ * i_clk       - Clock input
+ * i_rst       - Reset input
+ *
+ * i_if_pc     - Program counter in IF phase (lookup address)
+ * o_pred      - Branch predicted as taken
+ * o_pred_addr - Predicted branch target
+ * o_pred_idx  - PHT index used for the prediction (goes along the opcode)
+ *
+ * i_upd_en    - Update enable (branch or jump resolved in EX phase)
+ * i_upd_jump  - Resolved instruction is an unconditional jump
+ * i_upd_taken - Branch was taken
+ * i_upd_pc    - Address of the resolved branch
+ * i_upd_addr  - Target of the resolved branch
+ * i_upd_idx   - PHT index that was used to predict resolved branch
+ ***************************************************************************/
+`include "config.v"
+
+module predictor (
+  input         i_clk,
+  input         i_rst,
+
+  input  [31:0] i_if_pc,
+  output        o_pred,
+  output [31:0] o_pred_addr,
+  output [`BP_PHT_BITS-1:0] o_pred_idx,
+
+  input         i_upd_en,
+  input         i_upd_jump,
+  input         i_upd_taken,
+  input  [31:0] i_upd_pc,
+  input  [31:0] i_upd_addr,
+  // verilator lint_off unused
+  input  [`BP_PHT_BITS-1:0] i_upd_idx
+  // verilator lint_on unused
+);
+
+  localparam BTB_SIZE = (1 << `BP_BTB_BITS);
+  localparam TAG_BITS = 31 - `BP_BTB_BITS;
+
+  // Branch target buffer
+`ifdef HARDWARE_TIPS
+  (* ram_style = "distributed" *)
+`endif
+  reg  [30:0] btb_addr [0:BTB_SIZE-1];
+  reg  [TAG_BITS-1:0] btb_tag [0:BTB_SIZE-1];
+  reg   [1:0] btb_cnt  [0:BTB_SIZE-1];
+  reg         btb_jump [0:BTB_SIZE-1];
+  reg         btb_valid[0:BTB_SIZE-1];
+
+  // Lookup circuitry
+  wire [`BP_BTB_BITS-1:0] if_idx;
+  wire [TAG_BITS-1:0] if_tag;
+  wire        if_hit;
+  wire        if_dir;
+
+  // Update circuitry
+  wire [`BP_BTB_BITS-1:0] upd_idx;
+  wire [TAG_BITS-1:0] upd_tag;
+  wire        upd_hit;
+  wire  [1:0] upd_cnt;
+  wire  [1:0] upd_cnt_inc;
+  wire  [1:0] upd_cnt_dec;
+
+  // Global history and pattern history table
+`ifdef BP_GSHARE
+  localparam PHT_SIZE = (1 << `BP_PHT_BITS);
+  reg   [1:0] pht [0:PHT_SIZE-1];
+  reg  [`BP_PHT_BITS-1:0] ghr;
+  wire  [1:0] pht_cnt;
+`endif
+
+
+  /**
+   * Lookup
+   *  BTB is indexed with the halfword address (opcodes can be 16 bit long),
+   *  upper bits of the address are used as the tag, prediction is only
+   *  given when the entry is valid and the tag matches.
+   */
+  assign if_idx = i_if_pc[`BP_BTB_BITS:1];
+  assign if_tag = i_if_pc[31:`BP_BTB_BITS+1];
+  assign if_hit = btb_valid[if_idx] && (btb_tag[if_idx] == if_tag);
+
+`ifdef BP_GSHARE
+  assign o_pred_idx = i_if_pc[`BP_PHT_BITS:1] ^ ghr;
+  assign if_dir = pht[o_pred_idx][1];
+`else
+  assign o_pred_idx = 0;
+  assign if_dir = btb_cnt[if_idx][1];
+`endif
+
+  // Jumps are always taken, branches are taken if the counter says so
+  assign o_pred = if_hit && (btb_jump[if_idx] || if_dir);
+  assign o_pred_addr = { btb_addr[if_idx], 1'b0 };
+
+  /**
+   * Update
+   *  Taken branches (and jumps) are allocated in the BTB, branches that are
+   *  not taken only decrement the counter if they're already in the BTB.
+   */
+  assign upd_idx = i_upd_pc[`BP_BTB_BITS:1];
+  assign upd_tag = i_upd_pc[31:`BP_BTB_BITS+1];
+  assign upd_hit = btb_valid[upd_idx] && (btb_tag[upd_idx] == upd_tag);
+
+  // Saturating counter
+  assign upd_cnt = btb_cnt[upd_idx];
+  assign upd_cnt_inc = (&upd_cnt) ? upd_cnt : upd_cnt + 2'd1;
+  assign upd_cnt_dec = (~|upd_cnt) ? upd_cnt : upd_cnt - 2'd1;
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      for (integer i = 0; i < BTB_SIZE; i = i + 1) begin
+        btb_valid[i] <= 0;
+      end
+    end else if (i_upd_en) begin
+      if (i_upd_taken) begin
+        // Allocate new entry (weakly taken) or strengthen the existing one
+        btb_valid[upd_idx] <= 1'b1;
+        btb_tag[upd_idx]   <= upd_tag;
+        btb_addr[upd_idx]  <= i_upd_addr[31:1];
+        btb_jump[upd_idx]  <= i_upd_jump;
+        btb_cnt[upd_idx]   <= (upd_hit) ? upd_cnt_inc : 2'b10;
+      end else if (upd_hit) begin
+        // Weaken the existing entry
+        btb_cnt[upd_idx]   <= upd_cnt_dec;
+      end
+    end
+  end
+
+  /**
+   * Gshare direction predictor
+   *  The global history register holds the outcomes of the last conditional
+   *  branches, it's updated when the branch is resolved, not when it's
+   *  predicted, so it lags a few branches behind (it doesn't need recovery).
+   */
+`ifdef BP_GSHARE
+  assign pht_cnt = pht[i_upd_idx];
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      ghr <= 0;
+      for (integer i = 0; i < PHT_SIZE; i = i + 1) begin
+        pht[i] <= 2'b01;
+      end
+    end else if (i_upd_en && !i_upd_jump) begin
+      ghr <= { ghr[`BP_PHT_BITS-2:0], i_upd_taken };
+      if (i_upd_taken) begin
+        pht[i_upd_idx] <= (&pht_cnt) ? pht_cnt : pht_cnt + 2'd1;
+      end else begin
+        pht[i_upd_idx] <= (~|pht_cnt) ? pht_cnt : pht_cnt - 2'd1;
+      end
+    end
+  end
+`endif
+
+endmodule
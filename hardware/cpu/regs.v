@@ -6,6 +6,12 @@
  * Simple register array, there's an option to generate it as a distributed
  * RAM array. The array has one write port and two read ports, when the write
  * address is zero write is disabled (zero isn't hard-wired but works anyway).
+ * With POSEDGE_ONLY the array is written on the rising edge and read
+ * asynchronously (distributed RAM), so the read data is valid in the same
+ * cycle as the read address and no falling edge is needed. With DUAL_ISSUE
+ * the array has four read ports and two write ports (one per issue slot),
+ * it can't be mapped onto the RAM anymore, the second write port has the
+ * priority (it writes the result of the younger instruction).
  *
  * i_clk       - Clock input
  * i_ce        - Clock enable input
@@ -17,6 +23,14 @@
  *
  * o_dat_rd_a  - Read data 1 (RS1)
  * o_dat_rd_b  - Read data 2 (RS2)
+ *
+ * i_addr_rd_c - Read address 3 (RS1 of the second slot, DUAL_ISSUE only)
+ * i_addr_rd_d - Read address 4 (RS2 of the second slot, DUAL_ISSUE only)
+ * i_we2       - Second write enable input
+ * i_addr_wr2  - Second write address (RD of the second slot)
+ * i_dat_wr2   - Second write data (RD of the second slot)
+ * o_dat_rd_c  - Read data 3 (RS1 of the second slot)
+ * o_dat_rd_d  - Read data 4 (RS2 of the second slot)
  ***************************************************************************/
 `include "config.v"
 
@@ -31,21 +45,41 @@ module regs (
   input  [ 4:0] i_addr_wr,
   input  [31:0] i_dat_wr,
 
+`ifdef DUAL_ISSUE
+  input  [ 4:0] i_addr_rd_c,
+  input  [ 4:0] i_addr_rd_d,
+
+  input         i_we2,
+  input  [ 4:0] i_addr_wr2,
+  input  [31:0] i_dat_wr2,
+
+  output [31:0] o_dat_rd_c,
+  output [31:0] o_dat_rd_d,
+`endif
+
   output [31:0] o_dat_rd_a,
   output [31:0] o_dat_rd_b
 );
 
   // Register array
+`ifndef DUAL_ISSUE
 `ifdef HARDWARE_TIPS
 `ifdef REGS_DISTRIBUTED
   (* ram_style = "distributed" *)
 `else
   (* ram_style = "block" *)
 `endif
+`endif
 `endif
   reg [31:0] registers [0:31];
+`ifndef POSEDGE_ONLY
   reg [31:0] dat_rd_a_reg = 0;
   reg [31:0] dat_rd_b_reg = 0;
+`ifdef DUAL_ISSUE
+  reg [31:0] dat_rd_c_reg = 0;
+  reg [31:0] dat_rd_d_reg = 0;
+`endif
+`endif
 
   // Register array initialization (filling with zeros), this is required for
   //  the simulation to eliminate undefined values at the start
@@ -57,14 +91,46 @@ module regs (
   end
 `endif
 
+`ifdef POSEDGE_ONLY
+  // Register write process
+  always @(posedge i_clk) begin
+    if (i_ce && i_we && (i_addr_wr != 5'b00000)) begin
+      registers[i_addr_wr] <= i_dat_wr;
+    end
+`ifdef DUAL_ISSUE
+    if (i_ce && i_we2 && (i_addr_wr2 != 5'b00000)) begin
+      registers[i_addr_wr2] <= i_dat_wr2;
+    end
+`endif
+  end
+
+  /**
+   * Output assgnment
+   */
+  assign o_dat_rd_a = registers[i_addr_rd_a];
+  assign o_dat_rd_b = registers[i_addr_rd_b];
+`ifdef DUAL_ISSUE
+  assign o_dat_rd_c = registers[i_addr_rd_c];
+  assign o_dat_rd_d = registers[i_addr_rd_d];
+`endif
+`else
   // Register read/write process
   always @(posedge i_clk) begin
     dat_rd_a_reg <= registers[i_addr_rd_a];
     dat_rd_b_reg <= registers[i_addr_rd_b];
+`ifdef DUAL_ISSUE
+    dat_rd_c_reg <= registers[i_addr_rd_c];
+    dat_rd_d_reg <= registers[i_addr_rd_d];
+`endif
 
     if (i_ce && i_we && (i_addr_wr != 5'b00000)) begin
       registers[i_addr_wr] <= i_dat_wr;
     end
+`ifdef DUAL_ISSUE
+    if (i_ce && i_we2 && (i_addr_wr2 != 5'b00000)) begin
+      registers[i_addr_wr2] <= i_dat_wr2;
+    end
+`endif
   end
 
   /**
@@ -72,5 +138,10 @@ module regs (
    */
   assign o_dat_rd_a = dat_rd_a_reg;
   assign o_dat_rd_b = dat_rd_b_reg;
+`ifdef DUAL_ISSUE
+  assign o_dat_rd_c = dat_rd_c_reg;
+  assign o_dat_rd_d = dat_rd_d_reg;
+`endif
+`endif
 
 endmodule
@@ -13,9 +13,11 @@
  * i_funct3   - Shift function selector (used for left/right selection)
  * i_op_alt   - Alternative function (used for arythmetic/logic selection)
  * i_shift_en - Shifter operation enable (required to start the bit-shifter)
+ * i_start    - First cycle of the opcode in EX phase (POSEDGE_ONLY only)
  *
  * o_result   - Shift result
  * o_busy     - Shifter busy signal (remains '1' until bit shift finishes)
+ * o_rotate   - Rotator stage output (B_EXTENSION only, barrel shifter only)
  ***************************************************************************/
 `include "config.v"
 
@@ -31,8 +33,16 @@ module shifter (
   input  [ 2:0] i_funct3,
   input         i_op_alt,
   input         i_shift_en,
+`ifdef POSEDGE_ONLY
+  // verilator lint_off unused
+  input         i_start,
+  // verilator lint_on unused
+`endif
 
   output [31:0] o_result,
+`ifdef B_EXTENSION
+  output [31:0] o_rotate,
+`endif
   output        o_busy
 );
 
@@ -101,6 +111,11 @@ module shifter (
   // Busy signal
   assign o_busy = 0;
 
+  // Rotator output for the bit-manipulation operations
+`ifdef B_EXTENSION
+  assign o_rotate = shift_out;
+`endif
+
 `else
   /**
    * Bit Shifter
@@ -130,7 +145,11 @@ module shifter (
       shift_dir_left <= 0;
     end else begin
       // Initial register preload
+`ifdef POSEDGE_ONLY
+      if (op_shift && i_start) begin
+`else
       if (op_shift && ~|shift_amount) begin
+`endif
         shift_amount   <= i_in_b[4:0];
         shift_result   <= i_in_a;
         shift_dir_left <= op_sll;
@@ -154,7 +173,11 @@ module shifter (
 
   // Output signals
   assign o_result = shift_result;
+`ifdef POSEDGE_ONLY
+  assign o_busy = |shift_amount || (op_shift && i_start);
+`else
   assign o_busy = |shift_amount;
+`endif
 
 `endif
 
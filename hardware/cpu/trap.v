@@ -0,0 +1,196 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: trap.v
+ *
+ * This file contains the machine mode trap CSRs and the trap control. Traps
+ * are taken in the EX phase: the opcode in EX phase is discarded (it doesn't
+ * write back, access the memory or write the CSRs), older opcodes in MA and
+ * WB phases finish normally, so the traps are precise. Pending interrupt is
+ * taken before the opcode in EX phase, exceptions (ECALL, EBREAK and illegal
+ * opcodes) are taken instead of it, in both cases mepc is the address of
+ * this opcode. MRET redirects the fetch to mepc. Only the machine external
+ * interrupt (i_irq, level sensitive) is implemented, WFI is a NOP.
+ *
+ * 0x300 - mstatus  - MIE and MPIE bits (MPP is always machine mode, with
+ *                     F_EXTENSION FS is always dirty)
+ * 0x304 - mie      - MEIE bit
+ * 0x305 - mtvec    - Direct and vectored mode (interrupts go to base + 44)
+ * 0x340 - mscratch - Scratch register
+ * 0x341 - mepc     - Trap return address
+ * 0x342 - mcause   - Trap cause (2, 3 or 11, or interrupt 11)
+ * 0x343 - mtval    - Always zero
+ * 0x344 - mip      - MEIP bit (read-only, state of the interrupt input)
+ *
+ * i_clk     - Clock input
+ * i_rst     - Reset input
+ * i_ce      - Clock enable (opcode in EX phase leaves it)
+ * i_wr      - Write enable input (only valid in one cycle per instruction)
+ * i_addr    - CSR address input
+ * i_wr_data - CSR write data input
+ *
+ * i_irq     - External interrupt input
+ * i_valid   - Opcode in EX phase can be trapped (not a bubble)
+ * i_ecall   - ECALL in EX phase
+ * i_ebreak  - EBREAK in EX phase
+ * i_mret    - MRET in EX phase
+ * i_illegal - Illegal opcode in EX phase
+ * i_pc      - Address of the opcode in EX phase
+ *
+ * o_trap    - Trap is taken (opcode in EX phase is discarded)
+ * o_br_en   - Fetch redirect (trap or MRET)
+ * o_br_addr - Fetch redirect address
+ * o_rd_data - CSR read data output
+ * o_hit     - CSR address belongs to the trap CSRs
+ ***************************************************************************/
+`include "config.v"
+
+module trap (
+  input         i_clk,
+  input         i_rst,
+  input         i_ce,
+
+  input         i_wr,
+  input  [11:0] i_addr,
+  input  [31:0] i_wr_data,
+
+  input         i_irq,
+  input         i_valid,
+  input         i_ecall,
+  input         i_ebreak,
+  input         i_mret,
+  input         i_illegal,
+  input  [31:0] i_pc,
+
+  output        o_trap,
+  output        o_br_en,
+  output [31:0] o_br_addr,
+
+  output [31:0] o_rd_data,
+  output        o_hit
+);
+
+
+  // Trap CSRs
+  reg         mstatus_mie;
+  reg         mstatus_mpie;
+  reg         mie_meie;
+  reg  [29:0] mtvec_base;
+  reg         mtvec_mode;
+  reg  [31:0] mscratch;
+  reg  [30:0] mepc;
+  reg         mcause_int;
+  reg  [ 3:0] mcause_code;
+
+  // Trap control
+  wire        irq_take;
+  wire        exc_take;
+  wire [ 3:0] cause;
+  wire [31:0] trap_addr;
+
+  // Read circuitry
+  reg  [31:0] read_data;
+  reg         hit;
+
+
+  /**
+   * Trap control
+   *  Interrupt has the priority (opcode in EX phase hasn't been executed
+   *  yet), vectored mode only applies to the interrupts
+   */
+  assign irq_take = i_valid && i_irq && mie_meie && mstatus_mie;
+  assign exc_take = i_valid && (i_ecall || i_ebreak || i_illegal);
+
+  assign cause =
+    (irq_take)  ? 4'd11 :
+    (i_illegal) ? 4'd2  :
+    (i_ebreak)  ? 4'd3  : 4'd11;
+
+  assign trap_addr = {mtvec_base, 2'b00} +
+    ((mtvec_mode && irq_take) ? {26'd0, cause, 2'b00} : 32'd0);
+
+  /**
+   * Trap CSRs
+   *  Trap and MRET have the priority over the CSR writes (trapped opcode
+   *  doesn't write the CSRs anyway)
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      mstatus_mie  <= 0;
+      mstatus_mpie <= 0;
+      mie_meie     <= 0;
+      mtvec_base   <= 0;
+      mtvec_mode   <= 0;
+      mscratch     <= 0;
+      mepc         <= 0;
+      mcause_int   <= 0;
+      mcause_code  <= 0;
+    end else if (i_ce && o_trap) begin
+      mstatus_mie  <= 0;
+      mstatus_mpie <= mstatus_mie;
+      mepc         <= i_pc[31:1];
+      mcause_int   <= irq_take;
+      mcause_code  <= cause;
+    end else if (i_ce && i_mret) begin
+      mstatus_mie  <= mstatus_mpie;
+      mstatus_mpie <= 1'b1;
+    end else if (i_wr) begin
+      case (i_addr)
+        12'h300: begin
+          mstatus_mie  <= i_wr_data[3];
+          mstatus_mpie <= i_wr_data[7];
+        end
+        12'h304: mie_meie <= i_wr_data[11];
+        12'h305: begin
+          mtvec_base   <= i_wr_data[31:2];
+          mtvec_mode   <= i_wr_data[0];
+        end
+        12'h340: mscratch <= i_wr_data;
+        12'h341: mepc <= i_wr_data[31:1];
+        12'h342: begin
+          mcause_int   <= i_wr_data[31];
+          mcause_code  <= i_wr_data[3:0];
+        end
+        default: begin end  // Empty expression
+      endcase
+    end
+  end
+
+  /**
+   * Read from currently selected CSR
+   */
+  always @* begin
+    hit = 1'b1;
+    case (i_addr)
+`ifdef F_EXTENSION
+      12'h300: read_data = {1'b1, 16'd0, 2'b11, 2'b11, 3'd0, mstatus_mpie,
+        3'd0, mstatus_mie, 3'd0};
+`else
+      12'h300: read_data = {19'd0, 2'b11, 3'd0, mstatus_mpie, 3'd0,
+        mstatus_mie, 3'd0};
+`endif
+      12'h304: read_data = {20'd0, mie_meie, 11'd0};
+      12'h305: read_data = {mtvec_base, 1'b0, mtvec_mode};
+      12'h340: read_data = mscratch;
+      12'h341: read_data = {mepc, 1'b0};
+      12'h342: read_data = {mcause_int, 27'd0, mcause_code};
+      12'h343: read_data = 32'd0;
+      12'h344: read_data = {20'd0, i_irq, 11'd0};
+      default: begin
+        read_data = 32'd0;
+        hit = 1'b0;
+      end
+    endcase
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_trap    = irq_take || exc_take;
+  assign o_br_en   = o_trap || i_mret;
+  assign o_br_addr = (o_trap) ? trap_addr : {mepc, 1'b0};
+
+  assign o_rd_data = read_data;
+  assign o_hit     = hit;
+
+endmodule
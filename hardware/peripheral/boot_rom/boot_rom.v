@@ -37,22 +37,38 @@ module boot_rom (
     .EN_RSTRAM_B    ("FALSE"),
     .WRITE_MODE_A   ("NO_CHANGE"),
     .WRITE_MODE_B   ("NO_CHANGE"),
-    .INIT_00        (256'h00312223043001930031202300A00193100194631001F1930101218300008137),
+    .INIT_00        (256'h00312223043001930031202300A00193220192631001F1930101218300008137),
     .INIT_01        (256'hFFF28293FE019EE3FFF18193000281B7004128230012421300F0029300000213),
-    .INIT_02        (256'hFFF1819308018663FFF1819306018463FD0181930EC000EF00100493FE0294E3),
-    .INIT_03        (256'h0650019308018E63FFF1819300018C63FFF1819306018863FFF1819304018663),
-    .INIT_04        (256'hFE41CCE3004181930051A02306F002930000823700000193FC1FF06F00312623),
-    .INIT_05        (256'h0FC000EF0040031300038493108000EF00400313F9DFF06F0031262306300193),
-    .INIT_06        (256'h0DC000EF00400313F71FF06FFE0498E3FFF48493001383930D4000EF0003C183),
-    .INIT_07        (256'h06B00193007400230C4000EF00200313000384130D0000EF0040031300038493),
-    .INIT_08        (256'h000001930031262307300193F35FF06FFE0494E3FFF484930014041300312623),
-    .INIT_09        (256'hFE019CE30201F1930081218300000067FFC1011300008137000100B700312823),
-    .INIT_0A        (256'h0041C463FF918193010002130041CA63FD01819300A002130000806700C12183),
-    .INIT_0B        (256'h007181930032D4630301819300F1F193000182130390029300008067FE018193),
-    .INIT_0C        (256'h004272130081220300008067007202130042D4630302021300F2721300425213),
-    .INIT_0D        (256'h0000039300008293000300670031262300412623FC1FF0EF00008313FE020CE3),
-    .INIT_0E        (256'h0000000000028067FE0316E3FFF30313003383B3F81FF0EFF71FF0EF00439393),
-    .INIT_0F        (256'h0000000000000000000000000000000000000000000000000000000000000000)
+    .INIT_02        (256'hFFF181930A018263FFF1819308018063FD018193208000EF00100493FE0294E3),
+    .INIT_03        (256'hFFF181931A018C63FFF1819302018863FFF1819308018463FFF1819306018263),
+    .INIT_04        (256'hFA9FF06F003126230650019316018063FFF1819310018463FFF181930A018663),
+    .INIT_05        (256'h0031262306300193FE41CCE3004181930051A02306F002930000823700000193),
+    .INIT_06        (256'h23C000EF0003C183264000EF0040031300038493270000EF00400313F85FF06F),
+    .INIT_07        (256'h0040031300038493244000EF00400313F59FF06FFE0498E3FFF4849300138393),
+    .INIT_08        (256'h001404130031262306B001930074002322C000EF0020031300038413238000EF),
+    .INIT_09        (256'h13C000EF0020031300038413148000EF00400313F1DFF06FFE0494E3FFF48493),
+    .INIT_0A        (256'h003400230FF1F1930FC000EF0204806332058593EDB885B7FFF0051300038493),
+    .INIT_0B        (256'h06B00193100000EF00400313FFF54513FE0494E3FFF4849300140413144000EF),
+    .INIT_0C        (256'h00200313000384130E4000EF00400313EB9FF06F003126230650019300A38463),
+    .INIT_0D        (256'h0A8000EF0004418300048E6332058593EDB885B7FFF00513000384930D8000EF),
+    .INIT_0E        (256'h088000EF0FF5719300400493FFF54513FE0496E3FFF48493001404130E4000EF),
+    .INIT_0F        (256'h0031262306B00193084000EF00300313E59FF06FFE0498E3FFF4849300855513),
+    .INIT_10        (256'h00619193002181930101D1930101919300012183FE018CE30041F19300812183),
+    .INIT_11        (256'h00312823000001930031262307300193E19FF06F00712023FE019EE3FFF18193),
+    .INIT_12        (256'h00C12183FE019CE30201F1930081218300000067FFC1011300008137000100B7),
+    .INIT_13        (256'h00000393000082930000806700312623FE021CE3010272130081220300008067),
+    .INIT_14        (256'hFE0314E3FFF30313008202130033E3B3004191B30FF1F193FCDFF0EF00000213),
+    .INIT_15        (256'hFFF2021300B54533000284630015551300157293008002130035453300028067),
+    .INIT_16        (256'h0041C463FF918193010002130041CA63FD01819300A0021300008067FE0216E3),
+    .INIT_17        (256'h007181930032D4630301819300F1F193000182130390029300008067FE018193),
+    .INIT_18        (256'h004272130081220300008067007202130042D4630302021300F2721300425213),
+    .INIT_19        (256'h0000039300008293000300670031262300412623FC1FF0EF00008313FE020CE3),
+    .INIT_1A        (256'h0000000000028067FE0316E3FFF30313003383B3F81FF0EFF0DFF0EF00439393),
+    .INIT_1B        (256'h0000000000000000000000000000000000000000000000000000000000000000),
+    .INIT_1C        (256'h0000000000000000000000000000000000000000000000000000000000000000),
+    .INIT_1D        (256'h0000000000000000000000000000000000000000000000000000000000000000),
+    .INIT_1E        (256'h0000000000000000000000000000000000000000000000000000000000000000),
+    .INIT_1F        (256'h0000000000000000000000000000000000000000000000000000000000000000)
   ) boot_rom_bram (
     .DIA            (32'h00000000),
     .DOA            (o_data),
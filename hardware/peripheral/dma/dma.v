@@ -0,0 +1,302 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: dma.v
+ *
+ * This file contains the DMA controller, it's placed between the data port
+ * of the CPU and the data bus (just like the caches are placed between the
+ * CPU and the memory) and it shares the bus with the CPU, so the transfers
+ * run in the background while the CPU keeps executing. Bus is granted
+ * round-robin (when both the CPU and the DMA request the bus the one that
+ * had it last waits), the grant is kept until the memory sets the ready
+ * and while the CPU locks the bus (AMOs). CPU sees the ready cleared while
+ * it waits for the bus (its pipeline waits just like with a slow memory).
+ * Read data isn't routed through the controller, it goes to both masters.
+ *
+ * Transfers work in one of the modes:
+ *  0 - Copy      - Words are copied from the source to the destination
+ *  1 - Fill      - Destination is filled with the source register value
+ *  2 - Stream    - Bytes are read from the peripheral register at the source
+ *                  address (it isn't incremented) and stored at consecutive
+ *                  destination addresses, every read waits for the i_dreq
+ *                  (data available, UART RX buffer not empty), i_dreq is
+ *                  checked only before the read starts (the read itself may
+ *                  clear it), the read is then held until the ready
+ *  3 - Same as 2
+ * Word transfers require aligned addresses. Counter is decremented after
+ * every write, source and destination registers show the progress.
+ *
+ * 0 - Source register
+ * [31:0] - source address, fill value in fill mode (rw0)
+ *
+ * 1 - Destination register
+ * [31:0] - destination address (rw0)
+ *
+ * 2 - Count register
+ * [31:16] - unused
+ * [15:0] - number of the transfers left (words or bytes) (rw0)
+ *
+ * 3 - Control register
+ * [31:6] - unused
+ * [5] - abort (w) (stops the transfer after the current access)
+ * [4] - done flag (r, cleared by writing 1 or by the start)
+ * [3] - interrupt enable (rw0) (interrupt is requested while done is set)
+ * [2:1] - mode (rw0)
+ * [0] - start (w) / busy (r)
+ *
+ * Source, destination, count and mode can't be changed while busy, start
+ * with the count of zero just sets the done flag.
+ *
+ * i_clk         - Clock input (same edge as the CPU)
+ * i_rst         - Reset input
+ *
+ * i_wr          - Register write enable
+ * i_cs          - Register chip select
+ * i_addr        - Register address
+ * i_data_in     - Register write data
+ * o_data_out    - Register read data
+ * i_dreq        - Peripheral has the data for the stream mode
+ * o_irq         - Interrupt request (transfer is done)
+ *
+ * i_cpu_addr    - CPU data address
+ * i_cpu_data_wr - CPU write data
+ * i_cpu_wr      - CPU write request (byte enables)
+ * i_cpu_rd      - CPU read request
+ * i_cpu_lock    - Bus has to stay with the CPU after its request
+ * o_cpu_ready   - CPU request is done
+ *
+ * o_mem_addr    - Data bus address
+ * o_mem_data_wr - Data bus write data
+ * o_mem_wr      - Data bus write enable (byte enables)
+ * o_mem_rd      - Data bus read enable
+ * i_mem_data_rd - Data bus read data (with POSEDGE_ONLY it arrives in the
+ *                 next cycle)
+ * i_mem_ready   - Data bus request is done
+ ***************************************************************************/
+`include "../../cpu/config.v"
+
+module dma (
+  input         i_clk,
+  input         i_rst,
+
+  input         i_wr,
+  input         i_cs,
+  input  [ 1:0] i_addr,
+  input  [31:0] i_data_in,
+  output [31:0] o_data_out,
+  input         i_dreq,
+  output        o_irq,
+
+  input  [31:0] i_cpu_addr,
+  input  [31:0] i_cpu_data_wr,
+  input  [ 3:0] i_cpu_wr,
+  input         i_cpu_rd,
+  input         i_cpu_lock,
+  output        o_cpu_ready,
+
+  output [31:0] o_mem_addr,
+  output [31:0] o_mem_data_wr,
+  output [ 3:0] o_mem_wr,
+  output        o_mem_rd,
+  input  [31:0] i_mem_data_rd,
+  input         i_mem_ready
+);
+
+  localparam [1:0]
+    A_SRC   = 0,
+    A_DST   = 1,
+    A_COUNT = 2,
+    A_CTRL  = 3;
+
+  localparam [2:0]
+    S_IDLE  = 0,
+    S_READ  = 1,
+    S_DATA  = 2,
+    S_WRITE = 3,
+    S_WAIT  = 4;
+
+  // Registers
+  reg  [31:0] src_reg;
+  reg  [31:0] dst_reg;
+  reg  [15:0] count_reg;
+  reg  [ 1:0] mode_reg;
+  reg         irq_en_reg;
+  reg         done_reg;
+  wire        ctrl_wr;
+  wire        busy;
+  reg  [31:0] data_out;
+
+  // Transfer
+  reg  [ 2:0] state;
+  reg  [31:0] data_reg;
+  wire        mode_copy;
+  wire        mode_fill;
+  wire        mode_stream;
+  wire        dma_rd;
+  wire [ 3:0] dma_wr;
+  wire        dma_req;
+  wire        dma_ready;
+  wire [31:0] dma_addr;
+  wire [31:0] dma_data_wr;
+
+  // Bus arbitration
+  wire        cpu_req;
+  reg         owner;
+  reg         bus_busy;
+  wire        next;
+  wire        grant;
+
+
+  /**
+   * Registers
+   */
+  assign ctrl_wr = i_cs && i_wr && (i_addr == A_CTRL);
+  assign busy = (state != S_IDLE);
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      src_reg    <= 0;
+      dst_reg    <= 0;
+      count_reg  <= 0;
+      mode_reg   <= 0;
+      irq_en_reg <= 0;
+    end else if (busy) begin
+      if (dma_ready && state == S_WRITE) begin
+        src_reg   <= src_reg + ((mode_copy) ? 32'd4 : 32'd0);
+        dst_reg   <= dst_reg + ((mode_stream) ? 32'd1 : 32'd4);
+        count_reg <= count_reg - 16'd1;
+      end
+      if (ctrl_wr) begin
+        irq_en_reg <= i_data_in[3];
+      end
+    end else if (i_cs && i_wr) begin
+      case (i_addr)
+        A_SRC:   src_reg   <= i_data_in;
+        A_DST:   dst_reg   <= i_data_in;
+        A_COUNT: count_reg <= i_data_in[15:0];
+        A_CTRL: begin
+          mode_reg   <= i_data_in[2:1];
+          irq_en_reg <= i_data_in[3];
+        end
+      endcase
+    end
+  end
+
+  always @* begin
+    case (i_addr)
+      A_SRC:   data_out = src_reg;
+      A_DST:   data_out = dst_reg;
+      A_COUNT: data_out = { 16'd0, count_reg };
+      A_CTRL:  data_out = { 27'd0, done_reg, irq_en_reg, mode_reg, busy };
+    endcase
+  end
+
+  /**
+   * Transfer state machine
+   *  Fill mode only writes, stream mode waits for the i_dreq before every
+   *  read, with POSEDGE_ONLY the read data is taken in the cycle after the
+   *  read
+   */
+  assign mode_copy   = (mode_reg == 2'd0);
+  assign mode_fill   = (mode_reg == 2'd1);
+  assign mode_stream = mode_reg[1];
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      state    <= S_IDLE;
+      done_reg <= 0;
+    end else if (ctrl_wr && i_data_in[5]) begin
+      state    <= S_IDLE;
+    end else if (ctrl_wr && i_data_in[0] && !busy) begin
+      if (i_data_in[2:1] == 2'd1) begin
+        state  <= (count_reg != 0) ? S_WRITE : S_IDLE;
+      end else if (i_data_in[2]) begin
+        state  <= (count_reg != 0) ? S_WAIT : S_IDLE;
+      end else begin
+        state  <= (count_reg != 0) ? S_READ : S_IDLE;
+      end
+      done_reg <= (count_reg == 0);
+    end else begin
+      if (ctrl_wr && i_data_in[4]) begin
+        done_reg <= 1'b0;
+      end
+      case (state)
+        S_WAIT: begin
+          if (i_dreq) begin
+            state    <= S_READ;
+          end
+        end
+        S_READ: begin
+          if (dma_ready) begin
+`ifdef POSEDGE_ONLY
+            state    <= S_DATA;
+`else
+            state    <= S_WRITE;
+            data_reg <= i_mem_data_rd;
+`endif
+          end
+        end
+        S_DATA: begin
+          state    <= S_WRITE;
+          data_reg <= i_mem_data_rd;
+        end
+        S_WRITE: begin
+          if (dma_ready) begin
+            if (count_reg == 16'd1) begin
+              state    <= S_IDLE;
+              done_reg <= 1'b1;
+            end else begin
+              state    <= (mode_fill) ? S_WRITE :
+                (mode_stream) ? S_WAIT : S_READ;
+            end
+          end
+        end
+        default: begin end  // Empty expression
+      endcase
+    end
+  end
+
+  assign dma_rd = (state == S_READ);
+  assign dma_wr = (state != S_WRITE) ? 4'b0000 :
+    (mode_stream) ? (4'b0001 << dst_reg[1:0]) : 4'b1111;
+  assign dma_req = dma_rd || |dma_wr;
+  assign dma_addr = (state == S_READ) ? src_reg : dst_reg;
+  assign dma_data_wr =
+    (mode_fill)   ? src_reg :
+    (mode_stream) ? {4{data_reg[7:0]}} : data_reg;
+
+  /**
+   * Bus arbitration
+   *  Master that had the bus last has the lower priority, the owner keeps
+   *  the bus until its request is done (and unlocked)
+   */
+  assign cpu_req = i_cpu_rd || |i_cpu_wr;
+  assign next = (owner) ? !cpu_req : dma_req;
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      owner    <= 0;
+      bus_busy <= 0;
+    end else if (cpu_req || dma_req) begin
+      owner    <= grant;
+      bus_busy <= !i_mem_ready || (!grant && i_cpu_lock);
+    end
+  end
+
+  assign grant = (bus_busy) ? owner : next;
+  assign dma_ready = dma_req && grant && i_mem_ready;
+
+  /**
+   * Output assignment
+   */
+  assign o_data_out    = data_out;
+  assign o_irq         = irq_en_reg && done_reg;
+
+  assign o_cpu_ready   = !cpu_req || (!grant && i_mem_ready);
+
+  assign o_mem_addr    = (grant) ? dma_addr    : i_cpu_addr;
+  assign o_mem_data_wr = (grant) ? dma_data_wr : i_cpu_data_wr;
+  assign o_mem_wr      = (grant) ? dma_wr      : i_cpu_wr;
+  assign o_mem_rd      = (grant) ? dma_rd      : i_cpu_rd;
+
+endmodule
@@ -0,0 +1,213 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: dma_tb.v
+ *
+ * This is a test bench for the DMA controller (see dma.v). Memory (1kB at
+ * address 0x0000) is read on the falling edge of the clock (like in top.v),
+ * the fake peripheral data register at 0x800C returns consecutive bytes, a
+ * new one arrives every 8 cycles (i_dreq is set while there are any), it's
+ * popped on the falling edge of the read (like uart_regs.v in top.v), so
+ * i_dreq drops in the middle of the read of the last byte. Accesses above
+ * the memory can take one wait state (like BUS_IO_WAIT in top.v, strobes
+ * only in the first cycle). CPU port is driven by the tasks below, it keeps
+ * accessing the memory while the transfers run, so the arbitration is
+ * exercised too. Fill, copy and stream transfers (with and without the
+ * wait state) are checked, the result is printed at the end.
+ ***************************************************************************/
+`include "dma.v"
+
+module dma_tb;
+
+  initial begin
+    $dumpfile("dma_log.vcd");
+    $dumpvars(0, dma_i);
+  end
+
+  // DMA
+  reg         clk = 0;
+  reg         rst = 1;
+  reg  [31:0] cpu_addr = 0;
+  reg  [31:0] cpu_data_wr = 0;
+  reg  [ 3:0] cpu_wr = 0;
+  reg         cpu_rd = 0;
+  wire        cpu_ready;
+  wire [31:0] mem_addr;
+  wire [31:0] mem_data_wr;
+  wire [ 3:0] mem_wr;
+  wire        mem_rd;
+  reg  [31:0] mem_data_rd = 0;
+  wire [31:0] dma_out;
+  wire        dma_irq;
+  wire        dma_cs = (mem_addr[31:4] == 28'h0000802);
+
+  // Memory and the fake peripheral
+  reg  [31:0] memory [0:255];
+  reg  [ 7:0] rx_byte = 8'h30;
+  reg  [ 3:0] rx_count = 0;
+  reg  [ 2:0] rx_timer = 0;
+
+  // Wait state
+  reg         io_wait_en = 0;
+  reg         io_wait = 0;
+  wire        io_req = (mem_rd || |mem_wr) && (mem_addr >= 32'h00000400);
+  wire        mem_ready = !io_wait_en || !io_req || io_wait;
+
+  dma dma_i (
+    .i_clk         (clk),
+    .i_rst         (rst),
+    .i_wr          (&mem_wr && !io_wait),
+    .i_cs          (dma_cs),
+    .i_addr        (mem_addr[3:2]),
+    .i_data_in     (mem_data_wr),
+    .o_data_out    (dma_out),
+    .i_dreq        (rx_count != 0),
+    .o_irq         (dma_irq),
+    .i_cpu_addr    (cpu_addr),
+    .i_cpu_data_wr (cpu_data_wr),
+    .i_cpu_wr      (cpu_wr),
+    .i_cpu_rd      (cpu_rd),
+    .i_cpu_lock    (1'b0),
+    .o_cpu_ready   (cpu_ready),
+    .o_mem_addr    (mem_addr),
+    .o_mem_data_wr (mem_data_wr),
+    .o_mem_wr      (mem_wr),
+    .o_mem_rd      (mem_rd),
+    .i_mem_data_rd (mem_data_rd),
+    .i_mem_ready   (mem_ready)
+  );
+
+  always #2 clk = !clk;
+
+  always @(posedge clk) begin
+    if (rst) begin
+      io_wait <= 0;
+    end else begin
+      io_wait <= io_wait_en && io_req && !io_wait;
+    end
+  end
+
+  always @(negedge clk) begin
+    if (io_wait) begin
+      // Second cycle of the access, data is kept
+    end else if (mem_addr < 32'h00000400) begin
+      mem_data_rd <= memory[mem_addr[9:2]];
+      for (integer i = 0; i < 4; i = i + 1) begin
+        if (mem_wr[i]) begin
+          memory[mem_addr[9:2]][i*8 +: 8] <= mem_data_wr[i*8 +: 8];
+        end
+      end
+    end else if (dma_cs) begin
+      mem_data_rd <= dma_out;
+    end else begin
+      mem_data_rd <= {24'd0, rx_byte};
+    end
+  end
+
+  wire rx_new = (rx_timer == 0) && (rx_count != 4'hF);
+
+  always @(negedge clk) begin
+    rx_timer <= rx_timer + 1;
+    if (mem_rd && mem_addr == 32'h0000800C && !io_wait) begin
+      rx_byte  <= rx_byte + 1;
+      rx_count <= rx_count - 1 + rx_new;
+    end else begin
+      rx_count <= rx_count + rx_new;
+    end
+  end
+
+  // CPU accesses (tasks start and end right after the rising edge, ready is
+  // sampled on the falling edge, read data on the next rising edge)
+  reg  [31:0] rd_data;
+
+  task cpu_write(input [31:0] addr, input [31:0] data);
+    begin
+      cpu_addr = addr; cpu_data_wr = data; cpu_wr = 4'hf;
+      @(negedge clk); while (!cpu_ready) @(negedge clk);
+      @(posedge clk); #1 cpu_wr = 0;
+    end
+  endtask
+
+  task cpu_read(input [31:0] addr);
+    begin
+      cpu_addr = addr; cpu_rd = 1;
+      @(negedge clk); while (!cpu_ready) @(negedge clk);
+      @(posedge clk); rd_data = mem_data_rd; #1 cpu_rd = 0;
+    end
+  endtask
+
+  task dma_wait;
+    begin
+      cpu_read(32'h0000802C);
+      while (rd_data[0]) begin
+        cpu_write(32'h000003FC, rd_data);  // Keep the bus busy
+        cpu_read(32'h0000802C);
+      end
+    end
+  endtask
+
+  // Test sequence
+  integer errors = 0;
+
+  initial begin
+    for (integer i = 0; i < 256; i = i + 1) begin
+      memory[i] = 0;
+    end
+
+    #10 rst = 0;
+    @(posedge clk); #1;
+
+    // Fill 16 words at 0x100
+    cpu_write(32'h00008020, 32'hA5A50000);
+    cpu_write(32'h00008024, 32'h00000100);
+    cpu_write(32'h00008028, 16);
+    cpu_write(32'h0000802C, 32'h0000000B);  // Fill, irq enable, start
+    dma_wait;
+    if (!rd_data[4] || !dma_irq) errors = errors + 1;
+    for (integer i = 0; i < 16; i = i + 1) begin
+      if (memory[64 + i] != 32'hA5A50000) errors = errors + 1;
+    end
+    if (memory[80] != 0) errors = errors + 1;
+
+    // Copy 8 words from 0x000 to 0x200
+    for (integer i = 0; i < 8; i = i + 1) begin
+      memory[i] = 32'h11111111 * i;
+    end
+    cpu_write(32'h0000802C, 32'h00000010);  // Clear done
+    if (dma_irq) errors = errors + 1;
+    cpu_write(32'h00008020, 32'h00000000);
+    cpu_write(32'h00008024, 32'h00000200);
+    cpu_write(32'h00008028, 8);
+    cpu_write(32'h0000802C, 32'h00000001);  // Copy, start
+    dma_wait;
+    for (integer i = 0; i < 8; i = i + 1) begin
+      if (memory[128 + i] != 32'h11111111 * i) errors = errors + 1;
+    end
+
+    // Stream 6 bytes from the peripheral to 0x301
+    cpu_write(32'h00008020, 32'h0000800C);
+    cpu_write(32'h00008024, 32'h00000301);
+    cpu_write(32'h00008028, 6);
+    cpu_write(32'h0000802C, 32'h00000005);  // Stream, start
+    dma_wait;
+    if (memory[192] != 32'h32313000) errors = errors + 1;
+    if (memory[193] != 32'h00353433) errors = errors + 1;
+
+    // Stream 6 more bytes to 0x310 with the wait state
+    io_wait_en = 1;
+    cpu_write(32'h00008024, 32'h00000310);
+    cpu_write(32'h00008028, 6);
+    cpu_write(32'h0000802C, 32'h00000005);  // Stream, start
+    dma_wait;
+    if (memory[196] != 32'h39383736) errors = errors + 1;
+    if (memory[197] != 32'h00003B3A) errors = errors + 1;
+
+    if (errors == 0) begin
+      $display("DMA test passed");
+    end else begin
+      $display("DMA test failed (%0d errors)", errors);
+    end
+    $finish;
+  end
+
+endmodule
@@ -8,10 +8,14 @@
  * slower o_ce, the faster one is used for the RX where we need faster clock
  * to sync up with the start bit of the incoming transmission, the slower one
  * is used for the TX as it doesn't have to sync up with anything.
+ * Fractional part of the division is accumulated, every time it overflows
+ * the period of o_ce_x8 is made one cycle longer, so the average period is
+ * (i_clk_div + 1 + i_clk_frac / 256) cycles.
  *
- * i_clk     - Clock input
- * i_rst     - Reset input
- * i_clk_div - Clock division amount
+ * i_clk      - Clock input
+ * i_rst      - Reset input
+ * i_clk_div  - Clock division amount
+ * i_clk_frac - Clock division fraction (in 1/256 steps)
  *
  * o_ce_8x   - faster clock enable
  * o_ce      - slower clock enable
@@ -21,6 +25,7 @@ module uart_baud_gen(
   input         i_clk,
   input         i_rst,
   input  [15:0] i_clk_div,
+  input  [ 7:0] i_clk_frac,
   output        o_ce_x8,
   output        o_ce
 );
@@ -28,13 +33,18 @@ module uart_baud_gen(
   // Fast counter
   reg  [15:0] clk_cnt_1;
   wire        clk_cnt_1_top;
+  // Fraction accumulator
+  reg  [ 7:0] frac_acc;
+  reg         frac_extra;
+  wire [ 8:0] frac_sum;
   // Slow counter
   reg  [ 2:0] clk_cnt_2;
   wire        clk_cnt_2_top;
 
   /* First counter - main division counter, it counts up to (and including)
    * the i_clk_div value, and on top generates the clock enable for the next
-   * counter.
+   * counter (if the division amount is lowered below the current count the
+   * counter restarts right away instead of wrapping around).
    */
   always @(posedge i_clk) begin
     if (i_rst || clk_cnt_1_top) begin
@@ -43,7 +53,22 @@ module uart_baud_gen(
       clk_cnt_1 <= clk_cnt_1 + 16'd1;
     end
   end
-  assign clk_cnt_1_top = (clk_cnt_1 == i_clk_div);
+  assign clk_cnt_1_top = (clk_cnt_1 >= i_clk_div + {15'd0, frac_extra});
+
+  /* Fraction accumulator - fraction is added on every top of the first
+   * counter, the carry stretches the next period of the first counter.
+   */
+  assign frac_sum = {1'b0, frac_acc} + {1'b0, i_clk_frac};
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      frac_acc   <= 0;
+      frac_extra <= 0;
+    end else if (clk_cnt_1_top) begin
+      frac_acc   <= frac_sum[7:0];
+      frac_extra <= frac_sum[8];
+    end
+  end
 
   /* The second counter - modulo 8 counter used to generate clock for TX */
   always @(posedge i_clk) begin
@@ -0,0 +1,105 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: fifo.v
+ *
+ * This file contains the UART buffer, a circular buffer with 2^UART_FIFO_BITS
+ * entries (see config.v). The oldest entry is always put out on o_data
+ * (first word fall through), it's read from the array synchronously, so the
+ * array can be placed in the block RAM (UART_FIFO_BRAM), the entry written
+ * into the empty buffer is passed around the array. Writes to the full
+ * buffer and reads from the empty buffer are ignored.
+ *
+ * i_clk   - Clock input
+ * i_clear - Clear the buffer
+ *
+ * i_wr    - Write enable
+ * i_data  - Write data
+ * i_rd    - Read enable (removes the oldest entry)
+ * o_data  - Oldest entry (valid if the buffer isn't empty)
+ *
+ * o_empty - Buffer is empty
+ * o_half  - Buffer is more than half full
+ * o_full  - Buffer is full
+ ***************************************************************************/
+`include "../../cpu/config.v"
+
+module uart_fifo (
+  input        i_clk,
+  input        i_clear,
+
+  input        i_wr,
+  input  [8:0] i_data,
+  input        i_rd,
+  output [8:0] o_data,
+
+  output       o_empty,
+  output       o_half,
+  output       o_full
+);
+
+  localparam BITS = `UART_FIFO_BITS;
+  localparam DEPTH = (1 << `UART_FIFO_BITS);
+
+  // Buffer array
+`ifdef HARDWARE_TIPS
+`ifdef UART_FIFO_BRAM
+  (* ram_style = "block" *)
+`else
+  (* ram_style = "distributed" *)
+`endif
+`endif
+  reg  [8:0]      buffer [0:DEPTH-1];
+  reg  [8:0]      head;
+
+  // Pointers
+  reg  [BITS-1:0] wr_ptr;
+  reg  [BITS-1:0] rd_ptr;
+  reg  [BITS:0]   count;
+  wire [BITS-1:0] rd_ptr_next;
+  wire            wr_en;
+  wire            rd_en;
+
+
+  /**
+   * Pointers and the entry counter
+   */
+  assign wr_en = i_wr && !o_full;
+  assign rd_en = i_rd && !o_empty;
+  assign rd_ptr_next = rd_ptr + rd_en;
+
+  always @(posedge i_clk) begin
+    if (i_clear) begin
+      wr_ptr <= 0;
+      rd_ptr <= 0;
+      count  <= 0;
+    end else begin
+      if (wr_en) begin
+        wr_ptr <= wr_ptr + 1'b1;
+      end
+      rd_ptr <= rd_ptr_next;
+      count  <= count + wr_en - rd_en;
+    end
+  end
+
+  /**
+   * Buffer array
+   *  Oldest entry is read with the next read pointer, the entry written at
+   *  this address is passed around
+   */
+  always @(posedge i_clk) begin
+    if (wr_en) begin
+      buffer[wr_ptr] <= i_data;
+    end
+    head <= (wr_en && wr_ptr == rd_ptr_next) ? i_data : buffer[rd_ptr_next];
+  end
+
+  /**
+   * Output assignment
+   */
+  assign o_data  = head;
+  assign o_empty = (count == 0);
+  assign o_half  = (count > DEPTH / 2);
+  assign o_full  = (count == DEPTH);
+
+endmodule
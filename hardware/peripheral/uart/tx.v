@@ -20,6 +20,7 @@
  * o_tx     - TX output
  * o_busy   - Busy output (set at the i_start signal and cleared when the
  *            last stop bit is reached)
+ * o_idle   - Idle output (the last stop bit is out)
  ***************************************************************************/
 
 module uart_tx(
@@ -35,7 +36,8 @@ module uart_tx(
   input       i_start,
 
   output      o_tx,
-  output      o_busy
+  output      o_busy,
+  output      o_idle
 );
 
   // FSM States
@@ -212,5 +214,6 @@ module uart_tx(
 
   // All states besides S_IDLE and S_STOP are considered being busy
   assign o_busy = (state != S_IDLE) && (state != S_STOP);
+  assign o_idle = (state == S_IDLE);
 
 endmodule
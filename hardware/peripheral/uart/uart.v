@@ -4,11 +4,15 @@
  * File: uart.v
  *
  * This file contains the UART transmitter and receiver buffers and the baud
- * rate generator.
+ * rate generator. Both buffers have 2^UART_FIFO_BITS entries (see config.v
+ * and fifo.v). Receiver timeout is set when the receiver buffer isn't empty
+ * and nothing was received nor read for 4 characters (40 bit times), so the
+ * rest of the data below the interrupt threshold can be picked up.
  *
  * i_clk         - Clock input
  * i_rst         - Reset input
  * i_clk_div     - Clock division amoint
+ * i_clk_frac    - Clock division fraction (in 1/256 steps)
  *
  * i_length      - Receive data length (i_length + 6 is the actual length)
  * i_stop2       - Two stop bits enable
@@ -26,6 +30,8 @@
  *
  * o_overrun_err - Overrun error (state of '0' in stop bits)
  * o_parity_err  - Parity error (sum of all ones not correct)
+ * o_rx_lost     - Receiver buffer was full, data was lost (cleared like the
+ *                 errors)
  *
  * o_txbuf_empty - Transmitter buffer is empty
  * o_txbuf_half  - Transmitter buffer is half full
@@ -33,11 +39,14 @@
  * o_rxbuf_empty - Receiver buffer is empty
  * o_rxbuf_half  - Receiver buffer is half full
  * o_rxbuf_full  - Receiver buffer is full
+ * o_rx_timeout  - Receiver timeout
+ * o_tx_idle     - Transmitter buffer is empty and the last character is out
  *
  * o_tx          - Transmitter output
  * i_rx          - Receiver input
  ***************************************************************************/
 `include "baud_gen.v"
+`include "fifo.v"
 `include "tx.v"
 `include "rx.v"
 
@@ -45,6 +54,7 @@ module uart(
   input         i_clk,
   input         i_rst,
   input  [15:0] i_clk_div,
+  input  [ 7:0] i_clk_frac,
 
   input         i_txen,
   input         i_rxen,
@@ -65,6 +75,7 @@ module uart(
 
   output        o_overrun_err,
   output        o_parity_err,
+  output        o_rx_lost,
 
   output        o_txbuf_empty,
   output        o_txbuf_half,
@@ -72,6 +83,8 @@ module uart(
   output        o_rxbuf_empty,
   output        o_rxbuf_half,
   output        o_rxbuf_full,
+  output        o_rx_timeout,
+  output        o_tx_idle,
 
   output        o_tx,
   input         i_rx
@@ -82,24 +95,24 @@ module uart(
   wire       ce;
 
   // Transmiter buffer
-  reg  [8:0] tx_buffer [0:15];
-  reg  [4:0] tx_buff_cnt = 5'b01111;
-
   wire [8:0] tx_buff_data;
+  wire       tx_buff_clear;
   wire       tx_ce;
   wire       tx_start;
   wire       tx_busy;
+  wire       tx_idle;
   wire       tx_buf_empty;
   wire       tx_buf_half;
   wire       tx_buf_full;
 
   // Receiver buffer
-  reg  [8:0] rx_buffer [0:15];
-  reg  [4:0] rx_buff_cnt = 5'b01111;
+  wire [8:0] rx_buff_head;
   reg  [8:0] rx_buff_data = 0;
   reg        rx_busy_prev = 0;
+  reg        rx_lost = 0;
 
   wire [8:0] rx_data;
+  wire       rx_buff_clear;
   wire       rx_buff_wr;
   wire       rx_buf_empty;
   wire       rx_buf_half;
@@ -107,63 +120,47 @@ module uart(
   wire       rx_ce;
   wire       rx_busy;
 
+  // Receiver timeout
+  reg  [5:0] rx_idle_cnt = 0;
+  wire       rx_timeout;
+
   /**
    * Baud rate generator generates 2 clock enable signals one faster (ce_x8)
    * used for receiver syncing (it's divided further inside the receiver) and
    * a slower signal used for transmitter.
    */
   uart_baud_gen uart_baud_gen_i (
-    .i_clk     (i_clk),
-    .i_rst     (i_rst),
-    .i_clk_div (i_clk_div),
-    .o_ce_x8   (ce_x8),
-    .o_ce      (ce)
+    .i_clk      (i_clk),
+    .i_rst      (i_rst),
+    .i_clk_div  (i_clk_div),
+    .i_clk_frac (i_clk_frac),
+    .o_ce_x8    (ce_x8),
+    .o_ce       (ce)
   );
 
   /**
-   * Transmitter buffer, implemented as shift register and a counter register,
-   * bit 4 of the counter is used as inverted buffer empty signal, when data
-   * is loaded into the buffer counter changes state from 01111 (BIT4:0) to
-   * 10000 (BIT4:1), data is sent out until bit 4 gets cleared.
+   * Transmitter buffer, data is removed from the buffer when the transmitter
+   * starts sending it out.
    */
-  always @(posedge i_clk) begin
-    // If conditions for the buffer clear are met the counter is reset to
-    // initial values.
-    if (i_clear_txbuf || i_rst || !i_txen) begin
-      tx_buff_cnt <= 5'b01111;
-    end else begin
-      if (i_txwr) begin
-        // Shift the data into the buffer
-        for (integer i = 0; i < 15; i = i + 1) begin
-          tx_buffer[i + 1] <= tx_buffer[i];
-        end
-        tx_buffer[0] <= i_data_in;
-        // Unless at this point the data is read from the buffer increment the
-        // counter (if data is both read and written data is shifted but the
-        // counter stays the same).
-        if (!ce || !tx_start) begin
-          tx_buff_cnt <= tx_buff_cnt + 1;
-        end
-      end else if (ce && tx_start) begin
-        // If reading from the buffer and NOT writing to it decrement the cnt.
-        tx_buff_cnt <= tx_buff_cnt - 1;
-      end
-    end
-  end
+  assign tx_buff_clear = i_clear_txbuf || i_rst || !i_txen;
+
+  uart_fifo tx_fifo_i (
+    .i_clk   (i_clk),
+    .i_clear (tx_buff_clear),
+    .i_wr    (i_txwr),
+    .i_data  (i_data_in),
+    .i_rd    (ce && tx_start),
+    .o_data  (tx_buff_data),
+    .o_empty (tx_buf_empty),
+    .o_half  (tx_buf_half),
+    .o_full  (tx_buf_full)
+  );
 
-  // Buffer data is just multiplexed from the shift register (internally it's
-  // much more optimised than it looks)
-  assign tx_buff_data = tx_buffer[tx_buff_cnt[3:0]];
   // Transimtter ce is global ce AND transmitter enable
   assign tx_ce = ce && i_txen;
   // If there's data in the buffer and transmitter isn't already busy start
   // the transmission
-  assign tx_start = tx_buff_cnt[4] && !tx_busy;
-
-  // Transmitter buffer fill signals
-  assign tx_buf_empty = (tx_buff_cnt == 5'b01111);
-  assign tx_buf_half  = (tx_buff_cnt >= 5'b11000);
-  assign tx_buf_full  = (tx_buff_cnt == 5'b11111);
+  assign tx_start = !tx_buf_empty && !tx_busy;
 
   // Transmitter instancing
   uart_tx tx_i (
@@ -177,39 +174,33 @@ module uart(
     .i_odd    (i_odd),
     .i_start  (tx_start),
     .o_tx     (o_tx),
-    .o_busy   (tx_busy)
+    .o_busy   (tx_busy),
+    .o_idle   (tx_idle)
   );
 
   /**
    * Receiver buffer works just like the transmitter buffer, only real
    * difference being that the receiver dictates when the buffer is written
-   * instead of the data bus.
+   * instead of the data bus. Oldest entry is put out on the data line when
+   * it's read.
    */
+  assign rx_buff_clear = i_clear_rxbuf || i_rst || !i_rxen;
+
+  uart_fifo rx_fifo_i (
+    .i_clk   (i_clk),
+    .i_clear (rx_buff_clear),
+    .i_wr    (rx_buff_wr),
+    .i_data  (rx_data),
+    .i_rd    (i_rxrd),
+    .o_data  (rx_buff_head),
+    .o_empty (rx_buf_empty),
+    .o_half  (rx_buf_half),
+    .o_full  (rx_buf_full)
+  );
+
   always @(posedge i_clk) begin
-    // If conditions for the buffer clear are met the counter is reset to
-    // initial values.
-    if (i_clear_rxbuf || i_rst || !i_rxen) begin
-      rx_buff_cnt <= 5'b01111;
-    end else begin
-      if (rx_buff_wr) begin
-        // Shift the data into the buffer
-        for (integer i = 0; i < 15; i = i + 1) begin
-          rx_buffer[i + 1] <= rx_buffer[i];
-        end
-        rx_buffer[0] <= rx_data;
-        // Unless at R and W operation occured increment the counter.
-        if (!i_rxrd || !rx_buff_cnt[4]) begin
-          rx_buff_cnt <= rx_buff_cnt + 1;
-        end
-      end
-      if (i_rxrd && rx_buff_cnt[4]) begin
-        // Put the buffer data out on the data line
-        rx_buff_data <= rx_buffer[rx_buff_cnt[3:0]];
-        // Unless at R and W operation occured increment the counter.
-        if (!rx_buff_wr) begin
-          rx_buff_cnt <= rx_buff_cnt - 1;
-        end
-      end
+    if (i_rxrd && !rx_buf_empty) begin
+      rx_buff_data <= rx_buff_head;
     end
   end
 
@@ -223,16 +214,18 @@ module uart(
   end
 
   // Receive buffer write is enabled based on the data from the edge detector
-  // signal and whether the buffer is full, if buffer is full the data has to
-  // be discarded.
-  assign rx_buff_wr = rx_busy_prev && !rx_busy && ~&rx_buff_cnt;
+  // signal, if buffer is full the data is discarded (and the loss is noted).
+  assign rx_buff_wr = rx_busy_prev && !rx_busy;
   // Transimtter ce is global ce AND receiver enable
   assign rx_ce = ce_x8 && i_rxen;
 
-  // Receiver buffer fill signals
-  assign rx_buf_empty = (rx_buff_cnt == 5'b01111);
-  assign rx_buf_half  = (rx_buff_cnt >= 5'b11000);
-  assign rx_buf_full  = (rx_buff_cnt == 5'b11111);
+  always @(posedge i_clk) begin
+    if (i_rst || i_rst_err) begin
+      rx_lost <= 0;
+    end else if (rx_buff_wr && rx_buf_full) begin
+      rx_lost <= 1;
+    end
+  end
 
   // Receiver instancing
   uart_rx rx_i (
@@ -251,17 +244,41 @@ module uart(
     .o_busy        (rx_busy)
   );
 
+  /**
+   * Receiver timeout counts the bit times in which nothing happens with the
+   * receiver, it's restarted by the receiver activity and the buffer reads
+   */
+  always @(posedge i_clk) begin
+    if (rx_buff_clear || rx_busy || i_rxrd) begin
+      rx_idle_cnt <= 0;
+    end else if (ce && !rx_timeout) begin
+      rx_idle_cnt <= rx_idle_cnt + 1;
+    end
+  end
+
+  assign rx_timeout = (rx_idle_cnt == 6'd40);
+
   /**
    * Output assignments
    */
+`ifdef POSEDGE_ONLY
+  // Bus reads the data register synchronously (at the same edge that pops
+  // the buffer), so the oldest entry of the buffer is put out instead
+  assign o_data_out = rx_buff_head;
+`else
   assign o_data_out = rx_buff_data;
+`endif
+
+  assign o_rx_lost     = rx_lost;
 
   assign o_rxbuf_empty = rx_buf_empty;
   assign o_rxbuf_half  = rx_buf_half;
   assign o_rxbuf_full  = rx_buf_full;
+  assign o_rx_timeout  = rx_timeout && !rx_buf_empty;
 
   assign o_txbuf_empty = tx_buf_empty;
   assign o_txbuf_half  = tx_buf_half;
   assign o_txbuf_full  = tx_buf_full;
+  assign o_tx_idle     = tx_buf_empty && tx_idle;
 
 endmodule
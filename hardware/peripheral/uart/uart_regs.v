@@ -1,11 +1,16 @@
 /**
  *
  * 0 - Clock register
- * [31:16] - unused
+ * [31:24] - unused
+ * [23:16] - clock division fraction (rw0) (in 1/256 steps)
  * [15:0] - clock division (rw0)
  *
  * 1 - Configuration register
- * [31:9] - unused
+ * [31:13] - unused
+ * [12] - rx timeout interrupt enable (rw0)
+ * [11] - rx interrupt threshold (rw0) (0 - not empty, 1 - half full)
+ * [10] - tx interrupt enable (rw0) (tx buffer is less than half full)
+ * [9] - rx interrupt enable (rw0) (rx buffer has reached the threshold)
  * [8] - rx_clear bit (w)
  * [7] - tx_clear bit (w)
  * [6:5] - length (rw2)
@@ -16,7 +21,12 @@
  * [0] - tx enable (rw0)
  *
  * 2 - Status register
- * [31:8] - unused
+ * [31:12] - unused
+ * [11] - rx data lost (r) (rx buffer was full)
+ * [10] - tx idle (r) (tx buffer is empty and the last stop bit is out)
+ * [9] - rx timeout (r) (rx buffer isn't empty and nothing was received nor
+ *       read for 4 characters)
+ * [8] - interrupt request (r)
  * [7] - rx buffer full (r)
  * [6] - rx buffer half (r)
  * [5] - rx buffer empty (r)
@@ -25,10 +35,19 @@
  * [2] - tx buffer empty (r)
  * [1] - overrun err (r)
  * [0] - parity err (r)
+ * Error bits and the rx data lost bit are cleared by reading this register.
  *
  * 3 - Data io register
  * [31:9] - unused
  * [8:0] - tx/rx data (rw) (like AVR)
+ *
+ * Interrupt request output (o_irq) is level sensitive, it's set as long as
+ * any of the enabled conditions is met, so the interrupt handler clears it
+ * by reading the rx buffer or by filling the tx buffer (or by disabling
+ * the interrupt).
+ *
+ * Receiver data request output (o_rx_dreq) is set while the rx buffer
+ * isn't empty, it paces the DMA stream transfers (see dma.v).
  */
 `include "uart.v"
 
@@ -45,8 +64,11 @@ module uart_regs(
   output [31:0] o_data_out,
 
   output        o_tx,
-  input         i_rx
+  input         i_rx,
   // verilator lint_on unused
+
+  output        o_irq,
+  output        o_rx_dreq
 );
 
   localparam [1:0]
@@ -55,18 +77,23 @@ module uart_regs(
     A_STATUS = 2,
     A_DATA   = 3;
 
-  reg [15:0] clk_div_reg = 0;
-  reg [ 6:0] config_reg  = 7'h40;
+  reg [15:0] clk_div_reg  = 0;
+  reg [ 7:0] clk_frac_reg = 0;
+  reg [ 6:0] config_reg   = 7'h40;
+  reg [ 3:0] irq_reg      = 4'h0;
 
   wire [8:0] read_data;
   wire       overrun_err;
   wire       parity_err;
+  wire       rx_lost;
   wire       txbuf_empty;
   wire       txbuf_half;
   wire       txbuf_full;
   wire       rxbuf_empty;
   wire       rxbuf_half;
   wire       rxbuf_full;
+  wire       rx_timeout;
+  wire       tx_idle;
 
   wire clock_adr;
   wire config_adr;
@@ -78,23 +105,32 @@ module uart_regs(
   wire clear_rxbuf;
   wire clear_err;
 
-  wire [7:0] status_reg;
+  wire       irq_rx;
+  wire       irq_tx;
+  wire       irq_timeout;
+  wire       irq;
+
+  wire [11:0] status_reg;
 
   reg [31:0] data_out;
 
   always @(posedge i_clk) begin
     if (i_rst) begin
-      clk_div_reg <= 0;
+      clk_div_reg  <= 0;
+      clk_frac_reg <= 0;
     end else if (i_cs && i_wr && clock_adr) begin
-      clk_div_reg <= i_data_in[15:0];
+      clk_div_reg  <= i_data_in[15:0];
+      clk_frac_reg <= i_data_in[23:16];
     end
   end
 
   always @(posedge i_clk) begin
     if (i_rst) begin
       config_reg <= 0;
+      irq_reg    <= 0;
     end else if (i_cs && i_wr && config_adr) begin
       config_reg <= i_data_in[6:0];
+      irq_reg    <= i_data_in[12:9];
     end
   end
 
@@ -102,6 +138,7 @@ module uart_regs(
   .i_clk         (i_clk),
   .i_rst         (i_rst),
   .i_clk_div     (clk_div_reg),
+  .i_clk_frac    (clk_frac_reg),
   .i_txen        (config_reg[0]),
   .i_rxen        (config_reg[1]),
   .i_length      (config_reg[6:5]),
@@ -117,12 +154,15 @@ module uart_regs(
   .i_rxrd        (rxrd),
   .o_overrun_err (overrun_err),
   .o_parity_err  (parity_err),
+  .o_rx_lost     (rx_lost),
   .o_txbuf_empty (txbuf_empty),
   .o_txbuf_half  (txbuf_half),
   .o_txbuf_full  (txbuf_full),
   .o_rxbuf_empty (rxbuf_empty),
   .o_rxbuf_half  (rxbuf_half),
   .o_rxbuf_full  (rxbuf_full),
+  .o_rx_timeout  (rx_timeout),
+  .o_tx_idle     (tx_idle),
   .o_tx          (o_tx),
   .i_rx          (i_rx)
   );
@@ -138,7 +178,14 @@ module uart_regs(
   assign clear_rxbuf = i_cs && i_wr && config_adr && i_data_in[8];
   assign clear_err   = i_cs && i_rd && status_adr;
 
+  // Buffer threshold and receiver timeout interrupts
+  assign irq_rx      = irq_reg[0] && ((irq_reg[2]) ? rxbuf_half : !rxbuf_empty);
+  assign irq_tx      = irq_reg[1] && !txbuf_half;
+  assign irq_timeout = irq_reg[3] && rx_timeout;
+  assign irq         = irq_rx || irq_tx || irq_timeout;
+
   assign status_reg = {
+    rx_lost, tx_idle, rx_timeout, irq,
     rxbuf_full, rxbuf_half, rxbuf_empty,
     txbuf_full, txbuf_half, txbuf_empty,
     overrun_err, parity_err
@@ -146,13 +193,15 @@ module uart_regs(
 
   always @* begin
     case (i_addr)
-      A_CLOCK:  data_out = { 16'd0, clk_div_reg };
-      A_CONFIG: data_out = { 25'd0, config_reg };
-      A_STATUS: data_out = { 24'd0, status_reg };
+      A_CLOCK:  data_out = { 8'd0, clk_frac_reg, clk_div_reg };
+      A_CONFIG: data_out = { 19'd0, irq_reg, 2'd0, config_reg };
+      A_STATUS: data_out = { 20'd0, status_reg };
       A_DATA:   data_out = { 23'd0, read_data };
     endcase
   end
 
   assign o_data_out = data_out;
+  assign o_irq      = irq;
+  assign o_rx_dreq  = !rxbuf_empty;
 
 endmodule
@@ -1,3 +1,31 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: uart_tb.v
+ *
+ * This is a test bench for the UART (see uart.v). One clock cycle is 10 time
+ * units, the UART clock frequency (UART_TB_CLOCK) is only used for the
+ * division and the printed rates. Clock division and its fraction are
+ * calculated for UART_TB_BAUD (8N1 format), then:
+ *  - UART_TB_COUNT bytes are sent from the transmitter to the receiver (the
+ *    buffers are kept fed and drained), bit time error, number of bad bytes
+ *    and the throughput are checked
+ *  - UART_TB_COUNT bytes are sent to the receiver by the serial line model
+ *    running 2% faster and 2% slower than the set baud rate
+ *  - receiver timeout is checked (not set after 30 bit times, set after 45)
+ *  - receiver buffer is overfilled, data lost flag is checked
+ * The result is printed at the end.
+ ***************************************************************************/
+`ifndef UART_TB_CLOCK
+  `define UART_TB_CLOCK 10000000
+`endif
+`ifndef UART_TB_BAUD
+  `define UART_TB_BAUD 1000000
+`endif
+`ifndef UART_TB_COUNT
+  `define UART_TB_COUNT 256
+`endif
+
 `include "uart.v"
 
 module uart_tb;
@@ -7,119 +35,217 @@ module uart_tb;
     $dumpvars(0, uart_i);
   end
 
+  // Clock division (x8 period in 1/256 cycle steps)
+  localparam PERIOD = (`UART_TB_CLOCK * 32 + `UART_TB_BAUD / 2) / `UART_TB_BAUD;
+  localparam [15:0] DIV = PERIOD / 256 - 1;
+  localparam [ 7:0] FRAC = PERIOD % 256;
+  localparam DEPTH = (1 << `UART_FIFO_BITS);
+  // Bit time in time units
+  localparam BIT_TIME = 10 * `UART_TB_CLOCK / `UART_TB_BAUD;
+
+  // UART
   reg        clk = 0;
   reg        rst = 1;
-  reg  [1:0] length = 2;
-  reg        stop2 = 0;
-  reg        parity = 0;
-  reg        odd = 0;
-
-  reg  [8:0] data = 0;
+  reg  [8:0] data_in = 0;
+  wire [8:0] data_out;
   reg        wr = 0;
   reg        rd = 0;
-
-  always #1 clk = !clk;
-
-  initial begin
-    #10 rst = 0;
-
-    #10
-    data = 9'h048;
-    wr = 1'b1;
-    #2
-    data = 9'h055;
-    wr = 1'b1;
-    #2
-    data = 9'h04A;
-    wr = 1'b1;
-    #2
-    data = 9'h045;
-    wr = 1'b1;
-    #2
-    data = 9'h043;
-    wr = 1'b1;
-    #2
-    data = 9'h031;
-    wr = 1'b1;
-    #2
-    data = 9'h032;
-    wr = 1'b1;
-    #2
-    data = 9'h033;
-    wr = 1'b1;
-    #2
-    data = 9'h034;
-    wr = 1'b1;
-    #2
-    data = 9'h035;
-    wr = 1'b1;
-    #2
-    data = 9'h036;
-    wr = 1'b1;
-    #2
-    data = 9'h037;
-    wr = 1'b1;
-    #2
-    data = 9'h038;
-    wr = 1'b1;
-    #2
-    data = 9'h039;
-    wr = 1'b1;
-    #2
-    data = 9'h155;
-    wr = 1'b1;
-    #2
-    data = 9'h1FF;
-    wr = 1'b1;
-    #2
-    data = 9'h000;
-    wr = 1'b0;
-
-    #8000
-    rd = 1'b1;
-    #36
-    rd = 1'b0;
-
-    #100 $finish;
-  end
-
-  wire loopback;
+  reg        rst_err = 0;
+  reg        ext_mode = 0;
+  reg        ext_tx = 1;
+  wire       tx;
+  wire       overrun_err;
+  wire       parity_err;
+  wire       rx_lost;
+  wire       txbuf_full;
+  wire       rxbuf_empty;
+  wire       rxbuf_full;
+  wire       rx_timeout;
+  wire       tx_idle;
 
   // verilator lint_off PINCONNECTEMPTY
   uart uart_i (
-    .i_clk(clk),
-    .i_rst(rst),
-    .i_clk_div(16'd1),
-
-    .i_txen(1'b1),
-    .i_rxen(1'b1),
-
-    .i_length(length),
-    .i_stop2(stop2),
-    .i_parity(parity),
-    .i_odd(odd),
-
-    .i_rst_err(1'b0),
-    .i_clear_txbuf(1'b0),
-    .i_clear_rxbuf(1'b0),
-
-    .i_data_in(data),
-    .o_data_out(),
-    .i_txwr(wr),
-    .i_rxrd(rd),
-
-    .o_overrun_err(),
-    .o_parity_err(),
-
-    .o_txbuf_empty(),
-    .o_txbuf_half(),
-    .o_txbuf_full(),
-    .o_rxbuf_empty(),
-    .o_rxbuf_half(),
-    .o_rxbuf_full(),
-
-    .o_tx(loopback),
-    .i_rx(loopback)
+    .i_clk         (clk),
+    .i_rst         (rst),
+    .i_clk_div     (DIV),
+    .i_clk_frac    (FRAC),
+    .i_txen        (1'b1),
+    .i_rxen        (1'b1),
+    .i_length      (2'd2),
+    .i_stop2       (1'b0),
+    .i_parity      (1'b0),
+    .i_odd         (1'b0),
+    .i_rst_err     (rst_err),
+    .i_clear_txbuf (1'b0),
+    .i_clear_rxbuf (1'b0),
+    .i_data_in     (data_in),
+    .o_data_out    (data_out),
+    .i_txwr        (wr),
+    .i_rxrd        (rd),
+    .o_overrun_err (overrun_err),
+    .o_parity_err  (parity_err),
+    .o_rx_lost     (rx_lost),
+    .o_txbuf_empty (),
+    .o_txbuf_half  (),
+    .o_txbuf_full  (txbuf_full),
+    .o_rxbuf_empty (rxbuf_empty),
+    .o_rxbuf_half  (),
+    .o_rxbuf_full  (rxbuf_full),
+    .o_rx_timeout  (rx_timeout),
+    .o_tx_idle     (tx_idle),
+    .o_tx          (tx),
+    .i_rx          ((ext_mode) ? ext_tx : tx)
   );
+  // verilator lint_on PINCONNECTEMPTY
+
+  always #5 clk = !clk;
+
+  // Test data
+  reg  [7:0] test_data [0:`UART_TB_COUNT-1];
+  integer    errors = 0;
+  integer    bad_bytes;
+
+  // Bus side of the buffers (tasks start and end right after the rising edge)
+  reg  [7:0] rx_byte;
+
+  task tx_write(input [7:0] data);
+    begin
+      while (txbuf_full) @(posedge clk);
+      data_in = data; wr = 1;
+      @(posedge clk); #1 wr = 0;
+    end
+  endtask
+
+  task rx_read;
+    begin
+      while (rxbuf_empty) @(posedge clk);
+      rd = 1;
+`ifdef POSEDGE_ONLY
+      rx_byte = data_out[7:0];
+      @(posedge clk); #1 rd = 0;
+`else
+      @(posedge clk); #1 rd = 0;
+      rx_byte = data_out[7:0];
+`endif
+    end
+  endtask
+
+  task rx_check(input integer count);
+    begin
+      bad_bytes = 0;
+      for (integer i = 0; i < count; i = i + 1) begin
+        rx_read;
+        if (rx_byte != test_data[i]) bad_bytes = bad_bytes + 1;
+      end
+    end
+  endtask
+
+  // Serial line model (bit time in time units)
+  task ext_send(input [7:0] data, input integer bit_time);
+    begin
+      ext_tx = 0; #(bit_time);
+      for (integer i = 0; i < 8; i = i + 1) begin
+        ext_tx = data[i]; #(bit_time);
+      end
+      ext_tx = 1; #(bit_time);
+    end
+  endtask
+
+  task ext_test(input integer bit_time);
+    begin
+      fork
+        for (integer i = 0; i < `UART_TB_COUNT; i = i + 1) begin
+          ext_send(test_data[i], bit_time);
+        end
+        rx_check(`UART_TB_COUNT);
+      join
+      $display("Line at %0d%% baud: %0d/%0d bad bytes", BIT_TIME * 100 /
+        bit_time, bad_bytes, `UART_TB_COUNT);
+      if (bad_bytes != 0 || overrun_err || parity_err) errors = errors + 1;
+    end
+  endtask
+
+  // Bit time of the transmitter (time of the first and last start bit, the
+  // transmitter starts a character when it removes it from the buffer)
+  integer    start_first = -1;
+  integer    start_last;
+  integer    time_first;
+  integer    time_last;
+  real       bit_error;
+  real       rate;
+
+  always @(posedge clk) begin
+    if (!ext_mode && uart_i.ce && uart_i.tx_start) begin
+      if (start_first < 0) start_first = $time;
+      start_last = $time;
+    end
+  end
+
+  // Test sequence
+  initial begin
+    for (integer i = 0; i < `UART_TB_COUNT; i = i + 1) begin
+      test_data[i] = $random;
+    end
+    $display("Clock %0d Hz, baud %0d, division %0d + %0d/256",
+      `UART_TB_CLOCK, `UART_TB_BAUD, DIV, FRAC);
+
+    #100 rst = 0;
+    @(posedge clk); #1;
+
+    // Loopback
+    time_first = $time;
+    fork
+      for (integer i = 0; i < `UART_TB_COUNT; i = i + 1) begin
+        tx_write(test_data[i]);
+      end
+      rx_check(`UART_TB_COUNT);
+    join
+    time_last = $time;
+    while (!tx_idle) @(posedge clk);
+
+    bit_error = 100.0 * ((start_last - start_first) /
+      (10.0 * (`UART_TB_COUNT - 1)) - BIT_TIME) / BIT_TIME;
+    rate = `UART_TB_COUNT * 1.0 * `UART_TB_CLOCK / ((time_last - time_first)
+      / 10.0);
+    $display("Loopback: bit time error %0.3f%%, %0d/%0d bad bytes, %0.0f B/s",
+      bit_error, bad_bytes, `UART_TB_COUNT, rate);
+    if (bit_error > 1.0 || bit_error < -1.0) errors = errors + 1;
+    if (bad_bytes != 0 || overrun_err || parity_err) errors = errors + 1;
+    if (rate < 0.95 * `UART_TB_BAUD / 10) errors = errors + 1;
+
+    // Serial line 2% faster and 2% slower
+    ext_mode = 1;
+    ext_test(BIT_TIME * 98 / 100);
+    ext_test(BIT_TIME * 102 / 100);
+
+    // Receiver timeout
+    ext_send(8'h55, BIT_TIME);
+    #(BIT_TIME * 30);
+    if (rx_timeout) errors = errors + 1;
+    #(BIT_TIME * 15);
+    if (!rx_timeout) errors = errors + 1;
+    rx_read;
+    if (rx_timeout || rx_byte != 8'h55) errors = errors + 1;
+
+    // Receiver buffer overflow
+    for (integer i = 0; i < DEPTH; i = i + 1) begin
+      ext_send(i, BIT_TIME);
+    end
+    if (!rxbuf_full || rx_lost) errors = errors + 1;
+    ext_send(8'hAA, BIT_TIME);
+    if (!rx_lost) errors = errors + 1;
+    @(posedge clk); #1 rst_err = 1;
+    @(posedge clk); #1 rst_err = 0;
+    if (rx_lost) errors = errors + 1;
+    rx_read;
+    if (rx_byte != 8'h00) errors = errors + 1;
+
+    if (errors == 0) begin
+      $display("UART test passed");
+    end else begin
+      $display("UART test failed (%0d errors)", errors);
+    end
+    $finish;
+  end
 
 endmodule
@@ -0,0 +1,124 @@
+#!/bin/python3
+#
+# Benchmark runner
+#
+# Builds the benchmarks from software/benchmarks, runs them on the test bench
+# (or on the Verilator harness with --verilator) for every configuration and
+# prints the cycles, retired instructions and CPI of each one (ISA changes
+# show up in the instruction count). Cycles and retired instructions are
+# measured by the benchmark itself (mcycle and minstret around main), so the
+# results don't include the start-up code.
+#
+# Usage: bench.py [--verilator] [--config NAME ...] [--defines D1 D2 ...]
+#   --config   - Run only the listed configurations (see configs below)
+#   --defines  - Run the custom configuration with given defines
+#
+import sys
+import subprocess
+
+BENCH_DIR = '../../software/benchmarks'
+KILL_TIME = 40000000
+
+# Configuration name: (defines, software ISA)
+configs = {
+    'baseline':       ([], 'rv32imc'),
+    'no C extension': (['NO_C_EXTENSION'], 'rv32im'),
+    'bit shifter':    (['NO_BARREL_SHIFTER'], 'rv32imc'),
+    'no forwarding':  (['NO_HAZARD_DATA_FORWARDNG'], 'rv32imc'),
+    'posedge only':   (['POSEDGE_ONLY'], 'rv32imc'),
+    'EX forwarding':  (['HAZARD_EX_FORWARDING'], 'rv32imc'),
+    'MUL_DSP':        (['MUL_DSP'], 'rv32imc'),
+    'MUL_RADIX4':     (['MUL_RADIX4'], 'rv32imc'),
+    'DIV_FAST':       (['DIV_FAST'], 'rv32imc'),
+    'scoreboard':     (['MULDIV_SCOREBOARD'], 'rv32imc'),
+    'predictor':      (['BRANCH_PREDICTOR'], 'rv32imc'),
+    'gshare':         (['BRANCH_PREDICTOR', 'BP_GSHARE'], 'rv32imc'),
+    'fetch queue':    (['FETCH_QUEUE'], 'rv32imc'),
+    'decode JAL':     (['DECODE_JAL'], 'rv32imc'),
+    'return stack':   (['RETURN_STACK'], 'rv32imc'),
+    'B extension':    (['B_EXTENSION'], 'rv32imc_zba_zbb_zbs'),
+    'F extension':    (['F_EXTENSION'], 'rv32imfc'),
+    'dual issue':     (['DUAL_ISSUE'], 'rv32imc'),
+    'dual issue all': (['DUAL_ISSUE', 'HAZARD_EX_FORWARDING', 'BRANCH_PREDICTOR',
+                        'DECODE_JAL', 'RETURN_STACK'], 'rv32imc'),
+}
+
+# Simple subprocess wrapper
+def run(cmd):
+    output = subprocess.run(cmd, shell=True, stdout=subprocess.PIPE).stdout
+    return output.decode('utf-8', 'replace').split('\n')
+
+# Find the value written to given address (UART output from the benchmark
+#  isn't followed by a newline, so it can precede the W)
+def find_write(arr, addr):
+    for line in arr:
+        words = line.split()
+        if len(words) >= 3 and words[0].endswith('W') and words[2] == f'({addr:08x})':
+            return int(words[1])
+    return None
+
+# List of the benchmarks built for given ISA
+def benchmarks(arch):
+    out = run(f'ls {BENCH_DIR}/build/{arch}/*.hex')
+    return sorted(line.split('/')[-1][:-4] for line in out if line.endswith('.hex'))
+
+# Build the software and the simulation for given configuration
+def build(defines, arch, verilator):
+    run(f'make -C {BENCH_DIR} ARCH={arch} > /dev/null')
+    if verilator:
+        run(f'make verilator VL_DEFINES="{" ".join(defines)}" > /dev/null')
+    else:
+        flags = ' '.join(f'-D{define}' for define in defines)
+        run(f'iverilog -grelative-include -DSIMULATION -DKILL_TIME=#{KILL_TIME} '
+            f'{flags} -o cpu_bench.obj cpu_tb.v')
+
+# Run one benchmark, returns (cycles, instructions) or None if it failed
+def run_bench(name, arch, verilator):
+    hex_file = f'{BENCH_DIR}/build/{arch}/{name}.hex'
+    if verilator:
+        result = run(f'verilator/obj_dir/Vcpu --cycles {KILL_TIME // 2} {hex_file}')
+    else:
+        run(f'./test.py {hex_file}')
+        result = run('vvp cpu_bench.obj')
+    status = find_write(result, 0x10000)
+    if status != 0x555:
+        return None
+    return (find_write(result, 0x10004), find_write(result, 0x10008))
+
+def main():
+    args = sys.argv[1:]
+    verilator = '--verilator' in args
+    selected = list(configs.keys())
+    if '--config' in args:
+        selected = [a for a in args[args.index('--config') + 1:] if not a.startswith('--')]
+    if '--defines' in args:
+        defines = [a for a in args[args.index('--defines') + 1:] if not a.startswith('--')]
+        configs['custom'] = (defines, 'rv32imc')
+        selected = ['baseline', 'custom']
+
+    results = {}
+    for config in selected:
+        (defines, arch) = configs[config]
+        print(f'\n\033[97;1mRunning {config}:\033[0m {" ".join(defines)}')
+        build(defines, arch, verilator)
+        for bench in benchmarks(arch):
+            res = run_bench(bench, arch, verilator)
+            results[(config, bench)] = res
+            if res is None:
+                print(f'\033[31;1mFailed \033[97;1m{bench}\033[0m')
+                continue
+            (cycles, instret) = res
+            cpi = f'{cycles / instret:.3f}' if instret else 'n/a'
+            base = results.get(('baseline', bench))
+            diff = ''
+            if config != 'baseline' and base:
+                diff = f'({100.0 * (cycles - base[0]) / base[0]:+.1f}%'
+                if instret and base[1] and instret != base[1]:
+                    diff += f', {100.0 * (instret - base[1]) / base[1]:+.1f}% instructions'
+                diff += ')'
+            print(f'\033[97;1m{bench} \033[20G\033[0m{cycles:>12} cycles {instret:>12} instructions  CPI {cpi:>6} {diff}')
+
+    run('rm -f cpu_bench.obj')
+
+if __name__ == '__main__':
+    main()
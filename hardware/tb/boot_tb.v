@@ -0,0 +1,217 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: boot_tb.v
+ *
+ * This is a test bench for the bootloader and the loader script (see
+ * software/bootloader and software/loader), it runs the bootloader on the
+ * CPU with the real UART (uart_regs.v) and lets the loader talk to it. 32kB
+ * of memory is connected at addresses from 0x0000 to 0x7FFF (it starts with
+ * the jump to the bootloader), bootloader ROM at 0x10000 is read from
+ * BOOT_FILE (the bootloader has to be built with SIM=1), UART is at 0x8000,
+ * the button register reads zero (so the bootloader is entered). Memories
+ * and the UART are clocked on the falling edge like in top.v (BUS_IO_WAIT
+ * isn't supported here).
+ *
+ * Loader (PORT 'sim') writes the commands to the RX_PIPE, one per line:
+ *  w xx - Send the byte xx to the UART receiver
+ *  r n  - Run until the CPU has sent n more bytes
+ *  i n  - Idle for n cycles (baud rate switch)
+ *  q    - Stop the simulation
+ * every byte sent by the CPU is written to the TX_PIPE as a hex line. Both
+ * sides of the serial line use the bit time set by the UART clock divider
+ * and its fraction (bit edges are placed from the start of the character,
+ * so the fraction doesn't accumulate an error).
+ ***************************************************************************/
+`define BOOT_FILE "boot.mem"
+`define RX_PIPE "boot_rx.fifo"
+`define TX_PIPE "boot_tx.fifo"
+
+`include "../cpu/cpu.v"
+`include "../peripheral/uart/uart_regs.v"
+
+module boot_tb;
+
+  // CPU
+  reg         clk = 0;
+  reg         rst = 1;
+  wire [31:0] addr_i;
+  reg  [31:0] data_in_i;
+  wire [31:0] addr_d;
+  wire [31:0] data_rd_d;
+  wire [31:0] data_wr_d;
+  wire [ 3:0] wr_d;
+  wire        rd_d;
+
+  // verilator lint_off pinmissing
+  cpu cpu_i (
+    .i_clk         (clk),
+    .i_clk_ce      (1'b1),
+    .i_rst         (rst),
+`ifdef MULTI_CORE
+    .i_hart_id     (8'd0),
+`endif
+`ifdef TRAPS
+    .i_irq         (1'b0),
+`endif
+`ifdef CSR_EXTERNAL_BUS
+    .i_csr_rd_data (32'd0),
+`endif
+    .o_addr_i      (addr_i),
+    .i_data_in_i   (data_in_i),
+    .i_ready_i     (1'b1),
+    .o_addr_d      (addr_d),
+    .i_data_rd_d   (data_rd_d),
+    .o_data_wr_d   (data_wr_d),
+    .o_wr_d        (wr_d),
+    .o_rd_d        (rd_d),
+    .i_ready_d     (1'b1)
+  );
+  // verilator lint_on pinmissing
+
+  // Clock
+  always #1 clk = !clk;
+
+`ifdef POSEDGE_ONLY
+  wire mem_clk = clk;
+`else
+  wire mem_clk = !clk;
+`endif
+
+  // Memory and bootloader ROM
+  reg  [31:0] memory_array [0:8191];
+  reg  [31:0] boot_array [0:8191];
+  reg  [31:0] ram_data_d;
+  reg         ram_en_reg;
+  reg  [31:0] io_data_reg;
+  wire        ram_en = (addr_d < `BUS_IO_BASE);
+
+  initial begin
+    for (integer i = 0; i < 8192; i = i + 1) begin
+      memory_array[i] = 32'h0000006f;
+    end
+    memory_array[0] = 32'h000100b7;  // lui x1, 0x10
+    memory_array[1] = 32'h00008067;  // jalr x0, 0(x1)
+    $readmemh(`BOOT_FILE, boot_array);
+  end
+
+  always @(posedge mem_clk) begin
+    data_in_i <= (addr_i >= 32'h00010000) ? boot_array[addr_i[14:2]] :
+      memory_array[addr_i[14:2]];
+    ram_data_d <= memory_array[addr_d[14:2]];
+    ram_en_reg <= ram_en;
+    io_data_reg <= io_data;
+    for (integer i = 0; i < 4; i = i + 1) begin
+      if (wr_d[i] && ram_en) begin
+        memory_array[addr_d[14:2]][i*8 +: 8] <= data_wr_d[i*8 +: 8];
+      end
+    end
+  end
+
+  // UART
+  wire        uart_en = (addr_d[31:4] == 28'h0000800);
+  wire [31:0] uart_out;
+  wire        uart_tx;
+  reg         uart_rx = 1;
+  wire [31:0] io_data = (uart_en) ? uart_out : 32'd0;
+
+  uart_regs uart_regs_i (
+    .i_clk      (mem_clk),
+    .i_rst      (rst),
+    .i_wr       (&wr_d),
+    .i_rd       (rd_d),
+    .i_cs       (uart_en),
+    .i_addr     (addr_d[3:2]),
+    .i_data_in  (data_wr_d),
+    .o_data_out (uart_out),
+    .o_tx       (uart_tx),
+    .i_rx       (uart_rx),
+    .o_irq      (),
+    .o_rx_dreq  ()
+  );
+
+`ifdef POSEDGE_ONLY
+  assign data_rd_d = (ram_en_reg) ? ram_data_d : io_data_reg;
+`else
+  assign data_rd_d = (ram_en) ? ram_data_d : io_data;
+`endif
+
+  // Bit time of the serial line (in 1/32 cycle steps)
+  wire [31:0] bit_time = 256 * (uart_regs_i.clk_div_reg + 1) +
+    uart_regs_i.clk_frac_reg;
+
+  // Pipes to the loader
+  integer rx_pipe;
+  integer tx_pipe;
+  initial begin
+    rx_pipe = $fopen(`RX_PIPE, "r");
+    tx_pipe = $fopen(`TX_PIPE, "w");
+  end
+
+  // Bytes sent by the CPU are passed to the loader
+  integer     tx_count = 0;
+  integer     tx_pos;
+  reg  [ 7:0] tx_byte;
+
+  initial begin
+    #10;
+    forever begin
+      @(negedge uart_tx);
+      tx_pos = 0;
+      for (integer i = 0; i < 8; i = i + 1) begin
+        // Middle of the data bit (start bit is before it)
+        repeat ((((2 * i + 3) * bit_time) >> 6) - tx_pos) @(posedge clk);
+        tx_pos = ((2 * i + 3) * bit_time) >> 6;
+        tx_byte[i] = uart_tx;
+      end
+      repeat (((19 * bit_time) >> 6) - tx_pos) @(posedge clk);
+      $fwrite(tx_pipe, "%h\n", tx_byte);
+      $fflush(tx_pipe);
+      tx_count = tx_count + 1;
+    end
+  end
+
+  // Commands of the loader
+  integer     tx_expected = 0;
+  integer     cmd_count;
+  reg  [ 7:0] cmd;
+  reg  [31:0] cmd_arg;
+  integer     rx_pos;
+
+  task send_byte(input [7:0] data);
+    begin
+      uart_rx = 0;
+      rx_pos = 0;
+      for (integer i = 1; i <= 10; i = i + 1) begin
+        // End of the start bit, data bits and the stop bit
+        repeat (((i * bit_time) >> 5) - rx_pos) @(posedge clk);
+        rx_pos = (i * bit_time) >> 5;
+        uart_rx = (i < 9) ? data[i - 1] : 1'b1;
+      end
+    end
+  endtask
+
+  initial begin
+    #10 rst = 0;
+    wait (uart_regs_i.config_reg[1]);  // Bootloader has set up the UART
+    forever begin
+      cmd_count = $fscanf(rx_pipe, " %c %h", cmd, cmd_arg);
+      if (cmd_count < 1) begin
+        $display("Loader pipe closed"); $finish;
+      end
+      case (cmd)
+        "w": send_byte(cmd_arg[7:0]);
+        "r": begin
+          tx_expected = tx_expected + cmd_arg;
+          wait (tx_count >= tx_expected);
+        end
+        "i": repeat (cmd_arg) @(posedge clk);
+        "q": begin
+          $display("Stopped by the loader %d", $time / 2 + 1); $finish;
+        end
+        default: begin end  // Empty expression
+      endcase
+    end
+  end
+
+endmodule
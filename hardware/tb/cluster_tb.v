@@ -0,0 +1,206 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: cluster_tb.v
+ *
+ * This is a test bench for the multi-core cluster (see cluster.v), 32kB of
+ * memory is connected at addresses from 0x0000 to 0x7FFF, it's shared by
+ * all harts through the arbitrated data bus, and every hart reads its
+ * opcodes through its own private instruction port. Initial memory data is
+ * read from MEM_FILE (one program for all harts, they tell themselves apart
+ * by mhartid, see software/cluster). Data accesses are logged with the hart
+ * that did them, the value written to 0x10000 is the result of the hart
+ * (0x555 means pass). A hart that reaches 0x10000 reads "j ." from there (so
+ * it stays there), execution is stopped when all harts have reached it or
+ * after KILL_TIME cycles. With ICACHE enabled the private instruction ports
+ * are the refill ports of the caches (the memory answers right away).
+ ***************************************************************************/
+`define LOG_FILE "cluster_log.vcd"
+`define MEM_FILE "cpu.mem"
+`ifndef KILL_TIME
+`define KILL_TIME #100000
+`endif
+
+`include "../top/cluster.v"
+
+module cluster_tb;
+
+  localparam CORES = `CLUSTER_CORES;
+
+  // Dump file
+  initial begin
+    $dumpfile(`LOG_FILE);
+    $dumpvars(0, cluster_i);
+  end
+
+  // Cluster
+  reg                      i_clk;
+  reg                      i_rst;
+  wire [32*CORES-1:0]      o_addr_i;
+  wire [   CORES-1:0]      o_rd_i;
+  wire [32*CORES-1:0]      i_data_in_i;
+  wire [   CORES-1:0]      i_ready_i;
+  wire [31:0]              o_addr_d;
+  reg  [31:0]              i_data_rd_d;
+  wire [31:0]              o_data_wr_d;
+  wire [ 3:0]              o_wr_d;
+  wire                     o_rd_d;
+  wire                     i_ready_d;
+  wire [`CLUSTER_BITS-1:0] o_hart_d;
+
+  cluster cluster_i (
+    .i_clk       (i_clk),
+    .i_rst       (i_rst),
+`ifdef TRAPS
+    .i_irq       ({CORES{1'b0}}),
+`endif
+    .o_addr_i    (o_addr_i),
+    .o_rd_i      (o_rd_i),
+    .i_data_in_i (i_data_in_i),
+    .i_ready_i   (i_ready_i),
+    .o_addr_d    (o_addr_d),
+    .i_data_rd_d (i_data_rd_d),
+    .o_data_wr_d (o_data_wr_d),
+    .o_wr_d      (o_wr_d),
+    .o_rd_d      (o_rd_d),
+    .i_ready_d   (i_ready_d),
+    .o_hart_d    (o_hart_d)
+  );
+
+  // Clock
+  initial   i_clk = 0;
+  always #1 i_clk = !i_clk;
+
+  // Constant Signals
+  initial begin
+    i_rst = 1;
+    i_data_rd_d = 0;
+    #10 i_rst = 0;
+
+    `KILL_TIME $display("Killed by timeout"); $finish;
+  end
+
+  // Shared memory
+  reg [31:0] memory_array [0:8191];
+  initial begin
+    $readmemh(`MEM_FILE, memory_array);
+  end
+
+  // Private instruction ports (synchronous memory with POSEDGE_ONLY)
+  for (genvar h = 0; h < CORES; h = h + 1) begin : imem
+    wire [31:0] addr = o_addr_i[h*32 +: 32];
+    wire [31:0] data = (addr >= 32'h00010000) ? 32'h0000006f :
+      memory_array[addr[14:2]];
+    reg  [31:0] data_reg;
+
+`ifdef POSEDGE_ONLY
+    always @(posedge i_clk) begin
+`else
+    always @(negedge i_clk) begin
+`endif
+      data_reg <= data;
+    end
+
+    assign i_data_in_i[h*32 +: 32] = data_reg;
+
+`ifdef ICACHE
+`ifdef POSEDGE_ONLY
+    reg ready_reg;
+    always @(posedge i_clk) begin
+      ready_reg <= o_rd_i[h] && !ready_reg && !i_rst;
+    end
+    assign i_ready_i[h] = ready_reg;
+`else
+    assign i_ready_i[h] = o_rd_i[h];
+`endif
+`else
+    assign i_ready_i[h] = 1'b1;
+`endif
+  end
+
+  // Shared data memory process (synchronous memory with POSEDGE_ONLY)
+`ifdef POSEDGE_ONLY
+  always @(posedge i_clk) begin
+`else
+  always @(negedge i_clk) begin
+`endif
+
+    // Data read
+    if (o_rd_d && i_ready_d) begin
+      $display("R %d (%h) hart %0d", d_read_data, o_addr_d, o_hart_d);
+      i_data_rd_d <= d_read_data;
+    end else begin
+      i_data_rd_d <= 0;
+    end
+
+    // Data write (only the memory itself is written)
+    if (|o_wr_d && i_ready_d) begin
+      $display("W %d (%h) hart %0d", d_write_data, o_addr_d, o_hart_d);
+      if (o_addr_d < `BUS_IO_BASE) begin
+        memory_array[o_addr_d[14:2]] <= d_write_data;
+      end
+    end
+  end
+
+  // Additional memory signals
+  wire [31:0] d_read_data = memory_array[o_addr_d[14:2]];
+  wire [31:0] d_write_data = {
+    o_wr_d[3]? o_data_wr_d[31:24] : d_read_data[31:24],
+    o_wr_d[2]? o_data_wr_d[23:16] : d_read_data[23:16],
+    o_wr_d[1]? o_data_wr_d[15:8 ] : d_read_data[15:8 ],
+    o_wr_d[0]? o_data_wr_d[ 7:0 ] : d_read_data[ 7:0 ]
+  };
+
+  // I/O wait state
+`ifdef BUS_IO_WAIT
+  reg         io_wait;
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      io_wait <= 0;
+    end else begin
+      io_wait <= (o_rd_d || |o_wr_d) && (o_addr_d >= `BUS_IO_BASE) && !io_wait;
+    end
+  end
+  assign i_ready_d = !(o_rd_d || |o_wr_d) || (o_addr_d < `BUS_IO_BASE) || io_wait;
+`else
+  assign i_ready_d = 1'b1;
+`endif
+
+  // Results of the harts
+  reg  [31:0] result [0:CORES-1];
+  reg  [CORES-1:0] passed;
+  reg  [CORES-1:0] stopped;
+
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      passed  <= 0;
+      stopped <= 0;
+    end else begin
+      if (|o_wr_d && i_ready_d && o_addr_d == 32'h00010000) begin
+        result[o_hart_d] <= d_write_data;
+        passed[o_hart_d] <= (d_write_data == 32'h00000555);
+      end
+      for (integer h = 0; h < CORES; h = h + 1) begin
+        if (o_addr_i[h*32 +: 32] == 32'h00010000) begin
+          stopped[h] <= 1'b1;
+        end
+      end
+    end
+  end
+
+  // Stop when all harts have reached the kill address
+  always @(posedge i_clk) begin
+    if (&stopped) begin
+      for (integer h = 0; h < CORES; h = h + 1) begin
+        $display("Hart %0d result %h", h, result[h]);
+      end
+      if (&passed) begin
+        $display("All harts passed");
+      end else begin
+        $display("Some harts failed");
+      end
+      $display("Killed by reaching kill address %d", $time / 2 + 1); $finish;
+    end
+  end
+
+endmodule
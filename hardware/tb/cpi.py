@@ -0,0 +1,159 @@
+#!/bin/python3
+#
+# CPI analyser for the instruction trace (TRACE_PORT)
+#
+# Trace is written by cpu_tb.v (cpu_trace.txt) or the Verilator harness
+# (--itrace), every line is one instruction leaving the EX phase:
+#   <pc> <opcode> <cycles since the previous one> <stall causes>
+#
+# Every instruction takes one cycle, the extra cycles are split between the
+# causes that were seen before it. Branch flushes are charged to the branch
+# (previous instruction), everything else to the instruction that was
+# delayed. With an ELF file (build/<project>.out) cycles are also summed up
+# per function. With DUAL_ISSUE the instruction from the second issue slot
+# follows the first one with zero cycles, these are counted as paired.
+#
+# Usage: cpi.py <trace> [elf] [--top N]
+#
+import sys
+import struct
+
+causes = ['data hazard', 'fetch bubble', 'branch flush',
+          'ibus wait', 'alu busy', 'dbus wait']
+CAUSE_BRANCH = 2
+
+# Read function symbols from the ELF file (32-bit little endian only)
+def read_symbols(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'\x7fELF' or data[4] != 1 or data[5] != 1:
+        print(f'{path} is not a 32-bit little endian ELF file')
+        return []
+    shoff, = struct.unpack_from('<I', data, 32)
+    shentsize, shnum = struct.unpack_from('<HH', data, 46)
+    sections = [struct.unpack_from('<IIIIIIIIII', data, shoff + i * shentsize)
+                for i in range(shnum)]
+    symbols = []
+    for sec in sections:
+        # SHT_SYMTAB (link is the string table)
+        if sec[1] != 2:
+            continue
+        strtab = sections[sec[6]]
+        for off in range(sec[4], sec[4] + sec[5], 16):
+            name, value, size, info = struct.unpack_from('<IIIB', data, off)
+            # STT_FUNC
+            if info & 0xF != 2:
+                continue
+            start = strtab[4] + name
+            end = data.index(b'\0', start)
+            symbols.append((value, max(size, 2), data[start:end].decode()))
+    symbols.sort()
+    return symbols
+
+# Find a function containing given address
+def find_symbol(symbols, pc):
+    lo, hi = 0, len(symbols)
+    while lo < hi:
+        mid = (lo + hi) // 2
+        if symbols[mid][0] <= pc:
+            lo = mid + 1
+        else:
+            hi = mid
+    if lo and pc < symbols[lo - 1][0] + symbols[lo - 1][1]:
+        return symbols[lo - 1][2]
+    return '?'
+
+# Read the trace file
+def read_trace(path):
+    trace = []
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) != 4 or 'x' in line:
+                continue
+            trace.append(tuple(int(x, 16) for x in fields))
+    return trace
+
+def site_name(symbols, pc):
+    if symbols:
+        return f'{pc:08x} <{find_symbol(symbols, pc)}>'
+    return f'{pc:08x}'
+
+def main():
+    args = sys.argv[1:]
+    top = 10
+    if '--top' in args:
+        i = args.index('--top')
+        top = int(args[i + 1])
+        del args[i:i + 2]
+    if not args:
+        print('Usage: cpi.py <trace> [elf] [--top N]')
+        return
+    trace = read_trace(args[0])
+    symbols = read_symbols(args[1]) if len(args) > 1 else []
+    if not trace:
+        print('Trace is empty')
+        return
+
+    # First line includes the reset, it's skipped
+    trace = trace[1:]
+    instructions = len(trace)
+    cycles = sum(t[2] for t in trace)
+
+    cause_cycles = [0.0] * len(causes)
+    other_cycles = 0
+    paired = 0
+    sites = {}
+    functions = {}
+    prev_pc = trace[0][0]
+    for (pc, opcode, count, cause) in trace:
+        extra = count - 1
+        if count == 0:
+            paired += 1
+        func = find_symbol(symbols, pc) if symbols else None
+        if func is not None:
+            fn = functions.setdefault(func, [0, 0])
+            fn[0] += 1
+            fn[1] += count
+        if extra > 0:
+            active = [i for i in range(len(causes)) if cause & (1 << i)]
+            if not active:
+                other_cycles += extra
+            for i in active:
+                share = extra / len(active)
+                cause_cycles[i] += share
+                site_pc = prev_pc if i == CAUSE_BRANCH else pc
+                site = sites.setdefault(site_pc, [0.0, 0, [0.0] * len(causes)])
+                site[0] += share
+                site[1] += 1
+                site[2][i] += share
+        prev_pc = pc
+
+    # CPI breakdown
+    print(f'\n\033[97;1mInstructions:\033[0m {instructions}')
+    print(f'\033[97;1mCycles:\033[0m {cycles}')
+    print(f'\033[97;1mCPI:\033[0m {cycles / instructions:.3f}\n')
+    print(f'{"base":<16}{instructions:>12}{1.0:>8.3f}')
+    for i in range(len(causes)):
+        print(f'{causes[i]:<16}{cause_cycles[i]:>12.0f}{cause_cycles[i] / instructions:>8.3f}')
+    if other_cycles:
+        print(f'{"other":<16}{other_cycles:>12}{other_cycles / instructions:>8.3f}')
+    if paired:
+        print(f'{"paired":<16}{-paired:>12}{-paired / instructions:>8.3f}')
+
+    # Per function hot spots
+    if functions:
+        print(f'\n\033[97;1mFunctions:\033[0m')
+        hot = sorted(functions.items(), key=lambda f: -f[1][1])
+        for (name, (count, cyc)) in hot[:top]:
+            print(f'{name:<24}{cyc:>12} ({100.0 * cyc / cycles:5.1f}%)  CPI {cyc / count:.3f}')
+
+    # Stall sites
+    print(f'\n\033[97;1mTop {top} stall sites:\033[0m')
+    worst = sorted(sites.items(), key=lambda s: -s[1][0])
+    for (pc, (extra, count, per_cause)) in worst[:top]:
+        main_cause = causes[per_cause.index(max(per_cause))]
+        print(f'{site_name(symbols, pc):<36}{extra:>10.0f} cycles in {count:>8} ({main_cause})')
+
+if __name__ == '__main__':
+    main()
@@ -7,12 +7,40 @@
  * connected at addresses from 0x0000 to 0x7FFF, all CPU activitiy is dumped
  * to the LOG_FILE, initial memory data is read from MEM_FILE, execution is
  * stopped if the program counter reaches 0x10000 or after KILL_TIME cycles.
+ * With ICACHE enabled instructions are fetched through the instruction
+ * cache from the slow external memory model (see ext_mem.v), with DCACHE
+ * enabled data accesses go through the data cache and its own external
+ * memory model. Memory latency is set with EXT_MEM_LATENCY and
+ * EXT_MEM_BURST defines (-DEXT_MEM_LATENCY=20), cache statistics are
+ * printed when the execution is stopped. Without the data cache and with
+ * BUS_IO_WAIT enabled accesses above the memory take one wait state (like
+ * the I/O in top.v), accesses are logged when they're done. With
+ * TRACE_PORT enabled every instruction leaving the EX phase is written to
+ * the TRACE_FILE (pc, opcode, cycles and stall causes), see cpi.py. With
+ * TRAPS enabled the bit 0 of the word written to 0x10004 drives the external
+ * interrupt input (used by the trap selftest).
  ***************************************************************************/
 `define LOG_FILE "cpu_log.vcd"
 `define MEM_FILE "cpu.mem"
+`define TRACE_FILE "cpu_trace.txt"
+`ifndef KILL_TIME
 `define KILL_TIME #10000
+`endif
 
 `include "../cpu/cpu.v"
+`ifdef ICACHE
+`include "../cpu/icache.v"
+`endif
+`ifdef DCACHE
+`include "../cpu/dcache.v"
+`endif
+`ifdef ICACHE
+`include "ext_mem.v"
+`else
+`ifdef DCACHE
+`include "ext_mem.v"
+`endif
+`endif
 
 module cpu_tb;
 
@@ -26,29 +54,102 @@ module cpu_tb;
   reg         i_clk;
   reg         i_rst;
   reg         i_clk_ce;
+`ifdef ICACHE
+  wire [31:0] i_data_in_i;
+  wire        i_ready_i;
+`else
   reg  [31:0] i_data_in_i;
+  wire        i_ready_i = 1'b1;
+`endif
+`ifdef DCACHE
+`ifdef POSEDGE_ONLY
   reg  [31:0] i_data_rd_d;
+`else
+  wire [31:0] i_data_rd_d;
+`endif
+  wire        i_ready_d;
+`else
+  reg  [31:0] i_data_rd_d;
+  wire        i_ready_d;
+`endif
   wire [ 3:0] o_wr_d;
   wire        o_rd_d;
   wire [31:0] o_addr_i;
   wire [31:0] o_addr_d;
   wire [31:0] o_data_wr_d;
+`ifdef TRACE_PORT
+  wire        o_trace_valid;
+  wire [31:0] o_trace_pc;
+  wire [31:0] o_trace_ir;
+  wire [15:0] o_trace_cycles;
+  wire [ 5:0] o_trace_cause;
+`ifdef DUAL_ISSUE
+  wire        o_trace1_valid;
+  wire [31:0] o_trace1_pc;
+  wire [31:0] o_trace1_ir;
+`endif
+`endif
+`ifdef TRAPS
+  reg         i_irq;
+`endif
 
   // verilator lint_off pinmissing
   cpu cpu_i (
     .i_clk       (i_clk),
     .i_rst       (i_rst),
     .i_clk_ce    (i_clk_ce),
+`ifdef MULTI_CORE
+    .i_hart_id   (8'd0),
+`endif
+`ifdef TRAPS
+    .i_irq       (i_irq),
+`endif
+`ifdef TRACE_PORT
+    .o_trace_valid  (o_trace_valid),
+    .o_trace_pc     (o_trace_pc),
+    .o_trace_ir     (o_trace_ir),
+    .o_trace_cycles (o_trace_cycles),
+    .o_trace_cause  (o_trace_cause),
+`ifdef DUAL_ISSUE
+    .o_trace1_valid (o_trace1_valid),
+    .o_trace1_pc    (o_trace1_pc),
+    .o_trace1_ir    (o_trace1_ir),
+`endif
+`endif
     .o_addr_i    (o_addr_i),
     .i_data_in_i (i_data_in_i),
+    .i_ready_i   (i_ready_i),
     .o_addr_d    (o_addr_d),
     .i_data_rd_d (i_data_rd_d),
     .o_wr_d      (o_wr_d),
     .o_rd_d      (o_rd_d),
-    .o_data_wr_d (o_data_wr_d)
+    .o_data_wr_d (o_data_wr_d),
+    .i_ready_d   (i_ready_d)
   );
   // verilator lint_on pinmissing
 
+  // Instruction trace
+`ifdef TRACE_PORT
+  integer trace_file;
+  initial begin
+    trace_file = $fopen(`TRACE_FILE, "w");
+  end
+
+  always @(posedge i_clk) begin
+    if (o_trace_valid) begin
+      $fwrite(trace_file, "%h %h %h %h\n",
+        o_trace_pc, o_trace_ir, o_trace_cycles, o_trace_cause);
+    end
+`ifdef DUAL_ISSUE
+    // Second issue slot, no cycles of its own
+    if (o_trace1_valid) begin
+      $fwrite(trace_file, "%h %h %h %h\n",
+        o_trace1_pc, o_trace1_ir, 16'd0, 6'd0);
+    end
+`endif
+  end
+`endif
+
   // Clock
   initial   i_clk = 0;
   always #1 i_clk = !i_clk;
@@ -58,7 +159,9 @@ module cpu_tb;
   initial begin
     i_rst = 1;
     i_clk_ce = 1;
+`ifndef DCACHE
     i_data_rd_d = 0;
+`endif
     #10 i_rst = 0;
 
     `KILL_TIME $display("Killed by timeout"); $finish;
@@ -70,14 +173,21 @@ module cpu_tb;
     $readmemh("cpu.mem", memory_array);
   end
 
-  // Memory process
+  // Memory process (synchronous memory with POSEDGE_ONLY)
+`ifdef POSEDGE_ONLY
+  always @(posedge i_clk) begin
+`else
   always @(negedge i_clk) begin
+`endif
 
     // Instruction read
+`ifndef ICACHE
     i_data_in_i <= i_read_data;
+`endif
 
+`ifndef DCACHE
     // Data read
-    if (o_rd_d) begin
+    if (o_rd_d && i_ready_d) begin
       $display("R %d (%h)", d_write_data, o_addr_d);
       i_data_rd_d <= d_read_data;
     end else begin
@@ -85,10 +195,11 @@ module cpu_tb;
     end
 
     // Data write
-    if (|o_wr_d) begin
+    if (|o_wr_d && i_ready_d) begin
       $display("W %d (%h)", d_write_data, o_addr_d);
       memory_array[o_addr_d[14:2]] <= d_write_data;
     end
+`endif
   end
 
   // Additional memory signals
@@ -101,9 +212,155 @@ module cpu_tb;
     o_wr_d[0]? o_data_wr_d[ 7:0 ] : d_read_data[ 7:0 ]
   };
 
+  // I/O wait state
+`ifndef DCACHE
+`ifdef BUS_IO_WAIT
+  reg         io_wait;
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      io_wait <= 0;
+    end else begin
+      io_wait <= (o_rd_d || |o_wr_d) && (o_addr_d >= `BUS_IO_BASE) && !io_wait;
+    end
+  end
+  assign i_ready_d = !(o_rd_d || |o_wr_d) || (o_addr_d < `BUS_IO_BASE) || io_wait;
+`else
+  assign i_ready_d = 1'b1;
+`endif
+`endif
+
+  // Instruction cache and external memory
+`ifdef ICACHE
+  wire [31:0] ic_mem_addr;
+  wire        ic_mem_rd;
+  wire [31:0] ic_mem_data;
+  wire        ic_mem_ready;
+  wire [31:0] ic_hits;
+  wire [31:0] ic_misses;
+  wire [31:0] ext_addr;
+
+  icache icache_i (
+    .i_clk       (i_clk),
+    .i_rst       (i_rst),
+    .i_addr      (o_addr_i),
+    .o_data      (i_data_in_i),
+    .o_ready     (i_ready_i),
+    .o_mem_addr  (ic_mem_addr),
+    .o_mem_rd    (ic_mem_rd),
+    .i_mem_data  (ic_mem_data),
+    .i_mem_ready (ic_mem_ready),
+    .o_hits      (ic_hits),
+    .o_misses    (ic_misses)
+  );
+
+  ext_mem ext_mem_i (
+    .i_clk      (i_clk),
+    .i_rst      (i_rst),
+    .i_addr     (ic_mem_addr),
+    .i_rd       (ic_mem_rd),
+    .o_data     (ic_mem_data),
+    .o_ready    (ic_mem_ready),
+    .i_wr       (4'b0000),
+    .o_mem_addr (ext_addr),
+    .i_mem_data (memory_array[ext_addr[14:2]]),
+    .o_mem_wr   ()
+  );
+`endif
+
+  // Data cache and external memory
+`ifdef DCACHE
+  wire [31:0] dc_data_rd;
+  wire [31:0] dc_mem_addr;
+  wire [31:0] dc_mem_data_wr;
+  wire [ 3:0] dc_mem_wr;
+  wire        dc_mem_rd;
+  wire [31:0] dc_mem_data_rd;
+  wire        dc_mem_ready;
+  wire [31:0] dc_hits;
+  wire [31:0] dc_misses;
+  wire [31:0] ext_d_addr;
+  wire [ 3:0] ext_d_wr;
+
+  dcache dcache_i (
+    .i_clk         (i_clk),
+    .i_rst         (i_rst),
+    .i_addr        (o_addr_d),
+    .i_rd          (o_rd_d),
+    .i_wr          (o_wr_d),
+    .i_data_wr     (o_data_wr_d),
+    .o_data_rd     (dc_data_rd),
+    .o_ready       (i_ready_d),
+    .o_mem_addr    (dc_mem_addr),
+    .o_mem_data_wr (dc_mem_data_wr),
+    .o_mem_wr      (dc_mem_wr),
+    .o_mem_rd      (dc_mem_rd),
+    .i_mem_data_rd (dc_mem_data_rd),
+    .i_mem_ready   (dc_mem_ready),
+    .o_hits        (dc_hits),
+    .o_misses      (dc_misses)
+  );
+
+  ext_mem ext_mem_d (
+    .i_clk      (i_clk),
+    .i_rst      (i_rst),
+    .i_addr     (dc_mem_addr),
+    .i_rd       (dc_mem_rd),
+    .i_wr       (dc_mem_wr),
+    .o_data     (dc_mem_data_rd),
+    .o_ready    (dc_mem_ready),
+    .o_mem_addr (ext_d_addr),
+    .i_mem_data (memory_array[ext_d_addr[14:2]]),
+    .o_mem_wr   (ext_d_wr)
+  );
+
+  // Load data arrives in the next cycle with POSEDGE_ONLY
+`ifdef POSEDGE_ONLY
+  always @(posedge i_clk) begin
+    i_data_rd_d <= dc_data_rd;
+  end
+`else
+  assign i_data_rd_d = dc_data_rd;
+`endif
+
+  // Backing memory write
+  always @(posedge i_clk) begin
+    if (ext_d_wr[0]) memory_array[ext_d_addr[14:2]][ 7: 0] <= dc_mem_data_wr[ 7: 0];
+    if (ext_d_wr[1]) memory_array[ext_d_addr[14:2]][15: 8] <= dc_mem_data_wr[15: 8];
+    if (ext_d_wr[2]) memory_array[ext_d_addr[14:2]][23:16] <= dc_mem_data_wr[23:16];
+    if (ext_d_wr[3]) memory_array[ext_d_addr[14:2]][31:24] <= dc_mem_data_wr[31:24];
+  end
+
+  // CPU accesses are logged when they're accepted by the cache
+  always @(posedge i_clk) begin
+    if (o_rd_d && i_ready_d) begin
+      $display("R %d (%h)", dc_data_rd, o_addr_d);
+    end
+    if (|o_wr_d && i_ready_d) begin
+      $display("W %d (%h)", d_write_data, o_addr_d);
+    end
+  end
+`endif
+
+  // External interrupt input
+`ifdef TRAPS
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      i_irq <= 0;
+    end else if (|o_wr_d && i_ready_d && (o_addr_d == 32'h00010004)) begin
+      i_irq <= o_data_wr_d[0];
+    end
+  end
+`endif
+
   // Stop on kill address
   always @(posedge i_clk) begin
     if (o_addr_i == 32'h00010000) begin
+`ifdef ICACHE
+      $display("I-cache hits %d misses %d", ic_hits, ic_misses);
+`endif
+`ifdef DCACHE
+      $display("D-cache hits %d misses %d", dc_hits, dc_misses);
+`endif
       $display("Killed by reaching kill address %d", $time / 2 + 1); $finish;
     end
   end
@@ -0,0 +1,80 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: ext_mem.v
+ *
+ * This is a simulation model of a slow external memory (like DRAM) with
+ * variable latency. Request has to be held until o_ready is set, the first
+ * word takes EXT_MEM_LATENCY cycles, words requested right after the
+ * previous one (a burst, like a cache line refill) take EXT_MEM_BURST
+ * cycles, counting the cycle in which o_ready is set (0 works like 1, the
+ * access is done in the cycle it's requested). The memory array itself is
+ * outside of the model, it's read combinationally through o_mem_addr and
+ * i_mem_data and written on the rising edge of the clock when o_mem_wr is
+ * set (writes take the same time as the reads).
+ *
+ * i_clk      - Clock input
+ * i_rst      - Reset input
+ *
+ * i_addr     - Address from the bus master
+ * i_rd       - Read request from the bus master
+ * i_wr       - Write request from the bus master (byte enables)
+ * o_data     - Read data
+ * o_ready    - Read data is valid or write is done (ends the request)
+ *
+ * o_mem_addr - Address to the memory array
+ * i_mem_data - Data from the memory array
+ * o_mem_wr   - Write enable to the memory array (byte enables)
+ ***************************************************************************/
+`ifndef EXT_MEM_LATENCY
+`define EXT_MEM_LATENCY 8
+`endif
+`ifndef EXT_MEM_BURST
+`define EXT_MEM_BURST 1
+`endif
+
+module ext_mem (
+  input         i_clk,
+  input         i_rst,
+
+  input  [31:0] i_addr,
+  input         i_rd,
+  input  [ 3:0] i_wr,
+  output [31:0] o_data,
+  output        o_ready,
+
+  output [31:0] o_mem_addr,
+  input  [31:0] i_mem_data,
+  output [ 3:0] o_mem_wr
+);
+
+  // Latency counter and burst flag
+  reg  [15:0] cnt;
+  reg         burst;
+  wire [15:0] latency;
+  wire        req;
+
+  always @(posedge i_clk) begin
+    if (i_rst || !req) begin
+      cnt   <= 0;
+      burst <= 0;
+    end else if (o_ready) begin
+      cnt   <= 0;
+      burst <= 1'b1;
+    end else begin
+      cnt   <= cnt + 16'd1;
+    end
+  end
+
+  assign latency = (burst) ? `EXT_MEM_BURST : `EXT_MEM_LATENCY;
+  assign req = i_rd || |i_wr;
+
+  /**
+   * Output assignment
+   */
+  assign o_ready = req && (cnt + 16'd1 >= latency);
+  assign o_data = i_mem_data;
+  assign o_mem_addr = i_addr;
+  assign o_mem_wr = i_wr & {4{o_ready}};
+
+endmodule
@@ -1,5 +1,6 @@
 #!/bin/python3
 import os
+import sys
 import subprocess
 
 tests_simple = ['simple']
@@ -11,6 +12,15 @@ tests_store  = ['sb', 'sh', 'sw']
 tests_misc   = ['jal', 'jalr', 'auipc', 'lui']
 tests_cext   = ['rvc']
 tests_mext   = ['mul', 'mulh', 'mulhu', 'mulhsu', 'div', 'divu', 'rem', 'remu']
+tests_bext   = ['bitmanip']
+tests_aext   = ['lrsc', 'amoswap_w', 'amoadd_w', 'amoand_w', 'amoor_w', 'amoxor_w',
+                'amomin_w', 'amomax_w', 'amominu_w', 'amomaxu_w']
+tests_traps  = ['trap']
+tests_fext   = ['fldst', 'fmove', 'fadd', 'fmadd', 'fdiv', 'fmin', 'fcmp', 'fcvt',
+                'fcvt_w', 'fclass']
+
+# Verilator harness (used instead of the iverilog testbench with --verilator)
+verilator_bin = None
 
 # Simple subprocess wrapper
 def run(cmd):
@@ -24,10 +34,18 @@ def find_line(arr, pattern):
             return line
     return 'Killed by timeout'
 
+# Build the testbench with additional defines (used for comparisons)
+def build(obj, defines):
+    flags = ' '.join(f'-D{define}' for define in defines)
+    run(f'iverilog -grelative-include -DSIMULATION {flags} -o {obj} cpu_tb.v')
+
 # Run given test
-def run_test(test_name):
-    run(f'./test.py ../../software/selftests/build/{test_name}.hex')
-    result = run('vvp cpu_tb.obj')
+def run_test(test_name, obj='cpu_tb.obj'):
+    if verilator_bin:
+        result = run(f'{verilator_bin} --cycles 5000 ../../software/selftests/build/{test_name}.hex || true')
+    else:
+        run(f'./test.py ../../software/selftests/build/{test_name}.hex')
+        result = run(f'vvp {obj}')
     result_line = find_line(result, '(00010000)')
     cycles_taken = result[-1].split(' ')[-1]
     if '1365' in result_line:
@@ -53,7 +71,44 @@ def run_test_arr(tests_name, tests_arr):
     return (total_cycles, error)
 
 
+# Run all tests on both testbenches and print cycle counts side by side
+def compare(defines):
+    print(f'\n\033[97;1mComparing baseline with:\033[0m {" ".join(defines)}')
+    build('cpu_tb_base.obj', [])
+    build('cpu_tb_cmp.obj', defines)
+    tests = tests_simple + tests_imm + tests_normal + tests_branch + \
+        tests_load + tests_store + tests_misc + tests_mext + tests_cext
+    total_base = 0
+    total_cmp = 0
+    for test in tests:
+        base = int(run_test(test, 'cpu_tb_base.obj'))
+        cmp = int(run_test(test, 'cpu_tb_cmp.obj'))
+        if base == -1 or cmp == -1:
+            continue
+        total_base += base
+        total_cmp += cmp
+        print(f'\033[97;1m{test} \033[20G\033[0m{base} -> {cmp} ({cmp - base:+d})')
+    ratio = 100.0 * (total_cmp - total_base) / max(total_base, 1)
+    print(f'\n\033[97;1mTotal cycles taken:\033[0m {total_base} -> {total_cmp} ({ratio:+.1f}%)')
+    os.remove('cpu_tb_base.obj')
+    os.remove('cpu_tb_cmp.obj')
+
 def main():
+    global verilator_bin
+    # B extension tests only pass on the core built with B_EXTENSION
+    bext = '--bext' in sys.argv
+    # A extension tests only pass on the core built with A_EXTENSION
+    aext = '--aext' in sys.argv
+    # Trap tests only pass on the core built with TRAPS
+    traps = '--traps' in sys.argv
+    # F extension tests only pass on the core built with F_EXTENSION
+    fext = '--fext' in sys.argv
+    if len(sys.argv) > 1 and sys.argv[1] == '--verilator':
+        verilator_bin = 'verilator/obj_dir/Vcpu'
+    if len(sys.argv) > 2 and sys.argv[1] == '--compare':
+        compare(sys.argv[2:])
+        return
+
     total_cycles = 0
 
     # Run base isa tests
@@ -79,6 +134,26 @@ def main():
     # Run C extension test
     (cycles, error) = run_test_arr('C extension', tests_cext)
     if not error: print(f'Taken \033[97;1m{cycles}\033[0m cycles'); total_cycles += cycles
+
+    # Run B extension test
+    if bext:
+        (cycles, error) = run_test_arr('B extension', tests_bext)
+        if not error: print(f'Taken \033[97;1m{cycles}\033[0m cycles'); total_cycles += cycles
+
+    # Run A extension tests
+    if aext:
+        (cycles, error) = run_test_arr('A extension', tests_aext)
+        if not error: print(f'Taken \033[97;1m{cycles}\033[0m cycles'); total_cycles += cycles
+
+    # Run trap tests
+    if traps:
+        (cycles, error) = run_test_arr('trap', tests_traps)
+        if not error: print(f'Taken \033[97;1m{cycles}\033[0m cycles'); total_cycles += cycles
+
+    # Run F extension tests
+    if fext:
+        (cycles, error) = run_test_arr('F extension', tests_fext)
+        if not error: print(f'Taken \033[97;1m{cycles}\033[0m cycles'); total_cycles += cycles
     # Print total cycles taken
     print(f'\n\033[97;1mTotal cycles taken:\033[0m {total_cycles}')
 
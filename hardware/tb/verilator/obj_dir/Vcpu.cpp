@@ -0,0 +1,4263 @@
+#include "Vcpu.h"
+
+Vcpu::Vcpu() {
+  i_clk = 0ULL;
+  i_clk_ce = 0ULL;
+  i_rst = 0ULL;
+  o_addr_i = 0ULL;
+  i_data_in_i = 0ULL;
+  i_ready_i = 0ULL;
+  o_addr_d = 0ULL;
+  i_data_rd_d = 0ULL;
+  o_data_wr_d = 0ULL;
+  o_wr_d = 0ULL;
+  o_rd_d = 0ULL;
+  i_ready_d = 0ULL;
+  n13_core_ce = 0ULL;
+  n14_clk_ce = 0ULL;
+  n15_clk_n = 0ULL;
+  n16_fetch_ce = 0ULL;
+  n17_if_pc = 0ULL;
+  n18_if_addr = 0ULL;
+  n19_id_pc = 0ULL;
+  n20_id_ir = 0ULL;
+  n21_id_ret = 0ULL;
+  n22_hz_br = 0ULL;
+  n23_id_pred = 0ULL;
+  n24_id_pred_addr = 0ULL;
+  n25_id_pred_idx = 0ULL;
+  n26_immediate = 0ULL;
+  n27_funct3 = 0ULL;
+  n28_funct7 = 0ULL;
+  n29_rs1 = 0ULL;
+  n30_rs2 = 0ULL;
+  n31_rd = 0ULL;
+  n32_hz_rs1 = 0ULL;
+  n33_hz_rs2 = 0ULL;
+  n34_branch = 0ULL;
+  n35_jump = 0ULL;
+  n36_alu_pc = 0ULL;
+  n37_alu_imm = 0ULL;
+  n38_alu_en = 0ULL;
+  n39_d_wr = 0ULL;
+  n40_d_rd = 0ULL;
+  n41_wb_mux = 0ULL;
+  n42_wb_en = 0ULL;
+  n43_system = 0ULL;
+  n44_hz_data = 0ULL;
+  n45_id_bubble = 0ULL;
+  n46_rs1_raw_d = 0ULL;
+  n47_rs2_raw_d = 0ULL;
+  n48_rs1_d = 0ULL;
+  n49_rs2_d = 0ULL;
+  n50_ex_rs1_d = 0ULL;
+  n51_ex_rs2_d = 0ULL;
+  n52_ex_imm = 0ULL;
+  n53_ex_pc = 0ULL;
+  n54_ex_ret = 0ULL;
+  n55_ex_funct3 = 0ULL;
+  n56_ex_funct7 = 0ULL;
+  n57_ex_jump = 0ULL;
+  n58_ex_branch = 0ULL;
+  n59_ex_alu_pc = 0ULL;
+  n60_ex_alu_imm = 0ULL;
+  n61_ex_alu_en = 0ULL;
+  n62_ex_ma_wr = 0ULL;
+  n63_ex_ma_rd = 0ULL;
+  n64_ex_wb_mux = 0ULL;
+  n65_ex_wb_reg = 0ULL;
+  n66_ex_wb_en = 0ULL;
+  n67_ex_rs1 = 0ULL;
+  n68_ex_system = 0ULL;
+  n69_ex_valid = 0ULL;
+  n70_ex_pred = 0ULL;
+  n71_ex_pred_addr = 0ULL;
+  n72_ex_pred_idx = 0ULL;
+  n73_br_en = 0ULL;
+  n74_br_take = 0ULL;
+  n75_br_miss = 0ULL;
+  n76_br_addr = 0ULL;
+  n77_fetch_br_en = 0ULL;
+  n78_fetch_br_addr = 0ULL;
+  n79_trap_go = 0ULL;
+  n80_trap_br_en = 0ULL;
+  n81_trap_br_addr = 0ULL;
+  n82_id_jal_go = 0ULL;
+  n83_id_jal_addr = 0ULL;
+  n84_id_jal = 0ULL;
+  n85_ex_jal_done = 0ULL;
+  n86_id_ras_redir = 0ULL;
+  n87_ras_top = 0ULL;
+  n88_ras_valid = 0ULL;
+  n89_id_link_rd = 0ULL;
+  n90_id_link_rs1 = 0ULL;
+  n91_id_ras_push = 0ULL;
+  n92_id_ras_pop = 0ULL;
+  n93_id_ras_go = 0ULL;
+  n94_ex_ras_pred = 0ULL;
+  n95_ex_ras_addr = 0ULL;
+  n96_br_pred_miss = 0ULL;
+  n97_id1_ir = 0ULL;
+  n98_id1_valid = 0ULL;
+  n99_id1_issue = 0ULL;
+  n100_id1_simple = 0ULL;
+  n101_id1_md = 0ULL;
+  n102_id1_shift = 0ULL;
+  n103_id_pair = 0ULL;
+  n104_id1_imm = 0ULL;
+  n105_id1_funct3 = 0ULL;
+  n106_id1_funct7 = 0ULL;
+  n107_id1_rs1 = 0ULL;
+  n108_id1_rs2 = 0ULL;
+  n109_id1_rd = 0ULL;
+  n110_id1_hz_rs1 = 0ULL;
+  n111_id1_hz_rs2 = 0ULL;
+  n112_id1_branch = 0ULL;
+  n113_id1_jump = 0ULL;
+  n114_id1_alu_pc = 0ULL;
+  n115_id1_alu_imm = 0ULL;
+  n116_id1_alu_en = 0ULL;
+  n117_id1_ma_wr = 0ULL;
+  n118_id1_ma_rd = 0ULL;
+  n119_id1_wb_mux = 0ULL;
+  n120_id1_wb_en = 0ULL;
+  n121_id1_system = 0ULL;
+  n122_id1_hz_data = 0ULL;
+  n123_id1_hz_pair = 0ULL;
+  n124_id1_rs1_raw_d = 0ULL;
+  n125_id1_rs2_raw_d = 0ULL;
+  n126_id1_rs1_d = 0ULL;
+  n127_id1_rs2_d = 0ULL;
+  n128_ex1_rs1_d = 0ULL;
+  n129_ex1_rs2_d = 0ULL;
+  n130_ex1_imm = 0ULL;
+  n131_ex1_pc = 0ULL;
+  n132_ex1_funct3 = 0ULL;
+  n133_ex1_funct7 = 0ULL;
+  n134_ex1_alu_pc = 0ULL;
+  n135_ex1_alu_imm = 0ULL;
+  n136_ex1_alu_en = 0ULL;
+  n137_ex1_wb_reg = 0ULL;
+  n138_ex1_wb_en = 0ULL;
+  n139_ex1_res = 0ULL;
+  n140_ma1_res = 0ULL;
+  n141_ma1_wb_reg = 0ULL;
+  n142_ma1_wb_en = 0ULL;
+  n143_wb1_wb_d = 0ULL;
+  n144_wb1_wb_reg = 0ULL;
+  n145_wb1_wb_en = 0ULL;
+  n146_alu_out = 0ULL;
+  n147_alu_busy = 0ULL;
+  n148_alu_a_mux = 0ULL;
+  n149_alu_b_mux = 0ULL;
+  n150_ex_res_dat = 0ULL;
+  n151_ma_rs2_d = 0ULL;
+  n152_ma_res = 0ULL;
+  n153_ma_ret = 0ULL;
+  n154_ma_funct3 = 0ULL;
+  n155_ma_wr = 0ULL;
+  n156_ma_rd = 0ULL;
+  n157_ma_wb_reg = 0ULL;
+  n158_ma_wb_mux = 0ULL;
+  n159_ma_wb_en = 0ULL;
+  n160_ma_rd_dat = 0ULL;
+  n161_ma_ld_dat = 0ULL;
+  n162_ma_wr_dat = 0ULL;
+  n163_ma_we = 0ULL;
+  n164_ma_wr_en = 0ULL;
+  n165_ma_rd_en = 0ULL;
+  n166_ma_rd_bus = 0ULL;
+  n167_ma_rd_sent = 0ULL;
+  n168_ma_rd_keep = 0ULL;
+  n169_ma_rd_kept = 0ULL;
+  n170_wb_wb_d = 0ULL;
+  n171_wb_wb_reg = 0ULL;
+  n172_wb_wb_en = 0ULL;
+  n173_wb_dat_mux = 0ULL;
+  n174_wb_res = 0ULL;
+  n175_wb_dat = 0ULL;
+  n176_csr_rd_data = 0ULL;
+  n177_csr_wr_data = 0ULL;
+  n178_csr_wr_en = 0ULL;
+  n179_csr_rd = 0ULL;
+  n180_csr_wr = 0ULL;
+  n181_csr_set = 0ULL;
+  n182_csr_clr = 0ULL;
+  n183_csr_events = 0ULL;
+  n193_i_bp_en = 0ULL;
+  n216_bp_pc = 0ULL;
+  n217_bp_pred = 0ULL;
+  n218_bp_pred_addr = 0ULL;
+  n219_bp_pred_idx = 0ULL;
+  memset(n220_ras_data, 0, sizeof(n220_ras_data));
+  n221_ras_ptr = 0ULL;
+  n222_ras_cnt = 0ULL;
+  n223_ras_ptr_inc = 0ULL;
+  n224_ras_ptr_dec = 0ULL;
+  n225_fetch_pc = 0ULL;
+  n226_fetch_next = 0ULL;
+  n227_fetch_en = 0ULL;
+  n228_push_cnt = 0ULL;
+  n229_push_0 = 0ULL;
+  n230_push_1 = 0ULL;
+  n231_if_addr = 0ULL;
+  memset(n232_q_data, 0, sizeof(n232_q_data));
+  n233_q_cnt = 0ULL;
+  n234_q_pc = 0ULL;
+  memset(n235_q_rem, 0, sizeof(n235_q_rem));
+  n236_rem_cnt = 0ULL;
+  n237_id_c = 0ULL;
+  n238_id_valid = 0ULL;
+  n239_take = 0ULL;
+  n240_take_cnt = 0ULL;
+  n241_pop_cnt = 0ULL;
+  n242_pred_t0 = 0ULL;
+  n243_redirect = 0ULL;
+  n244_id1_lo = 0ULL;
+  n245_id1_hi = 0ULL;
+  n246_id1_c = 0ULL;
+  n247_id1_valid = 0ULL;
+  memset(n260_btb_addr, 0, sizeof(n260_btb_addr));
+  memset(n261_btb_tag, 0, sizeof(n261_btb_tag));
+  memset(n262_btb_cnt, 0, sizeof(n262_btb_cnt));
+  memset(n263_btb_jump, 0, sizeof(n263_btb_jump));
+  memset(n264_btb_valid, 0, sizeof(n264_btb_valid));
+  n265_if_idx = 0ULL;
+  n266_if_tag = 0ULL;
+  n267_if_hit = 0ULL;
+  n268_if_dir = 0ULL;
+  n269_upd_idx = 0ULL;
+  n270_upd_tag = 0ULL;
+  n271_upd_hit = 0ULL;
+  n272_upd_cnt = 0ULL;
+  n273_upd_cnt_inc = 0ULL;
+  n274_upd_cnt_dec = 0ULL;
+  n275_i = 0ULL;
+  n276_i = 0ULL;
+  n296_opcode = 0ULL;
+  n297_rs1 = 0ULL;
+  n298_rs2 = 0ULL;
+  n299_rd = 0ULL;
+  n300_funct3 = 0ULL;
+  n301_funct7 = 0ULL;
+  n302_copcode = 0ULL;
+  n303_rs1cs = 0ULL;
+  n304_rs2cs = 0ULL;
+  n305_rs1cl = 0ULL;
+  n306_rs2cl = 0ULL;
+  n307_funct2h = 0ULL;
+  n308_funct2l = 0ULL;
+  n309_quad3 = 0ULL;
+  n310_op_load = 0ULL;
+  n311_op_op_imm = 0ULL;
+  n312_op_auipc = 0ULL;
+  n313_op_store = 0ULL;
+  n314_op_op = 0ULL;
+  n315_op_lui = 0ULL;
+  n316_op_branch = 0ULL;
+  n317_op_jalr = 0ULL;
+  n318_op_jal = 0ULL;
+  n319_op_system = 0ULL;
+  n320_op_misc_mem = 0ULL;
+  n321_quad0 = 0ULL;
+  n322_quad1 = 0ULL;
+  n323_quad2 = 0ULL;
+  n324_op_caddi4spn = 0ULL;
+  n325_op_clw = 0ULL;
+  n326_op_csw = 0ULL;
+  n327_op_caddi = 0ULL;
+  n328_op_cjal = 0ULL;
+  n329_op_cli = 0ULL;
+  n330_op_clui_a16sp = 0ULL;
+  n331_op_calu = 0ULL;
+  n332_op_cj = 0ULL;
+  n333_op_cbeqz = 0ULL;
+  n334_op_cbnez = 0ULL;
+  n335_op_cslli = 0ULL;
+  n336_op_clwsp = 0ULL;
+  n337_op_cswsp = 0ULL;
+  n338_op_cjr_mv_add = 0ULL;
+  n339_op_cflw = 0ULL;
+  n340_op_cfsw = 0ULL;
+  n341_op_cflwsp = 0ULL;
+  n342_op_cfswsp = 0ULL;
+  n343_op_caddi16sp = 0ULL;
+  n344_op_clui = 0ULL;
+  n345_op_csrli = 0ULL;
+  n346_op_csrai = 0ULL;
+  n347_op_candi = 0ULL;
+  n348_op_caryth = 0ULL;
+  n349_op_csub = 0ULL;
+  n350_op_cxor = 0ULL;
+  n351_op_cor = 0ULL;
+  n352_op_cand = 0ULL;
+  n353_op_cmv = 0ULL;
+  n354_op_cadd = 0ULL;
+  n355_op_cjr = 0ULL;
+  n356_op_cjalr = 0ULL;
+  n357_op_cebreak = 0ULL;
+  n358_op_atomic = 0ULL;
+  n359_atomic_rd = 0ULL;
+  n360_atomic_wr = 0ULL;
+  n361_fpu_en = 0ULL;
+  n362_fp_load = 0ULL;
+  n363_fp_store = 0ULL;
+  n364_fp_hz_rs2 = 0ULL;
+  n365_bm_illegal = 0ULL;
+  n366_format_u = 0ULL;
+  n367_format_j = 0ULL;
+  n368_format_b = 0ULL;
+  n369_format_s = 0ULL;
+  n370_format_i = 0ULL;
+  n371_format_r = 0ULL;
+  n372_system = 0ULL;
+  n373_format_ciw = 0ULL;
+  n374_format_ci = 0ULL;
+  n375_format_cu = 0ULL;
+  n376_format_c16sp = 0ULL;
+  n377_format_cls = 0ULL;
+  n378_format_cj = 0ULL;
+  n379_format_cb = 0ULL;
+  n380_format_cssp = 0ULL;
+  n381_format_clsp = 0ULL;
+  n382_opcode_valid = 0ULL;
+  n383_immediate_u = 0ULL;
+  n384_immediate_j = 0ULL;
+  n385_immediate_b = 0ULL;
+  n386_immediate_s = 0ULL;
+  n387_immediate_i = 0ULL;
+  n388_immediate_ciw = 0ULL;
+  n389_immediate_ci = 0ULL;
+  n390_immediate_cu = 0ULL;
+  n391_immediate_c16sp = 0ULL;
+  n392_immediate_cls = 0ULL;
+  n393_immediate_cj = 0ULL;
+  n394_immediate_cb = 0ULL;
+  n395_immediate_cssp = 0ULL;
+  n396_immediate_clsp = 0ULL;
+  n397_immediate_mux = 0ULL;
+  n398_c_op_store = 0ULL;
+  n399_c_op_load = 0ULL;
+  n400_c_op_op_imm = 0ULL;
+  n401_c_op_op = 0ULL;
+  n402_c_jal = 0ULL;
+  n403_c_jalr = 0ULL;
+  n404_c_branch = 0ULL;
+  n405_alu_pc = 0ULL;
+  n406_alu_imm = 0ULL;
+  n407_alu_en = 0ULL;
+  n408_wb_mux = 0ULL;
+  n409_ma_wr = 0ULL;
+  n410_ma_rd = 0ULL;
+  n411_wb_en = 0ULL;
+  n412_hz_rs1 = 0ULL;
+  n413_hz_rs2 = 0ULL;
+  n414_jump = 0ULL;
+  n415_branch = 0ULL;
+  n416_rs1_mux = 0ULL;
+  n417_rs1_normal = 0ULL;
+  n418_rs1_sp = 0ULL;
+  n419_rs1_rs1l = 0ULL;
+  n420_rs1_rs1s = 0ULL;
+  n421_rs2_mux = 0ULL;
+  n422_rs2_normal = 0ULL;
+  n423_rs2_rs2s = 0ULL;
+  n424_rs2_rs2l = 0ULL;
+  n425_rd_mux = 0ULL;
+  n426_rd_normal = 0ULL;
+  n427_rd_rs2s = 0ULL;
+  n428_rd_rs1l = 0ULL;
+  n429_rd_rs1s = 0ULL;
+  n430_funct3_mux = 0ULL;
+  n431_funct3_normal = 0ULL;
+  n432_funct3_001 = 0ULL;
+  n433_funct3_010 = 0ULL;
+  n434_funct3_100 = 0ULL;
+  n435_funct3_101 = 0ULL;
+  n436_funct3_110 = 0ULL;
+  n437_funct3_111 = 0ULL;
+  n438_funct7_mux = 0ULL;
+  n439_funct7_normal = 0ULL;
+  n440_funct7_5 = 0ULL;
+  n443_i_addr_rd_a = 0ULL;
+  n444_i_addr_rd_b = 0ULL;
+  n446_i_addr_wr = 0ULL;
+  n448_i_addr_rd_c = 0ULL;
+  n449_i_addr_rd_d = 0ULL;
+  n451_i_addr_wr2 = 0ULL;
+  memset(n457_registers, 0, sizeof(n457_registers));
+  n458_dat_rd_a_reg = 0ULL;
+  n459_dat_rd_b_reg = 0ULL;
+  n460_dat_rd_c_reg = 0ULL;
+  n461_dat_rd_d_reg = 0ULL;
+  n462_i = 0ULL;
+  n490_i_pair_rd = 0ULL;
+  n491_i_pair_wb_en = 0ULL;
+  n492_o_hz_pair = 0ULL;
+  n498_rs1_hz_en = 0ULL;
+  n499_rs2_hz_en = 0ULL;
+  n500_hz_wb1 = 0ULL;
+  n501_hz_wb2 = 0ULL;
+  n502_hz_ma1 = 0ULL;
+  n503_hz_ma2 = 0ULL;
+  n504_hz_ma_res1 = 0ULL;
+  n505_hz_ma_ret1 = 0ULL;
+  n506_hz_ma_rd1 = 0ULL;
+  n507_hz_ma_res2 = 0ULL;
+  n508_hz_ma_ret2 = 0ULL;
+  n509_hz_ma_rd2 = 0ULL;
+  n510_hz_ex1 = 0ULL;
+  n511_hz_ex2 = 0ULL;
+  n512_hz_ex_res1 = 0ULL;
+  n513_hz_ex_ret1 = 0ULL;
+  n514_hz_ex_rd1 = 0ULL;
+  n515_hz_ex_res2 = 0ULL;
+  n516_hz_ex_ret2 = 0ULL;
+  n517_hz_ex_rd2 = 0ULL;
+  n518_hz2_wb1 = 0ULL;
+  n519_hz2_wb2 = 0ULL;
+  n520_hz2_ma1 = 0ULL;
+  n521_hz2_ma2 = 0ULL;
+  n522_hz2_ex1 = 0ULL;
+  n523_hz2_ex2 = 0ULL;
+  n524_rs1_d = 0ULL;
+  n525_rs2_d = 0ULL;
+  n526_hz_ma_ld = 0ULL;
+  n527_hz_data = 0ULL;
+  n547_opcode = 0ULL;
+  n548_rs1 = 0ULL;
+  n549_rs2 = 0ULL;
+  n550_rd = 0ULL;
+  n551_funct3 = 0ULL;
+  n552_funct7 = 0ULL;
+  n553_copcode = 0ULL;
+  n554_rs1cs = 0ULL;
+  n555_rs2cs = 0ULL;
+  n556_rs1cl = 0ULL;
+  n557_rs2cl = 0ULL;
+  n558_funct2h = 0ULL;
+  n559_funct2l = 0ULL;
+  n560_quad3 = 0ULL;
+  n561_op_load = 0ULL;
+  n562_op_op_imm = 0ULL;
+  n563_op_auipc = 0ULL;
+  n564_op_store = 0ULL;
+  n565_op_op = 0ULL;
+  n566_op_lui = 0ULL;
+  n567_op_branch = 0ULL;
+  n568_op_jalr = 0ULL;
+  n569_op_jal = 0ULL;
+  n570_op_system = 0ULL;
+  n571_op_misc_mem = 0ULL;
+  n572_quad0 = 0ULL;
+  n573_quad1 = 0ULL;
+  n574_quad2 = 0ULL;
+  n575_op_caddi4spn = 0ULL;
+  n576_op_clw = 0ULL;
+  n577_op_csw = 0ULL;
+  n578_op_caddi = 0ULL;
+  n579_op_cjal = 0ULL;
+  n580_op_cli = 0ULL;
+  n581_op_clui_a16sp = 0ULL;
+  n582_op_calu = 0ULL;
+  n583_op_cj = 0ULL;
+  n584_op_cbeqz = 0ULL;
+  n585_op_cbnez = 0ULL;
+  n586_op_cslli = 0ULL;
+  n587_op_clwsp = 0ULL;
+  n588_op_cswsp = 0ULL;
+  n589_op_cjr_mv_add = 0ULL;
+  n590_op_cflw = 0ULL;
+  n591_op_cfsw = 0ULL;
+  n592_op_cflwsp = 0ULL;
+  n593_op_cfswsp = 0ULL;
+  n594_op_caddi16sp = 0ULL;
+  n595_op_clui = 0ULL;
+  n596_op_csrli = 0ULL;
+  n597_op_csrai = 0ULL;
+  n598_op_candi = 0ULL;
+  n599_op_caryth = 0ULL;
+  n600_op_csub = 0ULL;
+  n601_op_cxor = 0ULL;
+  n602_op_cor = 0ULL;
+  n603_op_cand = 0ULL;
+  n604_op_cmv = 0ULL;
+  n605_op_cadd = 0ULL;
+  n606_op_cjr = 0ULL;
+  n607_op_cjalr = 0ULL;
+  n608_op_cebreak = 0ULL;
+  n609_op_atomic = 0ULL;
+  n610_atomic_rd = 0ULL;
+  n611_atomic_wr = 0ULL;
+  n612_fpu_en = 0ULL;
+  n613_fp_load = 0ULL;
+  n614_fp_store = 0ULL;
+  n615_fp_hz_rs2 = 0ULL;
+  n616_bm_illegal = 0ULL;
+  n617_format_u = 0ULL;
+  n618_format_j = 0ULL;
+  n619_format_b = 0ULL;
+  n620_format_s = 0ULL;
+  n621_format_i = 0ULL;
+  n622_format_r = 0ULL;
+  n623_system = 0ULL;
+  n624_format_ciw = 0ULL;
+  n625_format_ci = 0ULL;
+  n626_format_cu = 0ULL;
+  n627_format_c16sp = 0ULL;
+  n628_format_cls = 0ULL;
+  n629_format_cj = 0ULL;
+  n630_format_cb = 0ULL;
+  n631_format_cssp = 0ULL;
+  n632_format_clsp = 0ULL;
+  n633_opcode_valid = 0ULL;
+  n634_immediate_u = 0ULL;
+  n635_immediate_j = 0ULL;
+  n636_immediate_b = 0ULL;
+  n637_immediate_s = 0ULL;
+  n638_immediate_i = 0ULL;
+  n639_immediate_ciw = 0ULL;
+  n640_immediate_ci = 0ULL;
+  n641_immediate_cu = 0ULL;
+  n642_immediate_c16sp = 0ULL;
+  n643_immediate_cls = 0ULL;
+  n644_immediate_cj = 0ULL;
+  n645_immediate_cb = 0ULL;
+  n646_immediate_cssp = 0ULL;
+  n647_immediate_clsp = 0ULL;
+  n648_immediate_mux = 0ULL;
+  n649_c_op_store = 0ULL;
+  n650_c_op_load = 0ULL;
+  n651_c_op_op_imm = 0ULL;
+  n652_c_op_op = 0ULL;
+  n653_c_jal = 0ULL;
+  n654_c_jalr = 0ULL;
+  n655_c_branch = 0ULL;
+  n656_alu_pc = 0ULL;
+  n657_alu_imm = 0ULL;
+  n658_alu_en = 0ULL;
+  n659_wb_mux = 0ULL;
+  n660_ma_wr = 0ULL;
+  n661_ma_rd = 0ULL;
+  n662_wb_en = 0ULL;
+  n663_hz_rs1 = 0ULL;
+  n664_hz_rs2 = 0ULL;
+  n665_jump = 0ULL;
+  n666_branch = 0ULL;
+  n667_rs1_mux = 0ULL;
+  n668_rs1_normal = 0ULL;
+  n669_rs1_sp = 0ULL;
+  n670_rs1_rs1l = 0ULL;
+  n671_rs1_rs1s = 0ULL;
+  n672_rs2_mux = 0ULL;
+  n673_rs2_normal = 0ULL;
+  n674_rs2_rs2s = 0ULL;
+  n675_rs2_rs2l = 0ULL;
+  n676_rd_mux = 0ULL;
+  n677_rd_normal = 0ULL;
+  n678_rd_rs2s = 0ULL;
+  n679_rd_rs1l = 0ULL;
+  n680_rd_rs1s = 0ULL;
+  n681_funct3_mux = 0ULL;
+  n682_funct3_normal = 0ULL;
+  n683_funct3_001 = 0ULL;
+  n684_funct3_010 = 0ULL;
+  n685_funct3_100 = 0ULL;
+  n686_funct3_101 = 0ULL;
+  n687_funct3_110 = 0ULL;
+  n688_funct3_111 = 0ULL;
+  n689_funct7_mux = 0ULL;
+  n690_funct7_normal = 0ULL;
+  n691_funct7_5 = 0ULL;
+  n727_rs1_hz_en = 0ULL;
+  n728_rs2_hz_en = 0ULL;
+  n729_hz_wb1 = 0ULL;
+  n730_hz_wb2 = 0ULL;
+  n731_hz_ma1 = 0ULL;
+  n732_hz_ma2 = 0ULL;
+  n733_hz_ma_res1 = 0ULL;
+  n734_hz_ma_ret1 = 0ULL;
+  n735_hz_ma_rd1 = 0ULL;
+  n736_hz_ma_res2 = 0ULL;
+  n737_hz_ma_ret2 = 0ULL;
+  n738_hz_ma_rd2 = 0ULL;
+  n739_hz_ex1 = 0ULL;
+  n740_hz_ex2 = 0ULL;
+  n741_hz_ex_res1 = 0ULL;
+  n742_hz_ex_ret1 = 0ULL;
+  n743_hz_ex_rd1 = 0ULL;
+  n744_hz_ex_res2 = 0ULL;
+  n745_hz_ex_ret2 = 0ULL;
+  n746_hz_ex_rd2 = 0ULL;
+  n747_hz2_wb1 = 0ULL;
+  n748_hz2_wb2 = 0ULL;
+  n749_hz2_ma1 = 0ULL;
+  n750_hz2_ma2 = 0ULL;
+  n751_hz2_ex1 = 0ULL;
+  n752_hz2_ex2 = 0ULL;
+  n753_rs1_d = 0ULL;
+  n754_rs2_d = 0ULL;
+  n755_hz_ma_ld = 0ULL;
+  n756_hz_data = 0ULL;
+  n763_equal = 0ULL;
+  n764_lower = 0ULL;
+  n765_lower_u = 0ULL;
+  n766_condition_mux = 0ULL;
+  n767_condition = 0ULL;
+  n768_br_en = 0ULL;
+  n779_funct7_5 = 0ULL;
+  n780_op_subtract = 0ULL;
+  n781_adder_in_b = 0ULL;
+  n782_adder_out = 0ULL;
+  n783_logic_xor = 0ULL;
+  n784_logic_or = 0ULL;
+  n785_logic_and = 0ULL;
+  n786_comp = 0ULL;
+  n787_comp_u = 0ULL;
+  n788_shift_result = 0ULL;
+  n789_shift_en = 0ULL;
+  n790_shift_busy = 0ULL;
+  n791_mux = 0ULL;
+  n792_alu_result = 0ULL;
+  n793_funct7_0 = 0ULL;
+  n794_md_en = 0ULL;
+  n795_md_result = 0ULL;
+  n796_md_busy = 0ULL;
+  n800_i_in_b = 0ULL;
+  n806_op_sll = 0ULL;
+  n807_op_srl = 0ULL;
+  n808_op_sra = 0ULL;
+  memset(n809_shift_mask_array, 0, sizeof(n809_shift_mask_array));
+  n810_shift_mask = 0ULL;
+  n811_shift_amount = 0ULL;
+  memset(n812_shift_array, 0, sizeof(n812_shift_array));
+  n813_shift_out = 0ULL;
+  n814_shift_sll = 0ULL;
+  n815_shift_srl = 0ULL;
+  n816_shift_sra = 0ULL;
+  n825_in_a_n = 0ULL;
+  n826_in_b_n = 0ULL;
+  n827_mul_a_se = 0ULL;
+  n828_mul_b_se = 0ULL;
+  n829_div_se = 0ULL;
+  n830_a_se = 0ULL;
+  n831_b_se = 0ULL;
+  n832_a_s = 0ULL;
+  n833_b_s = 0ULL;
+  n834_mul_s = 0ULL;
+  n835_div_s = 0ULL;
+  n836_rem_s = 0ULL;
+  n837_div_rem_s = 0ULL;
+  n838_in_a = 0ULL;
+  n839_in_b = 0ULL;
+  n840_md_en = 0ULL;
+  n841_mul_q = 0ULL;
+  n842_mul = 0ULL;
+  n843_div_a = 0ULL;
+  n844_div_b = 0ULL;
+  n845_div_q = 0ULL;
+  n846_div_cnt = 0ULL;
+  n847_div_sub = 0ULL;
+  n848_div_cmp = 0ULL;
+  n849_div_busy = 0ULL;
+  n850_div_en = 0ULL;
+  n851_div_div = 0ULL;
+  n852_div_rem = 0ULL;
+  n853_div_res = 0ULL;
+  n854_div = 0ULL;
+  n855_mul_a_reg = 0ULL;
+  n856_mul_b_reg = 0ULL;
+  n857_mul_mul = 0ULL;
+  n858_mul_busy = 0ULL;
+  n859_mul_en = 0ULL;
+  n862_i_in_a = 0ULL;
+  n863_i_in_b = 0ULL;
+  n869_funct7_5 = 0ULL;
+  n870_op_subtract = 0ULL;
+  n871_adder_in_b = 0ULL;
+  n872_adder_out = 0ULL;
+  n873_logic_xor = 0ULL;
+  n874_logic_or = 0ULL;
+  n875_logic_and = 0ULL;
+  n876_comp = 0ULL;
+  n877_comp_u = 0ULL;
+  n878_shift_result = 0ULL;
+  n879_mux = 0ULL;
+  n883_i_in_b = 0ULL;
+  n888_o_busy = 0ULL;
+  n889_op_sll = 0ULL;
+  n890_op_srl = 0ULL;
+  n891_op_sra = 0ULL;
+  memset(n892_shift_mask_array, 0, sizeof(n892_shift_mask_array));
+  n893_shift_mask = 0ULL;
+  n894_shift_amount = 0ULL;
+  memset(n895_shift_array, 0, sizeof(n895_shift_array));
+  n896_shift_out = 0ULL;
+  n897_shift_sll = 0ULL;
+  n898_shift_srl = 0ULL;
+  n899_shift_sra = 0ULL;
+  n907_i_addr = 0ULL;
+  n910_i_instret_2 = 0ULL;
+  n912_misa = 0ULL;
+  n913_read_data = 0ULL;
+  n914_ext_data = 0ULL;
+  n915_cnt_data = 0ULL;
+  n916_other_data = 0ULL;
+  n917_cnt_rd_data = 0ULL;
+  n918_cnt_hit = 0ULL;
+  n919_write_enable = 0ULL;
+  n920_set_data = 0ULL;
+  n921_clr_data = 0ULL;
+  n922_write_data = 0ULL;
+  n925_i_wr = 0ULL;
+  memset(n932_count, 0, sizeof(n932_count));
+  n933_inhibit = 0ULL;
+  n934_index = 0ULL;
+  n935_sel_machine = 0ULL;
+  n936_sel_user = 0ULL;
+  n937_sel_count = 0ULL;
+  n938_sel_inhibit = 0ULL;
+  n939_sel_event = 0ULL;
+  n940_wr_lo = 0ULL;
+  n941_wr_hi = 0ULL;
+  n942_rd_index = 0ULL;
+  n943_rd_count = 0ULL;
+  n944_value = 0ULL;
+  n945_step = 0ULL;
+  n946_value = 0ULL;
+  n947_step = 0ULL;
+  n948_value = 0ULL;
+  n949_step = 0ULL;
+  n950_value = 0ULL;
+  n951_step = 0ULL;
+  n952_value = 0ULL;
+  n953_step = 0ULL;
+  n954_value = 0ULL;
+  n955_step = 0ULL;
+  n958_i_shift = 0ULL;
+  n959_i_length = 0ULL;
+  n960_i_signed_rd = 0ULL;
+  n964_length_mask = 0ULL;
+  n965_data_wr_shift = 0ULL;
+  n966_data_rd_shift = 0ULL;
+  n967_data_rd_short = 0ULL;
+  n968_sign_bit = 0ULL;
+  n969_sign_extension = 0ULL;
+  n970_data_rd_signed = 0ULL;
+  n971_we_lenght = 0ULL;
+  n972_we_shifted = 0ULL;
+  pv_0 = 0;
+  pv_1 = 0;
+  init_done_ = false;
+  p225_();
+}
+
+void Vcpu::p18_() {  // fetch_i.predictor_i.always@4274
+  if (((uint64_t)(i_rst))) {
+    n275_i = (uint32_t)(0x0ULL);
+    for (int guard_ = 0; guard_ < 100000 && (((uint64_t)((S64(((uint64_t)(n275_i)), 32) < S64(0x10ULL, 32))))); guard_++) {
+      uint64_t t2 = 0x0ULL;
+      { uint64_t i_ = (uint64_t)S64(((uint64_t)(n275_i)), 32); if (i_ < 16ULL) pw_n264_btb_valid.push_back({(uint32_t)i_, (uint8_t)((t2 & 0x1ULL)), (uint8_t)0x1ULL}); }
+      n275_i = (uint32_t)(((((uint64_t)(n275_i)) + 0x1ULL) & 0xFFFFFFFFULL));
+    }
+  } else {
+    if (((uint64_t)(n193_i_bp_en))) {
+      if (((uint64_t)(n73_br_en))) {
+        { uint64_t i_ = (uint64_t)(((uint64_t)(n269_upd_idx))); if (i_ < 16ULL) pw_n264_btb_valid.push_back({(uint32_t)i_, (uint8_t)(0x1ULL), (uint8_t)0x1ULL}); }
+        { uint64_t i_ = (uint64_t)(((uint64_t)(n269_upd_idx))); if (i_ < 16ULL) pw_n261_btb_tag.push_back({(uint32_t)i_, (uint32_t)(((uint64_t)(n270_upd_tag))), (uint32_t)0x7FFFFFFULL}); }
+        { uint64_t i_ = (uint64_t)(((uint64_t)(n269_upd_idx))); if (i_ < 16ULL) pw_n260_btb_addr.push_back({(uint32_t)i_, (uint32_t)(((uint64_t)((((uint64_t)(n146_alu_out) >> 1) & 0x7FFFFFFFULL)))), (uint32_t)0x7FFFFFFFULL}); }
+        { uint64_t i_ = (uint64_t)(((uint64_t)(n269_upd_idx))); if (i_ < 16ULL) pw_n263_btb_jump.push_back({(uint32_t)i_, (uint8_t)(((uint64_t)(n57_ex_jump))), (uint8_t)0x1ULL}); }
+        { uint64_t i_ = (uint64_t)(((uint64_t)(n269_upd_idx))); if (i_ < 16ULL) pw_n262_btb_cnt.push_back({(uint32_t)i_, (uint8_t)(((((uint64_t)(n271_upd_hit))) ? ((uint64_t)(n273_upd_cnt_inc)) : 0x2ULL)), (uint8_t)0x3ULL}); }
+      } else {
+        if (((uint64_t)(n271_upd_hit))) {
+          { uint64_t i_ = (uint64_t)(((uint64_t)(n269_upd_idx))); if (i_ < 16ULL) pw_n262_btb_cnt.push_back({(uint32_t)i_, (uint8_t)(((uint64_t)(n274_upd_cnt_dec))), (uint8_t)0x3ULL}); }
+        }
+      }
+    }
+  }
+}
+
+void Vcpu::p19_() {  // fetch_i.always@4420
+  if (((uint64_t)(i_rst))) {
+    uint64_t t3 = 0x0ULL;
+    nx_n221_ras_ptr = (uint8_t)((t3 & 0x3ULL));
+    uint64_t t4 = 0x0ULL;
+    nx_n222_ras_cnt = (uint8_t)((t4 & 0x7ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      if (((uint64_t)(((((uint64_t)(n91_id_ras_push)) != 0) && (((uint64_t)(n92_id_ras_pop)) != 0))))) {
+        { uint64_t i_ = (uint64_t)(((uint64_t)(n221_ras_ptr))); if (i_ < 4ULL) pw_n220_ras_data.push_back({(uint32_t)i_, (uint32_t)(((uint64_t)(n21_id_ret))), (uint32_t)0xFFFFFFFFULL}); }
+      } else {
+        if (((uint64_t)(n91_id_ras_push))) {
+          { uint64_t i_ = (uint64_t)(((uint64_t)(n223_ras_ptr_inc))); if (i_ < 4ULL) pw_n220_ras_data.push_back({(uint32_t)i_, (uint32_t)(((uint64_t)(n21_id_ret))), (uint32_t)0xFFFFFFFFULL}); }
+          nx_n221_ras_ptr = (uint8_t)(((uint64_t)(n223_ras_ptr_inc)));
+          if (((uint64_t)((((uint64_t)(n222_ras_cnt)) != 0x4ULL)))) {
+            uint64_t t5 = ((((uint64_t)(n222_ras_cnt)) + 0x1ULL) & 0xFFFFFFFFULL);
+            nx_n222_ras_cnt = (uint8_t)((t5 & 0x7ULL));
+          }
+        } else {
+          if (((uint64_t)(n92_id_ras_pop))) {
+            nx_n221_ras_ptr = (uint8_t)(((uint64_t)(n224_ras_ptr_dec)));
+            if (((uint64_t)((((uint64_t)(n222_ras_cnt)) != 0x0ULL)))) {
+              uint64_t t6 = ((((uint64_t)(n222_ras_cnt)) - 0x1ULL) & 0xFFFFFFFFULL);
+              nx_n222_ras_cnt = (uint8_t)((t6 & 0x7ULL));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+void Vcpu::p24_() {  // fetch_i.always@4505
+  if (((uint64_t)(i_rst))) {
+    nx_n225_fetch_pc = (uint32_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(n16_fetch_ce))) {
+      nx_n225_fetch_pc = (uint32_t)(((uint64_t)(n226_fetch_next)));
+    }
+  }
+}
+
+void Vcpu::p37_() {  // fetch_i.always@4563
+  if (((uint64_t)(i_rst))) {
+    uint64_t t9 = 0x0ULL;
+    nx_n233_q_cnt = (uint8_t)((t9 & 0x7ULL));
+    nx_n234_q_pc = (uint32_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(((((uint64_t)(n77_fetch_br_en)) != 0) || (((uint64_t)(n243_redirect)) != 0)))) != 0))))) {
+      uint64_t t10 = 0x0ULL;
+      nx_n233_q_cnt = (uint8_t)((t10 & 0x7ULL));
+      nx_n234_q_pc = (uint32_t)(((uint64_t)(n226_fetch_next)));
+    } else {
+      if (((uint64_t)(n16_fetch_ce))) {
+        nx_n233_q_cnt = (uint8_t)(((((uint64_t)(n236_rem_cnt)) + ((((uint64_t)(n227_fetch_en))) ? ((uint64_t)(((((uint64_t)0x0ULL) << 2) | ((uint64_t)((uint64_t)(n228_push_cnt)))))) : 0x0ULL)) & 0x7ULL));
+        nx_n234_q_pc = (uint32_t)(((((uint64_t)(n234_q_pc)) + ((uint64_t)(((((uint64_t)0x0ULL) << 4) | (((uint64_t)((uint64_t)(n241_pop_cnt))) << 1) | ((uint64_t)0x0ULL))))) & 0xFFFFFFFFULL));
+      }
+    }
+  }
+}
+
+void Vcpu::p38_() {  // fetch_i.always@4576
+  if (((uint64_t)(n16_fetch_ce))) {
+    n276_i = (uint32_t)(0x0ULL);
+    for (int guard_ = 0; guard_ < 100000 && (((uint64_t)((S64(((uint64_t)(n276_i)), 32) < S64(0x4ULL, 32))))); guard_++) {
+      if (((uint64_t)(((((uint64_t)(n227_fetch_en)) != 0) && (((uint64_t)((((uint64_t)((((uint64_t)(n276_i) >> 0) & 0x7ULL))) == ((uint64_t)(n236_rem_cnt))))) != 0))))) {
+        { uint64_t i_ = (uint64_t)S64(((uint64_t)(n276_i)), 32); if (i_ < 4ULL) pw_n232_q_data.push_back({(uint32_t)i_, (uint16_t)(((uint64_t)(n229_push_0))), (uint16_t)0xFFFFULL}); }
+      } else {
+        if (((uint64_t)(((((uint64_t)(((((uint64_t)(n227_fetch_en)) != 0) && (((uint64_t)((((uint64_t)(n228_push_cnt)) == 0x2ULL))) != 0)))) != 0) && (((uint64_t)((((uint64_t)((((uint64_t)(n276_i) >> 0) & 0x7ULL))) == ((((uint64_t)(n236_rem_cnt)) + 0x1ULL) & 0x7ULL)))) != 0))))) {
+          { uint64_t i_ = (uint64_t)S64(((uint64_t)(n276_i)), 32); if (i_ < 4ULL) pw_n232_q_data.push_back({(uint32_t)i_, (uint16_t)(((uint64_t)(n230_push_1))), (uint16_t)0xFFFFULL}); }
+        } else {
+          { uint64_t i_ = (uint64_t)S64(((uint64_t)(n276_i)), 32); if (i_ < 4ULL) pw_n232_q_data.push_back({(uint32_t)i_, (uint16_t)(((uint64_t)(((uint64_t)(((uint64_t)S64(((uint64_t)(n276_i)), 32))) < 4ULL ? n235_q_rem[(uint64_t)(((uint64_t)S64(((uint64_t)(n276_i)), 32)))] : 0)))), (uint16_t)0xFFFFULL}); }
+        }
+      }
+      n276_i = (uint32_t)(((((uint64_t)(n276_i)) + 0x1ULL) & 0xFFFFFFFFULL));
+    }
+  }
+}
+
+void Vcpu::p226_() {  // regs_i.always@6527
+  nx_n458_dat_rd_a_reg = (uint32_t)(((uint64_t)(n457_registers[((uint64_t)(n443_i_addr_rd_a))])));
+  nx_n459_dat_rd_b_reg = (uint32_t)(((uint64_t)(n457_registers[((uint64_t)(n444_i_addr_rd_b))])));
+  nx_n460_dat_rd_c_reg = (uint32_t)(((uint64_t)(n457_registers[((uint64_t)(n448_i_addr_rd_c))])));
+  nx_n461_dat_rd_d_reg = (uint32_t)(((uint64_t)(n457_registers[((uint64_t)(n449_i_addr_rd_d))])));
+  if (((uint64_t)(((((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n172_wb_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n446_i_addr_wr)) != 0x0ULL))) != 0))))) {
+    { uint64_t i_ = (uint64_t)(((uint64_t)(n446_i_addr_wr))); if (i_ < 32ULL) pw_n457_registers.push_back({(uint32_t)i_, (uint32_t)(((uint64_t)(n175_wb_dat))), (uint32_t)0xFFFFFFFFULL}); }
+  }
+  if (((uint64_t)(((((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n145_wb1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n451_i_addr_wr2)) != 0x0ULL))) != 0))))) {
+    { uint64_t i_ = (uint64_t)(((uint64_t)(n451_i_addr_wr2))); if (i_ < 32ULL) pw_n457_registers.push_back({(uint32_t)i_, (uint32_t)(((uint64_t)(n143_wb1_wb_d))), (uint32_t)0xFFFFFFFFULL}); }
+  }
+}
+
+void Vcpu::p487_() {  // always@8940
+  if (((uint64_t)(((((uint64_t)(i_rst)) != 0) || (((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n45_id_bubble)) != 0)))) != 0))))) {
+    nx_n50_ex_rs1_d = (uint32_t)(0x0ULL);
+    nx_n51_ex_rs2_d = (uint32_t)(0x0ULL);
+    nx_n52_ex_imm = (uint32_t)(0x0ULL);
+    nx_n53_ex_pc = (uint32_t)(0x0ULL);
+    nx_n54_ex_ret = (uint32_t)(0x0ULL);
+    uint64_t t29 = 0x0ULL;
+    nx_n55_ex_funct3 = (uint8_t)((t29 & 0x7ULL));
+    uint64_t t30 = 0x0ULL;
+    nx_n56_ex_funct7 = (uint8_t)((t30 & 0x7FULL));
+    uint64_t t31 = 0x0ULL;
+    nx_n67_ex_rs1 = (uint8_t)((t31 & 0x1FULL));
+    uint64_t t32 = 0x0ULL;
+    nx_n58_ex_branch = (uint8_t)((t32 & 0x1ULL));
+    uint64_t t33 = 0x0ULL;
+    nx_n57_ex_jump = (uint8_t)((t33 & 0x1ULL));
+    uint64_t t34 = 0x0ULL;
+    nx_n59_ex_alu_pc = (uint8_t)((t34 & 0x1ULL));
+    uint64_t t35 = 0x0ULL;
+    nx_n60_ex_alu_imm = (uint8_t)((t35 & 0x1ULL));
+    uint64_t t36 = 0x0ULL;
+    nx_n61_ex_alu_en = (uint8_t)((t36 & 0x1ULL));
+    uint64_t t37 = 0x0ULL;
+    nx_n62_ex_ma_wr = (uint8_t)((t37 & 0x1ULL));
+    uint64_t t38 = 0x0ULL;
+    nx_n63_ex_ma_rd = (uint8_t)((t38 & 0x1ULL));
+    uint64_t t39 = 0x0ULL;
+    nx_n65_ex_wb_reg = (uint8_t)((t39 & 0x1FULL));
+    uint64_t t40 = 0x0ULL;
+    nx_n64_ex_wb_mux = (uint8_t)((t40 & 0x3ULL));
+    uint64_t t41 = 0x0ULL;
+    nx_n66_ex_wb_en = (uint8_t)((t41 & 0x1ULL));
+    uint64_t t42 = 0x0ULL;
+    nx_n68_ex_system = (uint8_t)((t42 & 0x1ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n50_ex_rs1_d = (uint32_t)(((uint64_t)(n48_rs1_d)));
+      nx_n51_ex_rs2_d = (uint32_t)(((uint64_t)(n49_rs2_d)));
+      nx_n52_ex_imm = (uint32_t)(((uint64_t)(n26_immediate)));
+      nx_n53_ex_pc = (uint32_t)(((uint64_t)(n19_id_pc)));
+      nx_n54_ex_ret = (uint32_t)(((uint64_t)(n21_id_ret)));
+      nx_n55_ex_funct3 = (uint8_t)(((uint64_t)(n27_funct3)));
+      nx_n56_ex_funct7 = (uint8_t)(((uint64_t)(n28_funct7)));
+      nx_n67_ex_rs1 = (uint8_t)(((uint64_t)(n29_rs1)));
+      nx_n58_ex_branch = (uint8_t)(((uint64_t)(n34_branch)));
+      nx_n57_ex_jump = (uint8_t)(((uint64_t)(n35_jump)));
+      nx_n59_ex_alu_pc = (uint8_t)(((uint64_t)(n36_alu_pc)));
+      nx_n60_ex_alu_imm = (uint8_t)(((uint64_t)(n37_alu_imm)));
+      nx_n61_ex_alu_en = (uint8_t)(((uint64_t)(n38_alu_en)));
+      nx_n62_ex_ma_wr = (uint8_t)(((uint64_t)(n39_d_wr)));
+      nx_n63_ex_ma_rd = (uint8_t)(((uint64_t)(n40_d_rd)));
+      nx_n65_ex_wb_reg = (uint8_t)(((uint64_t)(n31_rd)));
+      nx_n64_ex_wb_mux = (uint8_t)(((uint64_t)(n41_wb_mux)));
+      nx_n66_ex_wb_en = (uint8_t)(((uint64_t)(n42_wb_en)));
+      nx_n68_ex_system = (uint8_t)(((uint64_t)(n43_system)));
+    }
+  }
+}
+
+void Vcpu::p488_() {  // always@8999
+  if (((uint64_t)(((((uint64_t)(i_rst)) != 0) || (((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n45_id_bubble)) != 0)))) != 0))))) {
+    uint64_t t43 = 0x0ULL;
+    nx_n69_ex_valid = (uint8_t)((t43 & 0x1ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n69_ex_valid = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir)) != 0))));
+    }
+  }
+}
+
+void Vcpu::p489_() {  // always@9039
+  if (((uint64_t)(((((uint64_t)(i_rst)) != 0) || (((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)((((uint64_t)(n99_id1_issue)) == 0))) != 0)))) != 0))))) {
+    nx_n128_ex1_rs1_d = (uint32_t)(0x0ULL);
+    nx_n129_ex1_rs2_d = (uint32_t)(0x0ULL);
+    nx_n130_ex1_imm = (uint32_t)(0x0ULL);
+    nx_n131_ex1_pc = (uint32_t)(0x0ULL);
+    uint64_t t44 = 0x0ULL;
+    nx_n132_ex1_funct3 = (uint8_t)((t44 & 0x7ULL));
+    uint64_t t45 = 0x0ULL;
+    nx_n133_ex1_funct7 = (uint8_t)((t45 & 0x7FULL));
+    uint64_t t46 = 0x0ULL;
+    nx_n134_ex1_alu_pc = (uint8_t)((t46 & 0x1ULL));
+    uint64_t t47 = 0x0ULL;
+    nx_n135_ex1_alu_imm = (uint8_t)((t47 & 0x1ULL));
+    uint64_t t48 = 0x0ULL;
+    nx_n136_ex1_alu_en = (uint8_t)((t48 & 0x1ULL));
+    uint64_t t49 = 0x0ULL;
+    nx_n137_ex1_wb_reg = (uint8_t)((t49 & 0x1FULL));
+    uint64_t t50 = 0x0ULL;
+    nx_n138_ex1_wb_en = (uint8_t)((t50 & 0x1ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n128_ex1_rs1_d = (uint32_t)(((uint64_t)(n126_id1_rs1_d)));
+      nx_n129_ex1_rs2_d = (uint32_t)(((uint64_t)(n127_id1_rs2_d)));
+      nx_n130_ex1_imm = (uint32_t)(((uint64_t)(n104_id1_imm)));
+      nx_n131_ex1_pc = (uint32_t)(((uint64_t)(n21_id_ret)));
+      nx_n132_ex1_funct3 = (uint8_t)(((uint64_t)(n105_id1_funct3)));
+      nx_n133_ex1_funct7 = (uint8_t)(((uint64_t)(n106_id1_funct7)));
+      nx_n134_ex1_alu_pc = (uint8_t)(((uint64_t)(n114_id1_alu_pc)));
+      nx_n135_ex1_alu_imm = (uint8_t)(((uint64_t)(n115_id1_alu_imm)));
+      nx_n136_ex1_alu_en = (uint8_t)(((uint64_t)(n116_id1_alu_en)));
+      nx_n137_ex1_wb_reg = (uint8_t)(((uint64_t)(n109_id1_rd)));
+      nx_n138_ex1_wb_en = (uint8_t)(((uint64_t)(n120_id1_wb_en)));
+    }
+  }
+}
+
+void Vcpu::p490_() {  // always@9079
+  if (((uint64_t)(((((uint64_t)(i_rst)) != 0) || (((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n45_id_bubble)) != 0)))) != 0))))) {
+    uint64_t t51 = 0x0ULL;
+    nx_n85_ex_jal_done = (uint8_t)((t51 & 0x1ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n85_ex_jal_done = (uint8_t)(((uint64_t)(n82_id_jal_go)));
+    }
+  }
+}
+
+void Vcpu::p491_() {  // always@9099
+  if (((uint64_t)(((((uint64_t)(i_rst)) != 0) || (((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n45_id_bubble)) != 0)))) != 0))))) {
+    uint64_t t52 = 0x0ULL;
+    nx_n94_ex_ras_pred = (uint8_t)((t52 & 0x1ULL));
+    nx_n95_ex_ras_addr = (uint32_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n94_ex_ras_pred = (uint8_t)(((uint64_t)(n93_id_ras_go)));
+      nx_n95_ex_ras_addr = (uint32_t)(((uint64_t)(n87_ras_top)));
+    }
+  }
+}
+
+void Vcpu::p492_() {  // always@9111
+  if (((uint64_t)(((((uint64_t)(i_rst)) != 0) || (((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n45_id_bubble)) != 0)))) != 0))))) {
+    uint64_t t53 = 0x0ULL;
+    nx_n70_ex_pred = (uint8_t)((t53 & 0x1ULL));
+    nx_n71_ex_pred_addr = (uint32_t)(0x0ULL);
+    uint64_t t54 = 0x0ULL;
+    nx_n72_ex_pred_idx = (uint8_t)((t54 & 0x3FULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n70_ex_pred = (uint8_t)(((uint64_t)(n23_id_pred)));
+      nx_n71_ex_pred_addr = (uint32_t)(((uint64_t)(n24_id_pred_addr)));
+      nx_n72_ex_pred_idx = (uint8_t)(((uint64_t)(n25_id_pred_idx)));
+    }
+  }
+}
+
+void Vcpu::p609_() {  // alu_i.muldiv_i.always@1659
+  if (((uint64_t)(i_rst))) {
+    nx_n855_mul_a_reg = (uint64_t)(0x0ULL);
+    nx_n856_mul_b_reg = (uint32_t)(0x0ULL);
+    nx_n857_mul_mul = (uint64_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(((((uint64_t)(n859_mul_en)) != 0) && (((uint64_t)((((uint64_t)(n856_mul_b_reg)) == 0))) != 0))))) {
+      nx_n855_mul_a_reg = (uint64_t)(((uint64_t)(((((uint64_t)0x0ULL) << 32) | ((uint64_t)((uint64_t)(n838_in_a)))))));
+      nx_n856_mul_b_reg = (uint32_t)(((uint64_t)(n839_in_b)));
+      nx_n857_mul_mul = (uint64_t)(0x0ULL);
+    } else {
+      if (((uint64_t)((((uint64_t)(n856_mul_b_reg)) != 0)))) {
+        if (((uint64_t)(((uint64_t)(n856_mul_b_reg) >> 0) & 1))) {
+          nx_n857_mul_mul = (uint64_t)((((uint64_t)(n857_mul_mul)) + ((uint64_t)(n855_mul_a_reg))));
+        }
+        nx_n855_mul_a_reg = (uint64_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n855_mul_a_reg) >> 0) & 0x7FFFFFFFFFFFFFFFULL)))) << 1) | ((uint64_t)0x0ULL)))));
+        nx_n856_mul_b_reg = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 31) | ((uint64_t)((uint64_t)((((uint64_t)(n856_mul_b_reg) >> 1) & 0x7FFFFFFFULL))))))));
+      }
+    }
+  }
+}
+
+void Vcpu::p614_() {  // alu_i.muldiv_i.always@1810
+  if (((uint64_t)(i_rst))) {
+    nx_n843_div_a = (uint64_t)(0x0ULL);
+    nx_n844_div_b = (uint32_t)(0x0ULL);
+    nx_n845_div_q = (uint32_t)(0x0ULL);
+    nx_n846_div_cnt = (uint8_t)(0x20ULL);
+  } else {
+    if (((uint64_t)(n850_div_en))) {
+      nx_n843_div_a = (uint64_t)(((uint64_t)(((((uint64_t)0x0ULL) << 32) | ((uint64_t)((uint64_t)(n838_in_a)))))));
+      nx_n844_div_b = (uint32_t)(((uint64_t)(n839_in_b)));
+      nx_n845_div_q = (uint32_t)(0x0ULL);
+      uint64_t t59 = 0x0ULL;
+      nx_n846_div_cnt = (uint8_t)((t59 & 0x3FULL));
+    }
+    if (((uint64_t)((((uint64_t)(((uint64_t)(n846_div_cnt) >> 5) & 1)) == 0)))) {
+      nx_n846_div_cnt = (uint8_t)(((((uint64_t)(n846_div_cnt)) + 0x1ULL) & 0x3FULL));
+      nx_n845_div_q = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n845_div_q) >> 0) & 0x7FFFFFFFULL)))) << 1) | ((uint64_t)((uint64_t)(n848_div_cmp)))))));
+      if (((uint64_t)(n848_div_cmp))) {
+        nx_n843_div_a = (uint64_t)(((uint64_t)(((((uint64_t)((uint64_t)(n847_div_sub))) << 32) | (((uint64_t)((uint64_t)((((uint64_t)(n843_div_a) >> 0) & 0x7FFFFFFFULL)))) << 1) | ((uint64_t)0x0ULL)))));
+      } else {
+        nx_n843_div_a = (uint64_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n843_div_a) >> 0) & 0x7FFFFFFFFFFFFFFFULL)))) << 1) | ((uint64_t)0x0ULL)))));
+      }
+    }
+  }
+}
+
+void Vcpu::p728_() {  // csr_i.always@7049
+  if (((uint64_t)(n919_write_enable))) {
+    { uint64_t t63 = ((uint64_t)(n907_i_addr));
+    {
+    }
+    }
+  }
+}
+
+void Vcpu::p738_() {  // csr_i.counters_i.cnt[0].counter.always@7541
+  if (((uint64_t)(i_rst))) {
+    nx_n944_value = (uint64_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(((((uint64_t)(n940_wr_lo)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x0ULL))) != 0))))) {
+      { int64_t p_ = 0; if (p_ >= 0 && p_ < 64) nx_n944_value = (uint64_t)(((uint64_t)nx_n944_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+    } else {
+      if (((uint64_t)(((((uint64_t)(n941_wr_hi)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x0ULL))) != 0))))) {
+        { int64_t p_ = 32; if (p_ >= 0 && p_ < 64) nx_n944_value = (uint64_t)(((uint64_t)nx_n944_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+      } else {
+        if (((uint64_t)(((((uint64_t)(((uint64_t)(n183_csr_events) >> 0) & 1)) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n933_inhibit) >> 0) & 1)) == 0))) != 0))))) {
+          nx_n944_value = (uint64_t)((((uint64_t)(n944_value)) + ((uint64_t)(n945_step))));
+        }
+      }
+    }
+  }
+}
+
+void Vcpu::p742_() {  // csr_i.counters_i.cnt[2].counter.always@7541
+  if (((uint64_t)(i_rst))) {
+    nx_n946_value = (uint64_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(((((uint64_t)(n940_wr_lo)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x2ULL))) != 0))))) {
+      { int64_t p_ = 0; if (p_ >= 0 && p_ < 64) nx_n946_value = (uint64_t)(((uint64_t)nx_n946_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+    } else {
+      if (((uint64_t)(((((uint64_t)(n941_wr_hi)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x2ULL))) != 0))))) {
+        { int64_t p_ = 32; if (p_ >= 0 && p_ < 64) nx_n946_value = (uint64_t)(((uint64_t)nx_n946_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+      } else {
+        if (((uint64_t)(((((uint64_t)(((uint64_t)(n183_csr_events) >> 2) & 1)) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n933_inhibit) >> 2) & 1)) == 0))) != 0))))) {
+          nx_n946_value = (uint64_t)((((uint64_t)(n946_value)) + ((uint64_t)(n947_step))));
+        }
+      }
+    }
+  }
+}
+
+void Vcpu::p745_() {  // csr_i.counters_i.cnt[3].counter.always@7541
+  if (((uint64_t)(i_rst))) {
+    nx_n948_value = (uint64_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(((((uint64_t)(n940_wr_lo)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x3ULL))) != 0))))) {
+      { int64_t p_ = 0; if (p_ >= 0 && p_ < 64) nx_n948_value = (uint64_t)(((uint64_t)nx_n948_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+    } else {
+      if (((uint64_t)(((((uint64_t)(n941_wr_hi)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x3ULL))) != 0))))) {
+        { int64_t p_ = 32; if (p_ >= 0 && p_ < 64) nx_n948_value = (uint64_t)(((uint64_t)nx_n948_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+      } else {
+        if (((uint64_t)(((((uint64_t)(((uint64_t)(n183_csr_events) >> 3) & 1)) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n933_inhibit) >> 3) & 1)) == 0))) != 0))))) {
+          nx_n948_value = (uint64_t)((((uint64_t)(n948_value)) + ((uint64_t)(n949_step))));
+        }
+      }
+    }
+  }
+}
+
+void Vcpu::p748_() {  // csr_i.counters_i.cnt[4].counter.always@7541
+  if (((uint64_t)(i_rst))) {
+    nx_n950_value = (uint64_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(((((uint64_t)(n940_wr_lo)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x4ULL))) != 0))))) {
+      { int64_t p_ = 0; if (p_ >= 0 && p_ < 64) nx_n950_value = (uint64_t)(((uint64_t)nx_n950_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+    } else {
+      if (((uint64_t)(((((uint64_t)(n941_wr_hi)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x4ULL))) != 0))))) {
+        { int64_t p_ = 32; if (p_ >= 0 && p_ < 64) nx_n950_value = (uint64_t)(((uint64_t)nx_n950_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+      } else {
+        if (((uint64_t)(((((uint64_t)(((uint64_t)(n183_csr_events) >> 4) & 1)) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n933_inhibit) >> 4) & 1)) == 0))) != 0))))) {
+          nx_n950_value = (uint64_t)((((uint64_t)(n950_value)) + ((uint64_t)(n951_step))));
+        }
+      }
+    }
+  }
+}
+
+void Vcpu::p751_() {  // csr_i.counters_i.cnt[5].counter.always@7541
+  if (((uint64_t)(i_rst))) {
+    nx_n952_value = (uint64_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(((((uint64_t)(n940_wr_lo)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x5ULL))) != 0))))) {
+      { int64_t p_ = 0; if (p_ >= 0 && p_ < 64) nx_n952_value = (uint64_t)(((uint64_t)nx_n952_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+    } else {
+      if (((uint64_t)(((((uint64_t)(n941_wr_hi)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x5ULL))) != 0))))) {
+        { int64_t p_ = 32; if (p_ >= 0 && p_ < 64) nx_n952_value = (uint64_t)(((uint64_t)nx_n952_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+      } else {
+        if (((uint64_t)(((((uint64_t)(((uint64_t)(n183_csr_events) >> 5) & 1)) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n933_inhibit) >> 5) & 1)) == 0))) != 0))))) {
+          nx_n952_value = (uint64_t)((((uint64_t)(n952_value)) + ((uint64_t)(n953_step))));
+        }
+      }
+    }
+  }
+}
+
+void Vcpu::p754_() {  // csr_i.counters_i.cnt[6].counter.always@7541
+  if (((uint64_t)(i_rst))) {
+    nx_n954_value = (uint64_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(((((uint64_t)(n940_wr_lo)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x6ULL))) != 0))))) {
+      { int64_t p_ = 0; if (p_ >= 0 && p_ < 64) nx_n954_value = (uint64_t)(((uint64_t)nx_n954_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+    } else {
+      if (((uint64_t)(((((uint64_t)(n941_wr_hi)) != 0) && (((uint64_t)((((uint64_t)(n934_index)) == 0x6ULL))) != 0))))) {
+        { int64_t p_ = 32; if (p_ >= 0 && p_ < 64) nx_n954_value = (uint64_t)(((uint64_t)nx_n954_value & ~((uint64_t)0xFFFFFFFFULL << p_)) | ((((uint64_t)(((uint64_t)(n922_write_data)))) & 0xFFFFFFFFULL) << p_)); }
+      } else {
+        if (((uint64_t)(((((uint64_t)(((uint64_t)(n183_csr_events) >> 6) & 1)) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n933_inhibit) >> 6) & 1)) == 0))) != 0))))) {
+          nx_n954_value = (uint64_t)((((uint64_t)(n954_value)) + ((uint64_t)(n955_step))));
+        }
+      }
+    }
+  }
+}
+
+void Vcpu::p756_() {  // csr_i.counters_i.always@7560
+  if (((uint64_t)(i_rst))) {
+    uint64_t t64 = 0x0ULL;
+    nx_n933_inhibit = (uint8_t)((t64 & 0x7FULL));
+  } else {
+    if (((uint64_t)(((((uint64_t)(n925_i_wr)) != 0) && (((uint64_t)(n938_sel_inhibit)) != 0))))) {
+      nx_n933_inhibit = (uint8_t)((((uint64_t)((((uint64_t)(n922_write_data) >> 0) & 0x7FULL))) & 0x7DULL));
+    }
+  }
+}
+
+void Vcpu::p775_() {  // always@9423
+  if (((uint64_t)(i_rst))) {
+    nx_n151_ma_rs2_d = (uint32_t)(0x0ULL);
+    nx_n152_ma_res = (uint32_t)(0x0ULL);
+    nx_n153_ma_ret = (uint32_t)(0x0ULL);
+    uint64_t t65 = 0x0ULL;
+    nx_n154_ma_funct3 = (uint8_t)((t65 & 0x7ULL));
+    uint64_t t66 = 0x0ULL;
+    nx_n155_ma_wr = (uint8_t)((t66 & 0x1ULL));
+    uint64_t t67 = 0x0ULL;
+    nx_n156_ma_rd = (uint8_t)((t67 & 0x1ULL));
+    uint64_t t68 = 0x0ULL;
+    nx_n157_ma_wb_reg = (uint8_t)((t68 & 0x1FULL));
+    uint64_t t69 = 0x0ULL;
+    nx_n158_ma_wb_mux = (uint8_t)((t69 & 0x3ULL));
+    uint64_t t70 = 0x0ULL;
+    nx_n159_ma_wb_en = (uint8_t)((t70 & 0x1ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n151_ma_rs2_d = (uint32_t)(((uint64_t)(n51_ex_rs2_d)));
+      nx_n152_ma_res = (uint32_t)(((uint64_t)(n150_ex_res_dat)));
+      nx_n153_ma_ret = (uint32_t)(((uint64_t)(n54_ex_ret)));
+      nx_n154_ma_funct3 = (uint8_t)(((uint64_t)(n55_ex_funct3)));
+      nx_n155_ma_wr = (uint8_t)(((uint64_t)(((((uint64_t)(n62_ex_ma_wr)) != 0) && (((uint64_t)((((uint64_t)(n79_trap_go)) == 0))) != 0)))));
+      nx_n156_ma_rd = (uint8_t)(((uint64_t)(((((uint64_t)(n63_ex_ma_rd)) != 0) && (((uint64_t)((((uint64_t)(n79_trap_go)) == 0))) != 0)))));
+      nx_n157_ma_wb_reg = (uint8_t)(((uint64_t)(n65_ex_wb_reg)));
+      nx_n158_ma_wb_mux = (uint8_t)(((uint64_t)(n64_ex_wb_mux)));
+      nx_n159_ma_wb_en = (uint8_t)(((uint64_t)(((((uint64_t)(n66_ex_wb_en)) != 0) && (((uint64_t)((((uint64_t)(n79_trap_go)) == 0))) != 0)))));
+    }
+  }
+}
+
+void Vcpu::p776_() {  // always@9468
+  if (((uint64_t)(i_rst))) {
+    nx_n140_ma1_res = (uint32_t)(0x0ULL);
+    uint64_t t71 = 0x0ULL;
+    nx_n141_ma1_wb_reg = (uint8_t)((t71 & 0x1FULL));
+    uint64_t t72 = 0x0ULL;
+    nx_n142_ma1_wb_en = (uint8_t)((t72 & 0x1ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n140_ma1_res = (uint32_t)(((uint64_t)(n139_ex1_res)));
+      nx_n141_ma1_wb_reg = (uint8_t)(((uint64_t)(n137_ex1_wb_reg)));
+      nx_n142_ma1_wb_en = (uint8_t)(((uint64_t)(((((uint64_t)(n138_ex1_wb_en)) != 0) && (((uint64_t)((((uint64_t)(n79_trap_go)) == 0))) != 0)))));
+    }
+  }
+}
+
+void Vcpu::p778_() {  // always@9495
+  if (((uint64_t)(i_rst))) {
+    uint64_t t73 = 0x0ULL;
+    nx_n167_ma_rd_sent = (uint8_t)((t73 & 0x1ULL));
+  } else {
+    nx_n167_ma_rd_sent = (uint8_t)(((uint64_t)(((((uint64_t)(n165_ma_rd_en)) != 0) && (((uint64_t)(i_ready_d)) != 0)))));
+  }
+}
+
+void Vcpu::p779_() {  // always@9503
+  if (((uint64_t)(((((uint64_t)(i_rst)) != 0) || (((uint64_t)(n14_clk_ce)) != 0))))) {
+    uint64_t t74 = 0x0ULL;
+    nx_n168_ma_rd_keep = (uint8_t)((t74 & 0x1ULL));
+    nx_n169_ma_rd_kept = (uint32_t)(0x0ULL);
+  } else {
+    if (((uint64_t)(n167_ma_rd_sent))) {
+      uint64_t t75 = 0x1ULL;
+      nx_n168_ma_rd_keep = (uint8_t)((t75 & 0x1ULL));
+      nx_n169_ma_rd_kept = (uint32_t)(((uint64_t)(i_data_rd_d)));
+    }
+  }
+}
+
+void Vcpu::p799_() {  // always@9588
+  if (((uint64_t)(i_rst))) {
+    nx_n170_wb_wb_d = (uint32_t)(0x0ULL);
+    uint64_t t81 = 0x0ULL;
+    nx_n171_wb_wb_reg = (uint8_t)((t81 & 0x1FULL));
+    uint64_t t82 = 0x0ULL;
+    nx_n172_wb_wb_en = (uint8_t)((t82 & 0x1ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n170_wb_wb_d = (uint32_t)(((uint64_t)(n173_wb_dat_mux)));
+      nx_n171_wb_wb_reg = (uint8_t)(((uint64_t)(n157_ma_wb_reg)));
+      nx_n172_wb_wb_en = (uint8_t)(((uint64_t)(n159_ma_wb_en)));
+    }
+  }
+}
+
+void Vcpu::p800_() {  // always@9616
+  if (((uint64_t)(i_rst))) {
+    nx_n143_wb1_wb_d = (uint32_t)(0x0ULL);
+    uint64_t t83 = 0x0ULL;
+    nx_n144_wb1_wb_reg = (uint8_t)((t83 & 0x1FULL));
+    uint64_t t84 = 0x0ULL;
+    nx_n145_wb1_wb_en = (uint8_t)((t84 & 0x1ULL));
+  } else {
+    if (((uint64_t)(n14_clk_ce))) {
+      nx_n143_wb1_wb_d = (uint32_t)(((uint64_t)(n140_ma1_res)));
+      nx_n144_wb1_wb_reg = (uint8_t)(((uint64_t)(n141_ma1_wb_reg)));
+      nx_n145_wb1_wb_en = (uint8_t)(((uint64_t)(n142_ma1_wb_en)));
+    }
+  }
+}
+
+void Vcpu::p225_() {  // 
+  n462_i = (uint32_t)(0x0ULL);
+  for (int guard_ = 0; guard_ < 100000 && (((uint64_t)((S64(((uint64_t)(n462_i)), 32) < S64(0x20ULL, 32))))); guard_++) {
+    { uint64_t i_ = (uint64_t)S64(((uint64_t)(n462_i)), 32); if (i_ < 32ULL) n457_registers[i_] = (uint32_t)(0x0ULL); }
+    n462_i = (uint32_t)(((((uint64_t)(n462_i)) + 0x1ULL) & 0xFFFFFFFFULL));
+  }
+}
+
+void Vcpu::comb_() {
+  {  // assign@9785
+    o_addr_d = (uint32_t)(((uint64_t)(n152_ma_res)));
+  }
+  {  // assign@9650
+    n174_wb_res = (uint32_t)(((uint64_t)(n170_wb_wb_d)));
+  }
+  {  // assign@9702
+    n175_wb_dat = (uint32_t)(((uint64_t)(n174_wb_res)));
+  }
+  {  // memory_i.i_signed_rd
+    n960_i_signed_rd = (uint8_t)(((uint64_t)((((uint64_t)(((uint64_t)(n154_ma_funct3) >> 2) & 1)) == 0))));
+  }
+  {  // memory_i.i_length
+    n959_i_length = (uint8_t)(((uint64_t)((((uint64_t)(n154_ma_funct3) >> 0) & 0x3ULL))));
+  }
+  {  // memory_i.i_shift
+    n958_i_shift = (uint8_t)(((uint64_t)((((uint64_t)(n152_ma_res) >> 0) & 0x3ULL))));
+  }
+  {  // memory_i.always@6097
+    { uint64_t t79 = ((uint64_t)(n959_i_length));
+    if ((t79 == 0x0ULL)) {
+      n971_we_lenght = (uint8_t)(0x1ULL);
+    } else if ((t79 == 0x1ULL)) {
+      n971_we_lenght = (uint8_t)(0x3ULL);
+    } else if ((t79 == 0x2ULL)) {
+      n971_we_lenght = (uint8_t)(0xFULL);
+    } else {
+      n971_we_lenght = (uint8_t)(0x0ULL);
+    }
+    }
+  }
+  {  // memory_i.always@6109
+    { uint64_t t80 = ((uint64_t)(n958_i_shift));
+    if ((t80 == 0x1ULL)) {
+      n972_we_shifted = (uint8_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n971_we_lenght) >> 0) & 0x7ULL)))) << 1) | ((uint64_t)0x0ULL)))));
+    } else if ((t80 == 0x2ULL)) {
+      n972_we_shifted = (uint8_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n971_we_lenght) >> 0) & 0x3ULL)))) << 2) | ((uint64_t)0x0ULL)))));
+    } else if ((t80 == 0x3ULL)) {
+      n972_we_shifted = (uint8_t)(((uint64_t)(((((uint64_t)((uint64_t)(((uint64_t)(n971_we_lenght) >> 0) & 1))) << 3) | ((uint64_t)0x0ULL)))));
+    } else {
+      n972_we_shifted = (uint8_t)(((uint64_t)(n971_we_lenght)));
+    }
+    }
+  }
+  {  // memory_i.assign@6123
+    n163_ma_we = (uint8_t)(((uint64_t)(n972_we_shifted)));
+  }
+  {  // memory_i.always@6058
+    { uint64_t t77 = ((uint64_t)(n958_i_shift));
+    if ((t77 == 0x1ULL)) {
+      n965_data_wr_shift = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n151_ma_rs2_d) >> 0) & 0xFFFFFFULL)))) << 8) | ((uint64_t)((uint64_t)((((uint64_t)(n151_ma_rs2_d) >> 24) & 0xFFULL))))))));
+    } else if ((t77 == 0x2ULL)) {
+      n965_data_wr_shift = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n151_ma_rs2_d) >> 0) & 0xFFFFULL)))) << 16) | ((uint64_t)((uint64_t)((((uint64_t)(n151_ma_rs2_d) >> 16) & 0xFFFFULL))))))));
+    } else if ((t77 == 0x3ULL)) {
+      n965_data_wr_shift = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n151_ma_rs2_d) >> 0) & 0xFFULL)))) << 24) | ((uint64_t)((uint64_t)((((uint64_t)(n151_ma_rs2_d) >> 8) & 0xFFFFFFULL))))))));
+    } else {
+      n965_data_wr_shift = (uint32_t)(((uint64_t)(n151_ma_rs2_d)));
+    }
+    }
+  }
+  {  // memory_i.assign@6121
+    n162_ma_wr_dat = (uint32_t)(((uint64_t)(n965_data_wr_shift)));
+  }
+  {  // assign@9786
+    o_data_wr_d = (uint32_t)(((uint64_t)(n162_ma_wr_dat)));
+  }
+  {  // memory_i.always@6041
+    { uint64_t t76 = ((uint64_t)(n959_i_length));
+    if ((t76 == 0x0ULL)) {
+      n964_length_mask = (uint32_t)(0xFFULL);
+    } else if ((t76 == 0x1ULL)) {
+      n964_length_mask = (uint32_t)(0xFFFFULL);
+    } else if ((t76 == 0x2ULL)) {
+      n964_length_mask = (uint32_t)(0xFFFFFFFFULL);
+    } else {
+      n964_length_mask = (uint32_t)(0x0ULL);
+    }
+    }
+  }
+  {  // assign@9513
+    n166_ma_rd_bus = (uint32_t)(((((uint64_t)(n168_ma_rd_keep))) ? ((uint64_t)(n169_ma_rd_kept)) : ((uint64_t)(i_data_rd_d))));
+  }
+  {  // memory_i.always@6077
+    { uint64_t t78 = ((uint64_t)(n958_i_shift));
+    if ((t78 == 0x1ULL)) {
+      n966_data_rd_shift = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n166_ma_rd_bus) >> 0) & 0xFFULL)))) << 24) | ((uint64_t)((uint64_t)((((uint64_t)(n166_ma_rd_bus) >> 8) & 0xFFFFFFULL))))))));
+    } else if ((t78 == 0x2ULL)) {
+      n966_data_rd_shift = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n166_ma_rd_bus) >> 0) & 0xFFFFULL)))) << 16) | ((uint64_t)((uint64_t)((((uint64_t)(n166_ma_rd_bus) >> 16) & 0xFFFFULL))))))));
+    } else if ((t78 == 0x3ULL)) {
+      n966_data_rd_shift = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n166_ma_rd_bus) >> 0) & 0xFFFFFFULL)))) << 8) | ((uint64_t)((uint64_t)((((uint64_t)(n166_ma_rd_bus) >> 24) & 0xFFULL))))))));
+    } else {
+      n966_data_rd_shift = (uint32_t)(((uint64_t)(n166_ma_rd_bus)));
+    }
+    }
+  }
+  {  // memory_i.assign@6087
+    n968_sign_bit = (uint8_t)(((((uint64_t)(((uint64_t)(n959_i_length) >> 0) & 1))) ? ((uint64_t)(((uint64_t)(n966_data_rd_shift) >> 15) & 1)) : ((uint64_t)(((uint64_t)(n966_data_rd_shift) >> 7) & 1))));
+  }
+  {  // memory_i.assign@6088
+    n969_sign_extension = (uint32_t)(((((uint64_t)(((((uint64_t)(n968_sign_bit)) != 0) && (((uint64_t)(n960_i_signed_rd)) != 0))))) ? (~((uint64_t)(n964_length_mask)) & 0xFFFFFFFFULL) : 0x0ULL));
+  }
+  {  // memory_i.assign@6086
+    n967_data_rd_short = (uint32_t)((((uint64_t)(n966_data_rd_shift)) & ((uint64_t)(n964_length_mask))));
+  }
+  {  // memory_i.assign@6089
+    n970_data_rd_signed = (uint32_t)((((uint64_t)(n967_data_rd_short)) | ((uint64_t)(n969_sign_extension))));
+  }
+  {  // memory_i.assign@6122
+    n160_ma_rd_dat = (uint32_t)(((uint64_t)(n970_data_rd_signed)));
+  }
+  {  // assign@9569
+    n161_ma_ld_dat = (uint32_t)(((uint64_t)(n160_ma_rd_dat)));
+  }
+  {  // always@9708
+    { uint64_t t85 = ((uint64_t)(n158_ma_wb_mux));
+    if ((t85 == 0x1ULL)) {
+      n173_wb_dat_mux = (uint32_t)(((uint64_t)(n161_ma_ld_dat)));
+    } else if ((t85 == 0x2ULL)) {
+      n173_wb_dat_mux = (uint32_t)(((uint64_t)(n153_ma_ret)));
+    } else {
+      n173_wb_dat_mux = (uint32_t)(((uint64_t)(n152_ma_res)));
+    }
+    }
+  }
+  {  // assign@9413
+    n81_trap_br_addr = (uint32_t)(0x0ULL);
+  }
+  {  // assign@9412
+    n80_trap_br_en = (uint8_t)(0x0ULL);
+  }
+  {  // assign@9411
+    n79_trap_go = (uint8_t)(0x0ULL);
+  }
+  {  // assign@9366
+    n179_csr_rd = (uint8_t)(((uint64_t)(((((uint64_t)(n68_ex_system)) != 0) && (((uint64_t)((((uint64_t)(n65_ex_wb_reg)) != 0x0ULL))) != 0)))));
+  }
+  {  // assign@9365
+    n178_csr_wr_en = (uint8_t)(((uint64_t)(((((uint64_t)(n68_ex_system)) != 0) && (((uint64_t)((((uint64_t)(n79_trap_go)) == 0))) != 0)))));
+  }
+  {  // assign@9370
+    n182_csr_clr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n178_csr_wr_en)) != 0) && (((uint64_t)((((uint64_t)((((uint64_t)(n55_ex_funct3) >> 0) & 0x3ULL))) == 0x3ULL))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n67_ex_rs1)) != 0x0ULL))) != 0)))));
+  }
+  {  // assign@9368
+    n181_csr_set = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n178_csr_wr_en)) != 0) && (((uint64_t)((((uint64_t)((((uint64_t)(n55_ex_funct3) >> 0) & 0x3ULL))) == 0x2ULL))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n67_ex_rs1)) != 0x0ULL))) != 0)))));
+  }
+  {  // assign@9367
+    n180_csr_wr = (uint8_t)(((uint64_t)(((((uint64_t)(n178_csr_wr_en)) != 0) && (((uint64_t)((((uint64_t)((((uint64_t)(n55_ex_funct3) >> 0) & 0x3ULL))) == 0x1ULL))) != 0)))));
+  }
+  {  // assign@9362
+    n177_csr_wr_data = (uint32_t)(((((uint64_t)(((uint64_t)(n55_ex_funct3) >> 2) & 1))) ? ((uint64_t)(((((uint64_t)0x0ULL) << 5) | ((uint64_t)((uint64_t)(n67_ex_rs1)))))) : ((uint64_t)(n50_ex_rs1_d))));
+  }
+  {  // csr_i.i_addr
+    n907_i_addr = (uint16_t)(((uint64_t)((((uint64_t)(n52_ex_imm) >> 0) & 0xFFFULL))));
+  }
+  {  // csr_i.counters_i.cnt[6].counter.assign@7553
+    { uint64_t i_ = (uint64_t)S64(0x6ULL, 32); if (i_ < 7ULL) n932_count[i_] = (uint64_t)(((uint64_t)(n954_value))); }
+  }
+  {  // csr_i.counters_i.cnt[5].counter.assign@7553
+    { uint64_t i_ = (uint64_t)S64(0x5ULL, 32); if (i_ < 7ULL) n932_count[i_] = (uint64_t)(((uint64_t)(n952_value))); }
+  }
+  {  // csr_i.counters_i.cnt[4].counter.assign@7553
+    { uint64_t i_ = (uint64_t)S64(0x4ULL, 32); if (i_ < 7ULL) n932_count[i_] = (uint64_t)(((uint64_t)(n950_value))); }
+  }
+  {  // csr_i.counters_i.cnt[3].counter.assign@7553
+    { uint64_t i_ = (uint64_t)S64(0x3ULL, 32); if (i_ < 7ULL) n932_count[i_] = (uint64_t)(((uint64_t)(n948_value))); }
+  }
+  {  // csr_i.counters_i.cnt[2].counter.assign@7553
+    { uint64_t i_ = (uint64_t)S64(0x2ULL, 32); if (i_ < 7ULL) n932_count[i_] = (uint64_t)(((uint64_t)(n946_value))); }
+  }
+  {  // csr_i.counters_i.cnt[1].time_alias.assign@7530
+    { uint64_t i_ = (uint64_t)S64(0x1ULL, 32); if (i_ < 7ULL) n932_count[i_] = (uint64_t)(0x0ULL); }
+  }
+  {  // csr_i.counters_i.cnt[0].counter.assign@7553
+    { uint64_t i_ = (uint64_t)S64(0x0ULL, 32); if (i_ < 7ULL) n932_count[i_] = (uint64_t)(((uint64_t)(n944_value))); }
+  }
+  {  // csr_i.counters_i.assign@7517
+    n938_sel_inhibit = (uint8_t)(((uint64_t)((((uint64_t)(n907_i_addr)) == 0x320ULL))));
+  }
+  {  // csr_i.counters_i.assign@7515
+    n936_sel_user = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n907_i_addr) >> 8) & 0xFULL))) == 0xCULL))));
+  }
+  {  // csr_i.counters_i.assign@7514
+    n935_sel_machine = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n907_i_addr) >> 8) & 0xFULL))) == 0xBULL))));
+  }
+  {  // csr_i.counters_i.assign@7516
+    n937_sel_count = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n935_sel_machine)) != 0) || (((uint64_t)(n936_sel_user)) != 0)))) != 0) && (((uint64_t)((((uint64_t)((((uint64_t)(n907_i_addr) >> 5) & 0x3ULL))) == 0x0ULL))) != 0)))));
+  }
+  {  // csr_i.counters_i.assign@7513
+    n934_index = (uint8_t)(((uint64_t)((((uint64_t)(n907_i_addr) >> 0) & 0x1FULL))));
+  }
+  {  // csr_i.counters_i.assign@7571
+    n942_rd_index = (uint8_t)(((((uint64_t)((((uint64_t)(n934_index)) == 0x1ULL)))) ? 0x0ULL : ((uint64_t)((((uint64_t)(n934_index) >> 0) & 0x7ULL)))));
+  }
+  {  // csr_i.counters_i.assign@7572
+    n943_rd_count = (uint64_t)(((((uint64_t)((((uint64_t)(n934_index)) < 0x7ULL)))) ? ((uint64_t)(((uint64_t)(((uint64_t)(n942_rd_index))) < 7ULL ? n932_count[(uint64_t)(((uint64_t)(n942_rd_index)))] : 0))) : 0x0ULL));
+  }
+  {  // csr_i.counters_i.assign@7518
+    n939_sel_event = (uint8_t)(((uint64_t)(((((uint64_t)((((uint64_t)((((uint64_t)(n907_i_addr) >> 5) & 0x7FULL))) == 0x19ULL))) != 0) && (((uint64_t)((((uint64_t)(n934_index)) >= 0x3ULL))) != 0)))));
+  }
+  {  // csr_i.counters_i.assign@7579
+    n918_cnt_hit = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n937_sel_count)) != 0) || (((uint64_t)(n938_sel_inhibit)) != 0)))) != 0) || (((uint64_t)(n939_sel_event)) != 0)))));
+  }
+  {  // csr_i.counters_i.assign@7574
+    n917_cnt_rd_data = (uint32_t)(((((uint64_t)(n938_sel_inhibit))) ? ((uint64_t)(((((uint64_t)0x0ULL) << 7) | ((uint64_t)((uint64_t)(n933_inhibit)))))) : ((((uint64_t)(n939_sel_event))) ? ((((uint64_t)((((uint64_t)(n934_index)) < 0x7ULL)))) ? ((uint64_t)(((((uint64_t)0x0ULL) << 5) | ((uint64_t)((uint64_t)(n934_index)))))) : 0x0ULL) : ((((uint64_t)(((uint64_t)(n907_i_addr) >> 7) & 1))) ? ((uint64_t)((((uint64_t)(n943_rd_count) >> 32) & 0xFFFFFFFFULL))) : ((uint64_t)((((uint64_t)(n943_rd_count) >> 0) & 0xFFFFFFFFULL)))))));
+  }
+  {  // csr_i.assign@7036
+    n919_write_enable = (uint8_t)(((((uint64_t)(n180_csr_wr)) | ((uint64_t)(n181_csr_set))) | ((uint64_t)(n182_csr_clr))));
+  }
+  {  // csr_i.assign@7018
+    n914_ext_data = (uint32_t)(0x0ULL);
+  }
+  {  // csr_i.assign@7022
+    n915_cnt_data = (uint32_t)(((((uint64_t)(n918_cnt_hit))) ? ((uint64_t)(n917_cnt_rd_data)) : ((uint64_t)(n914_ext_data))));
+  }
+  {  // csr_i.assign@7030
+    n916_other_data = (uint32_t)(((uint64_t)(n915_cnt_data)));
+  }
+  {  // csr_i.assign@6979
+    n912_misa = (uint32_t)(0x40001104ULL);
+  }
+  {  // csr_i.always@6994
+    { uint64_t t62 = ((uint64_t)(n907_i_addr));
+    if ((t62 == 0x301ULL)) {
+      n913_read_data = (uint32_t)(((uint64_t)(n912_misa)));
+    } else if ((t62 == 0xF11ULL)) {
+      n913_read_data = (uint32_t)(0x2D1BC3B7ULL);
+    } else if ((t62 == 0xF12ULL)) {
+      n913_read_data = (uint32_t)(0x2D1BC3B7ULL);
+    } else if ((t62 == 0xF13ULL)) {
+      n913_read_data = (uint32_t)(0x2D1BC3B7ULL);
+    } else if ((t62 == 0xF14ULL)) {
+      n913_read_data = (uint32_t)(0x0ULL);
+    } else {
+      n913_read_data = (uint32_t)(((uint64_t)(n916_other_data)));
+    }
+    }
+  }
+  {  // csr_i.assign@7134
+    n176_csr_rd_data = (uint32_t)(((uint64_t)(n913_read_data)));
+  }
+  {  // csr_i.assign@7039
+    n921_clr_data = (uint32_t)((((uint64_t)(n913_read_data)) & (~((uint64_t)(n177_csr_wr_data)) & 0xFFFFFFFFULL)));
+  }
+  {  // csr_i.assign@7038
+    n920_set_data = (uint32_t)((((uint64_t)(n913_read_data)) | ((uint64_t)(n177_csr_wr_data))));
+  }
+  {  // csr_i.assign@7041
+    n922_write_data = (uint32_t)(((((uint64_t)(n180_csr_wr))) ? ((uint64_t)(n177_csr_wr_data)) : ((((uint64_t)(n181_csr_set))) ? ((uint64_t)(n920_set_data)) : ((((uint64_t)(n182_csr_clr))) ? ((uint64_t)(n921_clr_data)) : 0x0ULL))));
+  }
+  {  // alu_1.i_in_b
+    n863_i_in_b = (uint32_t)(((((uint64_t)(n135_ex1_alu_imm))) ? ((uint64_t)(n130_ex1_imm)) : ((uint64_t)(n129_ex1_rs2_d))));
+  }
+  {  // alu_1.i_in_a
+    n862_i_in_a = (uint32_t)(((((uint64_t)(n134_ex1_alu_pc))) ? ((uint64_t)(n131_ex1_pc)) : ((uint64_t)(n128_ex1_rs1_d))));
+  }
+  {  // alu_1.shifter_i.i_in_b
+    n883_i_in_b = (uint8_t)(((uint64_t)((((uint64_t)(n863_i_in_b) >> 0) & 0x1FULL))));
+  }
+  {  // alu_1.shifter_i.assign@1050
+    uint64_t t60 = 0x0ULL;
+    n888_o_busy = (uint8_t)((t60 & 0x1ULL));
+  }
+  {  // alu_1.shifter_i.genblk[30].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1EULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x1ULL)))) << 31) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 1) & 0x7FFFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[29].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1DULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x3ULL)))) << 30) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 2) & 0x3FFFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[28].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1CULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x7ULL)))) << 29) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 3) & 0x1FFFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[27].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1BULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0xFULL)))) << 28) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 4) & 0xFFFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[26].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1AULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x1FULL)))) << 27) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 5) & 0x7FFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[25].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x19ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x3FULL)))) << 26) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 6) & 0x3FFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[24].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x18ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x7FULL)))) << 25) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 7) & 0x1FFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[23].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x17ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0xFFULL)))) << 24) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 8) & 0xFFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[22].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x16ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x1FFULL)))) << 23) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 9) & 0x7FFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[21].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x15ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x3FFULL)))) << 22) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 10) & 0x3FFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[20].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x14ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x7FFULL)))) << 21) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 11) & 0x1FFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[19].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x13ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0xFFFULL)))) << 20) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 12) & 0xFFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[18].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x12ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x1FFFULL)))) << 19) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 13) & 0x7FFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[17].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x11ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x3FFFULL)))) << 18) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 14) & 0x3FFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[16].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x10ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x7FFFULL)))) << 17) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 15) & 0x1FFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[15].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xFULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0xFFFFULL)))) << 16) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 16) & 0xFFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[14].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xEULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x1FFFFULL)))) << 15) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 17) & 0x7FFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[13].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xDULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x3FFFFULL)))) << 14) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 18) & 0x3FFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[12].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xCULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x7FFFFULL)))) << 13) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 19) & 0x1FFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[11].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xBULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0xFFFFFULL)))) << 12) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 20) & 0xFFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[10].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xAULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x1FFFFFULL)))) << 11) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 21) & 0x7FFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[9].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x9ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x3FFFFFULL)))) << 10) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 22) & 0x3FFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[8].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x8ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x7FFFFFULL)))) << 9) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 23) & 0x1FFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[7].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x7ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0xFFFFFFULL)))) << 8) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 24) & 0xFFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[6].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x6ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x1FFFFFFULL)))) << 7) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 25) & 0x7FULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[5].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x5ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x3FFFFFFULL)))) << 6) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 26) & 0x3FULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[4].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x4ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x7FFFFFFULL)))) << 5) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 27) & 0x1FULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[3].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x3ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0xFFFFFFFULL)))) << 4) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 28) & 0xFULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[2].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x2ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x1FFFFFFFULL)))) << 3) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 29) & 0x7ULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[1].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x3FFFFFFFULL)))) << 2) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 30) & 0x3ULL)))))))); }
+  }
+  {  // alu_1.shifter_i.genblk[0].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x0ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 0) & 0x7FFFFFFFULL)))) << 1) | ((uint64_t)((uint64_t)((((uint64_t)(n862_i_in_a) >> 31) & 0x1ULL)))))))); }
+  }
+  {  // alu_1.shifter_i.assign@1034
+    { uint64_t i_ = (uint64_t)S64(0x0ULL, 32); if (i_ < 32ULL) n895_shift_array[i_] = (uint32_t)(((uint64_t)(n862_i_in_a))); }
+  }
+  {  // alu_1.shifter_i.genblk[31].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1FULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x7FFFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[30].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1EULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x3FFFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[29].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1DULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x1FFFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[28].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1CULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0xFFFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[27].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1BULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x7FFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[26].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1AULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x3FFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[25].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x19ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x1FFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[24].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x18ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0xFFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[23].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x17ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x7FFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[22].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x16ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x3FFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[21].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x15ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x1FFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[20].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x14ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0xFFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[19].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x13ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x7FFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[18].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x12ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x3FFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[17].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x11ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x1FFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[16].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x10ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0xFFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[15].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xFULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x7FFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[14].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xEULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x3FFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[13].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xDULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x1FFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[12].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xCULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0xFFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[11].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xBULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x7FFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[10].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xAULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x3FFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[9].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x9ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x1FFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[8].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x8ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0xFFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[7].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x7ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x7FULL); }
+  }
+  {  // alu_1.shifter_i.genblk[6].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x6ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x3FULL); }
+  }
+  {  // alu_1.shifter_i.genblk[5].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x5ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x1FULL); }
+  }
+  {  // alu_1.shifter_i.genblk[4].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x4ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0xFULL); }
+  }
+  {  // alu_1.shifter_i.genblk[3].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x3ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x7ULL); }
+  }
+  {  // alu_1.shifter_i.genblk[2].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x2ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x3ULL); }
+  }
+  {  // alu_1.shifter_i.genblk[1].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x1ULL); }
+  }
+  {  // alu_1.shifter_i.genblk[0].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x0ULL, 32); if (i_ < 32ULL) n892_shift_mask_array[i_] = (uint32_t)(0x0ULL); }
+  }
+  {  // alu_1.shifter_i.assign@996
+    n889_op_sll = (uint8_t)(((uint64_t)(((((uint64_t)(n136_ex1_alu_en)) != 0) && (((uint64_t)((((uint64_t)(n132_ex1_funct3)) == 0x1ULL))) != 0)))));
+  }
+  {  // alu_1.shifter_i.assign@1031
+    n894_shift_amount = (uint8_t)(((((uint64_t)(n889_op_sll))) ? ((uint64_t)(n883_i_in_b)) : ((0x0ULL - ((uint64_t)(n883_i_in_b))) & 0x1FULL)));
+  }
+  {  // alu_1.shifter_i.assign@1038
+    n896_shift_out = (uint32_t)(((uint64_t)(n895_shift_array[((uint64_t)(n894_shift_amount))])));
+  }
+  {  // alu_1.shifter_i.assign@1027
+    n893_shift_mask = (uint32_t)(((uint64_t)(n892_shift_mask_array[((uint64_t)(n894_shift_amount))])));
+  }
+  {  // alu_1.shifter_i.assign@1042
+    n898_shift_srl = (uint32_t)((((uint64_t)(n896_shift_out)) & ((uint64_t)(n893_shift_mask))));
+  }
+  {  // alu_1.shifter_i.assign@1043
+    n899_shift_sra = (uint32_t)((((uint64_t)(n898_shift_srl)) | ((~((uint64_t)(n893_shift_mask)) & 0xFFFFFFFFULL) & ((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n862_i_in_a) >> 31) & 1)))))), 1, 32))))));
+  }
+  {  // alu_1.shifter_i.assign@1041
+    n897_shift_sll = (uint32_t)((((uint64_t)(n896_shift_out)) & (~((uint64_t)(n893_shift_mask)) & 0xFFFFFFFFULL)));
+  }
+  {  // alu_1.assign@7965
+    n877_comp_u = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)((((uint64_t)(((uint64_t)(n862_i_in_a)))) < ((uint64_t)(((uint64_t)(n863_i_in_b))))))))))));
+  }
+  {  // alu_1.assign@7964
+    n876_comp = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)((S64(((uint64_t)(((uint64_t)(n862_i_in_a)))), 32) < S64(((uint64_t)(((uint64_t)(n863_i_in_b)))), 32)))))))));
+  }
+  {  // alu_1.assign@7959
+    n875_logic_and = (uint32_t)((((uint64_t)(n862_i_in_a)) & ((uint64_t)(n863_i_in_b))));
+  }
+  {  // alu_1.assign@7958
+    n874_logic_or = (uint32_t)((((uint64_t)(n862_i_in_a)) | ((uint64_t)(n863_i_in_b))));
+  }
+  {  // alu_1.assign@7957
+    n873_logic_xor = (uint32_t)((((uint64_t)(n862_i_in_a)) ^ ((uint64_t)(n863_i_in_b))));
+  }
+  {  // alu_1.assign@7945
+    n869_funct7_5 = (uint8_t)(((uint64_t)((((uint64_t)(n133_ex1_funct7)) == 0x20ULL))));
+  }
+  {  // alu_1.shifter_i.assign@998
+    n891_op_sra = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n136_ex1_alu_en)) != 0) && (((uint64_t)((((uint64_t)(n132_ex1_funct3)) == 0x5ULL))) != 0)))) != 0) && (((uint64_t)(n869_funct7_5)) != 0)))));
+  }
+  {  // alu_1.shifter_i.assign@997
+    n890_op_srl = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n136_ex1_alu_en)) != 0) && (((uint64_t)((((uint64_t)(n132_ex1_funct3)) == 0x5ULL))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n869_funct7_5)) == 0))) != 0)))));
+  }
+  {  // alu_1.shifter_i.assign@1046
+    n878_shift_result = (uint32_t)(((((uint64_t)((((uint64_t)(n894_shift_amount)) != 0)))) ? ((((uint64_t)(n891_op_sra))) ? ((uint64_t)(n899_shift_sra)) : ((((uint64_t)(n890_op_srl))) ? ((uint64_t)(n898_shift_srl)) : ((uint64_t)(n897_shift_sll)))) : ((uint64_t)(n862_i_in_a))));
+  }
+  {  // alu_1.assign@7950
+    n870_op_subtract = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n136_ex1_alu_en)) != 0) && (((uint64_t)((((uint64_t)(n135_ex1_alu_imm)) == 0))) != 0)))) != 0) && (((uint64_t)(n869_funct7_5)) != 0)))));
+  }
+  {  // alu_1.assign@7951
+    n871_adder_in_b = (uint32_t)(((((uint64_t)(n870_op_subtract))) ? (~((uint64_t)(n863_i_in_b)) & 0xFFFFFFFFULL) : ((uint64_t)(n863_i_in_b))));
+  }
+  {  // alu_1.assign@7952
+    n872_adder_out = (uint32_t)(((((((uint64_t)(n862_i_in_a)) + ((uint64_t)(n871_adder_in_b))) & 0xFFFFFFFFULL) + ((uint64_t)(((((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)(n870_op_subtract))))))) & 0xFFFFFFFFULL));
+  }
+  {  // alu_1.always@7998
+    { uint64_t t61 = (((uint64_t)(n132_ex1_funct3)) & ((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(n136_ex1_alu_en)))))), 1, 3))));
+    if ((t61 == 0x0ULL)) {
+      n879_mux = (uint32_t)(((uint64_t)(n872_adder_out)));
+    } else if ((t61 == 0x1ULL)) {
+      n879_mux = (uint32_t)(((uint64_t)(n878_shift_result)));
+    } else if ((t61 == 0x2ULL)) {
+      n879_mux = (uint32_t)(((uint64_t)(n876_comp)));
+    } else if ((t61 == 0x3ULL)) {
+      n879_mux = (uint32_t)(((uint64_t)(n877_comp_u)));
+    } else if ((t61 == 0x4ULL)) {
+      n879_mux = (uint32_t)(((uint64_t)(n873_logic_xor)));
+    } else if ((t61 == 0x5ULL)) {
+      n879_mux = (uint32_t)(((uint64_t)(n878_shift_result)));
+    } else if ((t61 == 0x6ULL)) {
+      n879_mux = (uint32_t)(((uint64_t)(n874_logic_or)));
+    } else if ((t61 == 0x7ULL)) {
+      n879_mux = (uint32_t)(((uint64_t)(n875_logic_and)));
+    }
+    }
+  }
+  {  // alu_1.assign@8014
+    n139_ex1_res = (uint32_t)(((uint64_t)(n879_mux)));
+  }
+  {  // assign@9192
+    n149_alu_b_mux = (uint32_t)(((((uint64_t)(n60_ex_alu_imm))) ? ((uint64_t)(n52_ex_imm)) : ((uint64_t)(n51_ex_rs2_d))));
+  }
+  {  // assign@9191
+    n148_alu_a_mux = (uint32_t)(((((uint64_t)(n59_ex_alu_pc))) ? ((uint64_t)(n53_ex_pc)) : ((uint64_t)(n50_ex_rs1_d))));
+  }
+  {  // alu_i.muldiv_i.assign@1855
+    n852_div_rem = (uint32_t)(((uint64_t)((((uint64_t)(n843_div_a) >> 32) & 0xFFFFFFFFULL))));
+  }
+  {  // alu_i.muldiv_i.assign@1854
+    n851_div_div = (uint32_t)(((uint64_t)(n845_div_q)));
+  }
+  {  // alu_i.muldiv_i.assign@1856
+    n853_div_res = (uint32_t)(((((uint64_t)(((uint64_t)(n55_ex_funct3) >> 1) & 1))) ? ((uint64_t)(n852_div_rem)) : ((uint64_t)(n851_div_div))));
+  }
+  {  // alu_i.muldiv_i.assign@1848
+    n849_div_busy = (uint8_t)(((uint64_t)((((uint64_t)(((uint64_t)(n846_div_cnt) >> 5) & 1)) == 0))));
+  }
+  {  // alu_i.muldiv_i.assign@1844
+    n848_div_cmp = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n843_div_a) >> 31) & 0xFFFFFFFFULL))) >= ((uint64_t)(n844_div_b))))));
+  }
+  {  // alu_i.muldiv_i.assign@1843
+    n847_div_sub = (uint32_t)(((((uint64_t)((((uint64_t)(n843_div_a) >> 31) & 0xFFFFFFFFULL))) - ((uint64_t)(n844_div_b))) & 0xFFFFFFFFULL));
+  }
+  {  // alu_i.muldiv_i.assign@1689
+    n858_mul_busy = (uint8_t)(((uint64_t)((((uint64_t)(n856_mul_b_reg)) != 0))));
+  }
+  {  // alu_i.muldiv_i.assign@1867
+    n796_md_busy = (uint8_t)(((uint64_t)(((((uint64_t)(n858_mul_busy)) != 0) || (((uint64_t)(n849_div_busy)) != 0)))));
+  }
+  {  // alu_i.muldiv_i.assign@1501
+    n829_div_se = (uint8_t)(((uint64_t)(((((uint64_t)((((uint64_t)(n55_ex_funct3)) == 0x4ULL))) != 0) || (((uint64_t)((((uint64_t)(n55_ex_funct3)) == 0x6ULL))) != 0)))));
+  }
+  {  // alu_i.muldiv_i.assign@1500
+    n828_mul_b_se = (uint8_t)(((uint64_t)((((uint64_t)(n55_ex_funct3)) == 0x1ULL))));
+  }
+  {  // alu_i.muldiv_i.assign@1503
+    n831_b_se = (uint8_t)(((uint64_t)(((((uint64_t)(n828_mul_b_se)) != 0) || (((uint64_t)(n829_div_se)) != 0)))));
+  }
+  {  // alu_i.muldiv_i.assign@1499
+    n827_mul_a_se = (uint8_t)(((uint64_t)(((((uint64_t)((((uint64_t)(n55_ex_funct3)) == 0x1ULL))) != 0) || (((uint64_t)((((uint64_t)(n55_ex_funct3)) == 0x2ULL))) != 0)))));
+  }
+  {  // alu_i.muldiv_i.assign@1502
+    n830_a_se = (uint8_t)(((uint64_t)(((((uint64_t)(n827_mul_a_se)) != 0) || (((uint64_t)(n829_div_se)) != 0)))));
+  }
+  {  // alu_i.muldiv_i.assign@1512
+    n836_rem_s = (uint8_t)(((uint64_t)(((((uint64_t)(n830_a_se)) != 0) && (((uint64_t)(((uint64_t)(n148_alu_a_mux) >> 31) & 1)) != 0)))));
+  }
+  {  // alu_i.muldiv_i.assign@1510
+    n834_mul_s = (uint8_t)((((uint64_t)(((((uint64_t)(n830_a_se)) != 0) && (((uint64_t)(((uint64_t)(n148_alu_a_mux) >> 31) & 1)) != 0)))) ^ ((uint64_t)(((((uint64_t)(n831_b_se)) != 0) && (((uint64_t)(((uint64_t)(n149_alu_b_mux) >> 31) & 1)) != 0))))));
+  }
+  {  // alu_i.muldiv_i.assign@1694
+    n841_mul_q = (uint64_t)(((((uint64_t)(n834_mul_s))) ? (0x0ULL - ((uint64_t)(n857_mul_mul))) : ((uint64_t)(n857_mul_mul))));
+  }
+  {  // alu_i.muldiv_i.assign@1695
+    n842_mul = (uint32_t)(((((uint64_t)((((uint64_t)((((uint64_t)(n55_ex_funct3) >> 0) & 0x3ULL))) != 0)))) ? ((uint64_t)((((uint64_t)(n841_mul_q) >> 32) & 0xFFFFFFFFULL))) : ((uint64_t)((((uint64_t)(n841_mul_q) >> 0) & 0xFFFFFFFFULL)))));
+  }
+  {  // alu_i.muldiv_i.assign@1511
+    n835_div_s = (uint8_t)(((uint64_t)(n834_mul_s)));
+  }
+  {  // alu_i.muldiv_i.assign@1513
+    n837_div_rem_s = (uint8_t)(((((uint64_t)(((uint64_t)(n55_ex_funct3) >> 1) & 1))) ? ((uint64_t)(n836_rem_s)) : ((uint64_t)(n835_div_s))));
+  }
+  {  // alu_i.muldiv_i.assign@1857
+    n854_div = (uint32_t)(((((uint64_t)(n837_div_rem_s))) ? ((0x0ULL - ((uint64_t)(n853_div_res))) & 0xFFFFFFFFULL) : ((uint64_t)(n853_div_res))));
+  }
+  {  // alu_i.muldiv_i.assign@1862
+    n795_md_result = (uint32_t)(((((uint64_t)(((uint64_t)(n55_ex_funct3) >> 2) & 1))) ? ((uint64_t)(n854_div)) : ((uint64_t)(n842_mul))));
+  }
+  {  // alu_i.muldiv_i.assign@1496
+    n826_in_b_n = (uint32_t)((((~((uint64_t)(n149_alu_b_mux)) & 0xFFFFFFFFULL) + 0x1ULL) & 0xFFFFFFFFULL));
+  }
+  {  // alu_i.muldiv_i.assign@1507
+    n833_b_s = (uint32_t)(((((uint64_t)(((uint64_t)(n149_alu_b_mux) >> 31) & 1))) ? ((uint64_t)(n826_in_b_n)) : ((uint64_t)(n149_alu_b_mux))));
+  }
+  {  // alu_i.muldiv_i.assign@1517
+    n839_in_b = (uint32_t)(((((uint64_t)(n831_b_se))) ? ((uint64_t)(n833_b_s)) : ((uint64_t)(n149_alu_b_mux))));
+  }
+  {  // alu_i.muldiv_i.assign@1495
+    n825_in_a_n = (uint32_t)((((~((uint64_t)(n148_alu_a_mux)) & 0xFFFFFFFFULL) + 0x1ULL) & 0xFFFFFFFFULL));
+  }
+  {  // alu_i.muldiv_i.assign@1506
+    n832_a_s = (uint32_t)(((((uint64_t)(((uint64_t)(n148_alu_a_mux) >> 31) & 1))) ? ((uint64_t)(n825_in_a_n)) : ((uint64_t)(n148_alu_a_mux))));
+  }
+  {  // alu_i.muldiv_i.assign@1516
+    n838_in_a = (uint32_t)(((((uint64_t)(n830_a_se))) ? ((uint64_t)(n832_a_s)) : ((uint64_t)(n148_alu_a_mux))));
+  }
+  {  // alu_i.shifter_i.i_in_b
+    n800_i_in_b = (uint8_t)(((uint64_t)((((uint64_t)(n149_alu_b_mux) >> 0) & 0x1FULL))));
+  }
+  {  // alu_i.shifter_i.assign@1050
+    uint64_t t57 = 0x0ULL;
+    n790_shift_busy = (uint8_t)((t57 & 0x1ULL));
+  }
+  {  // alu_i.assign@2081
+    n147_alu_busy = (uint8_t)(((uint64_t)(((((uint64_t)(n790_shift_busy)) != 0) || (((uint64_t)(n796_md_busy)) != 0)))));
+  }
+  {  // alu_i.shifter_i.genblk[30].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1EULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x1ULL)))) << 31) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 1) & 0x7FFFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[29].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1DULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x3ULL)))) << 30) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 2) & 0x3FFFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[28].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1CULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x7ULL)))) << 29) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 3) & 0x1FFFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[27].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1BULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0xFULL)))) << 28) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 4) & 0xFFFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[26].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1AULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x1FULL)))) << 27) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 5) & 0x7FFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[25].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x19ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x3FULL)))) << 26) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 6) & 0x3FFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[24].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x18ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x7FULL)))) << 25) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 7) & 0x1FFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[23].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x17ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0xFFULL)))) << 24) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 8) & 0xFFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[22].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x16ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x1FFULL)))) << 23) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 9) & 0x7FFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[21].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x15ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x3FFULL)))) << 22) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 10) & 0x3FFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[20].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x14ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x7FFULL)))) << 21) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 11) & 0x1FFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[19].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x13ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0xFFFULL)))) << 20) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 12) & 0xFFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[18].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x12ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x1FFFULL)))) << 19) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 13) & 0x7FFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[17].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x11ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x3FFFULL)))) << 18) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 14) & 0x3FFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[16].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x10ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x7FFFULL)))) << 17) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 15) & 0x1FFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[15].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xFULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0xFFFFULL)))) << 16) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 16) & 0xFFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[14].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xEULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x1FFFFULL)))) << 15) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 17) & 0x7FFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[13].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xDULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x3FFFFULL)))) << 14) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 18) & 0x3FFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[12].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xCULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x7FFFFULL)))) << 13) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 19) & 0x1FFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[11].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xBULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0xFFFFFULL)))) << 12) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 20) & 0xFFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[10].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0xAULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x1FFFFFULL)))) << 11) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 21) & 0x7FFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[9].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x9ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x3FFFFFULL)))) << 10) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 22) & 0x3FFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[8].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x8ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x7FFFFFULL)))) << 9) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 23) & 0x1FFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[7].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x7ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0xFFFFFFULL)))) << 8) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 24) & 0xFFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[6].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x6ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x1FFFFFFULL)))) << 7) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 25) & 0x7FULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[5].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x5ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x3FFFFFFULL)))) << 6) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 26) & 0x3FULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[4].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x4ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x7FFFFFFULL)))) << 5) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 27) & 0x1FULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[3].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x3ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0xFFFFFFFULL)))) << 4) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 28) & 0xFULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[2].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x2ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x1FFFFFFFULL)))) << 3) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 29) & 0x7ULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[1].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x1ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x3FFFFFFFULL)))) << 2) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 30) & 0x3ULL)))))))); }
+  }
+  {  // alu_i.shifter_i.genblk[0].assign@1036
+    { uint64_t i_ = (uint64_t)S64(((0x0ULL + 0x1ULL) & 0xFFFFFFFFULL), 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 0) & 0x7FFFFFFFULL)))) << 1) | ((uint64_t)((uint64_t)((((uint64_t)(n148_alu_a_mux) >> 31) & 0x1ULL)))))))); }
+  }
+  {  // alu_i.shifter_i.assign@1034
+    { uint64_t i_ = (uint64_t)S64(0x0ULL, 32); if (i_ < 32ULL) n812_shift_array[i_] = (uint32_t)(((uint64_t)(n148_alu_a_mux))); }
+  }
+  {  // alu_i.shifter_i.genblk[31].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1FULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x7FFFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[30].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1EULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x3FFFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[29].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1DULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x1FFFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[28].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1CULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0xFFFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[27].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1BULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x7FFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[26].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1AULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x3FFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[25].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x19ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x1FFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[24].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x18ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0xFFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[23].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x17ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x7FFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[22].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x16ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x3FFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[21].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x15ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x1FFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[20].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x14ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0xFFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[19].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x13ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x7FFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[18].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x12ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x3FFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[17].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x11ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x1FFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[16].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x10ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0xFFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[15].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xFULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x7FFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[14].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xEULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x3FFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[13].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xDULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x1FFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[12].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xCULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0xFFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[11].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xBULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x7FFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[10].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0xAULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x3FFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[9].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x9ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x1FFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[8].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x8ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0xFFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[7].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x7ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x7FULL); }
+  }
+  {  // alu_i.shifter_i.genblk[6].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x6ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x3FULL); }
+  }
+  {  // alu_i.shifter_i.genblk[5].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x5ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x1FULL); }
+  }
+  {  // alu_i.shifter_i.genblk[4].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x4ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0xFULL); }
+  }
+  {  // alu_i.shifter_i.genblk[3].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x3ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x7ULL); }
+  }
+  {  // alu_i.shifter_i.genblk[2].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x2ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x3ULL); }
+  }
+  {  // alu_i.shifter_i.genblk[1].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x1ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x1ULL); }
+  }
+  {  // alu_i.shifter_i.genblk[0].assign@1025
+    { uint64_t i_ = (uint64_t)S64(0x0ULL, 32); if (i_ < 32ULL) n809_shift_mask_array[i_] = (uint32_t)(0x0ULL); }
+  }
+  {  // alu_i.assign@1983
+    n787_comp_u = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)((((uint64_t)(((uint64_t)(n148_alu_a_mux)))) < ((uint64_t)(((uint64_t)(n149_alu_b_mux))))))))))));
+  }
+  {  // alu_i.assign@1982
+    n786_comp = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)((S64(((uint64_t)(((uint64_t)(n148_alu_a_mux)))), 32) < S64(((uint64_t)(((uint64_t)(n149_alu_b_mux)))), 32)))))))));
+  }
+  {  // alu_i.assign@1974
+    n785_logic_and = (uint32_t)((((uint64_t)(n148_alu_a_mux)) & ((uint64_t)(n149_alu_b_mux))));
+  }
+  {  // alu_i.assign@1973
+    n784_logic_or = (uint32_t)((((uint64_t)(n148_alu_a_mux)) | ((uint64_t)(n149_alu_b_mux))));
+  }
+  {  // alu_i.assign@1972
+    n783_logic_xor = (uint32_t)((((uint64_t)(n148_alu_a_mux)) ^ ((uint64_t)(n149_alu_b_mux))));
+  }
+  {  // alu_i.assign@1959
+    n793_funct7_0 = (uint8_t)(((uint64_t)((((uint64_t)(n56_ex_funct7)) == 0x1ULL))));
+  }
+  {  // alu_i.assign@2073
+    n794_md_en = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n793_funct7_0)) != 0) && (((uint64_t)(n61_ex_alu_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n60_ex_alu_imm)) == 0))) != 0)))));
+  }
+  {  // alu_i.muldiv_i.assign@1518
+    n840_md_en = (uint8_t)(((uint64_t)(n794_md_en)));
+  }
+  {  // alu_i.muldiv_i.assign@1849
+    n850_div_en = (uint8_t)(((uint64_t)(((((uint64_t)(n840_md_en)) != 0) && (((uint64_t)(((uint64_t)(n55_ex_funct3) >> 2) & 1)) != 0)))));
+  }
+  {  // alu_i.muldiv_i.assign@1690
+    n859_mul_en = (uint8_t)(((uint64_t)(((((uint64_t)(n840_md_en)) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n55_ex_funct3) >> 2) & 1)) == 0))) != 0)))));
+  }
+  {  // alu_i.assign@2007
+    n789_shift_en = (uint8_t)(((uint64_t)(((((uint64_t)(n61_ex_alu_en)) != 0) && (((uint64_t)((((uint64_t)(n794_md_en)) == 0))) != 0)))));
+  }
+  {  // alu_i.shifter_i.assign@996
+    n806_op_sll = (uint8_t)(((uint64_t)(((((uint64_t)(n789_shift_en)) != 0) && (((uint64_t)((((uint64_t)(n55_ex_funct3)) == 0x1ULL))) != 0)))));
+  }
+  {  // alu_i.shifter_i.assign@1031
+    n811_shift_amount = (uint8_t)(((((uint64_t)(n806_op_sll))) ? ((uint64_t)(n800_i_in_b)) : ((0x0ULL - ((uint64_t)(n800_i_in_b))) & 0x1FULL)));
+  }
+  {  // alu_i.shifter_i.assign@1038
+    n813_shift_out = (uint32_t)(((uint64_t)(n812_shift_array[((uint64_t)(n811_shift_amount))])));
+  }
+  {  // alu_i.shifter_i.assign@1027
+    n810_shift_mask = (uint32_t)(((uint64_t)(n809_shift_mask_array[((uint64_t)(n811_shift_amount))])));
+  }
+  {  // alu_i.shifter_i.assign@1042
+    n815_shift_srl = (uint32_t)((((uint64_t)(n813_shift_out)) & ((uint64_t)(n810_shift_mask))));
+  }
+  {  // alu_i.shifter_i.assign@1043
+    n816_shift_sra = (uint32_t)((((uint64_t)(n815_shift_srl)) | ((~((uint64_t)(n810_shift_mask)) & 0xFFFFFFFFULL) & ((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n148_alu_a_mux) >> 31) & 1)))))), 1, 32))))));
+  }
+  {  // alu_i.shifter_i.assign@1041
+    n814_shift_sll = (uint32_t)((((uint64_t)(n813_shift_out)) & (~((uint64_t)(n810_shift_mask)) & 0xFFFFFFFFULL)));
+  }
+  {  // alu_i.assign@1957
+    n779_funct7_5 = (uint8_t)(((uint64_t)((((uint64_t)(n56_ex_funct7)) == 0x20ULL))));
+  }
+  {  // alu_i.shifter_i.assign@998
+    n808_op_sra = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n789_shift_en)) != 0) && (((uint64_t)((((uint64_t)(n55_ex_funct3)) == 0x5ULL))) != 0)))) != 0) && (((uint64_t)(n779_funct7_5)) != 0)))));
+  }
+  {  // alu_i.shifter_i.assign@997
+    n807_op_srl = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n789_shift_en)) != 0) && (((uint64_t)((((uint64_t)(n55_ex_funct3)) == 0x5ULL))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n779_funct7_5)) == 0))) != 0)))));
+  }
+  {  // alu_i.shifter_i.assign@1046
+    n788_shift_result = (uint32_t)(((((uint64_t)((((uint64_t)(n811_shift_amount)) != 0)))) ? ((((uint64_t)(n808_op_sra))) ? ((uint64_t)(n816_shift_sra)) : ((((uint64_t)(n807_op_srl))) ? ((uint64_t)(n815_shift_srl)) : ((uint64_t)(n814_shift_sll)))) : ((uint64_t)(n148_alu_a_mux))));
+  }
+  {  // alu_i.assign@1965
+    n780_op_subtract = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n61_ex_alu_en)) != 0) && (((uint64_t)((((uint64_t)(n60_ex_alu_imm)) == 0))) != 0)))) != 0) && (((uint64_t)(n779_funct7_5)) != 0)))));
+  }
+  {  // alu_i.assign@1966
+    n781_adder_in_b = (uint32_t)(((((uint64_t)(n780_op_subtract))) ? (~((uint64_t)(n149_alu_b_mux)) & 0xFFFFFFFFULL) : ((uint64_t)(n149_alu_b_mux))));
+  }
+  {  // alu_i.assign@1967
+    n782_adder_out = (uint32_t)(((((((uint64_t)(n148_alu_a_mux)) + ((uint64_t)(n781_adder_in_b))) & 0xFFFFFFFFULL) + ((uint64_t)(((((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)(n780_op_subtract))))))) & 0xFFFFFFFFULL));
+  }
+  {  // alu_i.always@2018
+    { uint64_t t58 = (((uint64_t)(n55_ex_funct3)) & ((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(n61_ex_alu_en)))))), 1, 3))));
+    if ((t58 == 0x0ULL)) {
+      n791_mux = (uint32_t)(((uint64_t)(n782_adder_out)));
+    } else if ((t58 == 0x1ULL)) {
+      n791_mux = (uint32_t)(((uint64_t)(n788_shift_result)));
+    } else if ((t58 == 0x2ULL)) {
+      n791_mux = (uint32_t)(((uint64_t)(n786_comp)));
+    } else if ((t58 == 0x3ULL)) {
+      n791_mux = (uint32_t)(((uint64_t)(n787_comp_u)));
+    } else if ((t58 == 0x4ULL)) {
+      n791_mux = (uint32_t)(((uint64_t)(n783_logic_xor)));
+    } else if ((t58 == 0x5ULL)) {
+      n791_mux = (uint32_t)(((uint64_t)(n788_shift_result)));
+    } else if ((t58 == 0x6ULL)) {
+      n791_mux = (uint32_t)(((uint64_t)(n784_logic_or)));
+    } else if ((t58 == 0x7ULL)) {
+      n791_mux = (uint32_t)(((uint64_t)(n785_logic_and)));
+    }
+    }
+  }
+  {  // alu_i.assign@2048
+    n792_alu_result = (uint32_t)(((uint64_t)(n791_mux)));
+  }
+  {  // alu_i.assign@2082
+    n146_alu_out = (uint32_t)(((((uint64_t)(n794_md_en))) ? ((uint64_t)(n795_md_result)) : ((uint64_t)(n792_alu_result))));
+  }
+  {  // assign@9482
+    n150_ex_res_dat = (uint32_t)(((((uint64_t)(n68_ex_system))) ? ((uint64_t)(n176_csr_rd_data)) : ((uint64_t)(n146_alu_out))));
+  }
+  {  // branch_i.assign@2427
+    n765_lower_u = (uint8_t)(((uint64_t)((((uint64_t)(((uint64_t)(n50_ex_rs1_d)))) < ((uint64_t)(((uint64_t)(n51_ex_rs2_d))))))));
+  }
+  {  // branch_i.assign@2426
+    n764_lower = (uint8_t)(((uint64_t)((S64(((uint64_t)(((uint64_t)(n50_ex_rs1_d)))), 32) < S64(((uint64_t)(((uint64_t)(n51_ex_rs2_d)))), 32)))));
+  }
+  {  // branch_i.assign@2425
+    n763_equal = (uint8_t)(((uint64_t)((((uint64_t)(n50_ex_rs1_d)) == ((uint64_t)(n51_ex_rs2_d))))));
+  }
+  {  // branch_i.always@2437
+    { uint64_t t55 = ((uint64_t)((((uint64_t)(n55_ex_funct3) >> 1) & 0x3ULL)));
+    if ((t55 == 0x0ULL)) {
+      n766_condition_mux = (uint8_t)(((uint64_t)(n763_equal)));
+    } else if ((t55 == 0x2ULL)) {
+      n766_condition_mux = (uint8_t)(((uint64_t)(n764_lower)));
+    } else if ((t55 == 0x3ULL)) {
+      n766_condition_mux = (uint8_t)(((uint64_t)(n765_lower_u)));
+    } else {
+      uint64_t t56 = 0x0ULL;
+      n766_condition_mux = (uint8_t)((t56 & 0x1ULL));
+    }
+    }
+  }
+  {  // branch_i.assign@2446
+    n767_condition = (uint8_t)((((uint64_t)(n766_condition_mux)) ^ ((uint64_t)(((uint64_t)(n55_ex_funct3) >> 0) & 1))));
+  }
+  {  // branch_i.assign@2452
+    n768_br_en = (uint8_t)(((uint64_t)(((((uint64_t)(n57_ex_jump)) != 0) || (((uint64_t)(((((uint64_t)(n58_ex_branch)) != 0) && (((uint64_t)(n767_condition)) != 0)))) != 0)))));
+  }
+  {  // branch_i.assign@2457
+    n73_br_en = (uint8_t)(((uint64_t)(n768_br_en)));
+  }
+  {  // assign@9160
+    n74_br_take = (uint8_t)(((uint64_t)(((((uint64_t)(n73_br_en)) != 0) && (((uint64_t)((((uint64_t)(n85_ex_jal_done)) == 0))) != 0)))));
+  }
+  {  // assign@9145
+    n76_br_addr = (uint32_t)(((((uint64_t)(n73_br_en))) ? ((uint64_t)(n146_alu_out)) : ((uint64_t)(n54_ex_ret))));
+  }
+  {  // assign@9144
+    n96_br_pred_miss = (uint8_t)(((((uint64_t)(n70_ex_pred))) ? ((uint64_t)(((((uint64_t)((((uint64_t)(n73_br_en)) == 0))) != 0) || (((uint64_t)((((uint64_t)(n146_alu_out)) != ((uint64_t)(n71_ex_pred_addr))))) != 0)))) : ((uint64_t)(n74_br_take))));
+  }
+  {  // assign@9153
+    n75_br_miss = (uint8_t)(((((uint64_t)(n94_ex_ras_pred))) ? ((uint64_t)((((uint64_t)(n146_alu_out)) != ((uint64_t)(n95_ex_ras_addr))))) : ((uint64_t)(n96_br_pred_miss))));
+  }
+  {  // hazard_1.assign@5595
+    uint64_t t28 = 0x0ULL;
+    n755_hz_ma_ld = (uint8_t)((t28 & 0x1ULL));
+  }
+  {  // decoder_1.decoder_1.bm_illegal=init
+    n616_bm_illegal = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.fp_hz_rs2=init
+    n615_fp_hz_rs2 = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.fp_store=init
+    n614_fp_store = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.fp_load=init
+    n613_fp_load = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.fpu_en=init
+    n612_fpu_en = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.atomic_wr=init
+    n611_atomic_wr = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.atomic_rd=init
+    n610_atomic_rd = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.op_atomic=init
+    n609_op_atomic = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.op_cfswsp=init
+    n593_op_cfswsp = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.op_cflwsp=init
+    n592_op_cflwsp = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.op_cfsw=init
+    n591_op_cfsw = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_1.decoder_1.op_cflw=init
+    n590_op_cflw = (uint8_t)(0x0ULL);
+  }
+  {  // hazard_i.i_pair_wb_en
+    n491_i_pair_wb_en = (uint8_t)(0x0ULL);
+  }
+  {  // hazard_i.i_pair_rd
+    n490_i_pair_rd = (uint8_t)(0x0ULL);
+  }
+  {  // hazard_i.assign@5595
+    uint64_t t19 = 0x0ULL;
+    n526_hz_ma_ld = (uint8_t)((t19 & 0x1ULL));
+  }
+  {  // regs_i.i_addr_wr2
+    n451_i_addr_wr2 = (uint8_t)(((uint64_t)(n144_wb1_wb_reg)));
+  }
+  {  // regs_i.i_addr_wr
+    n446_i_addr_wr = (uint8_t)(((uint64_t)(n171_wb_wb_reg)));
+  }
+  {  // regs_i.assign@6552
+    n125_id1_rs2_raw_d = (uint32_t)(((uint64_t)(n461_dat_rd_d_reg)));
+  }
+  {  // regs_i.assign@6551
+    n124_id1_rs1_raw_d = (uint32_t)(((uint64_t)(n460_dat_rd_c_reg)));
+  }
+  {  // regs_i.assign@6549
+    n47_rs2_raw_d = (uint32_t)(((uint64_t)(n459_dat_rd_b_reg)));
+  }
+  {  // regs_i.assign@6548
+    n46_rs1_raw_d = (uint32_t)(((uint64_t)(n458_dat_rd_a_reg)));
+  }
+  {  // decoder_i.decoder_i.bm_illegal=init
+    n365_bm_illegal = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.fp_hz_rs2=init
+    n364_fp_hz_rs2 = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.fp_store=init
+    n363_fp_store = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.fp_load=init
+    n362_fp_load = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.fpu_en=init
+    n361_fpu_en = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.atomic_wr=init
+    n360_atomic_wr = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.atomic_rd=init
+    n359_atomic_rd = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.op_atomic=init
+    n358_op_atomic = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.op_cfswsp=init
+    n342_op_cfswsp = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.op_cflwsp=init
+    n341_op_cflwsp = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.op_cfsw=init
+    n340_op_cfsw = (uint8_t)(0x0ULL);
+  }
+  {  // decoder_i.decoder_i.op_cflw=init
+    n339_op_cflw = (uint8_t)(0x0ULL);
+  }
+  {  // fetch_i.assign@4637
+    n20_id_ir = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(n232_q_data[1]))) << 16) | ((uint64_t)((uint64_t)(n232_q_data[0])))))));
+  }
+  {  // decoder_i.decoder_i.immediate_clsp=init
+    n396_immediate_clsp = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 8) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 2) & 0x3ULL)))) << 6) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1))) << 5) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 4) & 0x7ULL)))) << 2) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_cssp=init
+    n395_immediate_cssp = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 8) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 7) & 0x3ULL)))) << 6) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 9) & 0xFULL)))) << 2) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_cb=init
+    n394_immediate_cb = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)))))), 1, 24)))) << 8) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 5) & 0x3ULL)))) << 6) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 2) & 1))) << 5) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 10) & 0x3ULL)))) << 3) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 3) & 0x3ULL)))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_cj=init
+    n393_immediate_cj = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)))))), 1, 21)))) << 11) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 8) & 1))) << 10) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 9) & 0x3ULL)))) << 8) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 6) & 1))) << 7) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 7) & 1))) << 6) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 2) & 1))) << 5) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 11) & 1))) << 4) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 3) & 0x7ULL)))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_cls=init
+    n392_immediate_cls = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 5) & 1)))))), 1, 26)))) << 6) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 10) & 0x7ULL)))) << 3) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 6) & 1))) << 2) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_c16sp=init
+    n391_immediate_c16sp = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)))))), 1, 23)))) << 9) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 3) & 0x3ULL)))) << 7) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 5) & 1))) << 6) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 2) & 1))) << 5) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 6) & 1))) << 4) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_cu=init
+    n390_immediate_cu = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)))))), 1, 15)))) << 17) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 2) & 0x1FULL)))) << 12) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_ci=init
+    n389_immediate_ci = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)))))), 1, 27)))) << 5) | ((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 2) & 0x1FULL))))))));
+  }
+  {  // decoder_i.decoder_i.immediate_ciw=init
+    n388_immediate_ciw = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 10) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 7) & 0xFULL)))) << 6) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 11) & 0x3ULL)))) << 4) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 5) & 1))) << 3) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 6) & 1))) << 2) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_i=init
+    n387_immediate_i = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 31) & 1)))))), 1, 21)))) << 11) | ((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 20) & 0x7FFULL))))))));
+  }
+  {  // decoder_i.decoder_i.immediate_s=init
+    n386_immediate_s = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 31) & 1)))))), 1, 21)))) << 11) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 25) & 0x3FULL)))) << 5) | ((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 7) & 0x1FULL))))))));
+  }
+  {  // decoder_i.decoder_i.immediate_b=init
+    n385_immediate_b = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 31) & 1)))))), 1, 20)))) << 12) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 7) & 1))) << 11) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 25) & 0x3FULL)))) << 5) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 8) & 0xFULL)))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_j=init
+    n384_immediate_j = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 31) & 1)))))), 1, 12)))) << 20) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 12) & 0xFFULL)))) << 12) | (((uint64_t)((uint64_t)(((uint64_t)(n20_id_ir) >> 20) & 1))) << 11) | (((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 21) & 0x3FFULL)))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.immediate_u=init
+    n383_immediate_u = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 12) & 0xFFFFFULL)))) << 12) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_i.decoder_i.quad2=init
+    n323_quad2 = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n20_id_ir) >> 0) & 0x3ULL))) == 0x2ULL))));
+  }
+  {  // decoder_i.decoder_i.quad1=init
+    n322_quad1 = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n20_id_ir) >> 0) & 0x3ULL))) == 0x1ULL))));
+  }
+  {  // decoder_i.decoder_i.quad0=init
+    n321_quad0 = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n20_id_ir) >> 0) & 0x3ULL))) == 0x0ULL))));
+  }
+  {  // decoder_i.decoder_i.quad3=init
+    n309_quad3 = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n20_id_ir) >> 0) & 0x3ULL))) == 0x3ULL))));
+  }
+  {  // decoder_i.decoder_i.funct7_normal=init
+    n439_funct7_normal = (uint8_t)(((uint64_t)(n309_quad3)));
+  }
+  {  // decoder_i.decoder_i.funct3_normal=init
+    n431_funct3_normal = (uint8_t)(((uint64_t)(n309_quad3)));
+  }
+  {  // decoder_i.decoder_i.rd_normal=init
+    n426_rd_normal = (uint8_t)(((uint64_t)(n309_quad3)));
+  }
+  {  // decoder_i.decoder_i.rs2_normal=init
+    n422_rs2_normal = (uint8_t)(((uint64_t)(n309_quad3)));
+  }
+  {  // decoder_i.decoder_i.rs1_normal=init
+    n417_rs1_normal = (uint8_t)(((uint64_t)(n309_quad3)));
+  }
+  {  // decoder_i.decoder_i.funct2l=init
+    n308_funct2l = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 5) & 0x3ULL))));
+  }
+  {  // decoder_i.decoder_i.funct2h=init
+    n307_funct2h = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 10) & 0x3ULL))));
+  }
+  {  // decoder_i.decoder_i.rs2cl=init
+    n306_rs2cl = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 2) & 0x1FULL))));
+  }
+  {  // decoder_i.decoder_i.rs1cl=init
+    n305_rs1cl = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 7) & 0x1FULL))));
+  }
+  {  // decoder_i.decoder_i.rs2cs=init
+    n304_rs2cs = (uint8_t)(((uint64_t)(((((uint64_t)0x1ULL) << 3) | ((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 2) & 0x7ULL))))))));
+  }
+  {  // decoder_i.decoder_i.rs1cs=init
+    n303_rs1cs = (uint8_t)(((uint64_t)(((((uint64_t)0x1ULL) << 3) | ((uint64_t)((uint64_t)((((uint64_t)(n20_id_ir) >> 7) & 0x7ULL))))))));
+  }
+  {  // decoder_i.decoder_i.copcode=init
+    n302_copcode = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 13) & 0x7ULL))));
+  }
+  {  // decoder_i.decoder_i.op_cjr_mv_add=init
+    n338_op_cjr_mv_add = (uint8_t)(((uint64_t)(((((uint64_t)(n323_quad2)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x4ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cebreak=init
+    n357_op_cebreak = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n338_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n306_rs2cl)) == 0))) != 0)))) != 0) && (((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n305_rs1cl)) == 0))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cjalr=init
+    n356_op_cjalr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n338_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n306_rs2cl)) == 0))) != 0)))) != 0) && (((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n305_rs1cl)) != 0))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cjr=init
+    n355_op_cjr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n338_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n306_rs2cl)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)) == 0))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cadd=init
+    n354_op_cadd = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n338_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n306_rs2cl)) != 0))) != 0)))) != 0) && (((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cmv=init
+    n353_op_cmv = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n338_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n306_rs2cl)) != 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n20_id_ir) >> 12) & 1)) == 0))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cswsp=init
+    n337_op_cswsp = (uint8_t)(((uint64_t)(((((uint64_t)(n323_quad2)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x6ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rs2_rs2l=init
+    n424_rs2_rs2l = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n354_op_cadd)) != 0) || (((uint64_t)(n353_op_cmv)) != 0)))) != 0) || (((uint64_t)(n337_op_cswsp)) != 0)))) != 0) || (((uint64_t)(n342_op_cfswsp)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_cssp=init
+    n380_format_cssp = (uint8_t)(((uint64_t)(((((uint64_t)(n337_op_cswsp)) != 0) || (((uint64_t)(n342_op_cfswsp)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_clwsp=init
+    n336_op_clwsp = (uint8_t)(((uint64_t)(((((uint64_t)(n323_quad2)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_clsp=init
+    n381_format_clsp = (uint8_t)(((uint64_t)(((((uint64_t)(n336_op_clwsp)) != 0) || (((uint64_t)(n341_op_cflwsp)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cslli=init
+    n335_op_cslli = (uint8_t)(((uint64_t)(((((uint64_t)(n323_quad2)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cbnez=init
+    n334_op_cbnez = (uint8_t)(((uint64_t)(((((uint64_t)(n322_quad1)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x7ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.funct3_001=init
+    n432_funct3_001 = (uint8_t)(((uint64_t)(((((uint64_t)(n335_op_cslli)) != 0) || (((uint64_t)(n334_op_cbnez)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cbeqz=init
+    n333_op_cbeqz = (uint8_t)(((uint64_t)(((((uint64_t)(n322_quad1)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x6ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_cb=init
+    n379_format_cb = (uint8_t)(((uint64_t)(((((uint64_t)(n333_op_cbeqz)) != 0) || (((uint64_t)(n334_op_cbnez)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cj=init
+    n332_op_cj = (uint8_t)(((uint64_t)(((((uint64_t)(n322_quad1)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x5ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_calu=init
+    n331_op_calu = (uint8_t)(((uint64_t)(((((uint64_t)(n322_quad1)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x4ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_caryth=init
+    n348_op_caryth = (uint8_t)(((uint64_t)(((((uint64_t)(n331_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n307_funct2h)) == 0x3ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cand=init
+    n352_op_cand = (uint8_t)(((uint64_t)(((((uint64_t)(n348_op_caryth)) != 0) && (((uint64_t)((((uint64_t)(n308_funct2l)) == 0x3ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cor=init
+    n351_op_cor = (uint8_t)(((uint64_t)(((((uint64_t)(n348_op_caryth)) != 0) && (((uint64_t)((((uint64_t)(n308_funct2l)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.funct3_110=init
+    n436_funct3_110 = (uint8_t)(((uint64_t)(n351_op_cor)));
+  }
+  {  // decoder_i.decoder_i.op_cxor=init
+    n350_op_cxor = (uint8_t)(((uint64_t)(((((uint64_t)(n348_op_caryth)) != 0) && (((uint64_t)((((uint64_t)(n308_funct2l)) == 0x1ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.funct3_100=init
+    n434_funct3_100 = (uint8_t)(((uint64_t)(n350_op_cxor)));
+  }
+  {  // decoder_i.decoder_i.op_csub=init
+    n349_op_csub = (uint8_t)(((uint64_t)(((((uint64_t)(n348_op_caryth)) != 0) && (((uint64_t)((((uint64_t)(n308_funct2l)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_candi=init
+    n347_op_candi = (uint8_t)(((uint64_t)(((((uint64_t)(n331_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n307_funct2h)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.funct3_111=init
+    n437_funct3_111 = (uint8_t)(((uint64_t)(((((uint64_t)(n347_op_candi)) != 0) || (((uint64_t)(n352_op_cand)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_csrai=init
+    n346_op_csrai = (uint8_t)(((uint64_t)(((((uint64_t)(n331_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n307_funct2h)) == 0x1ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.funct7_5=init
+    n440_funct7_5 = (uint8_t)(((uint64_t)(((((uint64_t)(n346_op_csrai)) != 0) || (((uint64_t)(n349_op_csub)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_csrli=init
+    n345_op_csrli = (uint8_t)(((uint64_t)(((((uint64_t)(n331_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n307_funct2h)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.funct3_101=init
+    n435_funct3_101 = (uint8_t)(((uint64_t)(((((uint64_t)(n346_op_csrai)) != 0) || (((uint64_t)(n345_op_csrli)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rd_rs1s=init
+    n429_rd_rs1s = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n346_op_csrai)) != 0) || (((uint64_t)(n345_op_csrli)) != 0)))) != 0) || (((uint64_t)(n347_op_candi)) != 0)))) != 0) || (((uint64_t)(n348_op_caryth)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_clui_a16sp=init
+    n330_op_clui_a16sp = (uint8_t)(((uint64_t)(((((uint64_t)(n322_quad1)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x3ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_clui=init
+    n344_op_clui = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n330_op_clui_a16sp)) != 0) && (((uint64_t)((((uint64_t)(n305_rs1cl)) != 0x2ULL))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n305_rs1cl)) != 0))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_cu=init
+    n375_format_cu = (uint8_t)(((uint64_t)(n344_op_clui)));
+  }
+  {  // decoder_i.decoder_i.op_caddi16sp=init
+    n343_op_caddi16sp = (uint8_t)(((uint64_t)(((((uint64_t)(n330_op_clui_a16sp)) != 0) && (((uint64_t)((((uint64_t)(n305_rs1cl)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_c16sp=init
+    n376_format_c16sp = (uint8_t)(((uint64_t)(n343_op_caddi16sp)));
+  }
+  {  // decoder_i.decoder_i.op_cli=init
+    n329_op_cli = (uint8_t)(((uint64_t)(((((uint64_t)(n322_quad1)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_cjal=init
+    n328_op_cjal = (uint8_t)(((uint64_t)(((((uint64_t)(n322_quad1)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x1ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_cj=init
+    n378_format_cj = (uint8_t)(((uint64_t)(((((uint64_t)(n332_op_cj)) != 0) || (((uint64_t)(n328_op_cjal)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_caddi=init
+    n327_op_caddi = (uint8_t)(((uint64_t)(((((uint64_t)(n322_quad1)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rd_rs1l=init
+    n428_rd_rs1l = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n343_op_caddi16sp)) != 0) || (((uint64_t)(n327_op_caddi)) != 0)))) != 0) || (((uint64_t)(n329_op_cli)) != 0)))) != 0) || (((uint64_t)(n344_op_clui)) != 0)))) != 0) || (((uint64_t)(n335_op_cslli)) != 0)))) != 0) || (((uint64_t)(n354_op_cadd)) != 0)))) != 0) || (((uint64_t)(n353_op_cmv)) != 0)))) != 0) || (((uint64_t)(n336_op_clwsp)) != 0)))) != 0) || (((uint64_t)(n341_op_cflwsp)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rs1_rs1l=init
+    n419_rs1_rs1l = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n343_op_caddi16sp)) != 0) || (((uint64_t)(n327_op_caddi)) != 0)))) != 0) || (((uint64_t)(n335_op_cslli)) != 0)))) != 0) || (((uint64_t)(n355_op_cjr)) != 0)))) != 0) || (((uint64_t)(n356_op_cjalr)) != 0)))) != 0) || (((uint64_t)(n354_op_cadd)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_ci=init
+    n374_format_ci = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n327_op_caddi)) != 0) || (((uint64_t)(n329_op_cli)) != 0)))) != 0) || (((uint64_t)(n347_op_candi)) != 0)))) != 0) || (((uint64_t)(n335_op_cslli)) != 0)))) != 0) || (((uint64_t)(n346_op_csrai)) != 0)))) != 0) || (((uint64_t)(n345_op_csrli)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_csw=init
+    n326_op_csw = (uint8_t)(((uint64_t)(((((uint64_t)(n321_quad0)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x6ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rs2_rs2s=init
+    n423_rs2_rs2s = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n326_op_csw)) != 0) || (((uint64_t)(n348_op_caryth)) != 0)))) != 0) || (((uint64_t)(n340_op_cfsw)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_clw=init
+    n325_op_clw = (uint8_t)(((uint64_t)(((((uint64_t)(n321_quad0)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rs1_rs1s=init
+    n420_rs1_rs1s = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n325_op_clw)) != 0) || (((uint64_t)(n326_op_csw)) != 0)))) != 0) || (((uint64_t)(n346_op_csrai)) != 0)))) != 0) || (((uint64_t)(n345_op_csrli)) != 0)))) != 0) || (((uint64_t)(n347_op_candi)) != 0)))) != 0) || (((uint64_t)(n348_op_caryth)) != 0)))) != 0) || (((uint64_t)(n333_op_cbeqz)) != 0)))) != 0) || (((uint64_t)(n334_op_cbnez)) != 0)))) != 0) || (((uint64_t)(n339_op_cflw)) != 0)))) != 0) || (((uint64_t)(n340_op_cfsw)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_cls=init
+    n377_format_cls = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n325_op_clw)) != 0) || (((uint64_t)(n326_op_csw)) != 0)))) != 0) || (((uint64_t)(n339_op_cflw)) != 0)))) != 0) || (((uint64_t)(n340_op_cfsw)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_caddi4spn=init
+    n324_op_caddi4spn = (uint8_t)(((uint64_t)(((((uint64_t)(n321_quad0)) != 0) && (((uint64_t)((((uint64_t)(n302_copcode)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rd_rs2s=init
+    n427_rd_rs2s = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n324_op_caddi4spn)) != 0) || (((uint64_t)(n325_op_clw)) != 0)))) != 0) || (((uint64_t)(n339_op_cflw)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rs1_sp=init
+    n418_rs1_sp = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n324_op_caddi4spn)) != 0) || (((uint64_t)(n336_op_clwsp)) != 0)))) != 0) || (((uint64_t)(n337_op_cswsp)) != 0)))) != 0) || (((uint64_t)(n341_op_cflwsp)) != 0)))) != 0) || (((uint64_t)(n342_op_cfswsp)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_ciw=init
+    n373_format_ciw = (uint8_t)(((uint64_t)(n324_op_caddi4spn)));
+  }
+  {  // decoder_i.decoder_i.funct7=init
+    n301_funct7 = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 25) & 0x7FULL))));
+  }
+  {  // decoder_i.always@3464
+    { uint64_t t16 = 0x1ULL;
+    if ((t16 == ((uint64_t)(n439_funct7_normal)))) {
+      n438_funct7_mux = (uint8_t)(((uint64_t)(n301_funct7)));
+    } else {
+      n438_funct7_mux = (uint8_t)(((uint64_t)(((((uint64_t)0x0ULL) << 6) | (((uint64_t)((uint64_t)(n440_funct7_5))) << 5) | ((uint64_t)0x0ULL)))));
+    }
+    }
+  }
+  {  // decoder_i.assign@3484
+    n28_funct7 = (uint8_t)(((uint64_t)(n438_funct7_mux)));
+  }
+  {  // decoder_i.decoder_i.funct3=init
+    n300_funct3 = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 12) & 0x7ULL))));
+  }
+  {  // decoder_i.decoder_i.rd=init
+    n299_rd = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 7) & 0x1FULL))));
+  }
+  {  // decoder_i.always@3424
+    { uint64_t t14 = 0x1ULL;
+    if ((t14 == ((uint64_t)(n426_rd_normal)))) {
+      n425_rd_mux = (uint8_t)(((uint64_t)(n299_rd)));
+    } else if ((t14 == ((uint64_t)(n428_rd_rs1l)))) {
+      n425_rd_mux = (uint8_t)(((uint64_t)(n305_rs1cl)));
+    } else if ((t14 == ((uint64_t)(n429_rd_rs1s)))) {
+      n425_rd_mux = (uint8_t)(((uint64_t)(n303_rs1cs)));
+    } else if ((t14 == ((uint64_t)(n427_rd_rs2s)))) {
+      n425_rd_mux = (uint8_t)(((uint64_t)(n304_rs2cs)));
+    } else {
+      n425_rd_mux = (uint8_t)(((uint64_t)(((((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)(((((uint64_t)(n328_op_cjal)) != 0) || (((uint64_t)(n356_op_cjalr)) != 0)))))))));
+    }
+    }
+  }
+  {  // decoder_i.assign@3495
+    n31_rd = (uint8_t)(((uint64_t)(n425_rd_mux)));
+  }
+  {  // assign@8765
+    n89_id_link_rd = (uint8_t)(((uint64_t)(((((uint64_t)((((uint64_t)(n31_rd)) == 0x1ULL))) != 0) || (((uint64_t)((((uint64_t)(n31_rd)) == 0x5ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rs2=init
+    n298_rs2 = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 20) & 0x1FULL))));
+  }
+  {  // decoder_i.always@3406
+    { uint64_t t13 = 0x1ULL;
+    if ((t13 == ((uint64_t)(n422_rs2_normal)))) {
+      n421_rs2_mux = (uint8_t)(((uint64_t)(n298_rs2)));
+    } else if ((t13 == ((uint64_t)(n423_rs2_rs2s)))) {
+      n421_rs2_mux = (uint8_t)(((uint64_t)(n304_rs2cs)));
+    } else if ((t13 == ((uint64_t)(n424_rs2_rs2l)))) {
+      n421_rs2_mux = (uint8_t)(((uint64_t)(n306_rs2cl)));
+    } else {
+      n421_rs2_mux = (uint8_t)(0x0ULL);
+    }
+    }
+  }
+  {  // decoder_i.assign@3494
+    n30_rs2 = (uint8_t)(((uint64_t)(n421_rs2_mux)));
+  }
+  {  // regs_i.i_addr_rd_b
+    n444_i_addr_rd_b = (uint8_t)(((uint64_t)(n30_rs2)));
+  }
+  {  // decoder_i.decoder_i.opcode=init
+    n296_opcode = (uint8_t)(((uint64_t)((((uint64_t)(n20_id_ir) >> 2) & 0x1FULL))));
+  }
+  {  // decoder_i.decoder_i.op_misc_mem=init
+    n320_op_misc_mem = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x3ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_system=init
+    n319_op_system = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x1CULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.system=init
+    n372_system = (uint8_t)(((uint64_t)(((((uint64_t)(n319_op_system)) != 0) || (((uint64_t)(n357_op_cebreak)) != 0)))));
+  }
+  {  // decoder_i.assign@3486
+    n43_system = (uint8_t)(((uint64_t)(n372_system)));
+  }
+  {  // decoder_i.decoder_i.op_jal=init
+    n318_op_jal = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x1BULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.c_jal=init
+    n402_c_jal = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n318_op_jal)) != 0) || (((uint64_t)(n332_op_cj)) != 0)))) != 0) || (((uint64_t)(n328_op_cjal)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_j=init
+    n367_format_j = (uint8_t)(((uint64_t)(n318_op_jal)));
+  }
+  {  // decoder_i.decoder_i.op_jalr=init
+    n317_op_jalr = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x19ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.c_jalr=init
+    n403_c_jalr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n317_op_jalr)) != 0) || (((uint64_t)(n355_op_cjr)) != 0)))) != 0) || (((uint64_t)(n356_op_cjalr)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.jump=init
+    n414_jump = (uint8_t)(((uint64_t)(((((uint64_t)(n402_c_jal)) != 0) || (((uint64_t)(n403_c_jalr)) != 0)))));
+  }
+  {  // decoder_i.assign@3509
+    n35_jump = (uint8_t)(((uint64_t)(n414_jump)));
+  }
+  {  // decoder_i.decoder_i.op_branch=init
+    n316_op_branch = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x18ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.branch=init
+    n415_branch = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n316_op_branch)) != 0) || (((uint64_t)(n333_op_cbeqz)) != 0)))) != 0) || (((uint64_t)(n334_op_cbnez)) != 0)))));
+  }
+  {  // decoder_i.assign@3508
+    n34_branch = (uint8_t)(((uint64_t)(n415_branch)));
+  }
+  {  // decoder_i.decoder_i.c_branch=init
+    n404_c_branch = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n316_op_branch)) != 0) || (((uint64_t)(n333_op_cbeqz)) != 0)))) != 0) || (((uint64_t)(n334_op_cbnez)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_b=init
+    n368_format_b = (uint8_t)(((uint64_t)(n316_op_branch)));
+  }
+  {  // decoder_i.decoder_i.op_lui=init
+    n315_op_lui = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0xDULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.rs1=init
+    n297_rs1 = (uint8_t)((((uint64_t)((((uint64_t)(n20_id_ir) >> 15) & 0x1FULL))) & ((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)((((uint64_t)(n315_op_lui)) == 0))))))), 1, 5)))));
+  }
+  {  // decoder_i.always@3390
+    { uint64_t t12 = 0x1ULL;
+    if ((t12 == ((uint64_t)(n417_rs1_normal)))) {
+      n416_rs1_mux = (uint8_t)(((uint64_t)(n297_rs1)));
+    } else if ((t12 == ((uint64_t)(n419_rs1_rs1l)))) {
+      n416_rs1_mux = (uint8_t)(((uint64_t)(n305_rs1cl)));
+    } else if ((t12 == ((uint64_t)(n420_rs1_rs1s)))) {
+      n416_rs1_mux = (uint8_t)(((uint64_t)(n303_rs1cs)));
+    } else {
+      n416_rs1_mux = (uint8_t)(((uint64_t)(((((uint64_t)0x0ULL) << 2) | (((uint64_t)((uint64_t)(n418_rs1_sp))) << 1) | ((uint64_t)0x0ULL)))));
+    }
+    }
+  }
+  {  // decoder_i.assign@3493
+    n29_rs1 = (uint8_t)(((uint64_t)(n416_rs1_mux)));
+  }
+  {  // assign@8766
+    n90_id_link_rs1 = (uint8_t)(((uint64_t)(((((uint64_t)((((uint64_t)(n29_rs1)) == 0x1ULL))) != 0) || (((uint64_t)((((uint64_t)(n29_rs1)) == 0x5ULL))) != 0)))));
+  }
+  {  // regs_i.i_addr_rd_a
+    n443_i_addr_rd_a = (uint8_t)(((uint64_t)(n29_rs1)));
+  }
+  {  // decoder_i.decoder_i.op_op=init
+    n314_op_op = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0xCULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.c_op_op=init
+    n401_c_op_op = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n314_op_op)) != 0) || (((uint64_t)(n348_op_caryth)) != 0)))) != 0) || (((uint64_t)(n354_op_cadd)) != 0)))) != 0) || (((uint64_t)(n353_op_cmv)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.alu_imm=init
+    n406_alu_imm = (uint8_t)(((uint64_t)((((uint64_t)(n401_c_op_op)) == 0))));
+  }
+  {  // decoder_i.assign@3512
+    n37_alu_imm = (uint8_t)(((uint64_t)(n406_alu_imm)));
+  }
+  {  // decoder_i.decoder_i.format_r=init
+    n371_format_r = (uint8_t)(((uint64_t)(n314_op_op)));
+  }
+  {  // decoder_i.decoder_i.op_store=init
+    n313_op_store = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x8ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.c_op_store=init
+    n398_c_op_store = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n313_op_store)) != 0) || (((uint64_t)(n326_op_csw)) != 0)))) != 0) || (((uint64_t)(n337_op_cswsp)) != 0)))) != 0) || (((uint64_t)(n363_fp_store)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.hz_rs2=init
+    n413_hz_rs2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n404_c_branch)) != 0) || (((uint64_t)(n398_c_op_store)) != 0)))) != 0) || (((uint64_t)(n401_c_op_op)) != 0)))) != 0) || (((uint64_t)(n360_atomic_wr)) != 0)))) != 0) || (((uint64_t)(n364_fp_hz_rs2)) != 0)))));
+  }
+  {  // decoder_i.assign@3499
+    n33_hz_rs2 = (uint8_t)(((uint64_t)(n413_hz_rs2)));
+  }
+  {  // hazard_i.assign@5473
+    n499_rs2_hz_en = (uint8_t)(((uint64_t)(((((uint64_t)(n33_hz_rs2)) != 0) && (((uint64_t)((((uint64_t)(n30_rs2)) != 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5516
+    n523_hz2_ex2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n499_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n30_rs2)) == ((uint64_t)(n137_ex1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n138_ex1_wb_en)) != 0)))));
+  }
+  {  // hazard_i.assign@5496
+    n511_hz_ex2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n499_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n30_rs2)) == ((uint64_t)(n65_ex_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n66_ex_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n523_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5513
+    n521_hz2_ma2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n499_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n30_rs2)) == ((uint64_t)(n141_ma1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n142_ma1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n511_hz_ex2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n523_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5503
+    n517_hz_ex_rd2 = (uint8_t)(((uint64_t)(((((uint64_t)(n511_hz_ex2)) != 0) && (((uint64_t)(((uint64_t)(n64_ex_wb_mux) >> 0) & 1)) != 0)))));
+  }
+  {  // hazard_i.assign@5502
+    n516_hz_ex_ret2 = (uint8_t)(((uint64_t)(((((uint64_t)(n511_hz_ex2)) != 0) && (((uint64_t)((((uint64_t)(n64_ex_wb_mux)) == 0x2ULL))) != 0)))));
+  }
+  {  // hazard_i.assign@5501
+    n515_hz_ex_res2 = (uint8_t)(((uint64_t)(((((uint64_t)(n511_hz_ex2)) != 0) && (((uint64_t)((((uint64_t)(n64_ex_wb_mux)) == 0x0ULL))) != 0)))));
+  }
+  {  // hazard_i.assign@5484
+    n503_hz_ma2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n499_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n30_rs2)) == ((uint64_t)(n157_ma_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n159_ma_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n521_hz2_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n511_hz_ex2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n523_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5509
+    n519_hz2_wb2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n499_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n30_rs2)) == ((uint64_t)(n144_wb1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n145_wb1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n503_hz_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n521_hz2_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n511_hz_ex2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n523_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5491
+    n509_hz_ma_rd2 = (uint8_t)(((uint64_t)(((((uint64_t)(n503_hz_ma2)) != 0) && (((uint64_t)(((uint64_t)(n158_ma_wb_mux) >> 0) & 1)) != 0)))));
+  }
+  {  // hazard_i.assign@5490
+    n508_hz_ma_ret2 = (uint8_t)(((uint64_t)(((((uint64_t)(n503_hz_ma2)) != 0) && (((uint64_t)((((uint64_t)(n158_ma_wb_mux)) == 0x2ULL))) != 0)))));
+  }
+  {  // hazard_i.assign@5489
+    n507_hz_ma_res2 = (uint8_t)(((uint64_t)(((((uint64_t)(n503_hz_ma2)) != 0) && (((uint64_t)((((uint64_t)(n158_ma_wb_mux)) == 0x0ULL))) != 0)))));
+  }
+  {  // hazard_i.assign@5478
+    n501_hz_wb2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n499_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n30_rs2)) == ((uint64_t)(n171_wb_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n172_wb_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n519_hz2_wb2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n503_hz_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n521_hz2_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n511_hz_ex2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n523_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_i.always@5557
+    { uint64_t t18 = 0x1ULL;
+    if ((t18 == ((uint64_t)(n501_hz_wb2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n175_wb_dat)));
+    } else if ((t18 == ((uint64_t)(n519_hz2_wb2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n143_wb1_wb_d)));
+    } else if ((t18 == ((uint64_t)(n521_hz2_ma2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n140_ma1_res)));
+    } else if ((t18 == ((uint64_t)(n523_hz2_ex2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n139_ex1_res)));
+    } else if ((t18 == ((uint64_t)(n507_hz_ma_res2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n152_ma_res)));
+    } else if ((t18 == ((uint64_t)(n508_hz_ma_ret2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n153_ma_ret)));
+    } else if ((t18 == ((uint64_t)(n509_hz_ma_rd2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n161_ma_ld_dat)));
+    } else if ((t18 == ((uint64_t)(n516_hz_ex_ret2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n54_ex_ret)));
+    } else if ((t18 == ((uint64_t)(n515_hz_ex_res2)))) {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n150_ex_res_dat)));
+    } else {
+      n525_rs2_d = (uint32_t)(((uint64_t)(n47_rs2_raw_d)));
+    }
+    }
+  }
+  {  // hazard_i.assign@5684
+    n49_rs2_d = (uint32_t)(((uint64_t)(n525_rs2_d)));
+  }
+  {  // decoder_i.decoder_i.format_s=init
+    n369_format_s = (uint8_t)(((uint64_t)(n313_op_store)));
+  }
+  {  // decoder_i.decoder_i.op_auipc=init
+    n312_op_auipc = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x5ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.hz_rs1=init
+    n412_hz_rs1 = (uint8_t)(((uint64_t)((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n315_op_lui)) != 0) || (((uint64_t)(n312_op_auipc)) != 0)))) != 0) || (((uint64_t)(n402_c_jal)) != 0)))) != 0) || (((uint64_t)(n353_op_cmv)) != 0)))) == 0))));
+  }
+  {  // decoder_i.assign@3498
+    n32_hz_rs1 = (uint8_t)(((uint64_t)(n412_hz_rs1)));
+  }
+  {  // hazard_i.assign@5678
+    n492_o_hz_pair = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n491_i_pair_wb_en)) != 0) && (((uint64_t)((((uint64_t)(n490_i_pair_rd)) != 0))) != 0)))) != 0) && (((uint64_t)(((((uint64_t)(((((uint64_t)(n32_hz_rs1)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) == ((uint64_t)(n490_i_pair_rd))))) != 0)))) != 0) || (((uint64_t)(((((uint64_t)(n33_hz_rs2)) != 0) && (((uint64_t)((((uint64_t)(n30_rs2)) == ((uint64_t)(n490_i_pair_rd))))) != 0)))) != 0)))) != 0)))));
+  }
+  {  // hazard_i.assign@5472
+    n498_rs1_hz_en = (uint8_t)(((uint64_t)(((((uint64_t)(n32_hz_rs1)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) != 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5515
+    n522_hz2_ex1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n498_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) == ((uint64_t)(n137_ex1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n138_ex1_wb_en)) != 0)))));
+  }
+  {  // hazard_i.assign@5494
+    n510_hz_ex1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n498_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) == ((uint64_t)(n65_ex_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n66_ex_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n522_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5511
+    n520_hz2_ma1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n498_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) == ((uint64_t)(n141_ma1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n142_ma1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n510_hz_ex1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n522_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5500
+    n514_hz_ex_rd1 = (uint8_t)(((uint64_t)(((((uint64_t)(n510_hz_ex1)) != 0) && (((uint64_t)(((uint64_t)(n64_ex_wb_mux) >> 0) & 1)) != 0)))));
+  }
+  {  // hazard_i.assign@5584
+    n527_hz_data = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n514_hz_ex_rd1)) != 0) || (((uint64_t)(n517_hz_ex_rd2)) != 0)))) != 0) || (((uint64_t)(n526_hz_ma_ld)) != 0)))));
+  }
+  {  // hazard_i.assign@5695
+    n44_hz_data = (uint8_t)(((uint64_t)(n527_hz_data)));
+  }
+  {  // hazard_i.assign@5499
+    n513_hz_ex_ret1 = (uint8_t)(((uint64_t)(((((uint64_t)(n510_hz_ex1)) != 0) && (((uint64_t)((((uint64_t)(n64_ex_wb_mux)) == 0x2ULL))) != 0)))));
+  }
+  {  // hazard_i.assign@5498
+    n512_hz_ex_res1 = (uint8_t)(((uint64_t)(((((uint64_t)(n510_hz_ex1)) != 0) && (((uint64_t)((((uint64_t)(n64_ex_wb_mux)) == 0x0ULL))) != 0)))));
+  }
+  {  // hazard_i.assign@5482
+    n502_hz_ma1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n498_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) == ((uint64_t)(n157_ma_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n159_ma_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n520_hz2_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n510_hz_ex1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n522_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5507
+    n518_hz2_wb1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n498_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) == ((uint64_t)(n144_wb1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n145_wb1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n502_hz_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n520_hz2_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n510_hz_ex1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n522_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_i.assign@5488
+    n506_hz_ma_rd1 = (uint8_t)(((uint64_t)(((((uint64_t)(n502_hz_ma1)) != 0) && (((uint64_t)(((uint64_t)(n158_ma_wb_mux) >> 0) & 1)) != 0)))));
+  }
+  {  // hazard_i.assign@5487
+    n505_hz_ma_ret1 = (uint8_t)(((uint64_t)(((((uint64_t)(n502_hz_ma1)) != 0) && (((uint64_t)((((uint64_t)(n158_ma_wb_mux)) == 0x2ULL))) != 0)))));
+  }
+  {  // hazard_i.assign@5486
+    n504_hz_ma_res1 = (uint8_t)(((uint64_t)(((((uint64_t)(n502_hz_ma1)) != 0) && (((uint64_t)((((uint64_t)(n158_ma_wb_mux)) == 0x0ULL))) != 0)))));
+  }
+  {  // hazard_i.assign@5476
+    n500_hz_wb1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n498_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) == ((uint64_t)(n171_wb_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n172_wb_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n518_hz2_wb1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n502_hz_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n520_hz2_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n510_hz_ex1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n522_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_i.always@5530
+    { uint64_t t17 = 0x1ULL;
+    if ((t17 == ((uint64_t)(n500_hz_wb1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n175_wb_dat)));
+    } else if ((t17 == ((uint64_t)(n518_hz2_wb1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n143_wb1_wb_d)));
+    } else if ((t17 == ((uint64_t)(n520_hz2_ma1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n140_ma1_res)));
+    } else if ((t17 == ((uint64_t)(n522_hz2_ex1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n139_ex1_res)));
+    } else if ((t17 == ((uint64_t)(n504_hz_ma_res1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n152_ma_res)));
+    } else if ((t17 == ((uint64_t)(n505_hz_ma_ret1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n153_ma_ret)));
+    } else if ((t17 == ((uint64_t)(n506_hz_ma_rd1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n161_ma_ld_dat)));
+    } else if ((t17 == ((uint64_t)(n513_hz_ex_ret1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n54_ex_ret)));
+    } else if ((t17 == ((uint64_t)(n512_hz_ex_res1)))) {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n150_ex_res_dat)));
+    } else {
+      n524_rs1_d = (uint32_t)(((uint64_t)(n46_rs1_raw_d)));
+    }
+    }
+  }
+  {  // hazard_i.assign@5683
+    n48_rs1_d = (uint32_t)(((uint64_t)(n524_rs1_d)));
+  }
+  {  // decoder_i.decoder_i.alu_pc=init
+    n405_alu_pc = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n402_c_jal)) != 0) || (((uint64_t)(n312_op_auipc)) != 0)))) != 0) || (((uint64_t)(n404_c_branch)) != 0)))));
+  }
+  {  // decoder_i.assign@3511
+    n36_alu_pc = (uint8_t)(((uint64_t)(n405_alu_pc)));
+  }
+  {  // assign@8743
+    n84_id_jal = (uint8_t)(((uint64_t)(((((uint64_t)(n35_jump)) != 0) && (((uint64_t)(n36_alu_pc)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.format_u=init
+    n366_format_u = (uint8_t)(((uint64_t)(((((uint64_t)(n312_op_auipc)) != 0) || (((uint64_t)(n315_op_lui)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.op_op_imm=init
+    n311_op_op_imm = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x4ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.c_op_op_imm=init
+    n400_c_op_op_imm = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n311_op_op_imm)) != 0) || (((uint64_t)(((((uint64_t)(n331_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n348_op_caryth)) == 0))) != 0)))) != 0)))) != 0) || (((uint64_t)(n335_op_cslli)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.alu_en=init
+    n407_alu_en = (uint8_t)(((uint64_t)(((((uint64_t)(n401_c_op_op)) != 0) || (((uint64_t)(n400_c_op_op_imm)) != 0)))));
+  }
+  {  // decoder_i.assign@3513
+    n38_alu_en = (uint8_t)(((uint64_t)(n407_alu_en)));
+  }
+  {  // decoder_i.decoder_i.op_load=init
+    n310_op_load = (uint8_t)(((uint64_t)(((((uint64_t)(n309_quad3)) != 0) && (((uint64_t)((((uint64_t)(n296_opcode)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.c_op_load=init
+    n399_c_op_load = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n310_op_load)) != 0) || (((uint64_t)(n325_op_clw)) != 0)))) != 0) || (((uint64_t)(n336_op_clwsp)) != 0)))) != 0) || (((uint64_t)(n362_fp_load)) != 0)))));
+  }
+  {  // decoder_i.decoder_i.funct3_010=init
+    n433_funct3_010 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n398_c_op_store)) != 0) || (((uint64_t)(n399_c_op_load)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n309_quad3)) == 0))) != 0)))));
+  }
+  {  // decoder_i.always@3445
+    { uint64_t t15 = 0x1ULL;
+    if ((t15 == ((uint64_t)(n431_funct3_normal)))) {
+      n430_funct3_mux = (uint8_t)(((uint64_t)(n300_funct3)));
+    } else if ((t15 == ((uint64_t)(n432_funct3_001)))) {
+      n430_funct3_mux = (uint8_t)(0x1ULL);
+    } else if ((t15 == ((uint64_t)(n433_funct3_010)))) {
+      n430_funct3_mux = (uint8_t)(0x2ULL);
+    } else if ((t15 == ((uint64_t)(n434_funct3_100)))) {
+      n430_funct3_mux = (uint8_t)(0x4ULL);
+    } else if ((t15 == ((uint64_t)(n435_funct3_101)))) {
+      n430_funct3_mux = (uint8_t)(0x5ULL);
+    } else if ((t15 == ((uint64_t)(n436_funct3_110)))) {
+      n430_funct3_mux = (uint8_t)(0x6ULL);
+    } else if ((t15 == ((uint64_t)(n437_funct3_111)))) {
+      n430_funct3_mux = (uint8_t)(0x7ULL);
+    } else {
+      n430_funct3_mux = (uint8_t)(0x0ULL);
+    }
+    }
+  }
+  {  // decoder_i.assign@3483
+    n27_funct3 = (uint8_t)(((uint64_t)(n430_funct3_mux)));
+  }
+  {  // decoder_i.decoder_i.wb_mux=init
+    n408_wb_mux = (uint8_t)(((uint64_t)(((((uint64_t)((uint64_t)(((((uint64_t)(((((uint64_t)(n402_c_jal)) != 0) || (((uint64_t)(n403_c_jalr)) != 0)))) != 0) || (((uint64_t)(n361_fpu_en)) != 0))))) << 1) | ((uint64_t)((uint64_t)(((((uint64_t)(((((uint64_t)(n399_c_op_load)) != 0) || (((uint64_t)(n358_op_atomic)) != 0)))) != 0) || (((uint64_t)(n361_fpu_en)) != 0)))))))));
+  }
+  {  // decoder_i.assign@3527
+    n41_wb_mux = (uint8_t)(((uint64_t)(n408_wb_mux)));
+  }
+  {  // decoder_i.decoder_i.format_i=init
+    n370_format_i = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n310_op_load)) != 0) || (((uint64_t)(n311_op_op_imm)) != 0)))) != 0) || (((uint64_t)(n317_op_jalr)) != 0)))) != 0) || (((uint64_t)(n319_op_system)) != 0)))));
+  }
+  {  // decoder_i.always@3285
+    { uint64_t t11 = 0x1ULL;
+    if ((t11 == ((uint64_t)(n373_format_ciw)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n388_immediate_ciw)));
+    } else if ((t11 == ((uint64_t)(n374_format_ci)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n389_immediate_ci)));
+    } else if ((t11 == ((uint64_t)(n375_format_cu)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n390_immediate_cu)));
+    } else if ((t11 == ((uint64_t)(n376_format_c16sp)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n391_immediate_c16sp)));
+    } else if ((t11 == ((uint64_t)(n377_format_cls)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n392_immediate_cls)));
+    } else if ((t11 == ((uint64_t)(n378_format_cj)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n393_immediate_cj)));
+    } else if ((t11 == ((uint64_t)(n379_format_cb)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n394_immediate_cb)));
+    } else if ((t11 == ((uint64_t)(n380_format_cssp)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n395_immediate_cssp)));
+    } else if ((t11 == ((uint64_t)(n381_format_clsp)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n396_immediate_clsp)));
+    } else if ((t11 == ((uint64_t)(n357_op_cebreak)))) {
+      n397_immediate_mux = (uint32_t)(0x1ULL);
+    } else if ((t11 == ((uint64_t)(n366_format_u)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n383_immediate_u)));
+    } else if ((t11 == ((uint64_t)(n367_format_j)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n384_immediate_j)));
+    } else if ((t11 == ((uint64_t)(n368_format_b)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n385_immediate_b)));
+    } else if ((t11 == ((uint64_t)(n370_format_i)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n387_immediate_i)));
+    } else if ((t11 == ((uint64_t)(n369_format_s)))) {
+      n397_immediate_mux = (uint32_t)(((uint64_t)(n386_immediate_s)));
+    } else {
+      n397_immediate_mux = (uint32_t)(0x0ULL);
+    }
+    }
+  }
+  {  // decoder_i.assign@3482
+    n26_immediate = (uint32_t)(((uint64_t)(n397_immediate_mux)));
+  }
+  {  // decoder_i.decoder_i.opcode_valid=init
+    n382_opcode_valid = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n338_op_cjr_mv_add)) != 0) || (((uint64_t)(n331_op_calu)) != 0)))) != 0) || (((uint64_t)(n373_format_ciw)) != 0)))) != 0) || (((uint64_t)(n374_format_ci)) != 0)))) != 0) || (((uint64_t)(n375_format_cu)) != 0)))) != 0) || (((uint64_t)(n376_format_c16sp)) != 0)))) != 0) || (((uint64_t)(n377_format_cls)) != 0)))) != 0) || (((uint64_t)(n378_format_cj)) != 0)))) != 0) || (((uint64_t)(n379_format_cb)) != 0)))) != 0) || (((uint64_t)(n380_format_cssp)) != 0)))) != 0) || (((uint64_t)(n381_format_clsp)) != 0)))) != 0) || (((uint64_t)(n358_op_atomic)) != 0)))) != 0) || (((uint64_t)(n361_fpu_en)) != 0)))) != 0) || (((uint64_t)(n320_op_misc_mem)) != 0)))) != 0) || (((uint64_t)(n366_format_u)) != 0)))) != 0) || (((uint64_t)(n367_format_j)) != 0)))) != 0) || (((uint64_t)(n368_format_b)) != 0)))) != 0) || (((uint64_t)(n370_format_i)) != 0)))) != 0) || (((uint64_t)(n369_format_s)) != 0)))) != 0) || (((uint64_t)(n371_format_r)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n365_bm_illegal)) == 0))) != 0)))));
+  }
+  {  // decoder_i.decoder_i.wb_en=init
+    n411_wb_en = (uint8_t)(((uint64_t)(((((uint64_t)((((uint64_t)(((((uint64_t)(n398_c_op_store)) != 0) || (((uint64_t)(n404_c_branch)) != 0)))) == 0))) != 0) && (((uint64_t)(n382_opcode_valid)) != 0)))));
+  }
+  {  // decoder_i.assign@3528
+    n42_wb_en = (uint8_t)(((uint64_t)(n411_wb_en)));
+  }
+  {  // decoder_i.decoder_i.ma_rd=init
+    n410_ma_rd = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n399_c_op_load)) != 0) || (((uint64_t)(n359_atomic_rd)) != 0)))) != 0) && (((uint64_t)(n382_opcode_valid)) != 0)))));
+  }
+  {  // decoder_i.assign@3525
+    n40_d_rd = (uint8_t)(((uint64_t)(n410_ma_rd)));
+  }
+  {  // decoder_i.decoder_i.ma_wr=init
+    n409_ma_wr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n398_c_op_store)) != 0) || (((uint64_t)(n360_atomic_wr)) != 0)))) != 0) && (((uint64_t)(n382_opcode_valid)) != 0)))));
+  }
+  {  // decoder_i.assign@3524
+    n39_d_wr = (uint8_t)(((uint64_t)(n409_ma_wr)));
+  }
+  {  // fetch_i.assign@4636
+    n19_id_pc = (uint32_t)(((uint64_t)(n234_q_pc)));
+  }
+  {  // assign@8744
+    n83_id_jal_addr = (uint32_t)(((((uint64_t)(n19_id_pc)) + ((uint64_t)(n26_immediate))) & 0xFFFFFFFFULL));
+  }
+  {  // fetch_i.assign@4634
+    n17_if_pc = (uint32_t)(((uint64_t)(n225_fetch_pc)));
+  }
+  {  // fetch_i.assign@4621
+    n216_bp_pc = (uint32_t)(((uint64_t)(n234_q_pc)));
+  }
+  {  // fetch_i.assign@4595
+    n237_id_c = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n232_q_data[0]) >> 0) & 0x3ULL))) != 0x3ULL))));
+  }
+  {  // fetch_i.assign@4638
+    n21_id_ret = (uint32_t)(((((uint64_t)(n234_q_pc)) + ((((uint64_t)(n237_id_c))) ? 0x2ULL : 0x4ULL)) & 0xFFFFFFFFULL));
+  }
+  {  // fetch_i.assign@4612
+    n245_id1_hi = (uint16_t)(((((uint64_t)(n237_id_c))) ? ((uint64_t)(n232_q_data[2])) : ((uint64_t)(n232_q_data[3]))));
+  }
+  {  // fetch_i.assign@4611
+    n244_id1_lo = (uint16_t)(((((uint64_t)(n237_id_c))) ? ((uint64_t)(n232_q_data[1])) : ((uint64_t)(n232_q_data[2]))));
+  }
+  {  // fetch_i.assign@4641
+    n97_id1_ir = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(n245_id1_hi))) << 16) | ((uint64_t)((uint64_t)(n244_id1_lo)))))));
+  }
+  {  // decoder_1.decoder_1.immediate_clsp=init
+    n647_immediate_clsp = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 8) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 2) & 0x3ULL)))) << 6) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1))) << 5) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 4) & 0x7ULL)))) << 2) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_cssp=init
+    n646_immediate_cssp = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 8) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 7) & 0x3ULL)))) << 6) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 9) & 0xFULL)))) << 2) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_cb=init
+    n645_immediate_cb = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)))))), 1, 24)))) << 8) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 5) & 0x3ULL)))) << 6) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 2) & 1))) << 5) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 10) & 0x3ULL)))) << 3) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 3) & 0x3ULL)))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_cj=init
+    n644_immediate_cj = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)))))), 1, 21)))) << 11) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 8) & 1))) << 10) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 9) & 0x3ULL)))) << 8) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 6) & 1))) << 7) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 7) & 1))) << 6) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 2) & 1))) << 5) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 11) & 1))) << 4) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 3) & 0x7ULL)))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_cls=init
+    n643_immediate_cls = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 5) & 1)))))), 1, 26)))) << 6) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 10) & 0x7ULL)))) << 3) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 6) & 1))) << 2) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_c16sp=init
+    n642_immediate_c16sp = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)))))), 1, 23)))) << 9) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 3) & 0x3ULL)))) << 7) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 5) & 1))) << 6) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 2) & 1))) << 5) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 6) & 1))) << 4) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_cu=init
+    n641_immediate_cu = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)))))), 1, 15)))) << 17) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 2) & 0x1FULL)))) << 12) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_ci=init
+    n640_immediate_ci = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)))))), 1, 27)))) << 5) | ((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 2) & 0x1FULL))))))));
+  }
+  {  // decoder_1.decoder_1.immediate_ciw=init
+    n639_immediate_ciw = (uint32_t)(((uint64_t)(((((uint64_t)0x0ULL) << 10) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 7) & 0xFULL)))) << 6) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 11) & 0x3ULL)))) << 4) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 5) & 1))) << 3) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 6) & 1))) << 2) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_i=init
+    n638_immediate_i = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 31) & 1)))))), 1, 21)))) << 11) | ((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 20) & 0x7FFULL))))))));
+  }
+  {  // decoder_1.decoder_1.immediate_s=init
+    n637_immediate_s = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 31) & 1)))))), 1, 21)))) << 11) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 25) & 0x3FULL)))) << 5) | ((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 7) & 0x1FULL))))))));
+  }
+  {  // decoder_1.decoder_1.immediate_b=init
+    n636_immediate_b = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 31) & 1)))))), 1, 20)))) << 12) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 7) & 1))) << 11) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 25) & 0x3FULL)))) << 5) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 8) & 0xFULL)))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_j=init
+    n635_immediate_j = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 31) & 1)))))), 1, 12)))) << 20) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 12) & 0xFFULL)))) << 12) | (((uint64_t)((uint64_t)(((uint64_t)(n97_id1_ir) >> 20) & 1))) << 11) | (((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 21) & 0x3FFULL)))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.immediate_u=init
+    n634_immediate_u = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 12) & 0xFFFFFULL)))) << 12) | ((uint64_t)0x0ULL)))));
+  }
+  {  // decoder_1.decoder_1.quad2=init
+    n574_quad2 = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n97_id1_ir) >> 0) & 0x3ULL))) == 0x2ULL))));
+  }
+  {  // decoder_1.decoder_1.quad1=init
+    n573_quad1 = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n97_id1_ir) >> 0) & 0x3ULL))) == 0x1ULL))));
+  }
+  {  // decoder_1.decoder_1.quad0=init
+    n572_quad0 = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n97_id1_ir) >> 0) & 0x3ULL))) == 0x0ULL))));
+  }
+  {  // decoder_1.decoder_1.quad3=init
+    n560_quad3 = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n97_id1_ir) >> 0) & 0x3ULL))) == 0x3ULL))));
+  }
+  {  // decoder_1.decoder_1.funct7_normal=init
+    n690_funct7_normal = (uint8_t)(((uint64_t)(n560_quad3)));
+  }
+  {  // decoder_1.decoder_1.funct3_normal=init
+    n682_funct3_normal = (uint8_t)(((uint64_t)(n560_quad3)));
+  }
+  {  // decoder_1.decoder_1.rd_normal=init
+    n677_rd_normal = (uint8_t)(((uint64_t)(n560_quad3)));
+  }
+  {  // decoder_1.decoder_1.rs2_normal=init
+    n673_rs2_normal = (uint8_t)(((uint64_t)(n560_quad3)));
+  }
+  {  // decoder_1.decoder_1.rs1_normal=init
+    n668_rs1_normal = (uint8_t)(((uint64_t)(n560_quad3)));
+  }
+  {  // decoder_1.decoder_1.funct2l=init
+    n559_funct2l = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 5) & 0x3ULL))));
+  }
+  {  // decoder_1.decoder_1.funct2h=init
+    n558_funct2h = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 10) & 0x3ULL))));
+  }
+  {  // decoder_1.decoder_1.rs2cl=init
+    n557_rs2cl = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 2) & 0x1FULL))));
+  }
+  {  // decoder_1.decoder_1.rs1cl=init
+    n556_rs1cl = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 7) & 0x1FULL))));
+  }
+  {  // decoder_1.decoder_1.rs2cs=init
+    n555_rs2cs = (uint8_t)(((uint64_t)(((((uint64_t)0x1ULL) << 3) | ((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 2) & 0x7ULL))))))));
+  }
+  {  // decoder_1.decoder_1.rs1cs=init
+    n554_rs1cs = (uint8_t)(((uint64_t)(((((uint64_t)0x1ULL) << 3) | ((uint64_t)((uint64_t)((((uint64_t)(n97_id1_ir) >> 7) & 0x7ULL))))))));
+  }
+  {  // decoder_1.decoder_1.copcode=init
+    n553_copcode = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 13) & 0x7ULL))));
+  }
+  {  // decoder_1.decoder_1.op_cjr_mv_add=init
+    n589_op_cjr_mv_add = (uint8_t)(((uint64_t)(((((uint64_t)(n574_quad2)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x4ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cebreak=init
+    n608_op_cebreak = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n589_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n557_rs2cl)) == 0))) != 0)))) != 0) && (((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n556_rs1cl)) == 0))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cjalr=init
+    n607_op_cjalr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n589_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n557_rs2cl)) == 0))) != 0)))) != 0) && (((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n556_rs1cl)) != 0))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cjr=init
+    n606_op_cjr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n589_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n557_rs2cl)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)) == 0))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cadd=init
+    n605_op_cadd = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n589_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n557_rs2cl)) != 0))) != 0)))) != 0) && (((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cmv=init
+    n604_op_cmv = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n589_op_cjr_mv_add)) != 0) && (((uint64_t)((((uint64_t)(n557_rs2cl)) != 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n97_id1_ir) >> 12) & 1)) == 0))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cswsp=init
+    n588_op_cswsp = (uint8_t)(((uint64_t)(((((uint64_t)(n574_quad2)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x6ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rs2_rs2l=init
+    n675_rs2_rs2l = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n605_op_cadd)) != 0) || (((uint64_t)(n604_op_cmv)) != 0)))) != 0) || (((uint64_t)(n588_op_cswsp)) != 0)))) != 0) || (((uint64_t)(n593_op_cfswsp)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_cssp=init
+    n631_format_cssp = (uint8_t)(((uint64_t)(((((uint64_t)(n588_op_cswsp)) != 0) || (((uint64_t)(n593_op_cfswsp)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_clwsp=init
+    n587_op_clwsp = (uint8_t)(((uint64_t)(((((uint64_t)(n574_quad2)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_clsp=init
+    n632_format_clsp = (uint8_t)(((uint64_t)(((((uint64_t)(n587_op_clwsp)) != 0) || (((uint64_t)(n592_op_cflwsp)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cslli=init
+    n586_op_cslli = (uint8_t)(((uint64_t)(((((uint64_t)(n574_quad2)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cbnez=init
+    n585_op_cbnez = (uint8_t)(((uint64_t)(((((uint64_t)(n573_quad1)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x7ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.funct3_001=init
+    n683_funct3_001 = (uint8_t)(((uint64_t)(((((uint64_t)(n586_op_cslli)) != 0) || (((uint64_t)(n585_op_cbnez)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cbeqz=init
+    n584_op_cbeqz = (uint8_t)(((uint64_t)(((((uint64_t)(n573_quad1)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x6ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_cb=init
+    n630_format_cb = (uint8_t)(((uint64_t)(((((uint64_t)(n584_op_cbeqz)) != 0) || (((uint64_t)(n585_op_cbnez)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cj=init
+    n583_op_cj = (uint8_t)(((uint64_t)(((((uint64_t)(n573_quad1)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x5ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_calu=init
+    n582_op_calu = (uint8_t)(((uint64_t)(((((uint64_t)(n573_quad1)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x4ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_caryth=init
+    n599_op_caryth = (uint8_t)(((uint64_t)(((((uint64_t)(n582_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n558_funct2h)) == 0x3ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cand=init
+    n603_op_cand = (uint8_t)(((uint64_t)(((((uint64_t)(n599_op_caryth)) != 0) && (((uint64_t)((((uint64_t)(n559_funct2l)) == 0x3ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cor=init
+    n602_op_cor = (uint8_t)(((uint64_t)(((((uint64_t)(n599_op_caryth)) != 0) && (((uint64_t)((((uint64_t)(n559_funct2l)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.funct3_110=init
+    n687_funct3_110 = (uint8_t)(((uint64_t)(n602_op_cor)));
+  }
+  {  // decoder_1.decoder_1.op_cxor=init
+    n601_op_cxor = (uint8_t)(((uint64_t)(((((uint64_t)(n599_op_caryth)) != 0) && (((uint64_t)((((uint64_t)(n559_funct2l)) == 0x1ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.funct3_100=init
+    n685_funct3_100 = (uint8_t)(((uint64_t)(n601_op_cxor)));
+  }
+  {  // decoder_1.decoder_1.op_csub=init
+    n600_op_csub = (uint8_t)(((uint64_t)(((((uint64_t)(n599_op_caryth)) != 0) && (((uint64_t)((((uint64_t)(n559_funct2l)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_candi=init
+    n598_op_candi = (uint8_t)(((uint64_t)(((((uint64_t)(n582_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n558_funct2h)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.funct3_111=init
+    n688_funct3_111 = (uint8_t)(((uint64_t)(((((uint64_t)(n598_op_candi)) != 0) || (((uint64_t)(n603_op_cand)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_csrai=init
+    n597_op_csrai = (uint8_t)(((uint64_t)(((((uint64_t)(n582_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n558_funct2h)) == 0x1ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.funct7_5=init
+    n691_funct7_5 = (uint8_t)(((uint64_t)(((((uint64_t)(n597_op_csrai)) != 0) || (((uint64_t)(n600_op_csub)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_csrli=init
+    n596_op_csrli = (uint8_t)(((uint64_t)(((((uint64_t)(n582_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n558_funct2h)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.funct3_101=init
+    n686_funct3_101 = (uint8_t)(((uint64_t)(((((uint64_t)(n597_op_csrai)) != 0) || (((uint64_t)(n596_op_csrli)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rd_rs1s=init
+    n680_rd_rs1s = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n597_op_csrai)) != 0) || (((uint64_t)(n596_op_csrli)) != 0)))) != 0) || (((uint64_t)(n598_op_candi)) != 0)))) != 0) || (((uint64_t)(n599_op_caryth)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_clui_a16sp=init
+    n581_op_clui_a16sp = (uint8_t)(((uint64_t)(((((uint64_t)(n573_quad1)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x3ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_clui=init
+    n595_op_clui = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n581_op_clui_a16sp)) != 0) && (((uint64_t)((((uint64_t)(n556_rs1cl)) != 0x2ULL))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n556_rs1cl)) != 0))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_cu=init
+    n626_format_cu = (uint8_t)(((uint64_t)(n595_op_clui)));
+  }
+  {  // decoder_1.decoder_1.op_caddi16sp=init
+    n594_op_caddi16sp = (uint8_t)(((uint64_t)(((((uint64_t)(n581_op_clui_a16sp)) != 0) && (((uint64_t)((((uint64_t)(n556_rs1cl)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_c16sp=init
+    n627_format_c16sp = (uint8_t)(((uint64_t)(n594_op_caddi16sp)));
+  }
+  {  // decoder_1.decoder_1.op_cli=init
+    n580_op_cli = (uint8_t)(((uint64_t)(((((uint64_t)(n573_quad1)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_cjal=init
+    n579_op_cjal = (uint8_t)(((uint64_t)(((((uint64_t)(n573_quad1)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x1ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_cj=init
+    n629_format_cj = (uint8_t)(((uint64_t)(((((uint64_t)(n583_op_cj)) != 0) || (((uint64_t)(n579_op_cjal)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_caddi=init
+    n578_op_caddi = (uint8_t)(((uint64_t)(((((uint64_t)(n573_quad1)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rd_rs1l=init
+    n679_rd_rs1l = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n594_op_caddi16sp)) != 0) || (((uint64_t)(n578_op_caddi)) != 0)))) != 0) || (((uint64_t)(n580_op_cli)) != 0)))) != 0) || (((uint64_t)(n595_op_clui)) != 0)))) != 0) || (((uint64_t)(n586_op_cslli)) != 0)))) != 0) || (((uint64_t)(n605_op_cadd)) != 0)))) != 0) || (((uint64_t)(n604_op_cmv)) != 0)))) != 0) || (((uint64_t)(n587_op_clwsp)) != 0)))) != 0) || (((uint64_t)(n592_op_cflwsp)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rs1_rs1l=init
+    n670_rs1_rs1l = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n594_op_caddi16sp)) != 0) || (((uint64_t)(n578_op_caddi)) != 0)))) != 0) || (((uint64_t)(n586_op_cslli)) != 0)))) != 0) || (((uint64_t)(n606_op_cjr)) != 0)))) != 0) || (((uint64_t)(n607_op_cjalr)) != 0)))) != 0) || (((uint64_t)(n605_op_cadd)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_ci=init
+    n625_format_ci = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n578_op_caddi)) != 0) || (((uint64_t)(n580_op_cli)) != 0)))) != 0) || (((uint64_t)(n598_op_candi)) != 0)))) != 0) || (((uint64_t)(n586_op_cslli)) != 0)))) != 0) || (((uint64_t)(n597_op_csrai)) != 0)))) != 0) || (((uint64_t)(n596_op_csrli)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_csw=init
+    n577_op_csw = (uint8_t)(((uint64_t)(((((uint64_t)(n572_quad0)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x6ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rs2_rs2s=init
+    n674_rs2_rs2s = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n577_op_csw)) != 0) || (((uint64_t)(n599_op_caryth)) != 0)))) != 0) || (((uint64_t)(n591_op_cfsw)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_clw=init
+    n576_op_clw = (uint8_t)(((uint64_t)(((((uint64_t)(n572_quad0)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x2ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rs1_rs1s=init
+    n671_rs1_rs1s = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n576_op_clw)) != 0) || (((uint64_t)(n577_op_csw)) != 0)))) != 0) || (((uint64_t)(n597_op_csrai)) != 0)))) != 0) || (((uint64_t)(n596_op_csrli)) != 0)))) != 0) || (((uint64_t)(n598_op_candi)) != 0)))) != 0) || (((uint64_t)(n599_op_caryth)) != 0)))) != 0) || (((uint64_t)(n584_op_cbeqz)) != 0)))) != 0) || (((uint64_t)(n585_op_cbnez)) != 0)))) != 0) || (((uint64_t)(n590_op_cflw)) != 0)))) != 0) || (((uint64_t)(n591_op_cfsw)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_cls=init
+    n628_format_cls = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n576_op_clw)) != 0) || (((uint64_t)(n577_op_csw)) != 0)))) != 0) || (((uint64_t)(n590_op_cflw)) != 0)))) != 0) || (((uint64_t)(n591_op_cfsw)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_caddi4spn=init
+    n575_op_caddi4spn = (uint8_t)(((uint64_t)(((((uint64_t)(n572_quad0)) != 0) && (((uint64_t)((((uint64_t)(n553_copcode)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rd_rs2s=init
+    n678_rd_rs2s = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n575_op_caddi4spn)) != 0) || (((uint64_t)(n576_op_clw)) != 0)))) != 0) || (((uint64_t)(n590_op_cflw)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rs1_sp=init
+    n669_rs1_sp = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n575_op_caddi4spn)) != 0) || (((uint64_t)(n587_op_clwsp)) != 0)))) != 0) || (((uint64_t)(n588_op_cswsp)) != 0)))) != 0) || (((uint64_t)(n592_op_cflwsp)) != 0)))) != 0) || (((uint64_t)(n593_op_cfswsp)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_ciw=init
+    n624_format_ciw = (uint8_t)(((uint64_t)(n575_op_caddi4spn)));
+  }
+  {  // decoder_1.decoder_1.funct7=init
+    n552_funct7 = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 25) & 0x7FULL))));
+  }
+  {  // decoder_1.always@3464
+    { uint64_t t25 = 0x1ULL;
+    if ((t25 == ((uint64_t)(n690_funct7_normal)))) {
+      n689_funct7_mux = (uint8_t)(((uint64_t)(n552_funct7)));
+    } else {
+      n689_funct7_mux = (uint8_t)(((uint64_t)(((((uint64_t)0x0ULL) << 6) | (((uint64_t)((uint64_t)(n691_funct7_5))) << 5) | ((uint64_t)0x0ULL)))));
+    }
+    }
+  }
+  {  // decoder_1.assign@3484
+    n106_id1_funct7 = (uint8_t)(((uint64_t)(n689_funct7_mux)));
+  }
+  {  // decoder_1.decoder_1.funct3=init
+    n551_funct3 = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 12) & 0x7ULL))));
+  }
+  {  // decoder_1.decoder_1.rd=init
+    n550_rd = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 7) & 0x1FULL))));
+  }
+  {  // decoder_1.always@3424
+    { uint64_t t23 = 0x1ULL;
+    if ((t23 == ((uint64_t)(n677_rd_normal)))) {
+      n676_rd_mux = (uint8_t)(((uint64_t)(n550_rd)));
+    } else if ((t23 == ((uint64_t)(n679_rd_rs1l)))) {
+      n676_rd_mux = (uint8_t)(((uint64_t)(n556_rs1cl)));
+    } else if ((t23 == ((uint64_t)(n680_rd_rs1s)))) {
+      n676_rd_mux = (uint8_t)(((uint64_t)(n554_rs1cs)));
+    } else if ((t23 == ((uint64_t)(n678_rd_rs2s)))) {
+      n676_rd_mux = (uint8_t)(((uint64_t)(n555_rs2cs)));
+    } else {
+      n676_rd_mux = (uint8_t)(((uint64_t)(((((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)(((((uint64_t)(n579_op_cjal)) != 0) || (((uint64_t)(n607_op_cjalr)) != 0)))))))));
+    }
+    }
+  }
+  {  // decoder_1.assign@3495
+    n109_id1_rd = (uint8_t)(((uint64_t)(n676_rd_mux)));
+  }
+  {  // decoder_1.decoder_1.rs2=init
+    n549_rs2 = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 20) & 0x1FULL))));
+  }
+  {  // decoder_1.always@3406
+    { uint64_t t22 = 0x1ULL;
+    if ((t22 == ((uint64_t)(n673_rs2_normal)))) {
+      n672_rs2_mux = (uint8_t)(((uint64_t)(n549_rs2)));
+    } else if ((t22 == ((uint64_t)(n674_rs2_rs2s)))) {
+      n672_rs2_mux = (uint8_t)(((uint64_t)(n555_rs2cs)));
+    } else if ((t22 == ((uint64_t)(n675_rs2_rs2l)))) {
+      n672_rs2_mux = (uint8_t)(((uint64_t)(n557_rs2cl)));
+    } else {
+      n672_rs2_mux = (uint8_t)(0x0ULL);
+    }
+    }
+  }
+  {  // decoder_1.assign@3494
+    n108_id1_rs2 = (uint8_t)(((uint64_t)(n672_rs2_mux)));
+  }
+  {  // regs_i.i_addr_rd_d
+    n449_i_addr_rd_d = (uint8_t)(((uint64_t)(n108_id1_rs2)));
+  }
+  {  // decoder_1.decoder_1.opcode=init
+    n547_opcode = (uint8_t)(((uint64_t)((((uint64_t)(n97_id1_ir) >> 2) & 0x1FULL))));
+  }
+  {  // decoder_1.decoder_1.op_misc_mem=init
+    n571_op_misc_mem = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x3ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_system=init
+    n570_op_system = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x1CULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.system=init
+    n623_system = (uint8_t)(((uint64_t)(((((uint64_t)(n570_op_system)) != 0) || (((uint64_t)(n608_op_cebreak)) != 0)))));
+  }
+  {  // decoder_1.assign@3486
+    n121_id1_system = (uint8_t)(((uint64_t)(n623_system)));
+  }
+  {  // decoder_1.decoder_1.op_jal=init
+    n569_op_jal = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x1BULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.c_jal=init
+    n653_c_jal = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n569_op_jal)) != 0) || (((uint64_t)(n583_op_cj)) != 0)))) != 0) || (((uint64_t)(n579_op_cjal)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_j=init
+    n618_format_j = (uint8_t)(((uint64_t)(n569_op_jal)));
+  }
+  {  // decoder_1.decoder_1.op_jalr=init
+    n568_op_jalr = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x19ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.c_jalr=init
+    n654_c_jalr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n568_op_jalr)) != 0) || (((uint64_t)(n606_op_cjr)) != 0)))) != 0) || (((uint64_t)(n607_op_cjalr)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.jump=init
+    n665_jump = (uint8_t)(((uint64_t)(((((uint64_t)(n653_c_jal)) != 0) || (((uint64_t)(n654_c_jalr)) != 0)))));
+  }
+  {  // decoder_1.assign@3509
+    n113_id1_jump = (uint8_t)(((uint64_t)(n665_jump)));
+  }
+  {  // decoder_1.decoder_1.op_branch=init
+    n567_op_branch = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x18ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.branch=init
+    n666_branch = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n567_op_branch)) != 0) || (((uint64_t)(n584_op_cbeqz)) != 0)))) != 0) || (((uint64_t)(n585_op_cbnez)) != 0)))));
+  }
+  {  // decoder_1.assign@3508
+    n112_id1_branch = (uint8_t)(((uint64_t)(n666_branch)));
+  }
+  {  // decoder_1.decoder_1.c_branch=init
+    n655_c_branch = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n567_op_branch)) != 0) || (((uint64_t)(n584_op_cbeqz)) != 0)))) != 0) || (((uint64_t)(n585_op_cbnez)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.format_b=init
+    n619_format_b = (uint8_t)(((uint64_t)(n567_op_branch)));
+  }
+  {  // decoder_1.decoder_1.op_lui=init
+    n566_op_lui = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0xDULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.rs1=init
+    n548_rs1 = (uint8_t)((((uint64_t)((((uint64_t)(n97_id1_ir) >> 15) & 0x1FULL))) & ((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)((uint64_t)((((uint64_t)(n566_op_lui)) == 0))))))), 1, 5)))));
+  }
+  {  // decoder_1.always@3390
+    { uint64_t t21 = 0x1ULL;
+    if ((t21 == ((uint64_t)(n668_rs1_normal)))) {
+      n667_rs1_mux = (uint8_t)(((uint64_t)(n548_rs1)));
+    } else if ((t21 == ((uint64_t)(n670_rs1_rs1l)))) {
+      n667_rs1_mux = (uint8_t)(((uint64_t)(n556_rs1cl)));
+    } else if ((t21 == ((uint64_t)(n671_rs1_rs1s)))) {
+      n667_rs1_mux = (uint8_t)(((uint64_t)(n554_rs1cs)));
+    } else {
+      n667_rs1_mux = (uint8_t)(((uint64_t)(((((uint64_t)0x0ULL) << 2) | (((uint64_t)((uint64_t)(n669_rs1_sp))) << 1) | ((uint64_t)0x0ULL)))));
+    }
+    }
+  }
+  {  // decoder_1.assign@3493
+    n107_id1_rs1 = (uint8_t)(((uint64_t)(n667_rs1_mux)));
+  }
+  {  // regs_i.i_addr_rd_c
+    n448_i_addr_rd_c = (uint8_t)(((uint64_t)(n107_id1_rs1)));
+  }
+  {  // decoder_1.decoder_1.op_op=init
+    n565_op_op = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0xCULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.c_op_op=init
+    n652_c_op_op = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n565_op_op)) != 0) || (((uint64_t)(n599_op_caryth)) != 0)))) != 0) || (((uint64_t)(n605_op_cadd)) != 0)))) != 0) || (((uint64_t)(n604_op_cmv)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.alu_imm=init
+    n657_alu_imm = (uint8_t)(((uint64_t)((((uint64_t)(n652_c_op_op)) == 0))));
+  }
+  {  // decoder_1.assign@3512
+    n115_id1_alu_imm = (uint8_t)(((uint64_t)(n657_alu_imm)));
+  }
+  {  // decoder_1.decoder_1.format_r=init
+    n622_format_r = (uint8_t)(((uint64_t)(n565_op_op)));
+  }
+  {  // decoder_1.decoder_1.op_store=init
+    n564_op_store = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x8ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.c_op_store=init
+    n649_c_op_store = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n564_op_store)) != 0) || (((uint64_t)(n577_op_csw)) != 0)))) != 0) || (((uint64_t)(n588_op_cswsp)) != 0)))) != 0) || (((uint64_t)(n614_fp_store)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.hz_rs2=init
+    n664_hz_rs2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n655_c_branch)) != 0) || (((uint64_t)(n649_c_op_store)) != 0)))) != 0) || (((uint64_t)(n652_c_op_op)) != 0)))) != 0) || (((uint64_t)(n611_atomic_wr)) != 0)))) != 0) || (((uint64_t)(n615_fp_hz_rs2)) != 0)))));
+  }
+  {  // decoder_1.assign@3499
+    n111_id1_hz_rs2 = (uint8_t)(((uint64_t)(n664_hz_rs2)));
+  }
+  {  // hazard_1.assign@5473
+    n728_rs2_hz_en = (uint8_t)(((uint64_t)(((((uint64_t)(n111_id1_hz_rs2)) != 0) && (((uint64_t)((((uint64_t)(n108_id1_rs2)) != 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5516
+    n752_hz2_ex2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n728_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n108_id1_rs2)) == ((uint64_t)(n137_ex1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n138_ex1_wb_en)) != 0)))));
+  }
+  {  // hazard_1.assign@5496
+    n740_hz_ex2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n728_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n108_id1_rs2)) == ((uint64_t)(n65_ex_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n66_ex_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n752_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5513
+    n750_hz2_ma2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n728_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n108_id1_rs2)) == ((uint64_t)(n141_ma1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n142_ma1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n740_hz_ex2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n752_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5503
+    n746_hz_ex_rd2 = (uint8_t)(((uint64_t)(((((uint64_t)(n740_hz_ex2)) != 0) && (((uint64_t)(((uint64_t)(n64_ex_wb_mux) >> 0) & 1)) != 0)))));
+  }
+  {  // hazard_1.assign@5502
+    n745_hz_ex_ret2 = (uint8_t)(((uint64_t)(((((uint64_t)(n740_hz_ex2)) != 0) && (((uint64_t)((((uint64_t)(n64_ex_wb_mux)) == 0x2ULL))) != 0)))));
+  }
+  {  // hazard_1.assign@5501
+    n744_hz_ex_res2 = (uint8_t)(((uint64_t)(((((uint64_t)(n740_hz_ex2)) != 0) && (((uint64_t)((((uint64_t)(n64_ex_wb_mux)) == 0x0ULL))) != 0)))));
+  }
+  {  // hazard_1.assign@5484
+    n732_hz_ma2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n728_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n108_id1_rs2)) == ((uint64_t)(n157_ma_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n159_ma_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n750_hz2_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n740_hz_ex2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n752_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5509
+    n748_hz2_wb2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n728_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n108_id1_rs2)) == ((uint64_t)(n144_wb1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n145_wb1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n732_hz_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n750_hz2_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n740_hz_ex2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n752_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5491
+    n738_hz_ma_rd2 = (uint8_t)(((uint64_t)(((((uint64_t)(n732_hz_ma2)) != 0) && (((uint64_t)(((uint64_t)(n158_ma_wb_mux) >> 0) & 1)) != 0)))));
+  }
+  {  // hazard_1.assign@5490
+    n737_hz_ma_ret2 = (uint8_t)(((uint64_t)(((((uint64_t)(n732_hz_ma2)) != 0) && (((uint64_t)((((uint64_t)(n158_ma_wb_mux)) == 0x2ULL))) != 0)))));
+  }
+  {  // hazard_1.assign@5489
+    n736_hz_ma_res2 = (uint8_t)(((uint64_t)(((((uint64_t)(n732_hz_ma2)) != 0) && (((uint64_t)((((uint64_t)(n158_ma_wb_mux)) == 0x0ULL))) != 0)))));
+  }
+  {  // hazard_1.assign@5478
+    n730_hz_wb2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n728_rs2_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n108_id1_rs2)) == ((uint64_t)(n171_wb_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n172_wb_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n748_hz2_wb2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n732_hz_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n750_hz2_ma2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n740_hz_ex2)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n752_hz2_ex2)) == 0))) != 0)))));
+  }
+  {  // hazard_1.always@5557
+    { uint64_t t27 = 0x1ULL;
+    if ((t27 == ((uint64_t)(n730_hz_wb2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n175_wb_dat)));
+    } else if ((t27 == ((uint64_t)(n748_hz2_wb2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n143_wb1_wb_d)));
+    } else if ((t27 == ((uint64_t)(n750_hz2_ma2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n140_ma1_res)));
+    } else if ((t27 == ((uint64_t)(n752_hz2_ex2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n139_ex1_res)));
+    } else if ((t27 == ((uint64_t)(n736_hz_ma_res2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n152_ma_res)));
+    } else if ((t27 == ((uint64_t)(n737_hz_ma_ret2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n153_ma_ret)));
+    } else if ((t27 == ((uint64_t)(n738_hz_ma_rd2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n161_ma_ld_dat)));
+    } else if ((t27 == ((uint64_t)(n745_hz_ex_ret2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n54_ex_ret)));
+    } else if ((t27 == ((uint64_t)(n744_hz_ex_res2)))) {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n150_ex_res_dat)));
+    } else {
+      n754_rs2_d = (uint32_t)(((uint64_t)(n125_id1_rs2_raw_d)));
+    }
+    }
+  }
+  {  // hazard_1.assign@5684
+    n127_id1_rs2_d = (uint32_t)(((uint64_t)(n754_rs2_d)));
+  }
+  {  // decoder_1.decoder_1.format_s=init
+    n620_format_s = (uint8_t)(((uint64_t)(n564_op_store)));
+  }
+  {  // decoder_1.decoder_1.op_auipc=init
+    n563_op_auipc = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x5ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.hz_rs1=init
+    n663_hz_rs1 = (uint8_t)(((uint64_t)((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n566_op_lui)) != 0) || (((uint64_t)(n563_op_auipc)) != 0)))) != 0) || (((uint64_t)(n653_c_jal)) != 0)))) != 0) || (((uint64_t)(n604_op_cmv)) != 0)))) == 0))));
+  }
+  {  // decoder_1.assign@3498
+    n110_id1_hz_rs1 = (uint8_t)(((uint64_t)(n663_hz_rs1)));
+  }
+  {  // hazard_1.assign@5678
+    n123_id1_hz_pair = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n42_wb_en)) != 0) && (((uint64_t)((((uint64_t)(n31_rd)) != 0))) != 0)))) != 0) && (((uint64_t)(((((uint64_t)(((((uint64_t)(n110_id1_hz_rs1)) != 0) && (((uint64_t)((((uint64_t)(n107_id1_rs1)) == ((uint64_t)(n31_rd))))) != 0)))) != 0) || (((uint64_t)(((((uint64_t)(n111_id1_hz_rs2)) != 0) && (((uint64_t)((((uint64_t)(n108_id1_rs2)) == ((uint64_t)(n31_rd))))) != 0)))) != 0)))) != 0)))));
+  }
+  {  // hazard_1.assign@5472
+    n727_rs1_hz_en = (uint8_t)(((uint64_t)(((((uint64_t)(n110_id1_hz_rs1)) != 0) && (((uint64_t)((((uint64_t)(n107_id1_rs1)) != 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5515
+    n751_hz2_ex1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n727_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n107_id1_rs1)) == ((uint64_t)(n137_ex1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n138_ex1_wb_en)) != 0)))));
+  }
+  {  // hazard_1.assign@5494
+    n739_hz_ex1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n727_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n107_id1_rs1)) == ((uint64_t)(n65_ex_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n66_ex_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n751_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5511
+    n749_hz2_ma1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n727_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n107_id1_rs1)) == ((uint64_t)(n141_ma1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n142_ma1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n739_hz_ex1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n751_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5500
+    n743_hz_ex_rd1 = (uint8_t)(((uint64_t)(((((uint64_t)(n739_hz_ex1)) != 0) && (((uint64_t)(((uint64_t)(n64_ex_wb_mux) >> 0) & 1)) != 0)))));
+  }
+  {  // hazard_1.assign@5584
+    n756_hz_data = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n743_hz_ex_rd1)) != 0) || (((uint64_t)(n746_hz_ex_rd2)) != 0)))) != 0) || (((uint64_t)(n755_hz_ma_ld)) != 0)))));
+  }
+  {  // hazard_1.assign@5695
+    n122_id1_hz_data = (uint8_t)(((uint64_t)(n756_hz_data)));
+  }
+  {  // hazard_1.assign@5499
+    n742_hz_ex_ret1 = (uint8_t)(((uint64_t)(((((uint64_t)(n739_hz_ex1)) != 0) && (((uint64_t)((((uint64_t)(n64_ex_wb_mux)) == 0x2ULL))) != 0)))));
+  }
+  {  // hazard_1.assign@5498
+    n741_hz_ex_res1 = (uint8_t)(((uint64_t)(((((uint64_t)(n739_hz_ex1)) != 0) && (((uint64_t)((((uint64_t)(n64_ex_wb_mux)) == 0x0ULL))) != 0)))));
+  }
+  {  // hazard_1.assign@5482
+    n731_hz_ma1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n727_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n107_id1_rs1)) == ((uint64_t)(n157_ma_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n159_ma_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n749_hz2_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n739_hz_ex1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n751_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5507
+    n747_hz2_wb1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n727_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n107_id1_rs1)) == ((uint64_t)(n144_wb1_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n145_wb1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n731_hz_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n749_hz2_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n739_hz_ex1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n751_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_1.assign@5488
+    n735_hz_ma_rd1 = (uint8_t)(((uint64_t)(((((uint64_t)(n731_hz_ma1)) != 0) && (((uint64_t)(((uint64_t)(n158_ma_wb_mux) >> 0) & 1)) != 0)))));
+  }
+  {  // hazard_1.assign@5487
+    n734_hz_ma_ret1 = (uint8_t)(((uint64_t)(((((uint64_t)(n731_hz_ma1)) != 0) && (((uint64_t)((((uint64_t)(n158_ma_wb_mux)) == 0x2ULL))) != 0)))));
+  }
+  {  // hazard_1.assign@5486
+    n733_hz_ma_res1 = (uint8_t)(((uint64_t)(((((uint64_t)(n731_hz_ma1)) != 0) && (((uint64_t)((((uint64_t)(n158_ma_wb_mux)) == 0x0ULL))) != 0)))));
+  }
+  {  // hazard_1.assign@5476
+    n729_hz_wb1 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n727_rs1_hz_en)) != 0) && (((uint64_t)((((uint64_t)(n107_id1_rs1)) == ((uint64_t)(n171_wb_wb_reg))))) != 0)))) != 0) && (((uint64_t)(n172_wb_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n747_hz2_wb1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n731_hz_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n749_hz2_ma1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n739_hz_ex1)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n751_hz2_ex1)) == 0))) != 0)))));
+  }
+  {  // hazard_1.always@5530
+    { uint64_t t26 = 0x1ULL;
+    if ((t26 == ((uint64_t)(n729_hz_wb1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n175_wb_dat)));
+    } else if ((t26 == ((uint64_t)(n747_hz2_wb1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n143_wb1_wb_d)));
+    } else if ((t26 == ((uint64_t)(n749_hz2_ma1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n140_ma1_res)));
+    } else if ((t26 == ((uint64_t)(n751_hz2_ex1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n139_ex1_res)));
+    } else if ((t26 == ((uint64_t)(n733_hz_ma_res1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n152_ma_res)));
+    } else if ((t26 == ((uint64_t)(n734_hz_ma_ret1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n153_ma_ret)));
+    } else if ((t26 == ((uint64_t)(n735_hz_ma_rd1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n161_ma_ld_dat)));
+    } else if ((t26 == ((uint64_t)(n742_hz_ex_ret1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n54_ex_ret)));
+    } else if ((t26 == ((uint64_t)(n741_hz_ex_res1)))) {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n150_ex_res_dat)));
+    } else {
+      n753_rs1_d = (uint32_t)(((uint64_t)(n124_id1_rs1_raw_d)));
+    }
+    }
+  }
+  {  // hazard_1.assign@5683
+    n126_id1_rs1_d = (uint32_t)(((uint64_t)(n753_rs1_d)));
+  }
+  {  // decoder_1.decoder_1.alu_pc=init
+    n656_alu_pc = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n653_c_jal)) != 0) || (((uint64_t)(n563_op_auipc)) != 0)))) != 0) || (((uint64_t)(n655_c_branch)) != 0)))));
+  }
+  {  // decoder_1.assign@3511
+    n114_id1_alu_pc = (uint8_t)(((uint64_t)(n656_alu_pc)));
+  }
+  {  // decoder_1.decoder_1.format_u=init
+    n617_format_u = (uint8_t)(((uint64_t)(((((uint64_t)(n563_op_auipc)) != 0) || (((uint64_t)(n566_op_lui)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_op_imm=init
+    n562_op_op_imm = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x4ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.c_op_op_imm=init
+    n651_c_op_op_imm = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n562_op_op_imm)) != 0) || (((uint64_t)(((((uint64_t)(n582_op_calu)) != 0) && (((uint64_t)((((uint64_t)(n599_op_caryth)) == 0))) != 0)))) != 0)))) != 0) || (((uint64_t)(n586_op_cslli)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.alu_en=init
+    n658_alu_en = (uint8_t)(((uint64_t)(((((uint64_t)(n652_c_op_op)) != 0) || (((uint64_t)(n651_c_op_op_imm)) != 0)))));
+  }
+  {  // decoder_1.assign@3513
+    n116_id1_alu_en = (uint8_t)(((uint64_t)(n658_alu_en)));
+  }
+  {  // assign@8892
+    n101_id1_md = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n116_id1_alu_en)) != 0) && (((uint64_t)((((uint64_t)(n115_id1_alu_imm)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n106_id1_funct7)) == 0x1ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.op_load=init
+    n561_op_load = (uint8_t)(((uint64_t)(((((uint64_t)(n560_quad3)) != 0) && (((uint64_t)((((uint64_t)(n547_opcode)) == 0x0ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.c_op_load=init
+    n650_c_op_load = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n561_op_load)) != 0) || (((uint64_t)(n576_op_clw)) != 0)))) != 0) || (((uint64_t)(n587_op_clwsp)) != 0)))) != 0) || (((uint64_t)(n613_fp_load)) != 0)))));
+  }
+  {  // decoder_1.decoder_1.funct3_010=init
+    n684_funct3_010 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n649_c_op_store)) != 0) || (((uint64_t)(n650_c_op_load)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n560_quad3)) == 0))) != 0)))));
+  }
+  {  // decoder_1.always@3445
+    { uint64_t t24 = 0x1ULL;
+    if ((t24 == ((uint64_t)(n682_funct3_normal)))) {
+      n681_funct3_mux = (uint8_t)(((uint64_t)(n551_funct3)));
+    } else if ((t24 == ((uint64_t)(n683_funct3_001)))) {
+      n681_funct3_mux = (uint8_t)(0x1ULL);
+    } else if ((t24 == ((uint64_t)(n684_funct3_010)))) {
+      n681_funct3_mux = (uint8_t)(0x2ULL);
+    } else if ((t24 == ((uint64_t)(n685_funct3_100)))) {
+      n681_funct3_mux = (uint8_t)(0x4ULL);
+    } else if ((t24 == ((uint64_t)(n686_funct3_101)))) {
+      n681_funct3_mux = (uint8_t)(0x5ULL);
+    } else if ((t24 == ((uint64_t)(n687_funct3_110)))) {
+      n681_funct3_mux = (uint8_t)(0x6ULL);
+    } else if ((t24 == ((uint64_t)(n688_funct3_111)))) {
+      n681_funct3_mux = (uint8_t)(0x7ULL);
+    } else {
+      n681_funct3_mux = (uint8_t)(0x0ULL);
+    }
+    }
+  }
+  {  // decoder_1.assign@3483
+    n105_id1_funct3 = (uint8_t)(((uint64_t)(n681_funct3_mux)));
+  }
+  {  // assign@8893
+    n102_id1_shift = (uint8_t)(((uint64_t)(((((uint64_t)(n116_id1_alu_en)) != 0) && (((uint64_t)((((uint64_t)((((uint64_t)(n105_id1_funct3) >> 0) & 0x3ULL))) == 0x1ULL))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.wb_mux=init
+    n659_wb_mux = (uint8_t)(((uint64_t)(((((uint64_t)((uint64_t)(((((uint64_t)(((((uint64_t)(n653_c_jal)) != 0) || (((uint64_t)(n654_c_jalr)) != 0)))) != 0) || (((uint64_t)(n612_fpu_en)) != 0))))) << 1) | ((uint64_t)((uint64_t)(((((uint64_t)(((((uint64_t)(n650_c_op_load)) != 0) || (((uint64_t)(n609_op_atomic)) != 0)))) != 0) || (((uint64_t)(n612_fpu_en)) != 0)))))))));
+  }
+  {  // decoder_1.assign@3527
+    n119_id1_wb_mux = (uint8_t)(((uint64_t)(n659_wb_mux)));
+  }
+  {  // decoder_1.decoder_1.format_i=init
+    n621_format_i = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n561_op_load)) != 0) || (((uint64_t)(n562_op_op_imm)) != 0)))) != 0) || (((uint64_t)(n568_op_jalr)) != 0)))) != 0) || (((uint64_t)(n570_op_system)) != 0)))));
+  }
+  {  // decoder_1.always@3285
+    { uint64_t t20 = 0x1ULL;
+    if ((t20 == ((uint64_t)(n624_format_ciw)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n639_immediate_ciw)));
+    } else if ((t20 == ((uint64_t)(n625_format_ci)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n640_immediate_ci)));
+    } else if ((t20 == ((uint64_t)(n626_format_cu)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n641_immediate_cu)));
+    } else if ((t20 == ((uint64_t)(n627_format_c16sp)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n642_immediate_c16sp)));
+    } else if ((t20 == ((uint64_t)(n628_format_cls)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n643_immediate_cls)));
+    } else if ((t20 == ((uint64_t)(n629_format_cj)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n644_immediate_cj)));
+    } else if ((t20 == ((uint64_t)(n630_format_cb)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n645_immediate_cb)));
+    } else if ((t20 == ((uint64_t)(n631_format_cssp)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n646_immediate_cssp)));
+    } else if ((t20 == ((uint64_t)(n632_format_clsp)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n647_immediate_clsp)));
+    } else if ((t20 == ((uint64_t)(n608_op_cebreak)))) {
+      n648_immediate_mux = (uint32_t)(0x1ULL);
+    } else if ((t20 == ((uint64_t)(n617_format_u)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n634_immediate_u)));
+    } else if ((t20 == ((uint64_t)(n618_format_j)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n635_immediate_j)));
+    } else if ((t20 == ((uint64_t)(n619_format_b)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n636_immediate_b)));
+    } else if ((t20 == ((uint64_t)(n621_format_i)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n638_immediate_i)));
+    } else if ((t20 == ((uint64_t)(n620_format_s)))) {
+      n648_immediate_mux = (uint32_t)(((uint64_t)(n637_immediate_s)));
+    } else {
+      n648_immediate_mux = (uint32_t)(0x0ULL);
+    }
+    }
+  }
+  {  // decoder_1.assign@3482
+    n104_id1_imm = (uint32_t)(((uint64_t)(n648_immediate_mux)));
+  }
+  {  // decoder_1.decoder_1.opcode_valid=init
+    n633_opcode_valid = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n589_op_cjr_mv_add)) != 0) || (((uint64_t)(n582_op_calu)) != 0)))) != 0) || (((uint64_t)(n624_format_ciw)) != 0)))) != 0) || (((uint64_t)(n625_format_ci)) != 0)))) != 0) || (((uint64_t)(n626_format_cu)) != 0)))) != 0) || (((uint64_t)(n627_format_c16sp)) != 0)))) != 0) || (((uint64_t)(n628_format_cls)) != 0)))) != 0) || (((uint64_t)(n629_format_cj)) != 0)))) != 0) || (((uint64_t)(n630_format_cb)) != 0)))) != 0) || (((uint64_t)(n631_format_cssp)) != 0)))) != 0) || (((uint64_t)(n632_format_clsp)) != 0)))) != 0) || (((uint64_t)(n609_op_atomic)) != 0)))) != 0) || (((uint64_t)(n612_fpu_en)) != 0)))) != 0) || (((uint64_t)(n571_op_misc_mem)) != 0)))) != 0) || (((uint64_t)(n617_format_u)) != 0)))) != 0) || (((uint64_t)(n618_format_j)) != 0)))) != 0) || (((uint64_t)(n619_format_b)) != 0)))) != 0) || (((uint64_t)(n621_format_i)) != 0)))) != 0) || (((uint64_t)(n620_format_s)) != 0)))) != 0) || (((uint64_t)(n622_format_r)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n616_bm_illegal)) == 0))) != 0)))));
+  }
+  {  // decoder_1.decoder_1.wb_en=init
+    n662_wb_en = (uint8_t)(((uint64_t)(((((uint64_t)((((uint64_t)(((((uint64_t)(n649_c_op_store)) != 0) || (((uint64_t)(n655_c_branch)) != 0)))) == 0))) != 0) && (((uint64_t)(n633_opcode_valid)) != 0)))));
+  }
+  {  // decoder_1.assign@3528
+    n120_id1_wb_en = (uint8_t)(((uint64_t)(n662_wb_en)));
+  }
+  {  // decoder_1.decoder_1.ma_rd=init
+    n661_ma_rd = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n650_c_op_load)) != 0) || (((uint64_t)(n610_atomic_rd)) != 0)))) != 0) && (((uint64_t)(n633_opcode_valid)) != 0)))));
+  }
+  {  // decoder_1.assign@3525
+    n118_id1_ma_rd = (uint8_t)(((uint64_t)(n661_ma_rd)));
+  }
+  {  // decoder_1.decoder_1.ma_wr=init
+    n660_ma_wr = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n649_c_op_store)) != 0) || (((uint64_t)(n611_atomic_wr)) != 0)))) != 0) && (((uint64_t)(n633_opcode_valid)) != 0)))));
+  }
+  {  // decoder_1.assign@3524
+    n117_id1_ma_wr = (uint8_t)(((uint64_t)(n660_ma_wr)));
+  }
+  {  // fetch_i.assign@4613
+    n246_id1_c = (uint8_t)(((uint64_t)((((uint64_t)((((uint64_t)(n244_id1_lo) >> 0) & 0x3ULL))) != 0x3ULL))));
+  }
+  {  // fetch_i.assign@4596
+    n238_id_valid = (uint8_t)(((uint64_t)(((((uint64_t)((((uint64_t)(n233_q_cnt)) >= 0x2ULL))) != 0) || (((uint64_t)(((((uint64_t)((((uint64_t)(n233_q_cnt)) == 0x1ULL))) != 0) && (((uint64_t)(n237_id_c)) != 0)))) != 0)))));
+  }
+  {  // fetch_i.assign@4645
+    n22_hz_br = (uint8_t)(((uint64_t)((((uint64_t)(n238_id_valid)) == 0))));
+  }
+  {  // assign@8928
+    n45_id_bubble = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n22_hz_br)) != 0) || (((uint64_t)(n44_hz_data)) != 0)))) != 0) || (((uint64_t)(n75_br_miss)) != 0)))) != 0) || (((uint64_t)(n80_trap_br_en)) != 0)))));
+  }
+  {  // assign@8768
+    n92_id_ras_pop = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n35_jump)) != 0) && (((uint64_t)((((uint64_t)(n36_alu_pc)) == 0))) != 0)))) != 0) && (((uint64_t)(n90_id_link_rs1)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(((((uint64_t)(n89_id_link_rd)) != 0) && (((uint64_t)((((uint64_t)(n29_rs1)) == ((uint64_t)(n31_rd))))) != 0)))) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n45_id_bubble)) == 0))) != 0)))));
+  }
+  {  // assign@8767
+    n91_id_ras_push = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n35_jump)) != 0) && (((uint64_t)(n89_id_link_rd)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n45_id_bubble)) == 0))) != 0)))));
+  }
+  {  // fetch_i.assign@4614
+    n247_id1_valid = (uint8_t)(((uint64_t)(((((uint64_t)(n238_id_valid)) != 0) && (((uint64_t)((((uint64_t)(n233_q_cnt)) >= ((((((uint64_t)(n237_id_c))) ? 0x1ULL : 0x2ULL) + ((((uint64_t)(n246_id1_c))) ? 0x1ULL : 0x2ULL)) & 0x7ULL)))) != 0)))));
+  }
+  {  // fetch_i.assign@4642
+    n98_id1_valid = (uint8_t)(((uint64_t)(n247_id1_valid)));
+  }
+  {  // assign@8894
+    n100_id1_simple = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n98_id1_valid)) != 0) && (((uint64_t)(n120_id1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n119_id1_wb_mux)) == 0x0ULL))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n112_id1_branch)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n113_id1_jump)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n117_id1_ma_wr)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n118_id1_ma_rd)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n121_id1_system)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n101_id1_md)) == 0))) != 0)))));
+  }
+  {  // fetch_i.assign@4533
+    n230_push_1 = (uint16_t)(((uint64_t)((((uint64_t)(i_data_in_i) >> 16) & 0xFFFFULL))));
+  }
+  {  // fetch_i.assign@4532
+    n229_push_0 = (uint16_t)(((((uint64_t)(((uint64_t)(n225_fetch_pc) >> 1) & 1))) ? ((uint64_t)((((uint64_t)(i_data_in_i) >> 16) & 0xFFFFULL))) : ((uint64_t)((((uint64_t)(i_data_in_i) >> 0) & 0xFFFFULL)))));
+  }
+  {  // fetch_i.assign@4531
+    n228_push_cnt = (uint8_t)(((((uint64_t)(((uint64_t)(n225_fetch_pc) >> 1) & 1))) ? 0x1ULL : 0x2ULL));
+  }
+  {  // fetch_i.assign@4528
+    n231_if_addr = (uint32_t)(((uint64_t)(n225_fetch_pc)));
+  }
+  {  // fetch_i.assign@4635
+    n18_if_addr = (uint32_t)(((uint64_t)(n231_if_addr)));
+  }
+  {  // assign@9777
+    o_addr_i = (uint32_t)(((uint64_t)(n18_if_addr)));
+  }
+  {  // fetch_i.assign@4446
+    n88_ras_valid = (uint8_t)(((uint64_t)((((uint64_t)(n222_ras_cnt)) != 0))));
+  }
+  {  // assign@8770
+    n93_id_ras_go = (uint8_t)(((uint64_t)(((((uint64_t)(n92_id_ras_pop)) != 0) && (((uint64_t)(n88_ras_valid)) != 0)))));
+  }
+  {  // fetch_i.assign@4445
+    n87_ras_top = (uint32_t)(((uint64_t)(n220_ras_data[((uint64_t)(n221_ras_ptr))])));
+  }
+  {  // fetch_i.assign@4443
+    uint64_t t8 = ((((uint64_t)(n221_ras_ptr)) - 0x1ULL) & 0xFFFFFFFFULL);
+    n224_ras_ptr_dec = (uint8_t)((t8 & 0x3ULL));
+  }
+  {  // fetch_i.assign@4442
+    uint64_t t7 = ((((uint64_t)(n221_ras_ptr)) + 0x1ULL) & 0xFFFFFFFFULL);
+    n223_ras_ptr_inc = (uint8_t)((t7 & 0x3ULL));
+  }
+  {  // fetch_i.predictor_i.assign@4266
+    n270_upd_tag = (uint32_t)(((uint64_t)((((uint64_t)(n53_ex_pc) >> 5) & 0x7FFFFFFULL))));
+  }
+  {  // fetch_i.predictor_i.assign@4265
+    n269_upd_idx = (uint8_t)(((uint64_t)((((uint64_t)(n53_ex_pc) >> 1) & 0xFULL))));
+  }
+  {  // fetch_i.predictor_i.assign@4270
+    n272_upd_cnt = (uint8_t)(((uint64_t)(n262_btb_cnt[((uint64_t)(n269_upd_idx))])));
+  }
+  {  // fetch_i.predictor_i.assign@4272
+    n274_upd_cnt_dec = (uint8_t)(((((uint64_t)((((uint64_t)(n272_upd_cnt)) == 0)))) ? ((uint64_t)(n272_upd_cnt)) : ((((uint64_t)(n272_upd_cnt)) - 0x1ULL) & 0x3ULL)));
+  }
+  {  // fetch_i.predictor_i.assign@4271
+    n273_upd_cnt_inc = (uint8_t)(((((uint64_t)((((uint64_t)(n272_upd_cnt)) == 0x3ULL)))) ? ((uint64_t)(n272_upd_cnt)) : ((((uint64_t)(n272_upd_cnt)) + 0x1ULL) & 0x3ULL)));
+  }
+  {  // fetch_i.predictor_i.assign@4267
+    n271_upd_hit = (uint8_t)(((uint64_t)(((((uint64_t)(n264_btb_valid[((uint64_t)(n269_upd_idx))])) != 0) && (((uint64_t)((((uint64_t)(n261_btb_tag[((uint64_t)(n269_upd_idx))])) == ((uint64_t)(n270_upd_tag))))) != 0)))));
+  }
+  {  // fetch_i.predictor_i.assign@4252
+    uint64_t t1 = 0x0ULL;
+    n219_bp_pred_idx = (uint8_t)((t1 & 0x3FULL));
+  }
+  {  // fetch_i.assign@4625
+    n25_id_pred_idx = (uint8_t)(((uint64_t)(n219_bp_pred_idx)));
+  }
+  {  // fetch_i.predictor_i.assign@4245
+    n266_if_tag = (uint32_t)(((uint64_t)((((uint64_t)(n216_bp_pc) >> 5) & 0x7FFFFFFULL))));
+  }
+  {  // fetch_i.predictor_i.assign@4244
+    n265_if_idx = (uint8_t)(((uint64_t)((((uint64_t)(n216_bp_pc) >> 1) & 0xFULL))));
+  }
+  {  // fetch_i.predictor_i.assign@4258
+    n218_bp_pred_addr = (uint32_t)(((uint64_t)(((((uint64_t)((uint64_t)(n260_btb_addr[((uint64_t)(n265_if_idx))]))) << 1) | ((uint64_t)0x0ULL)))));
+  }
+  {  // fetch_i.assign@4624
+    n24_id_pred_addr = (uint32_t)(((uint64_t)(n218_bp_pred_addr)));
+  }
+  {  // fetch_i.predictor_i.assign@4253
+    n268_if_dir = (uint8_t)(((uint64_t)(((uint64_t)(n262_btb_cnt[((uint64_t)(n265_if_idx))]) >> 1) & 1)));
+  }
+  {  // fetch_i.predictor_i.assign@4246
+    n267_if_hit = (uint8_t)(((uint64_t)(((((uint64_t)(n264_btb_valid[((uint64_t)(n265_if_idx))])) != 0) && (((uint64_t)((((uint64_t)(n261_btb_tag[((uint64_t)(n265_if_idx))])) == ((uint64_t)(n266_if_tag))))) != 0)))));
+  }
+  {  // fetch_i.predictor_i.assign@4257
+    n217_bp_pred = (uint8_t)(((uint64_t)(((((uint64_t)(n267_if_hit)) != 0) && (((uint64_t)(((((uint64_t)(n263_btb_jump[((uint64_t)(n265_if_idx))])) != 0) || (((uint64_t)(n268_if_dir)) != 0)))) != 0)))));
+  }
+  {  // fetch_i.assign@4619
+    n242_pred_t0 = (uint8_t)(((uint64_t)(((((uint64_t)(n217_bp_pred)) != 0) && (((uint64_t)(n238_id_valid)) != 0)))));
+  }
+  {  // fetch_i.assign@4623
+    n23_id_pred = (uint8_t)(((uint64_t)(n242_pred_t0)));
+  }
+  {  // assign@8905
+    n103_id_pair = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)((((uint64_t)(n20_id_ir)) != 0))) != 0) && (((uint64_t)((((uint64_t)(n23_id_pred)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n34_branch)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n35_jump)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n43_system)) == 0))) != 0)))));
+  }
+  {  // assign@8913
+    n99_id1_issue = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n103_id_pair)) != 0) && (((uint64_t)(n100_id1_simple)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n122_id1_hz_data)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n123_id1_hz_pair)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n45_id_bubble)) == 0))) != 0)))));
+  }
+  {  // assign@8773
+    n86_id_ras_redir = (uint8_t)(((uint64_t)(((((uint64_t)(n93_id_ras_go)) != 0) && (((uint64_t)((((uint64_t)(((((uint64_t)(n23_id_pred)) != 0) && (((uint64_t)((((uint64_t)(n24_id_pred_addr)) == ((uint64_t)(n87_ras_top))))) != 0)))) == 0))) != 0)))));
+  }
+  {  // assign@8746
+    n82_id_jal_go = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n84_id_jal)) != 0) && (((uint64_t)((((uint64_t)(n23_id_pred)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n45_id_bubble)) == 0))) != 0)))));
+  }
+  {  // assign@8920
+    n78_fetch_br_addr = (uint32_t)(((((uint64_t)(n80_trap_br_en))) ? ((uint64_t)(n81_trap_br_addr)) : ((((uint64_t)(n75_br_miss))) ? ((uint64_t)(n76_br_addr)) : ((((uint64_t)(n82_id_jal_go))) ? ((uint64_t)(n83_id_jal_addr)) : ((uint64_t)(n87_ras_top))))));
+  }
+  {  // assign@8919
+    n77_fetch_br_en = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n80_trap_br_en)) != 0) || (((uint64_t)(n75_br_miss)) != 0)))) != 0) || (((uint64_t)(n82_id_jal_go)) != 0)))) != 0) || (((uint64_t)(n86_id_ras_redir)) != 0)))));
+  }
+  {  // fetch_i.assign@4597
+    n239_take = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n238_id_valid)) != 0) && (((uint64_t)((((uint64_t)(n44_hz_data)) == 0))) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n77_fetch_br_en)) == 0))) != 0)))));
+  }
+  {  // fetch_i.assign@4599
+    n240_take_cnt = (uint8_t)(((((uint64_t)((((uint64_t)(n239_take)) == 0)))) ? 0x0ULL : ((((((uint64_t)(n237_id_c))) ? 0x1ULL : 0x2ULL) + ((((uint64_t)((((uint64_t)(n99_id1_issue)) == 0)))) ? 0x0ULL : ((((uint64_t)(n246_id1_c))) ? 0x1ULL : 0x2ULL))) & 0x7ULL)));
+  }
+  {  // fetch_i.assign@4620
+    n243_redirect = (uint8_t)(((uint64_t)(((((uint64_t)(n242_pred_t0)) != 0) && (((uint64_t)(n239_take)) != 0)))));
+  }
+  {  // assign@8421
+    n15_clk_n = (uint8_t)(((uint64_t)((((uint64_t)(i_clk)) == 0))));
+  }
+  {  // assign@8415
+    n16_fetch_ce = (uint8_t)(((uint64_t)(i_clk_ce)));
+  }
+  {  // assign@8407
+    n13_core_ce = (uint8_t)(((uint64_t)(((((uint64_t)(i_clk_ce)) != 0) && (((uint64_t)((((uint64_t)(n147_alu_busy)) == 0))) != 0)))));
+  }
+  {  // assign@9578
+    n165_ma_rd_en = (uint8_t)((((uint64_t)(n156_ma_rd)) & ((uint64_t)(n13_core_ce))));
+  }
+  {  // assign@9778
+    o_rd_d = (uint8_t)(((uint64_t)(n165_ma_rd_en)));
+  }
+  {  // assign@9577
+    n164_ma_wr_en = (uint8_t)((((uint64_t)(n163_ma_we)) & ((uint64_t)(REPL64((uint64_t)((uint64_t)((((uint64_t)(((uint64_t)(n155_ma_wr)) & ((uint64_t)(n13_core_ce))))))), 1, 4)))));
+  }
+  {  // assign@9779
+    o_wr_d = (uint8_t)(((uint64_t)(n164_ma_wr_en)));
+  }
+  {  // assign@8411
+    n14_clk_ce = (uint8_t)(((uint64_t)(((((uint64_t)(n13_core_ce)) != 0) && (((uint64_t)(i_ready_d)) != 0)))));
+  }
+  {  // assign@9375
+    n183_csr_events = (uint8_t)(((uint64_t)(((((uint64_t)((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(((((uint64_t)(n156_ma_rd)) != 0) || (((uint64_t)(n155_ma_wr)) != 0)))) != 0))))) << 6) | (((uint64_t)((uint64_t)(((((uint64_t)(i_clk_ce)) != 0) && (((uint64_t)(n147_alu_busy)) != 0))))) << 5) | (((uint64_t)((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n75_br_miss)) != 0))))) << 4) | (((uint64_t)((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n44_hz_data)) != 0))))) << 3) | (((uint64_t)((uint64_t)(((((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n69_ex_valid)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n79_trap_go)) == 0))) != 0))))) << 2) | (((uint64_t)0x0ULL) << 1) | ((uint64_t)((uint64_t)(i_clk_ce)))))));
+  }
+  {  // csr_i.i_instret_2
+    n910_i_instret_2 = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n138_ex1_wb_en)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(n79_trap_go)) == 0))) != 0)))));
+  }
+  {  // csr_i.counters_i.cnt[6].counter.assign@7536
+    n955_step = (uint64_t)(((((uint64_t)(((((uint64_t)((0x6ULL == 0x2ULL))) != 0) && (((uint64_t)(n910_i_instret_2)) != 0))))) ? 0x2ULL : 0x1ULL));
+  }
+  {  // csr_i.counters_i.cnt[5].counter.assign@7536
+    n953_step = (uint64_t)(((((uint64_t)(((((uint64_t)((0x5ULL == 0x2ULL))) != 0) && (((uint64_t)(n910_i_instret_2)) != 0))))) ? 0x2ULL : 0x1ULL));
+  }
+  {  // csr_i.counters_i.cnt[4].counter.assign@7536
+    n951_step = (uint64_t)(((((uint64_t)(((((uint64_t)((0x4ULL == 0x2ULL))) != 0) && (((uint64_t)(n910_i_instret_2)) != 0))))) ? 0x2ULL : 0x1ULL));
+  }
+  {  // csr_i.counters_i.cnt[3].counter.assign@7536
+    n949_step = (uint64_t)(((((uint64_t)(((((uint64_t)((0x3ULL == 0x2ULL))) != 0) && (((uint64_t)(n910_i_instret_2)) != 0))))) ? 0x2ULL : 0x1ULL));
+  }
+  {  // csr_i.counters_i.cnt[2].counter.assign@7536
+    n947_step = (uint64_t)(((((uint64_t)(((((uint64_t)((0x2ULL == 0x2ULL))) != 0) && (((uint64_t)(n910_i_instret_2)) != 0))))) ? 0x2ULL : 0x1ULL));
+  }
+  {  // csr_i.counters_i.cnt[0].counter.assign@7536
+    n945_step = (uint64_t)(((((uint64_t)(((((uint64_t)((0x0ULL == 0x2ULL))) != 0) && (((uint64_t)(n910_i_instret_2)) != 0))))) ? 0x2ULL : 0x1ULL));
+  }
+  {  // csr_i.counters_i.i_wr
+    n925_i_wr = (uint8_t)(((uint64_t)(((((uint64_t)(n919_write_enable)) != 0) && (((uint64_t)(n14_clk_ce)) != 0)))));
+  }
+  {  // csr_i.counters_i.assign@7521
+    n941_wr_hi = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n925_i_wr)) != 0) && (((uint64_t)(n935_sel_machine)) != 0)))) != 0) && (((uint64_t)(n937_sel_count)) != 0)))) != 0) && (((uint64_t)(((uint64_t)(n907_i_addr) >> 7) & 1)) != 0)))));
+  }
+  {  // csr_i.counters_i.assign@7520
+    n940_wr_lo = (uint8_t)(((uint64_t)(((((uint64_t)(((((uint64_t)(((((uint64_t)(n925_i_wr)) != 0) && (((uint64_t)(n935_sel_machine)) != 0)))) != 0) && (((uint64_t)(n937_sel_count)) != 0)))) != 0) && (((uint64_t)((((uint64_t)(((uint64_t)(n907_i_addr) >> 7) & 1)) == 0))) != 0)))));
+  }
+  {  // fetch_i.i_bp_en
+    n193_i_bp_en = (uint8_t)(((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(((((uint64_t)(n58_ex_branch)) != 0) || (((uint64_t)(n57_ex_jump)) != 0)))) != 0)))));
+  }
+  {  // fetch_i.assign@4560
+    n241_pop_cnt = (uint8_t)(((((uint64_t)(n14_clk_ce))) ? ((uint64_t)(n240_take_cnt)) : 0x0ULL));
+  }
+  {  // fetch_i.assign@4561
+    n236_rem_cnt = (uint8_t)(((((uint64_t)(n233_q_cnt)) - ((uint64_t)(n241_pop_cnt))) & 0x7ULL));
+  }
+  {  // fetch_i.genblk[3].assign@4543
+    { uint64_t i_ = (uint64_t)S64(0x3ULL, 32); if (i_ < 4ULL) n235_q_rem[i_] = (uint16_t)(((uint64_t)(((uint64_t)((((0x3ULL + ((uint64_t)(n241_pop_cnt))) & 0xFFFFFFFFULL) & 0x3ULL)) < 4ULL ? n232_q_data[(uint64_t)((((0x3ULL + ((uint64_t)(n241_pop_cnt))) & 0xFFFFFFFFULL) & 0x3ULL))] : 0)))); }
+  }
+  {  // fetch_i.genblk[2].assign@4543
+    { uint64_t i_ = (uint64_t)S64(0x2ULL, 32); if (i_ < 4ULL) n235_q_rem[i_] = (uint16_t)(((uint64_t)(((uint64_t)((((0x2ULL + ((uint64_t)(n241_pop_cnt))) & 0xFFFFFFFFULL) & 0x3ULL)) < 4ULL ? n232_q_data[(uint64_t)((((0x2ULL + ((uint64_t)(n241_pop_cnt))) & 0xFFFFFFFFULL) & 0x3ULL))] : 0)))); }
+  }
+  {  // fetch_i.genblk[1].assign@4543
+    { uint64_t i_ = (uint64_t)S64(0x1ULL, 32); if (i_ < 4ULL) n235_q_rem[i_] = (uint16_t)(((uint64_t)(((uint64_t)((((0x1ULL + ((uint64_t)(n241_pop_cnt))) & 0xFFFFFFFFULL) & 0x3ULL)) < 4ULL ? n232_q_data[(uint64_t)((((0x1ULL + ((uint64_t)(n241_pop_cnt))) & 0xFFFFFFFFULL) & 0x3ULL))] : 0)))); }
+  }
+  {  // fetch_i.genblk[0].assign@4543
+    { uint64_t i_ = (uint64_t)S64(0x0ULL, 32); if (i_ < 4ULL) n235_q_rem[i_] = (uint16_t)(((uint64_t)(((uint64_t)((((0x0ULL + ((uint64_t)(n241_pop_cnt))) & 0xFFFFFFFFULL) & 0x3ULL)) < 4ULL ? n232_q_data[(uint64_t)((((0x0ULL + ((uint64_t)(n241_pop_cnt))) & 0xFFFFFFFFULL) & 0x3ULL))] : 0)))); }
+  }
+  {  // fetch_i.assign@4513
+    n227_fetch_en = (uint8_t)(((uint64_t)(((((uint64_t)(i_ready_i)) != 0) && (((uint64_t)((((((uint64_t)(n233_q_cnt)) - ((uint64_t)(n241_pop_cnt))) & 0x7ULL) <= 0x2ULL))) != 0)))));
+  }
+  {  // fetch_i.assign@4515
+    n226_fetch_next = (uint32_t)(((((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n77_fetch_br_en)) != 0))))) ? ((uint64_t)(n78_fetch_br_addr)) : ((((uint64_t)(((((uint64_t)(n14_clk_ce)) != 0) && (((uint64_t)(n243_redirect)) != 0))))) ? ((uint64_t)(n218_bp_pred_addr)) : ((((uint64_t)(n227_fetch_en))) ? ((uint64_t)(((((uint64_t)((((uint64_t)((((uint64_t)(n225_fetch_pc) >> 2) & 0x3FFFFFFFULL))) + 0x1ULL) & 0x3FFFFFFFULL)) << 2) | ((uint64_t)0x0ULL)))) : ((uint64_t)(n225_fetch_pc))))));
+  }
+}
+
+void Vcpu::eval() {
+  comb_();
+  if (!init_done_) {
+    init_done_ = true;
+    pv_0 = i_clk & 1;
+    pv_1 = n15_clk_n & 1;
+  }
+  for (int it_ = 0; it_ < 32; it_++) {
+    bool tr0 = !pv_0 && (i_clk & 1);
+    pv_0 = i_clk & 1;
+    bool tr1 = !pv_1 && (n15_clk_n & 1);
+    pv_1 = n15_clk_n & 1;
+    if (!(tr0 || tr1)) break;
+    nx_n50_ex_rs1_d = n50_ex_rs1_d;
+    nx_n51_ex_rs2_d = n51_ex_rs2_d;
+    nx_n52_ex_imm = n52_ex_imm;
+    nx_n53_ex_pc = n53_ex_pc;
+    nx_n54_ex_ret = n54_ex_ret;
+    nx_n55_ex_funct3 = n55_ex_funct3;
+    nx_n56_ex_funct7 = n56_ex_funct7;
+    nx_n57_ex_jump = n57_ex_jump;
+    nx_n58_ex_branch = n58_ex_branch;
+    nx_n59_ex_alu_pc = n59_ex_alu_pc;
+    nx_n60_ex_alu_imm = n60_ex_alu_imm;
+    nx_n61_ex_alu_en = n61_ex_alu_en;
+    nx_n62_ex_ma_wr = n62_ex_ma_wr;
+    nx_n63_ex_ma_rd = n63_ex_ma_rd;
+    nx_n64_ex_wb_mux = n64_ex_wb_mux;
+    nx_n65_ex_wb_reg = n65_ex_wb_reg;
+    nx_n66_ex_wb_en = n66_ex_wb_en;
+    nx_n67_ex_rs1 = n67_ex_rs1;
+    nx_n68_ex_system = n68_ex_system;
+    nx_n69_ex_valid = n69_ex_valid;
+    nx_n70_ex_pred = n70_ex_pred;
+    nx_n71_ex_pred_addr = n71_ex_pred_addr;
+    nx_n72_ex_pred_idx = n72_ex_pred_idx;
+    nx_n85_ex_jal_done = n85_ex_jal_done;
+    nx_n94_ex_ras_pred = n94_ex_ras_pred;
+    nx_n95_ex_ras_addr = n95_ex_ras_addr;
+    nx_n128_ex1_rs1_d = n128_ex1_rs1_d;
+    nx_n129_ex1_rs2_d = n129_ex1_rs2_d;
+    nx_n130_ex1_imm = n130_ex1_imm;
+    nx_n131_ex1_pc = n131_ex1_pc;
+    nx_n132_ex1_funct3 = n132_ex1_funct3;
+    nx_n133_ex1_funct7 = n133_ex1_funct7;
+    nx_n134_ex1_alu_pc = n134_ex1_alu_pc;
+    nx_n135_ex1_alu_imm = n135_ex1_alu_imm;
+    nx_n136_ex1_alu_en = n136_ex1_alu_en;
+    nx_n137_ex1_wb_reg = n137_ex1_wb_reg;
+    nx_n138_ex1_wb_en = n138_ex1_wb_en;
+    nx_n140_ma1_res = n140_ma1_res;
+    nx_n141_ma1_wb_reg = n141_ma1_wb_reg;
+    nx_n142_ma1_wb_en = n142_ma1_wb_en;
+    nx_n143_wb1_wb_d = n143_wb1_wb_d;
+    nx_n144_wb1_wb_reg = n144_wb1_wb_reg;
+    nx_n145_wb1_wb_en = n145_wb1_wb_en;
+    nx_n151_ma_rs2_d = n151_ma_rs2_d;
+    nx_n152_ma_res = n152_ma_res;
+    nx_n153_ma_ret = n153_ma_ret;
+    nx_n154_ma_funct3 = n154_ma_funct3;
+    nx_n155_ma_wr = n155_ma_wr;
+    nx_n156_ma_rd = n156_ma_rd;
+    nx_n157_ma_wb_reg = n157_ma_wb_reg;
+    nx_n158_ma_wb_mux = n158_ma_wb_mux;
+    nx_n159_ma_wb_en = n159_ma_wb_en;
+    nx_n167_ma_rd_sent = n167_ma_rd_sent;
+    nx_n168_ma_rd_keep = n168_ma_rd_keep;
+    nx_n169_ma_rd_kept = n169_ma_rd_kept;
+    nx_n170_wb_wb_d = n170_wb_wb_d;
+    nx_n171_wb_wb_reg = n171_wb_wb_reg;
+    nx_n172_wb_wb_en = n172_wb_wb_en;
+    nx_n221_ras_ptr = n221_ras_ptr;
+    nx_n222_ras_cnt = n222_ras_cnt;
+    nx_n225_fetch_pc = n225_fetch_pc;
+    nx_n233_q_cnt = n233_q_cnt;
+    nx_n234_q_pc = n234_q_pc;
+    nx_n458_dat_rd_a_reg = n458_dat_rd_a_reg;
+    nx_n459_dat_rd_b_reg = n459_dat_rd_b_reg;
+    nx_n460_dat_rd_c_reg = n460_dat_rd_c_reg;
+    nx_n461_dat_rd_d_reg = n461_dat_rd_d_reg;
+    nx_n843_div_a = n843_div_a;
+    nx_n844_div_b = n844_div_b;
+    nx_n845_div_q = n845_div_q;
+    nx_n846_div_cnt = n846_div_cnt;
+    nx_n855_mul_a_reg = n855_mul_a_reg;
+    nx_n856_mul_b_reg = n856_mul_b_reg;
+    nx_n857_mul_mul = n857_mul_mul;
+    nx_n933_inhibit = n933_inhibit;
+    nx_n944_value = n944_value;
+    nx_n946_value = n946_value;
+    nx_n948_value = n948_value;
+    nx_n950_value = n950_value;
+    nx_n952_value = n952_value;
+    nx_n954_value = n954_value;
+    if (tr0) p18_();
+    if (tr0) p19_();
+    if (tr0) p24_();
+    if (tr0) p37_();
+    if (tr0) p38_();
+    if (tr1) p226_();
+    if (tr0) p487_();
+    if (tr0) p488_();
+    if (tr0) p489_();
+    if (tr0) p490_();
+    if (tr0) p491_();
+    if (tr0) p492_();
+    if (tr1) p609_();
+    if (tr1) p614_();
+    if (tr0) p728_();
+    if (tr0) p738_();
+    if (tr0) p742_();
+    if (tr0) p745_();
+    if (tr0) p748_();
+    if (tr0) p751_();
+    if (tr0) p754_();
+    if (tr0) p756_();
+    if (tr0) p775_();
+    if (tr0) p776_();
+    if (tr1) p778_();
+    if (tr0) p779_();
+    if (tr0) p799_();
+    if (tr0) p800_();
+    n50_ex_rs1_d = nx_n50_ex_rs1_d;
+    n51_ex_rs2_d = nx_n51_ex_rs2_d;
+    n52_ex_imm = nx_n52_ex_imm;
+    n53_ex_pc = nx_n53_ex_pc;
+    n54_ex_ret = nx_n54_ex_ret;
+    n55_ex_funct3 = nx_n55_ex_funct3;
+    n56_ex_funct7 = nx_n56_ex_funct7;
+    n57_ex_jump = nx_n57_ex_jump;
+    n58_ex_branch = nx_n58_ex_branch;
+    n59_ex_alu_pc = nx_n59_ex_alu_pc;
+    n60_ex_alu_imm = nx_n60_ex_alu_imm;
+    n61_ex_alu_en = nx_n61_ex_alu_en;
+    n62_ex_ma_wr = nx_n62_ex_ma_wr;
+    n63_ex_ma_rd = nx_n63_ex_ma_rd;
+    n64_ex_wb_mux = nx_n64_ex_wb_mux;
+    n65_ex_wb_reg = nx_n65_ex_wb_reg;
+    n66_ex_wb_en = nx_n66_ex_wb_en;
+    n67_ex_rs1 = nx_n67_ex_rs1;
+    n68_ex_system = nx_n68_ex_system;
+    n69_ex_valid = nx_n69_ex_valid;
+    n70_ex_pred = nx_n70_ex_pred;
+    n71_ex_pred_addr = nx_n71_ex_pred_addr;
+    n72_ex_pred_idx = nx_n72_ex_pred_idx;
+    n85_ex_jal_done = nx_n85_ex_jal_done;
+    n94_ex_ras_pred = nx_n94_ex_ras_pred;
+    n95_ex_ras_addr = nx_n95_ex_ras_addr;
+    n128_ex1_rs1_d = nx_n128_ex1_rs1_d;
+    n129_ex1_rs2_d = nx_n129_ex1_rs2_d;
+    n130_ex1_imm = nx_n130_ex1_imm;
+    n131_ex1_pc = nx_n131_ex1_pc;
+    n132_ex1_funct3 = nx_n132_ex1_funct3;
+    n133_ex1_funct7 = nx_n133_ex1_funct7;
+    n134_ex1_alu_pc = nx_n134_ex1_alu_pc;
+    n135_ex1_alu_imm = nx_n135_ex1_alu_imm;
+    n136_ex1_alu_en = nx_n136_ex1_alu_en;
+    n137_ex1_wb_reg = nx_n137_ex1_wb_reg;
+    n138_ex1_wb_en = nx_n138_ex1_wb_en;
+    n140_ma1_res = nx_n140_ma1_res;
+    n141_ma1_wb_reg = nx_n141_ma1_wb_reg;
+    n142_ma1_wb_en = nx_n142_ma1_wb_en;
+    n143_wb1_wb_d = nx_n143_wb1_wb_d;
+    n144_wb1_wb_reg = nx_n144_wb1_wb_reg;
+    n145_wb1_wb_en = nx_n145_wb1_wb_en;
+    n151_ma_rs2_d = nx_n151_ma_rs2_d;
+    n152_ma_res = nx_n152_ma_res;
+    n153_ma_ret = nx_n153_ma_ret;
+    n154_ma_funct3 = nx_n154_ma_funct3;
+    n155_ma_wr = nx_n155_ma_wr;
+    n156_ma_rd = nx_n156_ma_rd;
+    n157_ma_wb_reg = nx_n157_ma_wb_reg;
+    n158_ma_wb_mux = nx_n158_ma_wb_mux;
+    n159_ma_wb_en = nx_n159_ma_wb_en;
+    n167_ma_rd_sent = nx_n167_ma_rd_sent;
+    n168_ma_rd_keep = nx_n168_ma_rd_keep;
+    n169_ma_rd_kept = nx_n169_ma_rd_kept;
+    n170_wb_wb_d = nx_n170_wb_wb_d;
+    n171_wb_wb_reg = nx_n171_wb_wb_reg;
+    n172_wb_wb_en = nx_n172_wb_wb_en;
+    for (auto &w : pw_n220_ras_data) n220_ras_data[w.i] = (n220_ras_data[w.i] & ~w.m) | (w.v & w.m);
+    pw_n220_ras_data.clear();
+    n221_ras_ptr = nx_n221_ras_ptr;
+    n222_ras_cnt = nx_n222_ras_cnt;
+    n225_fetch_pc = nx_n225_fetch_pc;
+    for (auto &w : pw_n232_q_data) n232_q_data[w.i] = (n232_q_data[w.i] & ~w.m) | (w.v & w.m);
+    pw_n232_q_data.clear();
+    n233_q_cnt = nx_n233_q_cnt;
+    n234_q_pc = nx_n234_q_pc;
+    for (auto &w : pw_n260_btb_addr) n260_btb_addr[w.i] = (n260_btb_addr[w.i] & ~w.m) | (w.v & w.m);
+    pw_n260_btb_addr.clear();
+    for (auto &w : pw_n261_btb_tag) n261_btb_tag[w.i] = (n261_btb_tag[w.i] & ~w.m) | (w.v & w.m);
+    pw_n261_btb_tag.clear();
+    for (auto &w : pw_n262_btb_cnt) n262_btb_cnt[w.i] = (n262_btb_cnt[w.i] & ~w.m) | (w.v & w.m);
+    pw_n262_btb_cnt.clear();
+    for (auto &w : pw_n263_btb_jump) n263_btb_jump[w.i] = (n263_btb_jump[w.i] & ~w.m) | (w.v & w.m);
+    pw_n263_btb_jump.clear();
+    for (auto &w : pw_n264_btb_valid) n264_btb_valid[w.i] = (n264_btb_valid[w.i] & ~w.m) | (w.v & w.m);
+    pw_n264_btb_valid.clear();
+    for (auto &w : pw_n457_registers) n457_registers[w.i] = (n457_registers[w.i] & ~w.m) | (w.v & w.m);
+    pw_n457_registers.clear();
+    n458_dat_rd_a_reg = nx_n458_dat_rd_a_reg;
+    n459_dat_rd_b_reg = nx_n459_dat_rd_b_reg;
+    n460_dat_rd_c_reg = nx_n460_dat_rd_c_reg;
+    n461_dat_rd_d_reg = nx_n461_dat_rd_d_reg;
+    n843_div_a = nx_n843_div_a;
+    n844_div_b = nx_n844_div_b;
+    n845_div_q = nx_n845_div_q;
+    n846_div_cnt = nx_n846_div_cnt;
+    n855_mul_a_reg = nx_n855_mul_a_reg;
+    n856_mul_b_reg = nx_n856_mul_b_reg;
+    n857_mul_mul = nx_n857_mul_mul;
+    n933_inhibit = nx_n933_inhibit;
+    n944_value = nx_n944_value;
+    n946_value = nx_n946_value;
+    n948_value = nx_n948_value;
+    n950_value = nx_n950_value;
+    n952_value = nx_n952_value;
+    n954_value = nx_n954_value;
+    comb_();
+  }
+}
+
@@ -0,0 +1,920 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+typedef unsigned __int128 u128;
+static inline uint64_t MK64(int w) { return w >= 64 ? ~0ULL : ((1ULL << w) - 1); }
+static inline u128 MK128(int w) { return w >= 128 ? ~(u128)0 : ((((u128)1) << w) - 1); }
+static inline uint64_t SX64(uint64_t v, int w, int W) {
+  return ((v >> (w - 1)) & 1) ? ((v | ~MK64(w)) & MK64(W)) : v; }
+static inline u128 SX128(u128 v, int w, int W) {
+  return ((v >> (w - 1)) & 1) ? ((v | ~MK128(w)) & MK128(W)) : v; }
+static inline int64_t S64(uint64_t v, int w) {
+  return w >= 64 ? (int64_t)v : (int64_t)(v << (64 - w)) >> (64 - w); }
+static inline __int128 S128(u128 v, int w) {
+  return w >= 128 ? (__int128)v : (__int128)(v << (128 - w)) >> (128 - w); }
+static inline uint64_t SHL64(uint64_t a, uint64_t n, int W) { return n >= (uint64_t)W ? 0 : (a << n) & MK64(W); }
+static inline u128 SHL128(u128 a, uint64_t n, int W) { return n >= (uint64_t)W ? 0 : (a << n) & MK128(W); }
+static inline uint64_t SHR64(uint64_t a, uint64_t n, int W) { return n >= (uint64_t)W ? 0 : a >> n; }
+static inline u128 SHR128(u128 a, uint64_t n, int W) { return n >= (uint64_t)W ? 0 : a >> n; }
+static inline uint64_t SAR64(uint64_t a, uint64_t n, int W) {
+  if (n >= (uint64_t)W) n = W - 1; return (uint64_t)(S64(a, W) >> n) & MK64(W); }
+static inline u128 SAR128(u128 a, uint64_t n, int W) {
+  if (n >= (uint64_t)W) n = W - 1; return (u128)(S128(a, W) >> n) & MK128(W); }
+static inline uint64_t REPL64(uint64_t v, int w, int n) {
+  uint64_t r = 0; for (int i = 0; i < n; i++) r = (r << w) | v; return r; }
+static inline u128 REPL128(u128 v, int w, int n) {
+  u128 r = 0; for (int i = 0; i < n; i++) r = (r << w) | v; return r; }
+static inline int PAR128(u128 v) { return __builtin_parityll((uint64_t)v) ^ __builtin_parityll((uint64_t)(v >> 64)); }
+static inline uint64_t DIVU64(uint64_t a, uint64_t b) { return b ? a / b : 0; }
+static inline uint64_t MODU64(uint64_t a, uint64_t b) { return b ? a % b : 0; }
+static inline uint64_t DIVS64(uint64_t a, uint64_t b, int W) {
+  int64_t x = S64(a, W), y = S64(b, W); return y ? (uint64_t)(x / y) & MK64(W) : 0; }
+static inline uint64_t MODS64(uint64_t a, uint64_t b, int W) {
+  int64_t x = S64(a, W), y = S64(b, W); return y ? (uint64_t)(x % y) & MK64(W) : 0; }
+
+class Vcpu {
+public:
+  uint8_t i_clk;
+  uint8_t i_clk_ce;
+  uint8_t i_rst;
+  uint32_t o_addr_i;
+  uint32_t i_data_in_i;
+  uint8_t i_ready_i;
+  uint32_t o_addr_d;
+  uint32_t i_data_rd_d;
+  uint32_t o_data_wr_d;
+  uint8_t o_wr_d;
+  uint8_t o_rd_d;
+  uint8_t i_ready_d;
+  Vcpu();
+  void eval();
+  void final() {}
+  // internals
+  uint8_t n13_core_ce;
+  uint8_t n14_clk_ce;
+  uint8_t n15_clk_n;
+  uint8_t n16_fetch_ce;
+  uint32_t n17_if_pc;
+  uint32_t n18_if_addr;
+  uint32_t n19_id_pc;
+  uint32_t n20_id_ir;
+  uint32_t n21_id_ret;
+  uint8_t n22_hz_br;
+  uint8_t n23_id_pred;
+  uint32_t n24_id_pred_addr;
+  uint8_t n25_id_pred_idx;
+  uint32_t n26_immediate;
+  uint8_t n27_funct3;
+  uint8_t n28_funct7;
+  uint8_t n29_rs1;
+  uint8_t n30_rs2;
+  uint8_t n31_rd;
+  uint8_t n32_hz_rs1;
+  uint8_t n33_hz_rs2;
+  uint8_t n34_branch;
+  uint8_t n35_jump;
+  uint8_t n36_alu_pc;
+  uint8_t n37_alu_imm;
+  uint8_t n38_alu_en;
+  uint8_t n39_d_wr;
+  uint8_t n40_d_rd;
+  uint8_t n41_wb_mux;
+  uint8_t n42_wb_en;
+  uint8_t n43_system;
+  uint8_t n44_hz_data;
+  uint8_t n45_id_bubble;
+  uint32_t n46_rs1_raw_d;
+  uint32_t n47_rs2_raw_d;
+  uint32_t n48_rs1_d;
+  uint32_t n49_rs2_d;
+  uint32_t n50_ex_rs1_d;
+  uint32_t nx_n50_ex_rs1_d;
+  uint32_t n51_ex_rs2_d;
+  uint32_t nx_n51_ex_rs2_d;
+  uint32_t n52_ex_imm;
+  uint32_t nx_n52_ex_imm;
+  uint32_t n53_ex_pc;
+  uint32_t nx_n53_ex_pc;
+  uint32_t n54_ex_ret;
+  uint32_t nx_n54_ex_ret;
+  uint8_t n55_ex_funct3;
+  uint8_t nx_n55_ex_funct3;
+  uint8_t n56_ex_funct7;
+  uint8_t nx_n56_ex_funct7;
+  uint8_t n57_ex_jump;
+  uint8_t nx_n57_ex_jump;
+  uint8_t n58_ex_branch;
+  uint8_t nx_n58_ex_branch;
+  uint8_t n59_ex_alu_pc;
+  uint8_t nx_n59_ex_alu_pc;
+  uint8_t n60_ex_alu_imm;
+  uint8_t nx_n60_ex_alu_imm;
+  uint8_t n61_ex_alu_en;
+  uint8_t nx_n61_ex_alu_en;
+  uint8_t n62_ex_ma_wr;
+  uint8_t nx_n62_ex_ma_wr;
+  uint8_t n63_ex_ma_rd;
+  uint8_t nx_n63_ex_ma_rd;
+  uint8_t n64_ex_wb_mux;
+  uint8_t nx_n64_ex_wb_mux;
+  uint8_t n65_ex_wb_reg;
+  uint8_t nx_n65_ex_wb_reg;
+  uint8_t n66_ex_wb_en;
+  uint8_t nx_n66_ex_wb_en;
+  uint8_t n67_ex_rs1;
+  uint8_t nx_n67_ex_rs1;
+  uint8_t n68_ex_system;
+  uint8_t nx_n68_ex_system;
+  uint8_t n69_ex_valid;
+  uint8_t nx_n69_ex_valid;
+  uint8_t n70_ex_pred;
+  uint8_t nx_n70_ex_pred;
+  uint32_t n71_ex_pred_addr;
+  uint32_t nx_n71_ex_pred_addr;
+  uint8_t n72_ex_pred_idx;
+  uint8_t nx_n72_ex_pred_idx;
+  uint8_t n73_br_en;
+  uint8_t n74_br_take;
+  uint8_t n75_br_miss;
+  uint32_t n76_br_addr;
+  uint8_t n77_fetch_br_en;
+  uint32_t n78_fetch_br_addr;
+  uint8_t n79_trap_go;
+  uint8_t n80_trap_br_en;
+  uint32_t n81_trap_br_addr;
+  uint8_t n82_id_jal_go;
+  uint32_t n83_id_jal_addr;
+  uint8_t n84_id_jal;
+  uint8_t n85_ex_jal_done;
+  uint8_t nx_n85_ex_jal_done;
+  uint8_t n86_id_ras_redir;
+  uint32_t n87_ras_top;
+  uint8_t n88_ras_valid;
+  uint8_t n89_id_link_rd;
+  uint8_t n90_id_link_rs1;
+  uint8_t n91_id_ras_push;
+  uint8_t n92_id_ras_pop;
+  uint8_t n93_id_ras_go;
+  uint8_t n94_ex_ras_pred;
+  uint8_t nx_n94_ex_ras_pred;
+  uint32_t n95_ex_ras_addr;
+  uint32_t nx_n95_ex_ras_addr;
+  uint8_t n96_br_pred_miss;
+  uint32_t n97_id1_ir;
+  uint8_t n98_id1_valid;
+  uint8_t n99_id1_issue;
+  uint8_t n100_id1_simple;
+  uint8_t n101_id1_md;
+  uint8_t n102_id1_shift;
+  uint8_t n103_id_pair;
+  uint32_t n104_id1_imm;
+  uint8_t n105_id1_funct3;
+  uint8_t n106_id1_funct7;
+  uint8_t n107_id1_rs1;
+  uint8_t n108_id1_rs2;
+  uint8_t n109_id1_rd;
+  uint8_t n110_id1_hz_rs1;
+  uint8_t n111_id1_hz_rs2;
+  uint8_t n112_id1_branch;
+  uint8_t n113_id1_jump;
+  uint8_t n114_id1_alu_pc;
+  uint8_t n115_id1_alu_imm;
+  uint8_t n116_id1_alu_en;
+  uint8_t n117_id1_ma_wr;
+  uint8_t n118_id1_ma_rd;
+  uint8_t n119_id1_wb_mux;
+  uint8_t n120_id1_wb_en;
+  uint8_t n121_id1_system;
+  uint8_t n122_id1_hz_data;
+  uint8_t n123_id1_hz_pair;
+  uint32_t n124_id1_rs1_raw_d;
+  uint32_t n125_id1_rs2_raw_d;
+  uint32_t n126_id1_rs1_d;
+  uint32_t n127_id1_rs2_d;
+  uint32_t n128_ex1_rs1_d;
+  uint32_t nx_n128_ex1_rs1_d;
+  uint32_t n129_ex1_rs2_d;
+  uint32_t nx_n129_ex1_rs2_d;
+  uint32_t n130_ex1_imm;
+  uint32_t nx_n130_ex1_imm;
+  uint32_t n131_ex1_pc;
+  uint32_t nx_n131_ex1_pc;
+  uint8_t n132_ex1_funct3;
+  uint8_t nx_n132_ex1_funct3;
+  uint8_t n133_ex1_funct7;
+  uint8_t nx_n133_ex1_funct7;
+  uint8_t n134_ex1_alu_pc;
+  uint8_t nx_n134_ex1_alu_pc;
+  uint8_t n135_ex1_alu_imm;
+  uint8_t nx_n135_ex1_alu_imm;
+  uint8_t n136_ex1_alu_en;
+  uint8_t nx_n136_ex1_alu_en;
+  uint8_t n137_ex1_wb_reg;
+  uint8_t nx_n137_ex1_wb_reg;
+  uint8_t n138_ex1_wb_en;
+  uint8_t nx_n138_ex1_wb_en;
+  uint32_t n139_ex1_res;
+  uint32_t n140_ma1_res;
+  uint32_t nx_n140_ma1_res;
+  uint8_t n141_ma1_wb_reg;
+  uint8_t nx_n141_ma1_wb_reg;
+  uint8_t n142_ma1_wb_en;
+  uint8_t nx_n142_ma1_wb_en;
+  uint32_t n143_wb1_wb_d;
+  uint32_t nx_n143_wb1_wb_d;
+  uint8_t n144_wb1_wb_reg;
+  uint8_t nx_n144_wb1_wb_reg;
+  uint8_t n145_wb1_wb_en;
+  uint8_t nx_n145_wb1_wb_en;
+  uint32_t n146_alu_out;
+  uint8_t n147_alu_busy;
+  uint32_t n148_alu_a_mux;
+  uint32_t n149_alu_b_mux;
+  uint32_t n150_ex_res_dat;
+  uint32_t n151_ma_rs2_d;
+  uint32_t nx_n151_ma_rs2_d;
+  uint32_t n152_ma_res;
+  uint32_t nx_n152_ma_res;
+  uint32_t n153_ma_ret;
+  uint32_t nx_n153_ma_ret;
+  uint8_t n154_ma_funct3;
+  uint8_t nx_n154_ma_funct3;
+  uint8_t n155_ma_wr;
+  uint8_t nx_n155_ma_wr;
+  uint8_t n156_ma_rd;
+  uint8_t nx_n156_ma_rd;
+  uint8_t n157_ma_wb_reg;
+  uint8_t nx_n157_ma_wb_reg;
+  uint8_t n158_ma_wb_mux;
+  uint8_t nx_n158_ma_wb_mux;
+  uint8_t n159_ma_wb_en;
+  uint8_t nx_n159_ma_wb_en;
+  uint32_t n160_ma_rd_dat;
+  uint32_t n161_ma_ld_dat;
+  uint32_t n162_ma_wr_dat;
+  uint8_t n163_ma_we;
+  uint8_t n164_ma_wr_en;
+  uint8_t n165_ma_rd_en;
+  uint32_t n166_ma_rd_bus;
+  uint8_t n167_ma_rd_sent;
+  uint8_t nx_n167_ma_rd_sent;
+  uint8_t n168_ma_rd_keep;
+  uint8_t nx_n168_ma_rd_keep;
+  uint32_t n169_ma_rd_kept;
+  uint32_t nx_n169_ma_rd_kept;
+  uint32_t n170_wb_wb_d;
+  uint32_t nx_n170_wb_wb_d;
+  uint8_t n171_wb_wb_reg;
+  uint8_t nx_n171_wb_wb_reg;
+  uint8_t n172_wb_wb_en;
+  uint8_t nx_n172_wb_wb_en;
+  uint32_t n173_wb_dat_mux;
+  uint32_t n174_wb_res;
+  uint32_t n175_wb_dat;
+  uint32_t n176_csr_rd_data;
+  uint32_t n177_csr_wr_data;
+  uint8_t n178_csr_wr_en;
+  uint8_t n179_csr_rd;
+  uint8_t n180_csr_wr;
+  uint8_t n181_csr_set;
+  uint8_t n182_csr_clr;
+  uint8_t n183_csr_events;
+  uint8_t n193_i_bp_en;
+  uint32_t n216_bp_pc;
+  uint8_t n217_bp_pred;
+  uint32_t n218_bp_pred_addr;
+  uint8_t n219_bp_pred_idx;
+  uint32_t n220_ras_data[4];
+  struct pw_t_n220_ras_data { uint32_t i; uint32_t v, m; };
+  std::vector<pw_t_n220_ras_data> pw_n220_ras_data;
+  uint8_t n221_ras_ptr;
+  uint8_t nx_n221_ras_ptr;
+  uint8_t n222_ras_cnt;
+  uint8_t nx_n222_ras_cnt;
+  uint8_t n223_ras_ptr_inc;
+  uint8_t n224_ras_ptr_dec;
+  uint32_t n225_fetch_pc;
+  uint32_t nx_n225_fetch_pc;
+  uint32_t n226_fetch_next;
+  uint8_t n227_fetch_en;
+  uint8_t n228_push_cnt;
+  uint16_t n229_push_0;
+  uint16_t n230_push_1;
+  uint32_t n231_if_addr;
+  uint16_t n232_q_data[4];
+  struct pw_t_n232_q_data { uint32_t i; uint16_t v, m; };
+  std::vector<pw_t_n232_q_data> pw_n232_q_data;
+  uint8_t n233_q_cnt;
+  uint8_t nx_n233_q_cnt;
+  uint32_t n234_q_pc;
+  uint32_t nx_n234_q_pc;
+  uint16_t n235_q_rem[4];
+  uint8_t n236_rem_cnt;
+  uint8_t n237_id_c;
+  uint8_t n238_id_valid;
+  uint8_t n239_take;
+  uint8_t n240_take_cnt;
+  uint8_t n241_pop_cnt;
+  uint8_t n242_pred_t0;
+  uint8_t n243_redirect;
+  uint16_t n244_id1_lo;
+  uint16_t n245_id1_hi;
+  uint8_t n246_id1_c;
+  uint8_t n247_id1_valid;
+  uint32_t n260_btb_addr[16];
+  struct pw_t_n260_btb_addr { uint32_t i; uint32_t v, m; };
+  std::vector<pw_t_n260_btb_addr> pw_n260_btb_addr;
+  uint32_t n261_btb_tag[16];
+  struct pw_t_n261_btb_tag { uint32_t i; uint32_t v, m; };
+  std::vector<pw_t_n261_btb_tag> pw_n261_btb_tag;
+  uint8_t n262_btb_cnt[16];
+  struct pw_t_n262_btb_cnt { uint32_t i; uint8_t v, m; };
+  std::vector<pw_t_n262_btb_cnt> pw_n262_btb_cnt;
+  uint8_t n263_btb_jump[16];
+  struct pw_t_n263_btb_jump { uint32_t i; uint8_t v, m; };
+  std::vector<pw_t_n263_btb_jump> pw_n263_btb_jump;
+  uint8_t n264_btb_valid[16];
+  struct pw_t_n264_btb_valid { uint32_t i; uint8_t v, m; };
+  std::vector<pw_t_n264_btb_valid> pw_n264_btb_valid;
+  uint8_t n265_if_idx;
+  uint32_t n266_if_tag;
+  uint8_t n267_if_hit;
+  uint8_t n268_if_dir;
+  uint8_t n269_upd_idx;
+  uint32_t n270_upd_tag;
+  uint8_t n271_upd_hit;
+  uint8_t n272_upd_cnt;
+  uint8_t n273_upd_cnt_inc;
+  uint8_t n274_upd_cnt_dec;
+  uint32_t n275_i;
+  uint32_t n276_i;
+  uint8_t n296_opcode;
+  uint8_t n297_rs1;
+  uint8_t n298_rs2;
+  uint8_t n299_rd;
+  uint8_t n300_funct3;
+  uint8_t n301_funct7;
+  uint8_t n302_copcode;
+  uint8_t n303_rs1cs;
+  uint8_t n304_rs2cs;
+  uint8_t n305_rs1cl;
+  uint8_t n306_rs2cl;
+  uint8_t n307_funct2h;
+  uint8_t n308_funct2l;
+  uint8_t n309_quad3;
+  uint8_t n310_op_load;
+  uint8_t n311_op_op_imm;
+  uint8_t n312_op_auipc;
+  uint8_t n313_op_store;
+  uint8_t n314_op_op;
+  uint8_t n315_op_lui;
+  uint8_t n316_op_branch;
+  uint8_t n317_op_jalr;
+  uint8_t n318_op_jal;
+  uint8_t n319_op_system;
+  uint8_t n320_op_misc_mem;
+  uint8_t n321_quad0;
+  uint8_t n322_quad1;
+  uint8_t n323_quad2;
+  uint8_t n324_op_caddi4spn;
+  uint8_t n325_op_clw;
+  uint8_t n326_op_csw;
+  uint8_t n327_op_caddi;
+  uint8_t n328_op_cjal;
+  uint8_t n329_op_cli;
+  uint8_t n330_op_clui_a16sp;
+  uint8_t n331_op_calu;
+  uint8_t n332_op_cj;
+  uint8_t n333_op_cbeqz;
+  uint8_t n334_op_cbnez;
+  uint8_t n335_op_cslli;
+  uint8_t n336_op_clwsp;
+  uint8_t n337_op_cswsp;
+  uint8_t n338_op_cjr_mv_add;
+  uint8_t n339_op_cflw;
+  uint8_t n340_op_cfsw;
+  uint8_t n341_op_cflwsp;
+  uint8_t n342_op_cfswsp;
+  uint8_t n343_op_caddi16sp;
+  uint8_t n344_op_clui;
+  uint8_t n345_op_csrli;
+  uint8_t n346_op_csrai;
+  uint8_t n347_op_candi;
+  uint8_t n348_op_caryth;
+  uint8_t n349_op_csub;
+  uint8_t n350_op_cxor;
+  uint8_t n351_op_cor;
+  uint8_t n352_op_cand;
+  uint8_t n353_op_cmv;
+  uint8_t n354_op_cadd;
+  uint8_t n355_op_cjr;
+  uint8_t n356_op_cjalr;
+  uint8_t n357_op_cebreak;
+  uint8_t n358_op_atomic;
+  uint8_t n359_atomic_rd;
+  uint8_t n360_atomic_wr;
+  uint8_t n361_fpu_en;
+  uint8_t n362_fp_load;
+  uint8_t n363_fp_store;
+  uint8_t n364_fp_hz_rs2;
+  uint8_t n365_bm_illegal;
+  uint8_t n366_format_u;
+  uint8_t n367_format_j;
+  uint8_t n368_format_b;
+  uint8_t n369_format_s;
+  uint8_t n370_format_i;
+  uint8_t n371_format_r;
+  uint8_t n372_system;
+  uint8_t n373_format_ciw;
+  uint8_t n374_format_ci;
+  uint8_t n375_format_cu;
+  uint8_t n376_format_c16sp;
+  uint8_t n377_format_cls;
+  uint8_t n378_format_cj;
+  uint8_t n379_format_cb;
+  uint8_t n380_format_cssp;
+  uint8_t n381_format_clsp;
+  uint8_t n382_opcode_valid;
+  uint32_t n383_immediate_u;
+  uint32_t n384_immediate_j;
+  uint32_t n385_immediate_b;
+  uint32_t n386_immediate_s;
+  uint32_t n387_immediate_i;
+  uint32_t n388_immediate_ciw;
+  uint32_t n389_immediate_ci;
+  uint32_t n390_immediate_cu;
+  uint32_t n391_immediate_c16sp;
+  uint32_t n392_immediate_cls;
+  uint32_t n393_immediate_cj;
+  uint32_t n394_immediate_cb;
+  uint32_t n395_immediate_cssp;
+  uint32_t n396_immediate_clsp;
+  uint32_t n397_immediate_mux;
+  uint8_t n398_c_op_store;
+  uint8_t n399_c_op_load;
+  uint8_t n400_c_op_op_imm;
+  uint8_t n401_c_op_op;
+  uint8_t n402_c_jal;
+  uint8_t n403_c_jalr;
+  uint8_t n404_c_branch;
+  uint8_t n405_alu_pc;
+  uint8_t n406_alu_imm;
+  uint8_t n407_alu_en;
+  uint8_t n408_wb_mux;
+  uint8_t n409_ma_wr;
+  uint8_t n410_ma_rd;
+  uint8_t n411_wb_en;
+  uint8_t n412_hz_rs1;
+  uint8_t n413_hz_rs2;
+  uint8_t n414_jump;
+  uint8_t n415_branch;
+  uint8_t n416_rs1_mux;
+  uint8_t n417_rs1_normal;
+  uint8_t n418_rs1_sp;
+  uint8_t n419_rs1_rs1l;
+  uint8_t n420_rs1_rs1s;
+  uint8_t n421_rs2_mux;
+  uint8_t n422_rs2_normal;
+  uint8_t n423_rs2_rs2s;
+  uint8_t n424_rs2_rs2l;
+  uint8_t n425_rd_mux;
+  uint8_t n426_rd_normal;
+  uint8_t n427_rd_rs2s;
+  uint8_t n428_rd_rs1l;
+  uint8_t n429_rd_rs1s;
+  uint8_t n430_funct3_mux;
+  uint8_t n431_funct3_normal;
+  uint8_t n432_funct3_001;
+  uint8_t n433_funct3_010;
+  uint8_t n434_funct3_100;
+  uint8_t n435_funct3_101;
+  uint8_t n436_funct3_110;
+  uint8_t n437_funct3_111;
+  uint8_t n438_funct7_mux;
+  uint8_t n439_funct7_normal;
+  uint8_t n440_funct7_5;
+  uint8_t n443_i_addr_rd_a;
+  uint8_t n444_i_addr_rd_b;
+  uint8_t n446_i_addr_wr;
+  uint8_t n448_i_addr_rd_c;
+  uint8_t n449_i_addr_rd_d;
+  uint8_t n451_i_addr_wr2;
+  uint32_t n457_registers[32];
+  struct pw_t_n457_registers { uint32_t i; uint32_t v, m; };
+  std::vector<pw_t_n457_registers> pw_n457_registers;
+  uint32_t n458_dat_rd_a_reg;
+  uint32_t nx_n458_dat_rd_a_reg;
+  uint32_t n459_dat_rd_b_reg;
+  uint32_t nx_n459_dat_rd_b_reg;
+  uint32_t n460_dat_rd_c_reg;
+  uint32_t nx_n460_dat_rd_c_reg;
+  uint32_t n461_dat_rd_d_reg;
+  uint32_t nx_n461_dat_rd_d_reg;
+  uint32_t n462_i;
+  uint8_t n490_i_pair_rd;
+  uint8_t n491_i_pair_wb_en;
+  uint8_t n492_o_hz_pair;
+  uint8_t n498_rs1_hz_en;
+  uint8_t n499_rs2_hz_en;
+  uint8_t n500_hz_wb1;
+  uint8_t n501_hz_wb2;
+  uint8_t n502_hz_ma1;
+  uint8_t n503_hz_ma2;
+  uint8_t n504_hz_ma_res1;
+  uint8_t n505_hz_ma_ret1;
+  uint8_t n506_hz_ma_rd1;
+  uint8_t n507_hz_ma_res2;
+  uint8_t n508_hz_ma_ret2;
+  uint8_t n509_hz_ma_rd2;
+  uint8_t n510_hz_ex1;
+  uint8_t n511_hz_ex2;
+  uint8_t n512_hz_ex_res1;
+  uint8_t n513_hz_ex_ret1;
+  uint8_t n514_hz_ex_rd1;
+  uint8_t n515_hz_ex_res2;
+  uint8_t n516_hz_ex_ret2;
+  uint8_t n517_hz_ex_rd2;
+  uint8_t n518_hz2_wb1;
+  uint8_t n519_hz2_wb2;
+  uint8_t n520_hz2_ma1;
+  uint8_t n521_hz2_ma2;
+  uint8_t n522_hz2_ex1;
+  uint8_t n523_hz2_ex2;
+  uint32_t n524_rs1_d;
+  uint32_t n525_rs2_d;
+  uint8_t n526_hz_ma_ld;
+  uint8_t n527_hz_data;
+  uint8_t n547_opcode;
+  uint8_t n548_rs1;
+  uint8_t n549_rs2;
+  uint8_t n550_rd;
+  uint8_t n551_funct3;
+  uint8_t n552_funct7;
+  uint8_t n553_copcode;
+  uint8_t n554_rs1cs;
+  uint8_t n555_rs2cs;
+  uint8_t n556_rs1cl;
+  uint8_t n557_rs2cl;
+  uint8_t n558_funct2h;
+  uint8_t n559_funct2l;
+  uint8_t n560_quad3;
+  uint8_t n561_op_load;
+  uint8_t n562_op_op_imm;
+  uint8_t n563_op_auipc;
+  uint8_t n564_op_store;
+  uint8_t n565_op_op;
+  uint8_t n566_op_lui;
+  uint8_t n567_op_branch;
+  uint8_t n568_op_jalr;
+  uint8_t n569_op_jal;
+  uint8_t n570_op_system;
+  uint8_t n571_op_misc_mem;
+  uint8_t n572_quad0;
+  uint8_t n573_quad1;
+  uint8_t n574_quad2;
+  uint8_t n575_op_caddi4spn;
+  uint8_t n576_op_clw;
+  uint8_t n577_op_csw;
+  uint8_t n578_op_caddi;
+  uint8_t n579_op_cjal;
+  uint8_t n580_op_cli;
+  uint8_t n581_op_clui_a16sp;
+  uint8_t n582_op_calu;
+  uint8_t n583_op_cj;
+  uint8_t n584_op_cbeqz;
+  uint8_t n585_op_cbnez;
+  uint8_t n586_op_cslli;
+  uint8_t n587_op_clwsp;
+  uint8_t n588_op_cswsp;
+  uint8_t n589_op_cjr_mv_add;
+  uint8_t n590_op_cflw;
+  uint8_t n591_op_cfsw;
+  uint8_t n592_op_cflwsp;
+  uint8_t n593_op_cfswsp;
+  uint8_t n594_op_caddi16sp;
+  uint8_t n595_op_clui;
+  uint8_t n596_op_csrli;
+  uint8_t n597_op_csrai;
+  uint8_t n598_op_candi;
+  uint8_t n599_op_caryth;
+  uint8_t n600_op_csub;
+  uint8_t n601_op_cxor;
+  uint8_t n602_op_cor;
+  uint8_t n603_op_cand;
+  uint8_t n604_op_cmv;
+  uint8_t n605_op_cadd;
+  uint8_t n606_op_cjr;
+  uint8_t n607_op_cjalr;
+  uint8_t n608_op_cebreak;
+  uint8_t n609_op_atomic;
+  uint8_t n610_atomic_rd;
+  uint8_t n611_atomic_wr;
+  uint8_t n612_fpu_en;
+  uint8_t n613_fp_load;
+  uint8_t n614_fp_store;
+  uint8_t n615_fp_hz_rs2;
+  uint8_t n616_bm_illegal;
+  uint8_t n617_format_u;
+  uint8_t n618_format_j;
+  uint8_t n619_format_b;
+  uint8_t n620_format_s;
+  uint8_t n621_format_i;
+  uint8_t n622_format_r;
+  uint8_t n623_system;
+  uint8_t n624_format_ciw;
+  uint8_t n625_format_ci;
+  uint8_t n626_format_cu;
+  uint8_t n627_format_c16sp;
+  uint8_t n628_format_cls;
+  uint8_t n629_format_cj;
+  uint8_t n630_format_cb;
+  uint8_t n631_format_cssp;
+  uint8_t n632_format_clsp;
+  uint8_t n633_opcode_valid;
+  uint32_t n634_immediate_u;
+  uint32_t n635_immediate_j;
+  uint32_t n636_immediate_b;
+  uint32_t n637_immediate_s;
+  uint32_t n638_immediate_i;
+  uint32_t n639_immediate_ciw;
+  uint32_t n640_immediate_ci;
+  uint32_t n641_immediate_cu;
+  uint32_t n642_immediate_c16sp;
+  uint32_t n643_immediate_cls;
+  uint32_t n644_immediate_cj;
+  uint32_t n645_immediate_cb;
+  uint32_t n646_immediate_cssp;
+  uint32_t n647_immediate_clsp;
+  uint32_t n648_immediate_mux;
+  uint8_t n649_c_op_store;
+  uint8_t n650_c_op_load;
+  uint8_t n651_c_op_op_imm;
+  uint8_t n652_c_op_op;
+  uint8_t n653_c_jal;
+  uint8_t n654_c_jalr;
+  uint8_t n655_c_branch;
+  uint8_t n656_alu_pc;
+  uint8_t n657_alu_imm;
+  uint8_t n658_alu_en;
+  uint8_t n659_wb_mux;
+  uint8_t n660_ma_wr;
+  uint8_t n661_ma_rd;
+  uint8_t n662_wb_en;
+  uint8_t n663_hz_rs1;
+  uint8_t n664_hz_rs2;
+  uint8_t n665_jump;
+  uint8_t n666_branch;
+  uint8_t n667_rs1_mux;
+  uint8_t n668_rs1_normal;
+  uint8_t n669_rs1_sp;
+  uint8_t n670_rs1_rs1l;
+  uint8_t n671_rs1_rs1s;
+  uint8_t n672_rs2_mux;
+  uint8_t n673_rs2_normal;
+  uint8_t n674_rs2_rs2s;
+  uint8_t n675_rs2_rs2l;
+  uint8_t n676_rd_mux;
+  uint8_t n677_rd_normal;
+  uint8_t n678_rd_rs2s;
+  uint8_t n679_rd_rs1l;
+  uint8_t n680_rd_rs1s;
+  uint8_t n681_funct3_mux;
+  uint8_t n682_funct3_normal;
+  uint8_t n683_funct3_001;
+  uint8_t n684_funct3_010;
+  uint8_t n685_funct3_100;
+  uint8_t n686_funct3_101;
+  uint8_t n687_funct3_110;
+  uint8_t n688_funct3_111;
+  uint8_t n689_funct7_mux;
+  uint8_t n690_funct7_normal;
+  uint8_t n691_funct7_5;
+  uint8_t n727_rs1_hz_en;
+  uint8_t n728_rs2_hz_en;
+  uint8_t n729_hz_wb1;
+  uint8_t n730_hz_wb2;
+  uint8_t n731_hz_ma1;
+  uint8_t n732_hz_ma2;
+  uint8_t n733_hz_ma_res1;
+  uint8_t n734_hz_ma_ret1;
+  uint8_t n735_hz_ma_rd1;
+  uint8_t n736_hz_ma_res2;
+  uint8_t n737_hz_ma_ret2;
+  uint8_t n738_hz_ma_rd2;
+  uint8_t n739_hz_ex1;
+  uint8_t n740_hz_ex2;
+  uint8_t n741_hz_ex_res1;
+  uint8_t n742_hz_ex_ret1;
+  uint8_t n743_hz_ex_rd1;
+  uint8_t n744_hz_ex_res2;
+  uint8_t n745_hz_ex_ret2;
+  uint8_t n746_hz_ex_rd2;
+  uint8_t n747_hz2_wb1;
+  uint8_t n748_hz2_wb2;
+  uint8_t n749_hz2_ma1;
+  uint8_t n750_hz2_ma2;
+  uint8_t n751_hz2_ex1;
+  uint8_t n752_hz2_ex2;
+  uint32_t n753_rs1_d;
+  uint32_t n754_rs2_d;
+  uint8_t n755_hz_ma_ld;
+  uint8_t n756_hz_data;
+  uint8_t n763_equal;
+  uint8_t n764_lower;
+  uint8_t n765_lower_u;
+  uint8_t n766_condition_mux;
+  uint8_t n767_condition;
+  uint8_t n768_br_en;
+  uint8_t n779_funct7_5;
+  uint8_t n780_op_subtract;
+  uint32_t n781_adder_in_b;
+  uint32_t n782_adder_out;
+  uint32_t n783_logic_xor;
+  uint32_t n784_logic_or;
+  uint32_t n785_logic_and;
+  uint32_t n786_comp;
+  uint32_t n787_comp_u;
+  uint32_t n788_shift_result;
+  uint8_t n789_shift_en;
+  uint8_t n790_shift_busy;
+  uint32_t n791_mux;
+  uint32_t n792_alu_result;
+  uint8_t n793_funct7_0;
+  uint8_t n794_md_en;
+  uint32_t n795_md_result;
+  uint8_t n796_md_busy;
+  uint8_t n800_i_in_b;
+  uint8_t n806_op_sll;
+  uint8_t n807_op_srl;
+  uint8_t n808_op_sra;
+  uint32_t n809_shift_mask_array[32];
+  uint32_t n810_shift_mask;
+  uint8_t n811_shift_amount;
+  uint32_t n812_shift_array[32];
+  uint32_t n813_shift_out;
+  uint32_t n814_shift_sll;
+  uint32_t n815_shift_srl;
+  uint32_t n816_shift_sra;
+  uint32_t n825_in_a_n;
+  uint32_t n826_in_b_n;
+  uint8_t n827_mul_a_se;
+  uint8_t n828_mul_b_se;
+  uint8_t n829_div_se;
+  uint8_t n830_a_se;
+  uint8_t n831_b_se;
+  uint32_t n832_a_s;
+  uint32_t n833_b_s;
+  uint8_t n834_mul_s;
+  uint8_t n835_div_s;
+  uint8_t n836_rem_s;
+  uint8_t n837_div_rem_s;
+  uint32_t n838_in_a;
+  uint32_t n839_in_b;
+  uint8_t n840_md_en;
+  uint64_t n841_mul_q;
+  uint32_t n842_mul;
+  uint64_t n843_div_a;
+  uint64_t nx_n843_div_a;
+  uint32_t n844_div_b;
+  uint32_t nx_n844_div_b;
+  uint32_t n845_div_q;
+  uint32_t nx_n845_div_q;
+  uint8_t n846_div_cnt;
+  uint8_t nx_n846_div_cnt;
+  uint32_t n847_div_sub;
+  uint8_t n848_div_cmp;
+  uint8_t n849_div_busy;
+  uint8_t n850_div_en;
+  uint32_t n851_div_div;
+  uint32_t n852_div_rem;
+  uint32_t n853_div_res;
+  uint32_t n854_div;
+  uint64_t n855_mul_a_reg;
+  uint64_t nx_n855_mul_a_reg;
+  uint32_t n856_mul_b_reg;
+  uint32_t nx_n856_mul_b_reg;
+  uint64_t n857_mul_mul;
+  uint64_t nx_n857_mul_mul;
+  uint8_t n858_mul_busy;
+  uint8_t n859_mul_en;
+  uint32_t n862_i_in_a;
+  uint32_t n863_i_in_b;
+  uint8_t n869_funct7_5;
+  uint8_t n870_op_subtract;
+  uint32_t n871_adder_in_b;
+  uint32_t n872_adder_out;
+  uint32_t n873_logic_xor;
+  uint32_t n874_logic_or;
+  uint32_t n875_logic_and;
+  uint32_t n876_comp;
+  uint32_t n877_comp_u;
+  uint32_t n878_shift_result;
+  uint32_t n879_mux;
+  uint8_t n883_i_in_b;
+  uint8_t n888_o_busy;
+  uint8_t n889_op_sll;
+  uint8_t n890_op_srl;
+  uint8_t n891_op_sra;
+  uint32_t n892_shift_mask_array[32];
+  uint32_t n893_shift_mask;
+  uint8_t n894_shift_amount;
+  uint32_t n895_shift_array[32];
+  uint32_t n896_shift_out;
+  uint32_t n897_shift_sll;
+  uint32_t n898_shift_srl;
+  uint32_t n899_shift_sra;
+  uint16_t n907_i_addr;
+  uint8_t n910_i_instret_2;
+  uint32_t n912_misa;
+  uint32_t n913_read_data;
+  uint32_t n914_ext_data;
+  uint32_t n915_cnt_data;
+  uint32_t n916_other_data;
+  uint32_t n917_cnt_rd_data;
+  uint8_t n918_cnt_hit;
+  uint8_t n919_write_enable;
+  uint32_t n920_set_data;
+  uint32_t n921_clr_data;
+  uint32_t n922_write_data;
+  uint8_t n925_i_wr;
+  uint64_t n932_count[7];
+  uint8_t n933_inhibit;
+  uint8_t nx_n933_inhibit;
+  uint8_t n934_index;
+  uint8_t n935_sel_machine;
+  uint8_t n936_sel_user;
+  uint8_t n937_sel_count;
+  uint8_t n938_sel_inhibit;
+  uint8_t n939_sel_event;
+  uint8_t n940_wr_lo;
+  uint8_t n941_wr_hi;
+  uint8_t n942_rd_index;
+  uint64_t n943_rd_count;
+  uint64_t n944_value;
+  uint64_t nx_n944_value;
+  uint64_t n945_step;
+  uint64_t n946_value;
+  uint64_t nx_n946_value;
+  uint64_t n947_step;
+  uint64_t n948_value;
+  uint64_t nx_n948_value;
+  uint64_t n949_step;
+  uint64_t n950_value;
+  uint64_t nx_n950_value;
+  uint64_t n951_step;
+  uint64_t n952_value;
+  uint64_t nx_n952_value;
+  uint64_t n953_step;
+  uint64_t n954_value;
+  uint64_t nx_n954_value;
+  uint64_t n955_step;
+  uint8_t n958_i_shift;
+  uint8_t n959_i_length;
+  uint8_t n960_i_signed_rd;
+  uint32_t n964_length_mask;
+  uint32_t n965_data_wr_shift;
+  uint32_t n966_data_rd_shift;
+  uint32_t n967_data_rd_short;
+  uint8_t n968_sign_bit;
+  uint32_t n969_sign_extension;
+  uint32_t n970_data_rd_signed;
+  uint8_t n971_we_lenght;
+  uint8_t n972_we_shifted;
+  uint8_t pv_0;
+  uint8_t pv_1;
+  bool init_done_;
+  void comb_();
+  void p18_();
+  void p19_();
+  void p24_();
+  void p37_();
+  void p38_();
+  void p226_();
+  void p487_();
+  void p488_();
+  void p489_();
+  void p490_();
+  void p491_();
+  void p492_();
+  void p609_();
+  void p614_();
+  void p728_();
+  void p738_();
+  void p742_();
+  void p745_();
+  void p748_();
+  void p751_();
+  void p754_();
+  void p756_();
+  void p775_();
+  void p776_();
+  void p778_();
+  void p779_();
+  void p799_();
+  void p800_();
+  void p225_();
+};
+
@@ -0,0 +1,5 @@
+#pragma once
+struct Verilated {
+  static void commandArgs(int, char **) {}
+  static void traceEverOn(bool) {}
+};
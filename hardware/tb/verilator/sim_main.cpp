@@ -0,0 +1,489 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: sim_main.cpp
+ *
+ * This is the Verilator harness for the CPU core, it's the fast alternative
+ * to the cpu_tb.v (iverilog) flow. Memory and I/O are modeled in C++ with
+ * the same memory map as in top.v:
+ *
+ * 0x00000000 - 0x00007FFF - RAM (aliased over the whole address space)
+ * 0x00008000 - 0x0000800F - UART registers (data register writes go to stdout)
+ * 0x00008010              - LEDs (write) and switches (read)
+ * 0x00010000              - Kill address (like in cpu_tb.v)
+ *
+ * Memory answers in the same cycle (falling edge), or in the next cycle
+ * with POSEDGE_ONLY (synchronous memory), data accesses can be given extra
+ * wait states (i_ready_d is cleared for them). Program is either an ELF file,
+ * a "cpu.mem" file (hex words) or a raw binary (build/<name>.hex) loaded at
+ * address zero. Simulation stops when the fetch reaches the kill address,
+ * when the program gets stuck in the jump to itself ("j ." or "c.j .") or
+ * when the cycle budget runs out. Writes to the kill address and the cycle
+ * count are printed just like in cpu_tb.v so selftest.py can parse them.
+ * With TRAPS enabled the bit 0 of the word written to 0x10004 drives the
+ * external interrupt input (like in cpu_tb.v).
+ *
+ * Usage: Vcpu [options] <program>
+ *  --cycles <n>     - Cycle budget (default 100000000)
+ *  --kill-addr <a>  - Kill address (default 0x10000)
+ *  --ram-size <n>   - RAM size, power of 2 (default 0x8000)
+ *  --loop-stop <n>  - Stop if fetch stays at "j ." for n cycles (0 - off)
+ *  --data-wait <n>  - Wait states of every data access (default 0)
+ *  --trace <file>   - Dump VCD trace (harness has to be built with TRACE=1)
+ *  --itrace <file>  - Write the instruction trace (TRACE_PORT only, cpi.py)
+ *  --quiet          - Don't print the summary
+ ***************************************************************************/
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Vcpu.h"
+#include "verilated.h"
+#if VM_TRACE
+#include "verilated_vcd_c.h"
+#endif
+
+// I/O addresses (see top.v)
+#define IO_BASE           0x00008000u
+#define IO_UART_CLOCK     0x00008000u
+#define IO_UART_CONFIG    0x00008004u
+#define IO_UART_STATUS    0x00008008u
+#define IO_UART_DATA      0x0000800Cu
+#define IO_LED            0x00008010u
+
+// UART status register (transmitter is always empty, receiver never has data)
+#define UART_STATUS_IDLE  ((1u << 2) | (1u << 5))
+
+// Reset length in cycles (same as in cpu_tb.v)
+#define RESET_CYCLES      5
+
+
+/**
+ * Simulation options
+ */
+struct options {
+  uint64_t cycles = 100000000;
+  uint32_t kill_addr = 0x00010000;
+  uint32_t ram_size = 0x00008000;
+  uint64_t loop_stop = 1000;
+  uint32_t data_wait = 0;
+  const char *trace = nullptr;
+  const char *itrace = nullptr;
+  const char *program = nullptr;
+  bool quiet = false;
+};
+
+/**
+ * Memory and I/O state
+ */
+struct bus {
+  std::vector<uint8_t> ram;
+  uint32_t uart_clock = 0;
+  uint32_t uart_config = 0;
+  uint8_t led = 0;
+  uint8_t irq = 0;
+  uint32_t data_in_i = 0;
+  uint32_t data_rd_d = 0;
+  uint32_t wait_cnt = 0;
+};
+
+static void usage(const char *name)
+{
+  fprintf(stderr, "Usage: %s [--cycles n] [--kill-addr a] [--ram-size n] "
+    "[--loop-stop n] [--data-wait n] [--trace file] [--itrace file] "
+    "[--quiet] <program>\n",
+    name);
+  exit(2);
+}
+
+static bool parse_args(int argc, char **argv, options &opt)
+{
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool has_val = (i + 1 < argc);
+    if (arg == "--cycles" && has_val) {
+      opt.cycles = strtoull(argv[++i], nullptr, 0);
+    } else if (arg == "--kill-addr" && has_val) {
+      opt.kill_addr = strtoul(argv[++i], nullptr, 0);
+    } else if (arg == "--ram-size" && has_val) {
+      opt.ram_size = strtoul(argv[++i], nullptr, 0);
+    } else if (arg == "--loop-stop" && has_val) {
+      opt.loop_stop = strtoull(argv[++i], nullptr, 0);
+    } else if (arg == "--data-wait" && has_val) {
+      opt.data_wait = strtoul(argv[++i], nullptr, 0);
+    } else if (arg == "--trace" && has_val) {
+      opt.trace = argv[++i];
+    } else if (arg == "--itrace" && has_val) {
+      opt.itrace = argv[++i];
+    } else if (arg == "--quiet") {
+      opt.quiet = true;
+    } else if (arg[0] == '+') {
+      // Verilator arguments (+verilator+...)
+    } else if (arg[0] != '-' && opt.program == nullptr) {
+      opt.program = argv[i];
+    } else {
+      return false;
+    }
+  }
+  if (opt.program == nullptr) return false;
+  if (opt.ram_size == 0 || (opt.ram_size & (opt.ram_size - 1))) return false;
+  return true;
+}
+
+/**
+ * Program loader
+ *  ELF files are loaded by their program headers, "cpu.mem" files are read
+ *  as the whitespace separated hex words, everything else is a raw binary.
+ */
+static uint32_t get32(const std::vector<uint8_t> &d, size_t off)
+{
+  return d[off] | (d[off + 1] << 8) | (d[off + 2] << 16) |
+    ((uint32_t)d[off + 3] << 24);
+}
+
+static uint16_t get16(const std::vector<uint8_t> &d, size_t off)
+{
+  return d[off] | (d[off + 1] << 8);
+}
+
+static bool load_elf(const std::vector<uint8_t> &d, bus &b)
+{
+  uint32_t mask = b.ram.size() - 1;
+  if (d.size() < 52 || d[4] != 1 || d[5] != 1) {
+    fprintf(stderr, "Only 32-bit little endian ELF files are supported\n");
+    return false;
+  }
+  uint32_t phoff = get32(d, 28);
+  uint16_t phentsize = get16(d, 42);
+  uint16_t phnum = get16(d, 44);
+  for (uint16_t i = 0; i < phnum; i++) {
+    size_t ph = phoff + (size_t)i * phentsize;
+    if (ph + 32 > d.size()) return false;
+    // PT_LOAD segments only
+    if (get32(d, ph) != 1) continue;
+    uint32_t offset = get32(d, ph + 4);
+    uint32_t paddr = get32(d, ph + 12);
+    uint32_t filesz = get32(d, ph + 16);
+    if ((size_t)offset + filesz > d.size()) return false;
+    for (uint32_t j = 0; j < filesz; j++) {
+      b.ram[(paddr + j) & mask] = d[offset + j];
+    }
+  }
+  return true;
+}
+
+static bool load_mem(const char *path, bus &b)
+{
+  std::ifstream in(path);
+  std::string word;
+  size_t addr = 0;
+  while (in >> word && addr + 4 <= b.ram.size()) {
+    uint32_t val = strtoul(word.c_str(), nullptr, 16);
+    for (int i = 0; i < 4; i++) {
+      b.ram[addr++] = val >> (8 * i);
+    }
+  }
+  return true;
+}
+
+static bool load_program(const char *path, bus &b)
+{
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    fprintf(stderr, "Can't open %s\n", path);
+    return false;
+  }
+  std::vector<uint8_t> d((std::istreambuf_iterator<char>(in)),
+    std::istreambuf_iterator<char>());
+
+  if (d.size() >= 4 && !memcmp(d.data(), "\x7f" "ELF", 4)) {
+    return load_elf(d, b);
+  }
+  std::string name = path;
+  if (name.size() > 4 && name.compare(name.size() - 4, 4, ".mem") == 0) {
+    return load_mem(path, b);
+  }
+  for (size_t i = 0; i < d.size() && i < b.ram.size(); i++) {
+    b.ram[i] = d[i];
+  }
+  return true;
+}
+
+/**
+ * Memory and I/O access
+ *  Called once per cycle at the edge at which the memory is clocked, with
+ *  the CPU outputs that were stable before that edge.
+ */
+static uint32_t ram_read(const bus &b, uint32_t addr)
+{
+  uint32_t a = addr & (b.ram.size() - 1) & ~3u;
+  return b.ram[a] | (b.ram[a + 1] << 8) | (b.ram[a + 2] << 16) |
+    ((uint32_t)b.ram[a + 3] << 24);
+}
+
+static uint32_t io_read(const bus &b, uint32_t addr)
+{
+  switch (addr & ~3u) {
+    case IO_UART_CLOCK:  return b.uart_clock;
+    case IO_UART_CONFIG: return b.uart_config;
+    case IO_UART_STATUS: return UART_STATUS_IDLE;
+    case IO_UART_DATA:   return 0;
+    default:             return 0;
+  }
+}
+
+static void io_write(bus &b, const options &opt, uint32_t addr,
+  uint32_t data, uint8_t we)
+{
+  // Writes to the kill address (and the words after it) are printed for the
+  //  selftests and benchmarks
+  if ((addr & ~0xFu) == opt.kill_addr) {
+    printf("W %10u (%08x)\n", data, addr);
+    if (addr == opt.kill_addr + 4) b.irq = data & 1;
+    return;
+  }
+  // UART only takes the whole word writes (like in top.v)
+  switch (addr & ~3u) {
+    case IO_UART_CLOCK:
+      if (we == 0xF) b.uart_clock = data;
+      break;
+    case IO_UART_CONFIG:
+      if (we == 0xF) b.uart_config = data;
+      break;
+    case IO_UART_DATA:
+      if (we == 0xF) putchar(data & 0xFF);
+      break;
+    case IO_LED:
+      if (we & 1) b.led = data;
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * Jump to itself ("jal x0, 0" or "c.j 0"), tight loops that poll something
+ *  or count down don't match, so they aren't stopped
+ */
+static bool is_jump_self(const bus &b, uint32_t addr)
+{
+  uint32_t mask = b.ram.size() - 1;
+  uint16_t lo = b.ram[addr & mask] | (b.ram[(addr + 1) & mask] << 8);
+  uint16_t hi = b.ram[(addr + 2) & mask] | (b.ram[(addr + 3) & mask] << 8);
+  return (lo == 0xA001) || (lo == 0x006F && hi == 0x0000);
+}
+
+/**
+ * Data memory wait states
+ *  Access is done when it has waited for data_wait cycles, the requests
+ *  don't depend on i_ready_d, so it's set after the CPU outputs settle.
+ */
+static void bus_ready(Vcpu *cpu, const bus &b, const options &opt)
+{
+  bool access = cpu->o_rd_d || cpu->o_wr_d;
+  cpu->i_ready_d = !access || b.wait_cnt >= opt.data_wait;
+  cpu->eval();
+}
+
+static void bus_wait(Vcpu *cpu, bus &b)
+{
+  bool access = cpu->o_rd_d || cpu->o_wr_d;
+  b.wait_cnt = (access && !cpu->i_ready_d) ? b.wait_cnt + 1 : 0;
+}
+
+static void bus_access(Vcpu *cpu, bus &b, const options &opt)
+{
+  uint32_t addr = cpu->o_addr_d;
+  uint32_t wdata = cpu->o_data_wr_d;
+  uint8_t we = (cpu->i_ready_d) ? cpu->o_wr_d : 0;
+
+  b.data_in_i = ram_read(b, cpu->o_addr_i);
+  b.data_rd_d = 0;
+
+  if (cpu->o_rd_d) {
+    b.data_rd_d = (addr < IO_BASE) ? ram_read(b, addr) : io_read(b, addr);
+  }
+
+  if (we && addr < IO_BASE) {
+    uint32_t a = addr & (b.ram.size() - 1) & ~3u;
+    for (int i = 0; i < 4; i++) {
+      if (we & (1 << i)) b.ram[a + i] = wdata >> (8 * i);
+    }
+  } else if (we) {
+    io_write(b, opt, addr, wdata, we);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  Verilated::commandArgs(argc, argv);
+
+  options opt;
+  if (!parse_args(argc, argv, opt)) usage(argv[0]);
+
+  bus b;
+  b.ram.assign(opt.ram_size, 0);
+  if (!load_program(opt.program, b)) return 2;
+
+  Vcpu *cpu = new Vcpu;
+
+  // Tracing (only if the model was built with the trace support)
+#if VM_TRACE
+  VerilatedVcdC *tfp = nullptr;
+  if (opt.trace) {
+    Verilated::traceEverOn(true);
+    tfp = new VerilatedVcdC;
+    cpu->trace(tfp, 99);
+    tfp->open(opt.trace);
+  }
+#else
+  if (opt.trace) {
+    fprintf(stderr, "Trace support isn't built in (use TRACE=1)\n");
+  }
+#endif
+  uint64_t time = 0;
+
+  // Instruction trace (same format as TRACE_FILE in cpu_tb.v)
+  FILE *itrace = nullptr;
+  if (opt.itrace) {
+#ifdef TRACE_PORT
+    itrace = fopen(opt.itrace, "w");
+    if (itrace == nullptr) {
+      fprintf(stderr, "Can't open %s\n", opt.itrace);
+      return 2;
+    }
+#else
+    fprintf(stderr, "Trace port isn't built in (use VL_DEFINES=TRACE_PORT)\n");
+#endif
+  }
+
+  cpu->i_clk = 0;
+  cpu->i_clk_ce = 1;
+  cpu->i_rst = 1;
+  cpu->i_ready_i = 1;
+  cpu->i_ready_d = 1;
+  cpu->i_data_in_i = 0;
+  cpu->i_data_rd_d = 0;
+#ifdef TRAPS
+  cpu->i_irq = 0;
+#endif
+  cpu->eval();
+
+  // Loop detection
+  uint32_t loop_addr = 0;
+  uint64_t loop_cnt = 0;
+  bool loop_found = false;
+
+  int status = 1;
+  uint64_t cycle;
+  for (cycle = 1; cycle <= opt.cycles; cycle++) {
+    cpu->i_rst = (cycle <= RESET_CYCLES);
+
+#ifdef POSEDGE_ONLY
+    // Synchronous memory is clocked at the rising edge, its accesses come
+    //  before the kill check (the result is stored along with the jump to
+    //  the kill address)
+    bus_access(cpu, b, opt);
+#endif
+
+    // Kill address is checked before the rising edge (like in cpu_tb.v)
+    if (!cpu->i_rst && cpu->o_addr_i == opt.kill_addr) {
+      if (!opt.quiet) {
+        printf("Killed by reaching kill address %lu\n", (unsigned long)cycle);
+      }
+      status = 0;
+      break;
+    }
+
+    // Fetch stuck at the jump to itself (fetch runs up to a few words ahead
+    //  of it before the jump is taken)
+    if (opt.loop_stop && !cpu->i_rst) {
+      if (loop_found && cpu->o_addr_i - loop_addr < 16) {
+        if (++loop_cnt >= opt.loop_stop) {
+          if (!opt.quiet) {
+            printf("\nStopped in a loop at %08x after %lu cycles\n",
+              loop_addr, (unsigned long)cycle);
+          }
+          status = 0;
+          break;
+        }
+      } else {
+        loop_addr = cpu->o_addr_i;
+        loop_cnt = 0;
+        loop_found = is_jump_self(b, loop_addr);
+      }
+    }
+
+    // Instruction leaving the EX phase at this edge
+#ifdef TRACE_PORT
+    if (itrace && cpu->o_trace_valid) {
+      fprintf(itrace, "%08x %08x %04x %02x\n", cpu->o_trace_pc,
+        cpu->o_trace_ir, cpu->o_trace_cycles, cpu->o_trace_cause);
+    }
+#ifdef DUAL_ISSUE
+    // Second issue slot, no cycles of its own
+    if (itrace && cpu->o_trace1_valid) {
+      fprintf(itrace, "%08x %08x %04x %02x\n", cpu->o_trace1_pc,
+        cpu->o_trace1_ir, 0, 0);
+    }
+#endif
+#endif
+
+    // Rising edge
+    bus_wait(cpu, b);
+    cpu->i_clk = 1;
+    cpu->eval();
+#ifdef TRAPS
+    // Interrupt input is registered at the rising edge (like in cpu_tb.v)
+    cpu->i_irq = b.irq;
+#endif
+#ifdef POSEDGE_ONLY
+    cpu->i_data_in_i = b.data_in_i;
+    cpu->i_data_rd_d = b.data_rd_d;
+    cpu->eval();
+#endif
+    bus_ready(cpu, b, opt);
+#if VM_TRACE
+    if (tfp) tfp->dump(time);
+#endif
+    time++;
+
+    // Falling edge (memory answers in the same cycle)
+#ifndef POSEDGE_ONLY
+    bus_access(cpu, b, opt);
+#endif
+    cpu->i_clk = 0;
+    cpu->eval();
+#ifndef POSEDGE_ONLY
+    cpu->i_data_in_i = b.data_in_i;
+    cpu->i_data_rd_d = b.data_rd_d;
+    cpu->eval();
+#endif
+    bus_ready(cpu, b, opt);
+#if VM_TRACE
+    if (tfp) tfp->dump(time);
+#endif
+    time++;
+  }
+
+  if (status && !opt.quiet) {
+    printf("\nKilled by timeout after %lu cycles\n", (unsigned long)opt.cycles);
+  }
+  fflush(stdout);
+  if (itrace) fclose(itrace);
+
+#if VM_TRACE
+  if (tfp) {
+    tfp->close();
+    delete tfp;
+  }
+#endif
+  cpu->final();
+  delete cpu;
+  return status;
+}
@@ -0,0 +1,122 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: arbiter.v
+ *
+ * This file contains the round-robin arbiter that connects the data ports
+ * of all harts in the cluster (see cluster.v) to the single shared data bus.
+ * Buses of the harts are concatenated (hart 0 in the lowest bits). Bus is
+ * granted to the first requesting hart after the one that was granted last,
+ * the grant is kept until the memory sets the ready (so the wait states of
+ * the I/O aren't interrupted) and while the hart locks the bus (AMO read
+ * and write have to be done without any other access in between). Harts
+ * that don't request the bus always see the ready set, the ones that wait
+ * for the bus see it cleared (their pipeline waits just like with a slow
+ * memory). Read data isn't routed through the arbiter, it's sent to all
+ * harts (only the granted one takes it).
+ *
+ * i_clk         - Clock input
+ * i_rst         - Reset input
+ *
+ * i_addr        - Address buses of the harts
+ * i_data_wr     - Write data buses of the harts
+ * i_wr          - Write enables of the harts (byte enables)
+ * i_rd          - Read enables of the harts
+ * i_lock        - Bus has to stay with the hart after its request
+ * o_ready       - Request of the hart is done
+ *
+ * o_mem_addr    - Shared bus address
+ * o_mem_data_wr - Shared bus write data
+ * o_mem_wr      - Shared bus write enable (byte enables)
+ * o_mem_rd      - Shared bus read enable
+ * i_mem_ready   - Shared bus request is done
+ * o_grant       - Hart that owns the shared bus
+ ***************************************************************************/
+`include "../cpu/config.v"
+
+module arbiter (
+  input                          i_clk,
+  input                          i_rst,
+
+  input  [32*`CLUSTER_CORES-1:0] i_addr,
+  input  [32*`CLUSTER_CORES-1:0] i_data_wr,
+  input  [ 4*`CLUSTER_CORES-1:0] i_wr,
+  input  [   `CLUSTER_CORES-1:0] i_rd,
+  input  [   `CLUSTER_CORES-1:0] i_lock,
+  output [   `CLUSTER_CORES-1:0] o_ready,
+
+  output [31:0]                  o_mem_addr,
+  output [31:0]                  o_mem_data_wr,
+  output [ 3:0]                  o_mem_wr,
+  output                         o_mem_rd,
+  input                          i_mem_ready,
+  output [`CLUSTER_BITS-1:0]     o_grant
+);
+
+  localparam CORES = `CLUSTER_CORES;
+
+  // Requests
+  wire [CORES-1:0] req;
+
+  // Grant
+  reg  [`CLUSTER_BITS-1:0] owner;
+  reg                      busy;
+  reg  [`CLUSTER_BITS-1:0] next;
+  reg  [`CLUSTER_BITS-1:0] idx;
+  reg                      found;
+  wire [`CLUSTER_BITS-1:0] grant;
+
+
+  /**
+   * Requests of the harts
+   */
+  for (genvar i = 0; i < CORES; i = i + 1) begin
+    assign req[i] = i_rd[i] || |i_wr[i*4 +: 4];
+  end
+
+  /**
+   * Round-robin search
+   *  The hart that was granted last has the lowest priority
+   */
+  always @* begin
+    next  = owner;
+    found = 1'b0;
+    for (integer i = 1; i <= CORES; i = i + 1) begin
+      idx = owner + i[`CLUSTER_BITS-1:0];
+      if (!found && req[idx]) begin
+        next  = idx;
+        found = 1'b1;
+      end
+    end
+  end
+
+  /**
+   * Grant register
+   *  The owner keeps the bus until its request is done (and unlocked)
+   */
+  always @(posedge i_clk) begin
+    if (i_rst) begin
+      owner <= 0;
+      busy  <= 0;
+    end else if (|req) begin
+      owner <= grant;
+      busy  <= !i_mem_ready || i_lock[grant];
+    end
+  end
+
+  assign grant = (busy) ? owner : next;
+
+  /**
+   * Output assignment
+   */
+  for (genvar i = 0; i < CORES; i = i + 1) begin
+    assign o_ready[i] = !req[i] || ((grant == i) && i_mem_ready);
+  end
+
+  assign o_mem_addr    = i_addr[grant*32 +: 32];
+  assign o_mem_data_wr = i_data_wr[grant*32 +: 32];
+  assign o_mem_wr      = i_wr[grant*4 +: 4];
+  assign o_mem_rd      = i_rd[grant];
+  assign o_grant       = grant;
+
+endmodule
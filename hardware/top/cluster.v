@@ -0,0 +1,166 @@
+/****************************************************************************
+ * Copyright 2023 Lukasz Forenc
+ *
+ * File: cluster.v
+ *
+ * This file contains the multi-core cluster, CLUSTER_CORES harts (set with
+ * CLUSTER_BITS in config.v) share a single data bus through the round-robin
+ * arbiter (see arbiter.v), every hart has its own private instruction port
+ * (with ICACHE enabled it's the refill port of its own instruction cache).
+ * Hart IDs are the indexes of the harts (mhartid is CSR_MHARTID + index),
+ * so the software can tell the harts apart, all of them start from the
+ * reset vector. Requires MULTI_CORE option. With A_EXTENSION every hart
+ * snoops the writes of the other harts (they clear its LR.W reservation)
+ * and AMOs lock the shared bus between their read and write. Data caches
+ * aren't included, private ones wouldn't be coherent (a shared one can be
+ * placed behind the shared data bus). Buses of the harts are concatenated,
+ * hart 0 in the lowest bits.
+ *
+ * i_clk       - Clock input
+ * i_rst       - Reset input
+ * i_irq       - External interrupt of every hart (TRAPS only)
+ *
+ * o_addr_i    - Instruction address of every hart
+ * o_rd_i      - Instruction read request of every hart (always set without
+ *               ICACHE)
+ * i_data_in_i - Instruction data of every hart
+ * i_ready_i   - Instruction data of the hart is valid
+ *
+ * o_addr_d    - Shared data bus address output
+ * i_data_rd_d - Shared data bus data input
+ * o_data_wr_d - Shared data bus data output
+ * o_wr_d      - Shared data bus write enable
+ * o_rd_d      - Shared data bus read enable
+ * i_ready_d   - Shared data bus request is done
+ * o_hart_d    - Hart that owns the shared data bus
+ *
+ * Both bus types use the same ready handshake as the CPU itself (see
+ * cpu.v), so the memories are connected the same way as in top.v.
+ ***************************************************************************/
+`include "../cpu/cpu.v"
+`ifdef ICACHE
+`include "../cpu/icache.v"
+`endif
+`include "arbiter.v"
+
+module cluster (
+  input                          i_clk,
+  input                          i_rst,
+`ifdef TRAPS
+  input  [   `CLUSTER_CORES-1:0] i_irq,
+`endif
+
+  output [32*`CLUSTER_CORES-1:0] o_addr_i,
+  output [   `CLUSTER_CORES-1:0] o_rd_i,
+  input  [32*`CLUSTER_CORES-1:0] i_data_in_i,
+  input  [   `CLUSTER_CORES-1:0] i_ready_i,
+
+  output [31:0]                  o_addr_d,
+  input  [31:0]                  i_data_rd_d,
+  output [31:0]                  o_data_wr_d,
+  output [ 3:0]                  o_wr_d,
+  output                         o_rd_d,
+  input                          i_ready_d,
+  output [`CLUSTER_BITS-1:0]     o_hart_d
+);
+
+  localparam CORES = `CLUSTER_CORES;
+
+  // Data ports of the harts
+  wire [32*CORES-1:0] hart_addr_d;
+  wire [32*CORES-1:0] hart_data_wr_d;
+  wire [ 4*CORES-1:0] hart_wr_d;
+  wire [   CORES-1:0] hart_rd_d;
+  wire [   CORES-1:0] hart_ready_d;
+  wire [   CORES-1:0] hart_lock_d;
+
+
+  /**
+   * Harts
+   */
+  for (genvar h = 0; h < CORES; h = h + 1) begin : hart
+    wire [ 7:0] hart_id = h;
+    wire        snoop_wr = |o_wr_d && i_ready_d && (o_hart_d != h);
+    wire [31:0] cpu_addr_i;
+    wire [31:0] cpu_data_in_i;
+    wire        cpu_ready_i;
+
+    // verilator lint_off pinmissing
+    cpu cpu_i (
+      .i_clk         (i_clk),
+      .i_clk_ce      (1'b1),
+      .i_rst         (i_rst),
+      .i_hart_id     (hart_id),
+`ifdef A_EXTENSION
+      .i_snoop_wr    (snoop_wr),
+      .i_snoop_addr  (o_addr_d),
+`endif
+`ifdef TRAPS
+      .i_irq         (i_irq[h]),
+`endif
+`ifdef CSR_EXTERNAL_BUS
+      .i_csr_rd_data (32'd0),
+`endif
+      .o_addr_i      (cpu_addr_i),
+      .i_data_in_i   (cpu_data_in_i),
+      .i_ready_i     (cpu_ready_i),
+      .o_addr_d      (hart_addr_d[h*32 +: 32]),
+      .i_data_rd_d   (i_data_rd_d),
+      .o_data_wr_d   (hart_data_wr_d[h*32 +: 32]),
+      .o_wr_d        (hart_wr_d[h*4 +: 4]),
+      .o_rd_d        (hart_rd_d[h]),
+`ifdef A_EXTENSION
+      .o_lock_d      (hart_lock_d[h]),
+`endif
+      .i_ready_d     (hart_ready_d[h])
+    );
+    // verilator lint_on pinmissing
+
+`ifndef A_EXTENSION
+    assign hart_lock_d[h] = 1'b0;
+`endif
+
+    // Private instruction port (either straight from the CPU or from the cache)
+`ifdef ICACHE
+    icache icache_i (
+      .i_clk       (i_clk),
+      .i_rst       (i_rst),
+      .i_addr      (cpu_addr_i),
+      .o_data      (cpu_data_in_i),
+      .o_ready     (cpu_ready_i),
+      .o_mem_addr  (o_addr_i[h*32 +: 32]),
+      .o_mem_rd    (o_rd_i[h]),
+      .i_mem_data  (i_data_in_i[h*32 +: 32]),
+      .i_mem_ready (i_ready_i[h]),
+      .o_hits      (),
+      .o_misses    ()
+    );
+`else
+    assign o_addr_i[h*32 +: 32] = cpu_addr_i;
+    assign o_rd_i[h] = 1'b1;
+    assign cpu_data_in_i = i_data_in_i[h*32 +: 32];
+    assign cpu_ready_i = i_ready_i[h];
+`endif
+  end
+
+  /**
+   * Shared data bus arbiter
+   */
+  arbiter arbiter_i (
+    .i_clk         (i_clk),
+    .i_rst         (i_rst),
+    .i_addr        (hart_addr_d),
+    .i_data_wr     (hart_data_wr_d),
+    .i_wr          (hart_wr_d),
+    .i_rd          (hart_rd_d),
+    .i_lock        (hart_lock_d),
+    .o_ready       (hart_ready_d),
+    .o_mem_addr    (o_addr_d),
+    .o_mem_data_wr (o_data_wr_d),
+    .o_mem_wr      (o_wr_d),
+    .o_mem_rd      (o_rd_d),
+    .i_mem_ready   (i_ready_d),
+    .o_grant       (o_hart_d)
+  );
+
+endmodule
@@ -1,5 +1,11 @@
 `include "../cpu/cpu.v"
+`ifdef ICACHE
+`include "../cpu/icache.v"
+`endif
 `include "../peripheral/uart/uart_regs.v"
+`ifdef DMA
+`include "../peripheral/dma/dma.v"
+`endif
 `include "../peripheral/boot_rom/boot_rom.v"
 
 module top (
@@ -26,28 +32,104 @@ module top (
     end
   end
 
+  // Memories and peripherals are clocked on the falling edge (so they answer
+  // in the same cycle), with POSEDGE_ONLY they're read synchronously on the
+  // rising edge and the data arrives in the next cycle
+`ifdef POSEDGE_ONLY
+  wire mem_clk = clk;
+`else
+  wire mem_clk = !clk;
+`endif
+
   // CPU stuff
   wire [31:0] cpu_i_addr;
   wire [31:0] cpu_i_data_in;
+  wire        cpu_i_ready;
   wire [31:0] cpu_d_addr;
   wire [31:0] cpu_d_data_in;
   wire [31:0] cpu_d_data_out;
   wire [ 3:0] cpu_d_data_wr;
   wire        cpu_d_data_rd;
+  wire        cpu_d_ready;
+  wire        cpu_d_lock;
+  wire        uart_irq;
+  wire        uart_rx_dreq;
+  wire        dma_irq;
 
   cpu cpu_i (
     .i_clk       (clk),
     .i_clk_ce    (1'b1),
     .i_rst       (reset),
+`ifdef MULTI_CORE
+    .i_hart_id   (8'd0),
+`endif
+`ifdef TRAPS
+    .i_irq       (uart_irq || dma_irq),
+`endif
     .o_addr_i    (cpu_i_addr),
     .i_data_in_i (cpu_i_data_in),
+    .i_ready_i   (cpu_i_ready),
     .o_addr_d    (cpu_d_addr),
     .i_data_rd_d (cpu_d_data_in),
     .o_data_wr_d (cpu_d_data_out),
     .o_wr_d      (cpu_d_data_wr),
-    .o_rd_d      (cpu_d_data_rd)
+    .o_rd_d      (cpu_d_data_rd),
+`ifdef A_EXTENSION
+    .o_lock_d    (cpu_d_lock),
+`endif
+    .i_ready_d   (cpu_d_ready)
   );
 
+`ifndef A_EXTENSION
+  assign cpu_d_lock = 1'b0;
+`endif
+
+  // Data bus stuff (either straight from the CPU or shared with the DMA, see
+  // dma.v)
+  wire [31:0] bus_d_addr;
+  wire [31:0] bus_d_data_out;
+  wire [ 3:0] bus_d_data_wr;
+  wire        bus_d_data_rd;
+  wire        bus_d_ready;
+
+  // Instruction bus stuff (either straight from the CPU or from the cache)
+  wire [31:0] bus_i_addr;
+  wire [31:0] bus_i_data;
+  wire        bus_i_rd;
+  wire        bus_i_ready;
+
+`ifdef ICACHE
+  icache icache_i (
+    .i_clk       (clk),
+    .i_rst       (reset),
+    .i_addr      (cpu_i_addr),
+    .o_data      (cpu_i_data_in),
+    .o_ready     (cpu_i_ready),
+    .o_mem_addr  (bus_i_addr),
+    .o_mem_rd    (bus_i_rd),
+    .i_mem_data  (bus_i_data),
+    .i_mem_ready (bus_i_ready),
+    .o_hits      (),
+    .o_misses    ()
+  );
+`else
+  assign bus_i_addr = cpu_i_addr;
+  assign bus_i_rd = 1'b1;
+  assign cpu_i_data_in = bus_i_data;
+  assign cpu_i_ready = 1'b1;
+`endif
+
+  // Synchronous memory has the data in the cycle after the address
+`ifdef POSEDGE_ONLY
+  reg bus_i_ready_reg = 0;
+  always @(posedge clk) begin
+    bus_i_ready_reg <= bus_i_rd && !bus_i_ready_reg && !reset;
+  end
+  assign bus_i_ready = bus_i_ready_reg;
+`else
+  assign bus_i_ready = bus_i_rd;
+`endif
+
   // Memory stuff
   (* ram_style = "block" *)
   reg   [7:0] ram_array_3 [0:8191];
@@ -59,8 +141,11 @@ module top (
   reg  [31:0] ram_data_out_i;
   reg  [31:0] ram_data_out_d;
   wire        ram_en;
+  reg         ram_en_reg;
+
+  always @(posedge mem_clk) begin
+    ram_en_reg <= ram_en;
 
-  always @(negedge clk) begin
     ram_data_out_i <= {
       ram_array_3[ram_addr_i],
       ram_array_2[ram_addr_i],
@@ -75,35 +160,39 @@ module top (
       ram_array_0[ram_addr_d]
     };
 
-    if (cpu_d_data_wr[0] && ram_en) begin
-      ram_array_0[ram_addr_d] <= cpu_d_data_out[7:0];
+    if (bus_d_data_wr[0] && ram_en) begin
+      ram_array_0[ram_addr_d] <= bus_d_data_out[7:0];
     end
 
-    if (cpu_d_data_wr[1] && ram_en) begin
-      ram_array_1[ram_addr_d] <= cpu_d_data_out[15:8];
+    if (bus_d_data_wr[1] && ram_en) begin
+      ram_array_1[ram_addr_d] <= bus_d_data_out[15:8];
     end
 
-    if (cpu_d_data_wr[2] && ram_en) begin
-      ram_array_2[ram_addr_d] <= cpu_d_data_out[23:16];
+    if (bus_d_data_wr[2] && ram_en) begin
+      ram_array_2[ram_addr_d] <= bus_d_data_out[23:16];
     end
 
-    if (cpu_d_data_wr[3] && ram_en) begin
-      ram_array_3[ram_addr_d] <= cpu_d_data_out[31:24];
+    if (bus_d_data_wr[3] && ram_en) begin
+      ram_array_3[ram_addr_d] <= bus_d_data_out[31:24];
     end
   end
 
-  assign ram_addr_i = cpu_i_addr[14:2];
-  assign ram_addr_d = cpu_d_addr[14:2];
-  assign ram_en = (cpu_d_addr < 32'h00008000);
+  assign ram_addr_i = bus_i_addr[14:2];
+  assign ram_addr_d = bus_d_addr[14:2];
+  assign ram_en = (bus_d_addr < `BUS_IO_BASE);
 
   // bootloader stuff
   wire [31:0] bld_data;
   boot_rom boot_rom_i (
-    .i_clk  (!clk),
-    .i_addr (cpu_i_addr[10:2]),
+    .i_clk  (mem_clk),
+    .i_addr (bus_i_addr[10:2]),
     .o_data (bld_data)
   );
-  wire bld_en = (cpu_i_addr >= 32'h00010000 && cpu_i_addr < 32'h00010800);
+  wire bld_en = (bus_i_addr >= 32'h00010000 && bus_i_addr < 32'h00010800);
+  reg bld_en_reg = 0;
+  always @(posedge mem_clk) begin
+    bld_en_reg <= bld_en;
+  end
 
   // IO stuff
   wire [31:0] io_out;
@@ -111,33 +200,110 @@ module top (
   reg [7:0] led_reg;
   wire led_en;
   wire uart_en;
+  wire [31:0] dma_out;
+  wire dma_en;
+
+  // IO wait state (strobes are only issued in the first cycle of access)
+  wire        io_req;
+  wire        io_first;
+  reg  [31:0] io_data_r;
+  always @(posedge clk) begin
+    if (io_first) begin
+      io_data_r <= io_out;
+    end
+  end
+`ifdef BUS_IO_WAIT
+  reg         io_wait;
+  always @(posedge clk) begin
+    if (reset) begin
+      io_wait <= 0;
+    end else begin
+      io_wait <= io_req && !io_wait;
+    end
+  end
+  assign io_first = !io_wait;
+  assign bus_d_ready = !io_req || io_wait;
+`else
+  assign io_first = 1'b1;
+  assign bus_d_ready = 1'b1;
+`endif
+  assign io_req = !ram_en && (bus_d_data_rd || |bus_d_data_wr);
 
-  assign led_en = (cpu_d_addr == 32'h00008010);
-  always @(negedge clk) begin
-    if (cpu_d_data_wr[0] && led_en) begin
-      led_reg <= cpu_d_data_out[7:0];
+  assign led_en = (bus_d_addr == 32'h00008010);
+  always @(posedge mem_clk) begin
+    if (bus_d_data_wr[0] && led_en && io_first) begin
+      led_reg <= bus_d_data_out[7:0];
     end
   end
 
-  assign uart_en = (cpu_d_addr[31:4] == 28'h0000800);
+  assign uart_en = (bus_d_addr[31:4] == 28'h0000800);
   uart_regs uart_regs_i (
-    .i_clk      (!clk),
+    .i_clk      (mem_clk),
     .i_rst      (reset),
-    .i_wr       (&cpu_d_data_wr),
-    .i_rd       (cpu_d_data_rd),
+    .i_wr       (&bus_d_data_wr && io_first),
+    .i_rd       (bus_d_data_rd && io_first),
     .i_cs       (uart_en),
-    .i_addr     (cpu_d_addr[3:2]),
-    .i_data_in  (cpu_d_data_out),
+    .i_addr     (bus_d_addr[3:2]),
+    .i_data_in  (bus_d_data_out),
     .o_data_out (uart_out),
     .o_tx       (UART_TX),
-    .i_rx       (UART_RX)
+    .i_rx       (UART_RX),
+    .o_irq      (uart_irq),
+    .o_rx_dreq  (uart_rx_dreq)
   );
 
+`ifdef DMA
+  assign dma_en = (bus_d_addr[31:4] == 28'h0000802);
+  dma dma_i (
+    .i_clk         (clk),
+    .i_rst         (reset),
+    .i_wr          (&bus_d_data_wr && io_first),
+    .i_cs          (dma_en),
+    .i_addr        (bus_d_addr[3:2]),
+    .i_data_in     (bus_d_data_out),
+    .o_data_out    (dma_out),
+    .i_dreq        (uart_rx_dreq),
+    .o_irq         (dma_irq),
+    .i_cpu_addr    (cpu_d_addr),
+    .i_cpu_data_wr (cpu_d_data_out),
+    .i_cpu_wr      (cpu_d_data_wr),
+    .i_cpu_rd      (cpu_d_data_rd),
+    .i_cpu_lock    (cpu_d_lock),
+    .o_cpu_ready   (cpu_d_ready),
+    .o_mem_addr    (bus_d_addr),
+    .o_mem_data_wr (bus_d_data_out),
+    .o_mem_wr      (bus_d_data_wr),
+    .o_mem_rd      (bus_d_data_rd),
+    .i_mem_data_rd (cpu_d_data_in),
+    .i_mem_ready   (bus_d_ready)
+  );
+`else
+  assign dma_en  = 1'b0;
+  assign dma_out = 32'd0;
+  assign dma_irq = 1'b0;
+
+  assign bus_d_addr     = cpu_d_addr;
+  assign bus_d_data_out = cpu_d_data_out;
+  assign bus_d_data_wr  = cpu_d_data_wr;
+  assign bus_d_data_rd  = cpu_d_data_rd;
+  assign cpu_d_ready    = bus_d_ready;
+`endif
+
   assign LED = led_reg;
 
   // CPU bus stuff
-  assign io_out = uart_en ? uart_out : {19'd0, Switch[5:1], DPSwitch};
+  assign io_out = uart_en ? uart_out : dma_en ? dma_out :
+    {19'd0, Switch[5:1], DPSwitch};
+`ifdef POSEDGE_ONLY
+  assign cpu_d_data_in = ram_en_reg ? ram_data_out_d : io_data_r;
+  assign bus_i_data = bld_en_reg ? bld_data : ram_data_out_i;
+`else
+`ifdef BUS_IO_WAIT
+  assign cpu_d_data_in = ram_en ? ram_data_out_d : io_data_r;
+`else
   assign cpu_d_data_in = ram_en ? ram_data_out_d : io_out;
-  assign cpu_i_data_in = bld_en ? bld_data : ram_data_out_i;
+`endif
+  assign bus_i_data = bld_en ? bld_data : ram_data_out_i;
+`endif
 
 endmodule
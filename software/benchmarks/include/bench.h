@@ -0,0 +1,37 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/*
+ * Results are written to the kill address of the test bench (cpu_tb.v and
+ * the Verilator harness both print these writes), main returns zero when
+ * the benchmark result was correct and the error code otherwise.
+ */
+#define BENCH_TOHOST      0x10000
+#define BENCH_RESULT      0x0
+#define BENCH_CYCLES      0x4
+#define BENCH_INSTRET     0x8
+#define BENCH_PASS        0x555
+
+#ifndef __ASSEMBLER__
+#include <stddef.h>
+#include <stdint.h>
+
+// Simple pseudo random generator (same sequence on every run)
+static inline uint32_t bench_rand(uint32_t *state)
+{
+  *state = *state * 1103515245u + 12345u;
+  return *state >> 8;
+}
+
+void *memcpy(void *dst, const void *src, size_t n);
+void *memset(void *dst, int c, size_t n);
+void *memmove(void *dst, const void *src, size_t n);
+int memcmp(const void *a, const void *b, size_t n);
+size_t strlen(const char *s);
+char *strcpy(char *dst, const char *src);
+int strcmp(const char *a, const char *b);
+void bench_putc(char c);
+int bench_printf(const char *fmt, ...);
+#endif
+
+#endif
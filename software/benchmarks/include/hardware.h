@@ -0,0 +1,47 @@
+#include <stdint.h>
+#define __REG32(x)        *(volatile uint32_t*)(x)
+
+#define UART_CLOCK        __REG32(0x8000)
+#define UART_CONFIG       __REG32(0x8004)
+#define UART_STATUS       __REG32(0x8008)
+#define UART_DATA         __REG32(0x800C)
+#define LED_REG           __REG32(0x8010)
+#define BUTTON_REG        __REG32(0x8010)
+#define DMA_SRC           __REG32(0x8020)
+#define DMA_DST           __REG32(0x8024)
+#define DMA_COUNT         __REG32(0x8028)
+#define DMA_CTRL          __REG32(0x802C)
+
+#define UART_TX_EN        0
+#define UART_RX_EN        1
+#define UART_PARITY       2
+#define UART_ODD          3
+#define UART_2STOP        4
+#define UART_LENGTH       5
+#define UART_TX_CLEAR     7
+#define UART_RX_CLEAR     8
+
+#define UART_FRAC         16
+
+#define UART_OVERRUN_ERR  0
+#define UART_PARITY_ERR   1
+#define UART_TX_EMPTY     2
+#define UART_TX_HALF      3
+#define UART_TX_FULL      4
+#define UART_RX_EMPTY     5
+#define UART_RX_HALF      6
+#define UART_RX_FULL      7
+#define UART_RX_TIMEOUT   9
+#define UART_TX_IDLE      10
+#define UART_RX_LOST      11
+
+#define DMA_START         0
+#define DMA_BUSY          0
+#define DMA_MODE          1
+#define DMA_IRQ_EN        3
+#define DMA_DONE          4
+#define DMA_ABORT         5
+
+#define DMA_MODE_COPY     0
+#define DMA_MODE_FILL     1
+#define DMA_MODE_STREAM   2
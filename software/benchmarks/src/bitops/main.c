@@ -0,0 +1,96 @@
+#include <stdint.h>
+#include "../../include/bench.h"
+
+#define DATA_SIZE   1024
+#define HEX_CHECK   "DEADBEEF"
+
+static uint32_t data[DATA_SIZE];
+static char text[DATA_SIZE * 9];
+
+// Convert the word to 8 hex digits (like the bootloader does it)
+static void word_to_hex(uint32_t value, char *out)
+{
+  for (int i = 7; i >= 0; i--) {
+    uint32_t digit = value & 0xF;
+    out[i] = (digit > 9) ? (digit + 'A' - 10) : (digit + '0');
+    value >>= 4;
+  }
+}
+
+// Big endian byte packing (network order headers)
+static uint32_t pack_be(uint32_t value)
+{
+  return __builtin_bswap32(value);
+}
+
+// Bit field statistics (set bits, highest bit, lowest bit)
+static uint32_t bit_stats(const uint32_t *buf, int n)
+{
+  uint32_t sum = 0;
+  for (int i = 0; i < n; i++) {
+    uint32_t v = buf[i] | 1;
+    sum += __builtin_popcount(v);
+    sum += 31 - __builtin_clz(v);
+    sum += __builtin_ctz(v);
+  }
+  return sum;
+}
+
+// Saturated and masked accumulation (min/max, andn)
+static uint32_t clamp_mask(const uint32_t *buf, int n, uint32_t mask)
+{
+  int32_t acc = 0;
+  for (int i = 0; i < n; i++) {
+    int32_t v = (int32_t)(buf[i] & ~mask);
+    v = (v < -1000) ? -1000 : v;
+    v = (v > 1000) ? 1000 : v;
+    acc += v;
+  }
+  return acc;
+}
+
+// Rotating hash with the indexed table walk (rotations, shift and add)
+static uint32_t rotate_hash(const uint32_t *buf, int n)
+{
+  uint32_t hash = 0x811C9DC5u;
+  for (int i = 0; i < n; i++) {
+    uint32_t v = buf[(i * 7) & (DATA_SIZE - 1)];
+    hash = ((hash << 5) | (hash >> 27)) ^ v;
+  }
+  return hash;
+}
+
+int main(void)
+{
+  uint32_t seed = 1;
+  for (int i = 0; i < DATA_SIZE; i++) {
+    data[i] = bench_rand(&seed);
+  }
+
+  word_to_hex(0xDEADBEEFu, text);
+  for (int i = 0; i < 8; i++) {
+    if (text[i] != HEX_CHECK[i]) {
+      return 1;
+    }
+  }
+  if (pack_be(0x11223344u) != 0x44332211u) {
+    return 2;
+  }
+  uint32_t probe = 0x80;
+  if (bit_stats(&probe, 1) != 2 + 7 + 0) {
+    return 3;
+  }
+
+  // Hex dump of the whole buffer
+  for (int i = 0; i < DATA_SIZE; i++) {
+    word_to_hex(pack_be(data[i]), &text[i * 9]);
+    text[i * 9 + 8] = ' ';
+  }
+
+  uint32_t result = bit_stats(data, DATA_SIZE);
+  result += clamp_mask(data, DATA_SIZE, 0xFFFFF000u);
+  result += rotate_hash(data, DATA_SIZE);
+  result += text[DATA_SIZE * 9 - 2];
+  bench_putc(result & 0x7F);
+  return 0;
+}
@@ -0,0 +1,208 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "../../include/bench.h"
+#include "../../include/hardware.h"
+
+/*
+ * Freestanding replacements of the C library functions (benchmarks aren't
+ * linked with newlib so the compiler generated calls land here too)
+ */
+void *memcpy(void *dst, const void *src, size_t n)
+{
+  uint8_t *d = dst;
+  const uint8_t *s = src;
+
+  // Copy whole words if both pointers have the same alignment
+  if ((((uintptr_t)d ^ (uintptr_t)s) & 3) == 0) {
+    while (((uintptr_t)d & 3) && n) {
+      *d++ = *s++;
+      n--;
+    }
+    uint32_t *dw = (uint32_t *)d;
+    const uint32_t *sw = (const uint32_t *)s;
+    while (n >= 16) {
+      dw[0] = sw[0];
+      dw[1] = sw[1];
+      dw[2] = sw[2];
+      dw[3] = sw[3];
+      dw += 4;
+      sw += 4;
+      n -= 16;
+    }
+    while (n >= 4) {
+      *dw++ = *sw++;
+      n -= 4;
+    }
+    d = (uint8_t *)dw;
+    s = (const uint8_t *)sw;
+  }
+
+  while (n--) {
+    *d++ = *s++;
+  }
+  return dst;
+}
+
+void *memset(void *dst, int c, size_t n)
+{
+  uint8_t *d = dst;
+  uint32_t word = (uint8_t)c * 0x01010101u;
+
+  while (((uintptr_t)d & 3) && n) {
+    *d++ = c;
+    n--;
+  }
+  uint32_t *dw = (uint32_t *)d;
+  while (n >= 4) {
+    *dw++ = word;
+    n -= 4;
+  }
+  d = (uint8_t *)dw;
+  while (n--) {
+    *d++ = c;
+  }
+  return dst;
+}
+
+void *memmove(void *dst, const void *src, size_t n)
+{
+  uint8_t *d = dst;
+  const uint8_t *s = src;
+
+  if (d <= s || d >= s + n) {
+    return memcpy(dst, src, n);
+  }
+  while (n--) {
+    d[n] = s[n];
+  }
+  return dst;
+}
+
+int memcmp(const void *a, const void *b, size_t n)
+{
+  const uint8_t *pa = a;
+  const uint8_t *pb = b;
+
+  for (size_t i = 0; i < n; i++) {
+    if (pa[i] != pb[i]) {
+      return pa[i] - pb[i];
+    }
+  }
+  return 0;
+}
+
+size_t strlen(const char *s)
+{
+  size_t n = 0;
+  while (s[n]) {
+    n++;
+  }
+  return n;
+}
+
+char *strcpy(char *dst, const char *src)
+{
+  char *d = dst;
+  while ((*d++ = *src++)) {
+  }
+  return dst;
+}
+
+int strcmp(const char *a, const char *b)
+{
+  while (*a && *a == *b) {
+    a++;
+    b++;
+  }
+  return (uint8_t)*a - (uint8_t)*b;
+}
+
+// UART isn't polled (it's only present in the Verilator harness and on the
+//  board, the test bench only needs the results)
+void bench_putc(char c)
+{
+  UART_DATA = c;
+}
+
+/*
+ * Minimal printf (%d, %u, %x, %s, %c with width and zero padding) for the
+ * CoreMark and Dhrystone output
+ */
+static void print_num(uint32_t value, int base, int negative, int width,
+  char pad)
+{
+  char buf[12];
+  int len = 0;
+  do {
+    buf[len++] = "0123456789abcdef"[value % base];
+    value /= base;
+  } while (value);
+  if (negative) {
+    buf[len++] = '-';
+  }
+  while (width-- > len) {
+    bench_putc(pad);
+  }
+  while (len) {
+    bench_putc(buf[--len]);
+  }
+}
+
+int bench_printf(const char *fmt, ...)
+{
+  va_list args;
+  va_start(args, fmt);
+  for (; *fmt; fmt++) {
+    if (*fmt != '%') {
+      bench_putc(*fmt);
+      continue;
+    }
+    fmt++;
+    char pad = ' ';
+    int width = 0;
+    if (*fmt == '0') {
+      pad = '0';
+      fmt++;
+    }
+    while (*fmt >= '0' && *fmt <= '9') {
+      width = width * 10 + (*fmt++ - '0');
+    }
+    while (*fmt == 'l') {
+      fmt++;
+    }
+    switch (*fmt) {
+      case 'd':
+      case 'i': {
+        int32_t v = va_arg(args, int32_t);
+        print_num((v < 0) ? -v : v, 10, v < 0, width, pad);
+        break;
+      }
+      case 'u':
+        print_num(va_arg(args, uint32_t), 10, 0, width, pad);
+        break;
+      case 'x':
+      case 'X':
+        print_num(va_arg(args, uint32_t), 16, 0, width, pad);
+        break;
+      case 's': {
+        const char *s = va_arg(args, const char *);
+        while (*s) {
+          bench_putc(*s++);
+        }
+        break;
+      }
+      case 'c':
+        bench_putc(va_arg(args, int));
+        break;
+      case '\0':
+        fmt--;
+        break;
+      default:
+        bench_putc(*fmt);
+        break;
+    }
+  }
+  va_end(args);
+  return 0;
+}
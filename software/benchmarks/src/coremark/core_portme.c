@@ -0,0 +1,87 @@
+#include <stddef.h>
+#include "coremark.h"
+#include "core_portme.h"
+#include "../../include/bench.h"
+
+#define F_CPU             10000000u
+#define EE_TICKS_PER_SEC  F_CPU
+
+#if VALIDATION_RUN
+volatile ee_s32 seed1_volatile = 0x3415;
+volatile ee_s32 seed2_volatile = 0x3415;
+volatile ee_s32 seed3_volatile = 0x66;
+#endif
+#if PERFORMANCE_RUN
+volatile ee_s32 seed1_volatile = 0x0;
+volatile ee_s32 seed2_volatile = 0x0;
+volatile ee_s32 seed3_volatile = 0x66;
+#endif
+#if PROFILE_RUN
+volatile ee_s32 seed1_volatile = 0x8;
+volatile ee_s32 seed2_volatile = 0x8;
+volatile ee_s32 seed3_volatile = 0x8;
+#endif
+volatile ee_s32 seed4_volatile = ITERATIONS;
+volatile ee_s32 seed5_volatile = 0;
+
+ee_u32 default_num_contexts = 1;
+
+// CRC errors of the run (CoreMark's main always returns zero)
+static ee_s16 crc_errors;
+
+static CORETIMETYPE start_time_val;
+static CORETIMETYPE stop_time_val;
+
+static CORETIMETYPE read_mcycle(void)
+{
+  CORETIMETYPE value;
+  asm volatile ("csrr %0, mcycle" : "=r"(value));
+  return value;
+}
+
+void start_time(void)
+{
+  start_time_val = read_mcycle();
+}
+
+void stop_time(void)
+{
+  stop_time_val = read_mcycle();
+}
+
+CORE_TICKS get_time(void)
+{
+  return stop_time_val - start_time_val;
+}
+
+secs_ret time_in_secs(CORE_TICKS ticks)
+{
+  return ticks / EE_TICKS_PER_SEC;
+}
+
+void portable_init(core_portable *p, int *argc, char *argv[])
+{
+  (void)argc;
+  (void)argv;
+  p->portable_id = 1;
+}
+
+// The port is the last member of the results, the CRCs of known seeds are
+//  checked by the time CoreMark calls this
+void portable_fini(core_portable *p)
+{
+  core_results *res = (core_results *)((char *)p -
+    offsetof(core_results, port));
+  crc_errors = res->err;
+  p->portable_id = 0;
+}
+
+// CoreMark's main is renamed (core_main.c is built with -Dmain=coremark_main)
+//  so the result can be reported to the test bench
+int coremark_main(void);
+
+int main(void)
+{
+  coremark_main();
+  return crc_errors;
+}
@@ -0,0 +1,76 @@
+#ifndef CORE_PORTME_H
+#define CORE_PORTME_H
+
+/*
+ * CoreMark port for the simulation (the unmodified sources are in
+ * software/benchmarks/coremark), time is measured with mcycle and the output
+ * goes to the UART data register.
+ */
+#include <stddef.h>
+
+#define HAS_FLOAT         0
+#define HAS_TIME_H        0
+#define USE_CLOCK         0
+#define HAS_STDIO         0
+#define HAS_PRINTF        0
+
+#ifndef COMPILER_VERSION
+#ifdef __GNUC__
+#define COMPILER_VERSION  "GCC"__VERSION__
+#else
+#define COMPILER_VERSION  "unknown"
+#endif
+#endif
+#ifndef COMPILER_FLAGS
+#define COMPILER_FLAGS    FLAGS_STR
+#endif
+#ifndef MEM_LOCATION
+#define MEM_LOCATION      "STACK"
+#endif
+
+typedef signed short      ee_s16;
+typedef unsigned short    ee_u16;
+typedef signed int        ee_s32;
+typedef int               ee_f32;
+typedef unsigned char     ee_u8;
+typedef unsigned int      ee_u32;
+typedef ee_u32            ee_ptr_int;
+typedef size_t            ee_size_t;
+
+#define align_mem(x)      (void *)(4 + (((ee_ptr_int)(x)-1) & ~3))
+
+#define CORETIMETYPE      ee_u32
+typedef ee_u32 CORE_TICKS;
+
+#define SEED_METHOD       SEED_VOLATILE
+#define MEM_METHOD        MEM_STACK
+#define MULTITHREAD       1
+#define USE_PTHREAD       0
+#define USE_FORK          0
+#define USE_SOCKET        0
+#define MAIN_HAS_NOARGC   1
+#define MAIN_HAS_NORETURN 0
+
+extern ee_u32 default_num_contexts;
+
+typedef struct CORE_PORTABLE_S {
+  ee_u8 portable_id;
+} core_portable;
+
+void portable_init(core_portable *p, int *argc, char *argv[]);
+void portable_fini(core_portable *p);
+
+#if !defined(PROFILE_RUN) && !defined(PERFORMANCE_RUN) && !defined(VALIDATION_RUN)
+#if (TOTAL_DATA_SIZE == 1200)
+#define PROFILE_RUN       1
+#elif (TOTAL_DATA_SIZE == 2000)
+#define PERFORMANCE_RUN   1
+#else
+#define VALIDATION_RUN    1
+#endif
+#endif
+
+#define ee_printf         bench_printf
+int bench_printf(const char *fmt, ...);
+
+#endif
@@ -0,0 +1,62 @@
+#include <stdint.h>
+#include "../../include/bench.h"
+
+#define DATA_SIZE   4096
+#define CRC_CHECK   0xCBF43926u
+
+static uint8_t data[DATA_SIZE];
+static uint32_t table[256];
+
+// Bitwise CRC32 (reflected, polynomial 0xEDB88320)
+static uint32_t crc32_bitwise(const uint8_t *buf, size_t len)
+{
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= buf[i];
+    for (int j = 0; j < 8; j++) {
+      crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+// Table driven CRC32
+static void crc32_init(void)
+{
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t crc = i;
+    for (int j = 0; j < 8; j++) {
+      crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+    }
+    table[i] = crc;
+  }
+}
+
+static uint32_t crc32_table(const uint8_t *buf, size_t len)
+{
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < len; i++) {
+    crc = (crc >> 8) ^ table[(crc ^ buf[i]) & 0xFF];
+  }
+  return ~crc;
+}
+
+int main(void)
+{
+  uint32_t seed = 1;
+  for (int i = 0; i < DATA_SIZE; i++) {
+    data[i] = bench_rand(&seed);
+  }
+
+  crc32_init();
+  if (crc32_table((const uint8_t *)"123456789", 9) != CRC_CHECK) {
+    return 1;
+  }
+  if (crc32_bitwise((const uint8_t *)"123456789", 9) != CRC_CHECK) {
+    return 2;
+  }
+  if (crc32_table(data, DATA_SIZE) != crc32_bitwise(data, DATA_SIZE)) {
+    return 3;
+  }
+  return 0;
+}
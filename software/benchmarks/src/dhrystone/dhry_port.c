@@ -0,0 +1,88 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "dhry.h"
+#include "../../include/bench.h"
+
+/*
+ * Dhrystone port for the simulation (the unmodified sources are in
+ * software/benchmarks/dhrystone), the number of runs is DHRYSTONE_RUNS, time
+ * is measured with mcycle and main checks the final values Dhrystone prints.
+ */
+#define F_CPU             10000000u
+
+#ifndef DHRYSTONE_RUNS
+#define DHRYSTONE_RUNS    2000
+#endif
+
+extern Rec_Pointer Ptr_Glob;
+extern Rec_Pointer Next_Ptr_Glob;
+extern int Int_Glob;
+extern Boolean Bool_Glob;
+extern char Ch_1_Glob;
+extern char Ch_2_Glob;
+extern int Arr_1_Glob[50];
+extern int Arr_2_Glob[50][50];
+
+// Dhrystone allocates only the two global records
+static uint32_t heap[32];
+static size_t heap_used;
+
+void *malloc(size_t size)
+{
+  void *ptr = &heap[heap_used];
+  heap_used += (size + 3) / 4;
+  return (heap_used <= sizeof(heap) / 4) ? ptr : NULL;
+}
+
+// Number of runs through the benchmark (the only input Dhrystone reads)
+int scanf(const char *fmt, ...)
+{
+  (void)fmt;
+  va_list args;
+  va_start(args, fmt);
+  *va_arg(args, int *) = DHRYSTONE_RUNS;
+  va_end(args);
+  return 1;
+}
+
+long time(long *t)
+{
+  uint32_t cycles;
+  asm volatile ("csrr %0, mcycle" : "=r"(cycles));
+  long secs = cycles / F_CPU;
+  if (t) {
+    *t = secs;
+  }
+  return secs;
+}
+
+// Dhrystone's main is renamed (dhry_1.c is built with -Dmain=dhry_main) so the
+//  final values can be checked
+int dhry_main();
+
+int main(void)
+{
+  dhry_main();
+
+  if (Int_Glob != 5 || Bool_Glob != 1 || Ch_1_Glob != 'A' ||
+    Ch_2_Glob != 'B' || Arr_1_Glob[8] != 7 ||
+    Arr_2_Glob[8][7] != DHRYSTONE_RUNS + 10) {
+    return 1;
+  }
+  if (Ptr_Glob->Discr != Ident_1 ||
+    Ptr_Glob->variant.var_1.Enum_Comp != Ident_3 ||
+    Ptr_Glob->variant.var_1.Int_Comp != 17 ||
+    strcmp(Ptr_Glob->variant.var_1.Str_Comp,
+      "DHRYSTONE PROGRAM, SOME STRING")) {
+    return 2;
+  }
+  if (Next_Ptr_Glob->Discr != Ident_1 ||
+    Next_Ptr_Glob->variant.var_1.Enum_Comp != Ident_2 ||
+    Next_Ptr_Glob->variant.var_1.Int_Comp != 18 ||
+    strcmp(Next_Ptr_Glob->variant.var_1.Str_Comp,
+      "DHRYSTONE PROGRAM, SOME STRING")) {
+    return 3;
+  }
+  return 0;
+}
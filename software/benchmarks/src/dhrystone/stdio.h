@@ -0,0 +1,15 @@
+#ifndef DHRY_STDIO_H
+#define DHRY_STDIO_H
+
+/*
+ * The benchmarks aren't linked with a C library, this header (included by
+ * dhry.h) gives Dhrystone the few functions it uses: strcpy and strcmp from
+ * the benchmark library, printf goes to the UART and scanf returns the number
+ * of runs (dhry_port.c).
+ */
+#include "../../include/bench.h"
+
+#define printf            bench_printf
+int scanf(const char *fmt, ...);
+
+#endif
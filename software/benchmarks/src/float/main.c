@@ -0,0 +1,89 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include "../../include/bench.h"
+
+// Single-precision arithmetic, done by the F extension when it's in the ISA
+//  and by the libgcc soft float otherwise (rv32imfc vs rv32imc). Values are
+//  small integers, so the results are exact in both cases (even with FMA).
+#define MAX_PRIME   500
+#define PRIME_COUNT 95
+#define VEC_SIZE    64
+
+static float vec_a[VEC_SIZE];
+static float vec_b[VEC_SIZE];
+
+// There's no libm in the benchmarks, without the F extension the square
+//  root is calculated with the Newton iterations (starting above the root
+//  they only decrease, so stop once they don't)
+static float sqrt_f(float x)
+{
+#ifdef __riscv_flen
+  return __builtin_sqrtf(x);
+#else
+  if (x <= 0.0f) {
+    return 0.0f;
+  }
+  float r = (x > 1.0f) ? x : 1.0f;
+  for (;;) {
+    float next = 0.5f * (r + x / r);
+    if (next >= r) {
+      return r;
+    }
+    r = next;
+  }
+#endif
+}
+
+// Same trial division as software/primes (square root limit)
+static bool is_prime(int n)
+{
+  if (n < 2) {
+    return false;
+  }
+  int limit = (int)sqrt_f((float)n) + 1;
+  for (int i = 2; i <= limit && i < n; i++) {
+    if (n % i == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(void)
+{
+  int count = 0;
+  for (int i = 2; i <= MAX_PRIME; i++) {
+    if (is_prime(i)) {
+      count++;
+    }
+  }
+  if (count != PRIME_COUNT) {
+    return 1;
+  }
+
+  int32_t dot_ref = 0;
+  for (int i = 0; i < VEC_SIZE; i++) {
+    vec_a[i] = (float)(i % 17);
+    vec_b[i] = (float)(i % 13 - 6);
+    dot_ref += (i % 17) * (i % 13 - 6);
+  }
+
+  float dot = 0.0f;
+  for (int i = 0; i < VEC_SIZE; i++) {
+    dot += vec_a[i] * vec_b[i];
+  }
+  if ((int32_t)dot != dot_ref) {
+    return 2;
+  }
+
+  for (int i = 1; i < VEC_SIZE; i++) {
+    float x = (float)(i * 7);
+    if ((int)(x / 7.0f) != i) {
+      return 3;
+    }
+    if ((int)(sqrt_f((float)(i * i)) + 0.5f) != i) {
+      return 4;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,51 @@
+#include <stdint.h>
+#include "../../include/bench.h"
+
+#define BUF_SIZE    1024
+
+static uint8_t src[BUF_SIZE + 8];
+static uint8_t dst[BUF_SIZE + 8];
+
+static const uint16_t sizes[] = { 1, 3, 4, 7, 16, 31, 64, 100, 256, 1024 };
+
+int main(void)
+{
+  uint32_t seed = 7;
+  for (int i = 0; i < BUF_SIZE + 8; i++) {
+    src[i] = bench_rand(&seed);
+  }
+
+  // Sweep over sizes and source/destination alignments
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    size_t n = sizes[s];
+    for (int src_off = 0; src_off < 4; src_off++) {
+      for (int dst_off = 0; dst_off < 4; dst_off++) {
+        memset(dst, 0xA5, n + 8);
+        memcpy(dst + dst_off, src + src_off, n);
+        if (memcmp(dst + dst_off, src + src_off, n)) {
+          return 1;
+        }
+        if (dst_off && dst[dst_off - 1] != 0xA5) {
+          return 2;
+        }
+        if (dst[dst_off + n] != 0xA5) {
+          return 3;
+        }
+      }
+    }
+  }
+
+  // Fill sweep
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    size_t n = sizes[s];
+    for (int off = 0; off < 4; off++) {
+      memset(dst + off, s, n);
+      for (size_t i = 0; i < n; i++) {
+        if (dst[off + i] != s) {
+          return 4;
+        }
+      }
+    }
+  }
+  return 0;
+}
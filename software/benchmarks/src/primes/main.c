@@ -0,0 +1,32 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include "../../include/bench.h"
+
+// Same trial division as software/primes (without the printing and with
+//  the integer square root check instead of the soft float one)
+#define MAX_PRIME   2000
+#define PRIME_COUNT 303
+
+static bool is_prime(int n)
+{
+  if (n < 2) {
+    return false;
+  }
+  for (int i = 2; i * i <= n; i++) {
+    if (n % i == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(void)
+{
+  int count = 0;
+  for (int i = 2; i <= MAX_PRIME; i++) {
+    if (is_prime(i)) {
+      count++;
+    }
+  }
+  return (count == PRIME_COUNT) ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+#include <stdint.h>
+#include "../../include/bench.h"
+
+#define ARRAY_SIZE  1024
+#define SMALL_SORT  12
+
+static int32_t array[ARRAY_SIZE];
+
+static void insertion_sort(int32_t *a, int n)
+{
+  for (int i = 1; i < n; i++) {
+    int32_t v = a[i];
+    int j = i - 1;
+    while (j >= 0 && a[j] > v) {
+      a[j + 1] = a[j];
+      j--;
+    }
+    a[j + 1] = v;
+  }
+}
+
+// Quicksort (median of three pivot, small partitions are insertion sorted)
+static void quick_sort(int32_t *a, int n)
+{
+  while (n > SMALL_SORT) {
+    int32_t x = a[0], y = a[n / 2], z = a[n - 1];
+    int32_t pivot = (x < y) ? ((y < z) ? y : (x < z) ? z : x)
+                            : ((x < z) ? x : (y < z) ? z : y);
+    int i = 0;
+    int j = n - 1;
+    while (i <= j) {
+      while (a[i] < pivot) i++;
+      while (a[j] > pivot) j--;
+      if (i <= j) {
+        int32_t t = a[i];
+        a[i++] = a[j];
+        a[j--] = t;
+      }
+    }
+    // Recurse into the smaller part
+    if (j + 1 < n - i) {
+      quick_sort(a, j + 1);
+      a += i;
+      n -= i;
+    } else {
+      quick_sort(a + i, n - i);
+      n = j + 1;
+    }
+  }
+  insertion_sort(a, n);
+}
+
+int main(void)
+{
+  uint32_t seed = 42;
+  uint32_t sum = 0;
+  for (int i = 0; i < ARRAY_SIZE; i++) {
+    array[i] = bench_rand(&seed) - 0x800000;
+    sum += array[i];
+  }
+
+  quick_sort(array, ARRAY_SIZE);
+
+  for (int i = 1; i < ARRAY_SIZE; i++) {
+    if (array[i - 1] > array[i]) {
+      return 1;
+    }
+    sum -= array[i];
+  }
+  sum -= array[0];
+  return (sum != 0) ? 2 : 0;
+}
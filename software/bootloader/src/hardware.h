@@ -5,6 +5,10 @@
 #define UART_DATA         0xC
 #define LED_REG           0x10
 #define BUTTON_REG        0x10
+#define DMA_SRC           0x20
+#define DMA_DST           0x24
+#define DMA_COUNT         0x28
+#define DMA_CTRL          0x2C
 
 #define UART_TX_EN        0
 #define UART_RX_EN        1
@@ -15,6 +19,8 @@
 #define UART_TX_CLEAR     7
 #define UART_RX_CLEAR     8
 
+#define UART_FRAC         16
+
 #define UART_OVERRUN_ERR  0
 #define UART_PARITY_ERR   1
 #define UART_TX_EMPTY     2
@@ -22,4 +28,18 @@
 #define UART_TX_FULL      4
 #define UART_RX_EMPTY     5
 #define UART_RX_HALF      6
-#define UART_RX_FULL      7
\ No newline at end of file
+#define UART_RX_FULL      7
+#define UART_RX_TIMEOUT   9
+#define UART_TX_IDLE      10
+#define UART_RX_LOST      11
+
+#define DMA_START         0
+#define DMA_BUSY          0
+#define DMA_MODE          1
+#define DMA_IRQ_EN        3
+#define DMA_DONE          4
+#define DMA_ABORT         5
+
+#define DMA_MODE_COPY     0
+#define DMA_MODE_FILL     1
+#define DMA_MODE_STREAM   2
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef CLUSTER_H
+#define CLUSTER_H
+
+/*
+ * Every hart writes its result to the kill address of the test bench
+ * (cluster_tb.v prints these writes with the hart ID) and stops there,
+ * main returns zero when the result of the hart was correct and the error
+ * code otherwise.
+ */
+#define CLUSTER_TOHOST    0x10000
+#define CLUSTER_PASS      0x555
+
+// Stack size of every hart (log2), stacks are placed below each other
+#define CLUSTER_STACK_BITS 11
+
+#endif
@@ -0,0 +1,119 @@
+#include <stddef.h>
+#include <stdint.h>
+#include "../include/cluster.h"
+
+/*
+ * Every hart runs its own program (selected with its hart ID), all of them
+ * share the data memory, so every program only uses its own variables.
+ */
+#define PRIMES_MAX  2000
+#define CRC_SIZE    512
+#define SORT_SIZE   128
+#define MULDIV_N    500
+
+static uint8_t sieve[PRIMES_MAX];
+static uint8_t crc_data[CRC_SIZE];
+static uint32_t sort_data[SORT_SIZE];
+
+// Simple pseudo random generator (same sequence on every run)
+static uint32_t rand_next(uint32_t *state)
+{
+  *state = *state * 1103515245u + 12345u;
+  return *state >> 8;
+}
+
+// Number of primes below PRIMES_MAX (sieve of Eratosthenes)
+static uint32_t primes(void)
+{
+  uint32_t count = 0;
+  for (size_t i = 2; i < PRIMES_MAX; i++) {
+    if (sieve[i]) {
+      continue;
+    }
+    count++;
+    for (size_t j = i * i; j < PRIMES_MAX; j += i) {
+      sieve[j] = 1;
+    }
+  }
+  return count;
+}
+
+// CRC32 of pseudo random data (reflected, polynomial 0xEDB88320)
+static uint32_t crc(void)
+{
+  uint32_t state = 1;
+  for (size_t i = 0; i < CRC_SIZE; i++) {
+    crc_data[i] = rand_next(&state);
+  }
+
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < CRC_SIZE; i++) {
+    crc ^= crc_data[i];
+    for (int j = 0; j < 8; j++) {
+      crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+// Insertion sort of pseudo random data, weighted sum of the sorted data
+static uint32_t sort(void)
+{
+  uint32_t state = 2;
+  for (size_t i = 0; i < SORT_SIZE; i++) {
+    sort_data[i] = rand_next(&state);
+  }
+
+  for (size_t i = 1; i < SORT_SIZE; i++) {
+    uint32_t value = sort_data[i];
+    size_t j = i;
+    for (; j > 0 && sort_data[j - 1] > value; j--) {
+      sort_data[j] = sort_data[j - 1];
+    }
+    sort_data[j] = value;
+  }
+
+  uint32_t sum = 0;
+  for (size_t i = 0; i < SORT_SIZE; i++) {
+    if (i > 0 && sort_data[i - 1] > sort_data[i]) {
+      return 0;
+    }
+    sum += sort_data[i] * (i + 1);
+  }
+  return sum;
+}
+
+// Multiplications and divisions (the Mul/Div unit of every hart)
+static uint32_t muldiv(void)
+{
+  uint32_t acc = 0;
+  for (uint32_t i = 1; i <= MULDIV_N; i++) {
+    acc += (i * i * i) / (i + 3);
+    acc ^= (acc % (i + 7)) << 3;
+  }
+  return acc;
+}
+
+static const struct {
+  uint32_t (*run)(void);
+  uint32_t expected;
+} programs[] = {
+  { primes, 0x0000012Fu },
+  { crc,    0x247334C3u },
+  { sort,   0x8BA94156u },
+  { muldiv, 0x0277D07Cu },
+};
+
+#define PROGRAMS (sizeof(programs) / sizeof(programs[0]))
+
+int main(uint32_t hart)
+{
+  // Harts without their own program have nothing to do
+  if (hart >= PROGRAMS) {
+    return 0;
+  }
+  if (programs[hart].run() != programs[hart].expected) {
+    return hart + 1;
+  }
+  return 0;
+}
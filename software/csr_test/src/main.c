@@ -50,5 +50,24 @@ int main(void)
   sprintf(buffer, "MHARTID:   %08X\n", result);
   uart_print(buffer);
 
+  asm("csrr %0, 0xB00" : "=r"(result));
+  sprintf(buffer, "MCYCLE:    %u\n", result);
+  uart_print(buffer);
+  asm("csrr %0, 0xB02" : "=r"(result));
+  sprintf(buffer, "MINSTRET:  %u\n", result);
+  uart_print(buffer);
+  asm("csrr %0, 0xB03" : "=r"(result));
+  sprintf(buffer, "HZ_DATA:   %u\n", result);
+  uart_print(buffer);
+  asm("csrr %0, 0xB04" : "=r"(result));
+  sprintf(buffer, "BR_FLUSH:  %u\n", result);
+  uart_print(buffer);
+  asm("csrr %0, 0xB05" : "=r"(result));
+  sprintf(buffer, "ALU_BUSY:  %u\n", result);
+  uart_print(buffer);
+  asm("csrr %0, 0xB06" : "=r"(result));
+  sprintf(buffer, "LD_ST:     %u\n", result);
+  uart_print(buffer);
+
   while (1);
 }
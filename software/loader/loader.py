@@ -1,22 +1,92 @@
 #!/bin/python3
 """
   Simple Loader for working with the bootloader.
+
+  Memory is written and read in binary blocks checked with CRC32 (bootloader
+  commands '6' and '7'), bad blocks are sent again. If the answer doesn't come
+  in time (lost bytes), the bootloader is resynchronised first and the block
+  is sent again too. With the BAUD argument
+  the bootloader is switched to the given baud rate first (command '8').
+  Bootloader takes BYTE_CYCLES per byte of the written block (CRC is
+  calculated bit by bit), the UART receiver buffer is much smaller than the
+  block, so the baud rate can't be higher than F_CPU * 10 / BYTE_CYCLES
+  (~950 kbaud at 10 MHz).
+  PORT 'sim' connects to the bootloader test bench (hardware/tb/boot_tb.v)
+  through its pipes instead of the serial port.
 """
-import serial
 import sys
+import time
+import zlib
 
 EXPECTED_SIGNATURE = b'37839363'
 END_ADDRESS = 0x8000
 BLOCK_SIZE = 0x200
+RETRIES = 5
+TIMEOUT = 1.0
+F_CPU = 10000000
+BYTE_CYCLES = 105
 SERIAL = '/dev/ttyACM1'
+SIM_RX_PIPE = 'boot_rx.fifo'
+SIM_TX_PIPE = 'boot_tx.fifo'
+SIM_SWITCH_CYCLES = 0x2000
 FILE = ''
 
+class SimSerial:
+  """
+    Serial port of the simulated UART, every byte is sent to the test bench as
+    a "w" command, reads are "r" commands (test bench runs until the CPU sends
+    the bytes out), baud rate change is an "i" command (test bench idles while
+    the bootloader switches, its UART model follows the divider by itself).
+  """
+  def __init__(self, rx_pipe, tx_pipe):
+    self.rx = open(rx_pipe, 'w')
+    self.tx = open(tx_pipe, 'r')
+    self._baudrate = 0
+
+  def write(self, data):
+    for b in data:
+      self.rx.write(f"w {b:02x}\n")
+
+  def read(self, size = 1):
+    self.rx.write(f"r {size:x}\n")
+    self.rx.flush()
+    res = bytes()
+    for i in range(size):
+      res += bytes([int(self.tx.readline(), 16)])
+    return res
+
+  @property
+  def baudrate(self):
+    return self._baudrate
+
+  @baudrate.setter
+  def baudrate(self, baud):
+    self._baudrate = baud
+    self.rx.write(f"i {SIM_SWITCH_CYCLES:x}\n")
+
+  def close(self):
+    self.rx.write("q\n")
+    self.rx.close()
+    self.tx.close()
+
 def show_header():
   print("\nPROJECT-RISK loader v1.0")
 
 def open_serial():
+  if SERIAL == 'sim':
+    print("Connecting to the test bench")
+    return SimSerial(SIM_RX_PIPE, SIM_TX_PIPE)
+  import serial
   print(f"Connecting to serial port {SERIAL}")
-  return serial.Serial(SERIAL)
+  return serial.Serial(SERIAL, timeout = TIMEOUT)
+
+def resync(ser):
+  # The bootloader may still wait for the rest of a command that lost some
+  # bytes, it's fed with zeros (unknown command, each answered with 'e') and
+  # the answers are dropped until it goes quiet
+  ser.write(bytes(BLOCK_SIZE + 16))
+  while len(ser.read(BLOCK_SIZE + 16)) != 0:
+    pass
 
 def read_address(ser, addr):
   ser.write(bytes(f"0{addr:04x}", encoding='ASCII'))
@@ -38,6 +108,45 @@ def write_bytes(ser, addr, data, length):
       return False
   return True
 
+def write_block(ser, addr, data):
+  crc = zlib.crc32(data)
+  ser.write(b'6' + addr.to_bytes(4, 'little') + len(data).to_bytes(2, 'little'))
+  ser.write(data + crc.to_bytes(4, 'little'))
+  res = ser.read(1)
+  if len(res) == 0:
+    resync(ser)
+  return (res == b'k')
+
+def read_block(ser, addr, length):
+  ser.write(b'7' + addr.to_bytes(4, 'little') + length.to_bytes(2, 'little'))
+  data = ser.read(length)
+  crc = ser.read(4)
+  if len(data) != length or len(crc) != 4:
+    resync(ser)
+    return None
+  return data if int.from_bytes(crc, 'little') == zlib.crc32(data) else None
+
+def set_baud(ser, baud):
+  # Division is (divider + 1 + fraction / 256), it's calculated in 1/256 steps
+  steps = max(round(F_CPU * 32 / baud), 0x100)
+  div = (steps >> 8) - 1
+  frac = steps & 0xFF
+  actual = F_CPU * 32 / steps
+  if div > 0xFFFF or abs(actual - baud) / baud > 0.03:
+    print(f"Baud rate {baud} can't be set (closest is {actual:.0f})")
+    sys.exit(1)
+  if baud > F_CPU * 10 // BYTE_CYCLES:
+    print(f"Baud rate {baud} is too high for the bootloader "
+      f"(at most {F_CPU * 10 // BYTE_CYCLES})")
+    sys.exit(1)
+  print(f"Switching to {baud} baud (divider {div} + {frac}/256)")
+  ser.write(b'8' + div.to_bytes(2, 'little') + frac.to_bytes(1, 'little'))
+  if ser.read(1) != b'k':
+    print("Baud rate switch failed")
+    sys.exit(1)
+  ser.baudrate = baud
+  time.sleep(0.01)
+
 def get_signature(ser):
   signature  = read_address(ser, 0x7E00)
   signature += read_address(ser, 0x7E04)
@@ -66,22 +175,36 @@ def get_memory(ser, length):
   res = bytes()
   print_progress_bar(0, length, prefix = 'Reading:')
   for i in range(0, length, BLOCK_SIZE):
-    res += read_bytes(ser, i, BLOCK_SIZE)
-    print_progress_bar(min(i + BLOCK_SIZE, length), length, prefix = 'Reading:')
+    size = min(BLOCK_SIZE, length - i)
+    for retry in range(RETRIES):
+      block = read_block(ser, i, size)
+      if block is not None:
+        break
+    else:
+      print(f"\nReading block at {i:04X} failed")
+      sys.exit(1)
+    res += block
+    print_progress_bar(i + size, length, prefix = 'Reading:')
   return res
 
 def set_memory(ser, memory: bytes):
   print(f"Writing memory contents ({len(memory) / 1024:.1f}Kb):")
   print_progress_bar(0, len(memory), prefix = 'Writing:')
-  for i in range(len(memory)):
-    write_address(ser, i, memory[i])
-    print_progress_bar(i + 1, len(memory), prefix = 'Writing:')
+  for i in range(0, len(memory), BLOCK_SIZE):
+    block = memory[i:i + BLOCK_SIZE]
+    for retry in range(RETRIES):
+      if write_block(ser, i, block):
+        break
+    else:
+      print(f"\nWriting block at {i:04X} failed")
+      sys.exit(1)
+    print_progress_bar(i + len(block), len(memory), prefix = 'Writing:')
 
 def main():
   show_header()
 
-  if len(sys.argv) != 4:
-    print("Usage: ./loader.py [PORT] [read/write/verify] [FILE]")
+  if len(sys.argv) not in [4, 5]:
+    print("Usage: ./loader.py [PORT/sim] [read/write/verify] [FILE] ([BAUD])")
     sys.exit(1)
 
   global SERIAL
@@ -92,9 +215,13 @@ def main():
   FILE = sys.argv[3]
 
   verify = False
+  ok = True
+
+  if len(sys.argv) == 5:
+    set_baud(ser, int(sys.argv[4]))
 
   if sys.argv[2] == 'read':
-    memory = bytes.fromhex(str(get_memory(ser, END_ADDRESS))[2:-1])
+    memory = get_memory(ser, END_ADDRESS)
     f = open(FILE, 'wb')
     f.write(memory)
     f.close()
@@ -115,8 +242,7 @@ def main():
     f = open(FILE, 'rb')
     memory_orig = f.read()
     f.close()
-    ok = True
-    memory = bytes.fromhex(str(get_memory(ser, len(memory_orig)))[2:-1])
+    memory = get_memory(ser, len(memory_orig))
     for i in range(len(memory_orig)):
       if memory_orig[i] != memory[i]:
         ok = False
@@ -125,6 +251,7 @@ def main():
       print("Verified OK.")
 
   ser.close()
+  sys.exit(0 if ok else 1)
 
 if __name__ == '__main__':
   main()
@@ -28,7 +28,10 @@ bool is_prime(int n)
   if (n < 2) {
     return false;
   }
-  for (int i = 2; i <= ceil(sqrt(n)); i++) {
+  // Limit is calculated once (single precision, with the F extension it's
+  //  a single FSQRT.S instead of the soft float library calls)
+  int limit = (int)ceilf(sqrtf((float)n));
+  for (int i = 2; i <= limit; i++) {
     if (n % i == 0) {
       return false;
     }